@@ -35,6 +35,7 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "Bootstrap.h"
+#include "FastPollingMutexSem.h"
 #include "Loader.h"
 #include "ObjectRegistryDatabase.h"
 #include "ReferenceT.h"
@@ -91,6 +91,12 @@ inline bool TestAndSet(volatile int8 *p) {
     return (!__atomic_test_and_set(p, TSL_MEMMODEL));
 }
 
+inline bool CompareAndSwap(volatile int32 *p,
+                           int32 oldValue,
+                           int32 newValue) {
+    return __atomic_compare_exchange_n(p, &oldValue, newValue, false, MEMMODEL, MEMMODEL);
+}
+
 inline void Add(volatile int32 *p, int32 value) {
     __atomic_add_fetch(p, value, MEMMODEL);
 }
@@ -99,6 +105,30 @@ inline void Sub(volatile int32 *p, int32 value) {
     __atomic_sub_fetch(p, value, MEMMODEL);
 }
 
+inline uint32 LoadAcquire(volatile const uint32 *p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+inline void StoreRelease(volatile uint32 *p, uint32 value) {
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+inline void AcquireBarrier() {
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+
+inline void ReleaseBarrier() {
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+inline void SpinPause() {
+#if defined(__ARM_ARCH) && (__ARM_ARCH >= 7)
+    asm volatile("yield" ::: "memory");
+#else
+    asm volatile("" ::: "memory");
+#endif
+}
+
 }
 
 }
@@ -101,6 +101,14 @@ inline bool TestAndSet(volatile int8 *p) {
     return _InterlockedCompareExchange8(pp, 1, 0) == 0;
 }
 
+inline bool CompareAndSwap(volatile int32 *p,
+                           int32 oldValue,
+                           int32 newValue) {
+    volatile long* pp = (volatile long *) p;
+    //returns the initial value of *pp
+    return _InterlockedCompareExchange(pp, newValue, oldValue) == oldValue;
+}
+
 inline void Add(volatile int32 *p,
                 int32 value) {
 
@@ -114,6 +122,32 @@ inline void Sub(volatile int32 *p,
     _InterlockedExchangeAdd(pp, -value);
 }
 
+inline uint32 LoadAcquire(volatile const uint32 *p) {
+    //x86 loads have acquire semantics, only the compiler has to be stopped
+    uint32 value = *p;
+    _ReadWriteBarrier();
+    return value;
+}
+
+inline void StoreRelease(volatile uint32 *p,
+                         uint32 value) {
+    //x86 stores have release semantics, only the compiler has to be stopped
+    _ReadWriteBarrier();
+    *p = value;
+}
+
+inline void AcquireBarrier() {
+    _ReadWriteBarrier();
+}
+
+inline void ReleaseBarrier() {
+    _ReadWriteBarrier();
+}
+
+inline void SpinPause() {
+    _mm_pause();
+}
+
 }
 }
 #endif /* ATOMICA_H_ */
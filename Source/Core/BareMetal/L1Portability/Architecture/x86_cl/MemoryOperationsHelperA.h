@@ -0,0 +1,81 @@
+/**
+ * @file MemoryOperationsHelperA.h
+ * @brief Header file for module MemoryOperationsHelperA
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module MemoryOperationsHelperA
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ *
+ * This architecture forwards all the operations to the libc.
+ * This header is only to be included by the MemoryOperationsHelper implementation.
+ */
+
+#ifndef MEMORYOPERATIONSHELPERA_H_
+#define MEMORYOPERATIONSHELPERA_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#ifndef LINT
+#include <string.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace MemoryOperationsHelper {
+
+static inline void CopyA(void * const destination,
+                         const void * const source,
+                         const uint32 size) {
+    (void) memcpy(destination, source, static_cast<size_t>(size));
+}
+
+static inline void SetA(void * const mem,
+                        const char8 c,
+                        const uint32 size) {
+    (void) memset(mem, c, static_cast<size_t>(size));
+}
+
+static inline int32 CompareA(const void * const mem1,
+                             const void * const mem2,
+                             const uint32 size) {
+    return memcmp(mem1, mem2, static_cast<size_t>(size));
+}
+
+static inline const void *SearchA(const void * const mem,
+                                  const char8 c,
+                                  const uint32 size) {
+    return memchr(mem, c, static_cast<size_t>(size));
+}
+
+}
+
+}
+
+#endif /* MEMORYOPERATIONSHELPERA_H_ */
@@ -151,6 +151,16 @@ inline bool TestAndSet(volatile int8 *p) {
 #endif
 }
 
+inline bool CompareAndSwap(volatile int32 *p,
+                           int32 oldValue,
+                           int32 newValue) {
+#if GCC_VERSION > 40700
+    return __atomic_compare_exchange_n(p, &oldValue, newValue, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#else
+    return __sync_bool_compare_and_swap(p, oldValue, newValue);
+#endif
+}
+
 inline void Add(volatile int32 *p, int32 value) {
 #if GCC_VERSION > 40700
     __atomic_add_fetch(p, value, __ATOMIC_SEQ_CST);
@@ -176,6 +186,46 @@ inline void Sub(volatile int32 *p, int32 value) {
 #endif
 }
 
+inline uint32 LoadAcquire(volatile const uint32 *p) {
+#if GCC_VERSION > 40700
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#else
+    /* x86 loads are never reordered with other loads, only the compiler has to be stopped */
+    uint32 value = *p;
+    asm volatile("" ::: "memory");
+    return value;
+#endif
+}
+
+inline void StoreRelease(volatile uint32 *p, uint32 value) {
+#if GCC_VERSION > 40700
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+#else
+    asm volatile("" ::: "memory");
+    *p = value;
+#endif
+}
+
+inline void AcquireBarrier() {
+#if GCC_VERSION > 40700
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#else
+    asm volatile("" ::: "memory");
+#endif
+}
+
+inline void ReleaseBarrier() {
+#if GCC_VERSION > 40700
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+#else
+    asm volatile("" ::: "memory");
+#endif
+}
+
+inline void SpinPause() {
+    asm volatile("pause" ::: "memory");
+}
+
 }
 
 }
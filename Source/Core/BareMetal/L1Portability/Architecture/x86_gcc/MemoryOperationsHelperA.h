@@ -0,0 +1,327 @@
+/**
+ * @file MemoryOperationsHelperA.h
+ * @brief Header file for module MemoryOperationsHelperA
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module MemoryOperationsHelperA
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ *
+ * The x86 implementation copies (and sets) large memory areas with non-temporal SSE2 or AVX2 stores. The instruction set
+ * is selected at runtime (CPUID) the first time that a large memory area is copied.
+ * This header is only to be included by the MemoryOperationsHelper implementation.
+ */
+
+#ifndef MEMORYOPERATIONSHELPERA_H_
+#define MEMORYOPERATIONSHELPERA_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#ifndef LINT
+#include <cpuid.h>
+#include <immintrin.h>
+#include <string.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace MemoryOperationsHelper {
+
+/**
+ * Above this size (in bytes) Copy and Set use non-temporal (streaming) stores, so that large
+ * buffers do not evict the working set of the real-time threads from the cache.
+ */
+static const uint32 MEMORY_OPERATIONS_HELPER_NON_TEMPORAL_THRESHOLD = 1048576u;
+
+/**
+ * The instruction set was not detected yet.
+ */
+static const uint32 MEMORY_OPERATIONS_HELPER_ISA_UNKNOWN = 0u;
+
+/**
+ * Only the libc functions are to be used.
+ */
+static const uint32 MEMORY_OPERATIONS_HELPER_ISA_NONE = 1u;
+
+/**
+ * The SSE2 kernels are to be used.
+ */
+static const uint32 MEMORY_OPERATIONS_HELPER_ISA_SSE2 = 2u;
+
+/**
+ * The AVX2 kernels are to be used.
+ */
+static const uint32 MEMORY_OPERATIONS_HELPER_ISA_AVX2 = 3u;
+
+/**
+ * The instruction set detected by DetectInstructionSetA. Constant initialised, so that it is valid even if the
+ * functions are called during the dynamic initialisation of other modules.
+ */
+static volatile uint32 instructionSetA = MEMORY_OPERATIONS_HELPER_ISA_UNKNOWN;
+
+/**
+ * @brief Detects the best instruction set supported by the processor and by the operating system.
+ * @return MEMORY_OPERATIONS_HELPER_ISA_AVX2 if AVX2 is supported and the OS saves the YMM registers,
+ * otherwise MEMORY_OPERATIONS_HELPER_ISA_SSE2 if SSE2 is supported, otherwise MEMORY_OPERATIONS_HELPER_ISA_NONE.
+ */
+static inline uint32 DetectInstructionSetA() {
+    uint32 isa = MEMORY_OPERATIONS_HELPER_ISA_NONE;
+    uint32 eax = 0u;
+    uint32 ebx = 0u;
+    uint32 ecx = 0u;
+    uint32 edx = 0u;
+    uint32 maxLeaf = __get_cpuid_max(0u, NULL_PTR(uint32 *));
+    if (maxLeaf >= 1u) {
+        __cpuid(1u, eax, ebx, ecx, edx);
+        if ((edx & bit_SSE2) != 0u) {
+            isa = MEMORY_OPERATIONS_HELPER_ISA_SSE2;
+        }
+        bool avx = (((ecx & bit_OSXSAVE) != 0u) && ((ecx & bit_AVX) != 0u));
+        if ((avx) && (maxLeaf >= 7u)) {
+            //The OS must save the XMM and the YMM state on context switches
+            uint32 xcr0Low = 0u;
+            uint32 xcr0High = 0u;
+            __asm__ __volatile__ ("xgetbv" : "=a" (xcr0Low), "=d" (xcr0High) : "c" (0u));
+            if ((xcr0Low & 0x6u) == 0x6u) {
+                __cpuid_count(7u, 0u, eax, ebx, ecx, edx);
+                if ((ebx & bit_AVX2) != 0u) {
+                    isa = MEMORY_OPERATIONS_HELPER_ISA_AVX2;
+                }
+            }
+        }
+    }
+    return isa;
+}
+
+/**
+ * @brief Gets the instruction set to be used by the streaming kernels.
+ * @return the value of instructionSetA, detecting it if it was not yet detected.
+ */
+static inline uint32 GetInstructionSetA() {
+    uint32 isa = instructionSetA;
+    if (isa == MEMORY_OPERATIONS_HELPER_ISA_UNKNOWN) {
+        //Concurrent detections write the same value.
+        isa = DetectInstructionSetA();
+        instructionSetA = isa;
+    }
+    return isa;
+}
+
+/**
+ * @brief AVX2 memory copy with non-temporal stores.
+ * @details The first vector is copied with an unaligned store, so that all the streaming stores are 32 bytes aligned.
+ * The last (partial) vector is copied with an overlapping store.
+ * @pre size >= MEMORY_OPERATIONS_HELPER_NON_TEMPORAL_THRESHOLD and the memory areas do not overlap.
+ */
+__attribute__((target("avx2")))
+static inline void StreamCopyAVX2(uint8 * const destination,
+                                  const uint8 * const source,
+                                  const uint32 size) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source)));
+    uint32 i = static_cast<uint32>((32u - (reinterpret_cast<uintp>(destination) & 31u)) & 31u);
+    for (; (i + 128u) <= size; i += 128u) {
+        __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[i]));
+        __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[i + 32u]));
+        __m256i v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[i + 64u]));
+        __m256i v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[i + 96u]));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(&destination[i]), v0);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(&destination[i + 32u]), v1);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(&destination[i + 64u]), v2);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(&destination[i + 96u]), v3);
+    }
+    //The streaming stores are weakly ordered
+    _mm_sfence();
+    for (; (i + 32u) <= size; i += 32u) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&destination[i]), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[i])));
+    }
+    if (i < size) {
+        i = (size - 32u);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&destination[i]), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[i])));
+    }
+}
+
+/**
+ * @brief SSE2 memory copy with non-temporal stores.
+ * @details See StreamCopyAVX2 (with 16 bytes vectors).
+ * @pre size >= MEMORY_OPERATIONS_HELPER_NON_TEMPORAL_THRESHOLD and the memory areas do not overlap.
+ */
+__attribute__((target("sse2")))
+static inline void StreamCopySSE2(uint8 * const destination,
+                                  const uint8 * const source,
+                                  const uint32 size) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), _mm_loadu_si128(reinterpret_cast<const __m128i *>(source)));
+    uint32 i = static_cast<uint32>((16u - (reinterpret_cast<uintp>(destination) & 15u)) & 15u);
+    for (; (i + 64u) <= size; i += 64u) {
+        __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i]));
+        __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i + 16u]));
+        __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i + 32u]));
+        __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i + 48u]));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&destination[i]), v0);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&destination[i + 16u]), v1);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&destination[i + 32u]), v2);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&destination[i + 48u]), v3);
+    }
+    _mm_sfence();
+    for (; (i + 16u) <= size; i += 16u) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&destination[i]), _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i])));
+    }
+    if (i < size) {
+        i = (size - 16u);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&destination[i]), _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i])));
+    }
+}
+
+/**
+ * @brief AVX2 memory set with non-temporal stores.
+ * @details See StreamCopyAVX2.
+ * @pre size >= MEMORY_OPERATIONS_HELPER_NON_TEMPORAL_THRESHOLD.
+ */
+__attribute__((target("avx2")))
+static inline void StreamSetAVX2(uint8 * const mem,
+                                 const char8 c,
+                                 const uint32 size) {
+    const __m256i v = _mm256_set1_epi8(c);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(mem), v);
+    uint32 i = static_cast<uint32>((32u - (reinterpret_cast<uintp>(mem) & 31u)) & 31u);
+    for (; (i + 128u) <= size; i += 128u) {
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(&mem[i]), v);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(&mem[i + 32u]), v);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(&mem[i + 64u]), v);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(&mem[i + 96u]), v);
+    }
+    _mm_sfence();
+    for (; (i + 32u) <= size; i += 32u) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&mem[i]), v);
+    }
+    if (i < size) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&mem[size - 32u]), v);
+    }
+}
+
+/**
+ * @brief SSE2 memory set with non-temporal stores.
+ * @details See StreamCopyAVX2 (with 16 bytes vectors).
+ * @pre size >= MEMORY_OPERATIONS_HELPER_NON_TEMPORAL_THRESHOLD.
+ */
+__attribute__((target("sse2")))
+static inline void StreamSetSSE2(uint8 * const mem,
+                                 const char8 c,
+                                 const uint32 size) {
+    const __m128i v = _mm_set1_epi8(c);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), v);
+    uint32 i = static_cast<uint32>((16u - (reinterpret_cast<uintp>(mem) & 15u)) & 15u);
+    for (; (i + 64u) <= size; i += 64u) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&mem[i]), v);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&mem[i + 16u]), v);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&mem[i + 32u]), v);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&mem[i + 48u]), v);
+    }
+    _mm_sfence();
+    for (; (i + 16u) <= size; i += 16u) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&mem[i]), v);
+    }
+    if (i < size) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&mem[size - 16u]), v);
+    }
+}
+
+/**
+ * @brief Copies \a size bytes from \a source to \a destination.
+ * @details Below MEMORY_OPERATIONS_HELPER_NON_TEMPORAL_THRESHOLD the libc memcpy is used (the
+ * glibc already selects, at load time, vector kernels that are faster than the streaming ones for data that fits in the cache).
+ * @pre source and destination are not NULL and do not overlap.
+ */
+static inline void CopyA(void * const destination,
+                         const void * const source,
+                         const uint32 size) {
+    uint32 isa = MEMORY_OPERATIONS_HELPER_ISA_NONE;
+    if (size >= MEMORY_OPERATIONS_HELPER_NON_TEMPORAL_THRESHOLD) {
+        isa = GetInstructionSetA();
+    }
+    if (isa == MEMORY_OPERATIONS_HELPER_ISA_AVX2) {
+        StreamCopyAVX2(static_cast<uint8 *>(destination), static_cast<const uint8 *>(source), size);
+    }
+    else if (isa == MEMORY_OPERATIONS_HELPER_ISA_SSE2) {
+        StreamCopySSE2(static_cast<uint8 *>(destination), static_cast<const uint8 *>(source), size);
+    }
+    else {
+        (void) memcpy(destination, source, static_cast<size_t>(size));
+    }
+}
+
+/**
+ * @brief Sets \a size bytes of \a mem to \a c.
+ * @details See CopyA.
+ * @pre mem is not NULL.
+ */
+static inline void SetA(void * const mem,
+                        const char8 c,
+                        const uint32 size) {
+    uint32 isa = MEMORY_OPERATIONS_HELPER_ISA_NONE;
+    if (size >= MEMORY_OPERATIONS_HELPER_NON_TEMPORAL_THRESHOLD) {
+        isa = GetInstructionSetA();
+    }
+    if (isa == MEMORY_OPERATIONS_HELPER_ISA_AVX2) {
+        StreamSetAVX2(static_cast<uint8 *>(mem), c, size);
+    }
+    else if (isa == MEMORY_OPERATIONS_HELPER_ISA_SSE2) {
+        StreamSetSSE2(static_cast<uint8 *>(mem), c, size);
+    }
+    else {
+        (void) memset(mem, c, static_cast<size_t>(size));
+    }
+}
+
+/**
+ * @brief Compares \a size bytes of \a mem1 and \a mem2.
+ * @return the same as memcmp.
+ * @pre mem1 and mem2 are not NULL.
+ */
+static inline int32 CompareA(const void * const mem1,
+                             const void * const mem2,
+                             const uint32 size) {
+    return memcmp(mem1, mem2, static_cast<size_t>(size));
+}
+
+/**
+ * @brief Searches the first occurrence of \a c in the first \a size bytes of \a mem.
+ * @return the same as memchr.
+ * @pre mem is not NULL.
+ */
+static inline const void *SearchA(const void * const mem,
+                                  const char8 c,
+                                  const uint32 size) {
+    return memchr(mem, c, static_cast<size_t>(size));
+}
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYOPERATIONSHELPERA_H_ */
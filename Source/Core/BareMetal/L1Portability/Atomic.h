@@ -119,6 +119,16 @@ namespace MARTe {
          */
         inline bool TestAndSet(volatile int8 *p);
 
+        /**
+         * @brief Atomically compares a 32 bit memory location with an expected value and, if equal, replaces it with a new value.
+         * @param[in,out] p the pointer to the 32 bit variable to be compared and set.
+         * @param[in] oldValue the value that *p is expected to have.
+         * @param[in] newValue the value to store in *p if *p == oldValue.
+         * @return true if *p was equal to oldValue and was set to newValue.
+         * @pre p != NULL.
+         */
+        inline bool CompareAndSwap(volatile int32 *p, int32 oldValue, int32 newValue);
+
         /**
          * @brief Atomically adds two 32 bit integers.
          * @param[in,out] p the pointer to the variable which must be incremented.
@@ -135,6 +145,40 @@ namespace MARTe {
          */
         inline void Sub (volatile int32 *p, int32 value);
 
+        /**
+         * @brief Reads a 32 bit unsigned integer with acquire semantics.
+         * @details No memory access that follows this load can be reordered before it.
+         * @param[in] p the pointer to the variable to read.
+         * @return the value of *p.
+         * @pre p != NULL.
+         */
+        inline uint32 LoadAcquire (volatile const uint32 *p);
+
+        /**
+         * @brief Writes a 32 bit unsigned integer with release semantics.
+         * @details No memory access that precedes this store can be reordered after it.
+         * @param[out] p the pointer to the variable to write.
+         * @param[in] value the value to store in *p.
+         * @pre p != NULL.
+         */
+        inline void StoreRelease (volatile uint32 *p, uint32 value);
+
+        /**
+         * @brief Prevents the loads that precede the barrier from being reordered with any memory access that follows it.
+         */
+        inline void AcquireBarrier ();
+
+        /**
+         * @brief Prevents the stores that follow the barrier from being reordered with any memory access that precedes it.
+         */
+        inline void ReleaseBarrier ();
+
+        /**
+         * @brief Hints the processor that the caller is busy waiting on a memory location (e.g. the x86 pause instruction).
+         * @details To be called in spin loops, in order to reduce the power consumption and the penalty of exiting the loop.
+         */
+        inline void SpinPause ();
+
     }
 
 }
@@ -53,6 +53,8 @@ void NullErrorProcessFunction(const ErrorInformation &errorInfo,
 
 ErrorProcessFunctionType errorMessageProcessFunction = &NullErrorProcessFunction;
 
+DeferredErrorProcessFunctionType deferredErrorProcessFunction = static_cast<DeferredErrorProcessFunctionType>(NULL);
+
 /**
  * @brief A structure pairing an error code with its explanation.
  */
@@ -167,6 +169,11 @@ void SetErrorProcessFunction(const ErrorProcessFunctionType userFun) {
     else {
         errorMessageProcessFunction = &NullErrorProcessFunction;
     }
+    deferredErrorProcessFunction = static_cast<DeferredErrorProcessFunctionType>(NULL);
+}
+
+void SetDeferredErrorProcessFunction(const DeferredErrorProcessFunctionType userFun) {
+    deferredErrorProcessFunction = userFun;
 }
 
 }
@@ -0,0 +1,58 @@
+/**
+ * @file FastAdaptiveMutexSem_Polling_Generic.cpp
+ * @brief Source file for class FastAdaptiveMutexSem
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the operating system dependent methods
+ * of the class FastAdaptiveMutexSem for the environments that do not offer a wait-on-address primitive.
+ * The waiting thread releases the CPU for the shortest possible time and polls again.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "FastAdaptiveMutexSem.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/*lint -e{715} timeout is not needed as the function returns after releasing the CPU once*/
+void FastAdaptiveMutexSem::OsWait(volatile int32 * const address,
+                                  const int32 value,
+                                  const TimeoutType &timeout) {
+    if (*address == value) {
+        Sleep::Sec(1e-6F);
+    }
+}
+
+/*lint -e{715} the waiting threads poll the address*/
+void FastAdaptiveMutexSem::OsWake(volatile int32 * const address) {
+}
+
+}
@@ -36,6 +36,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "../../MemoryOperationsHelper.h"
+#include INCLUDE_FILE_ARCHITECTURE(BareMetal,L1Portability,ARCHITECTURE,MemoryOperationsHelperA.h)
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -55,10 +56,8 @@ bool Copy(void* const destination,
 
     bool ret = false;
     if ((source != NULL) && (destination != NULL)) {
-        ret = memcpy(destination, source, static_cast<osulong>(size)) != NULL;
-        if (!ret) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryOperationsHelper: Failed memcpy()");
-        }
+        CopyA(destination, source, size);
+        ret = true;
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "MemoryOperationsHelper: Invalid input arguments");
@@ -75,7 +74,7 @@ int32 Compare(const void * const mem1,
     int32 ret = -1;
 
     if ((mem1 != NULL) && (mem2 != NULL)) {
-        int32 temp = memcmp(mem1, mem2, static_cast<size_t>(size));
+        int32 temp = CompareA(mem1, mem2, size);
         if (temp < 0) {
             ret = 1; // 1 if mem1<mem2
         }
@@ -100,7 +99,7 @@ const void* Search(const void * const mem,
     const void* ret = static_cast<const void*>(NULL);
     if (mem != NULL) {
 
-        ret = memchr(mem, c, static_cast<size_t>(size));
+        ret = SearchA(mem, c, size);
 
     }
     else {
@@ -136,10 +135,8 @@ bool Set(void * const mem,
     bool ret = false;
     if (mem != NULL) {
 
-        ret = memset(mem, c, static_cast<size_t>(size)) != NULL;
-        if (!ret) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryOperationsHelper: Failed memset()");
-        }
+        SetA(mem, c, size);
+        ret = true;
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "MemoryOperationsHelper: Invalid input arguments");
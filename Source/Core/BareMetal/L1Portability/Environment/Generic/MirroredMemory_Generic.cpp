@@ -0,0 +1,62 @@
+/**
+ * @file MirroredMemory_Generic.cpp
+ * @brief Source file for module MirroredMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the module MirroredMemory for the
+ * environments where the same physical memory cannot be mapped at two virtual addresses.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "MirroredMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+uint32 MirroredMemory::GetGranularity() {
+    return 0u;
+}
+
+/*lint -e{715} the mirroring is not supported in this environment*/
+void *MirroredMemory::Allocate(const uint32 numberOfRegions,
+                               const uint32 * const regionSizes,
+                               const bool * const mirrored) {
+    REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "Mirrored memory is not supported.");
+    return NULL_PTR(void *);
+}
+
+//Nothing can have been allocated in this environment.
+bool MirroredMemory::Free(void *&address) {
+    address = NULL_PTR(void *);
+    return false;
+}
+
+}
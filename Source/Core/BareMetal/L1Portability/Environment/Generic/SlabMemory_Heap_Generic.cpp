@@ -0,0 +1,82 @@
+/**
+ * @file SlabMemory_Heap_Generic.cpp
+ * @brief Source file for module SlabMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the module SlabMemory for the
+ * environments without virtual memory control. The slab is allocated on the standard heap
+ * and the huge page and memory locking options are ignored.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "HeapManager.h"
+#include "MemoryOperationsHelper.h"
+#include "SlabMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/*lint -e{715} hugePages and lockMemory are not supported in this environment*/
+void *SlabMemory::Allocate(const uint32 size,
+                           const bool hugePages,
+                           const bool lockMemory) {
+    //Room to align the address and to store the heap address just before the aligned address.
+    uint32 totalSize = (size + ALIGNMENT) + static_cast<uint32>(sizeof(void *));
+    void *heapAddress = HeapManager::Malloc(totalSize);
+    void *address = NULL_PTR(void *);
+    if (heapAddress != NULL_PTR(void *)) {
+        /*lint -e{923} -e{9091} the address is aligned by integer arithmetic*/
+        uintp aligned = reinterpret_cast<uintp>(heapAddress) + static_cast<uintp>(sizeof(void *));
+        aligned = ((aligned + ALIGNMENT) - 1u) & ~(static_cast<uintp>(ALIGNMENT) - 1u);
+        /*lint -e{923} -e{9091} see above*/
+        address = reinterpret_cast<void *>(aligned);
+        /*lint -e{927} -e{826} the header is just before the aligned address*/
+        reinterpret_cast<void **>(address)[-1] = heapAddress;
+        if (!MemoryOperationsHelper::Set(address, '\0', size)) {
+            void *header = heapAddress;
+            (void) HeapManager::Free(header);
+            address = NULL_PTR(void *);
+        }
+    }
+    return address;
+}
+
+bool SlabMemory::Free(void *&address) {
+    bool ok = (address != NULL_PTR(void *));
+    if (ok) {
+        /*lint -e{927} -e{826} the header is just before the aligned address*/
+        void *heapAddress = reinterpret_cast<void **>(address)[-1];
+        ok = HeapManager::Free(heapAddress);
+        address = NULL_PTR(void *);
+    }
+    return ok;
+}
+
+}
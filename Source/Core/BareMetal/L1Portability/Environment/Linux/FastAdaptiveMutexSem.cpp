@@ -0,0 +1,73 @@
+/**
+ * @file FastAdaptiveMutexSem.cpp
+ * @brief Source file for class FastAdaptiveMutexSem
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the Linux (futex based) definition of the
+ * operating system dependent methods of the class FastAdaptiveMutexSem.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "FastAdaptiveMutexSem.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+void FastAdaptiveMutexSem::OsWait(volatile int32 * const address,
+                                  const int32 value,
+                                  const TimeoutType &timeout) {
+    struct timespec *timeoutSpecPtr = static_cast<struct timespec *>(NULL);
+    struct timespec timeoutSpec;
+    if (timeout != TTInfiniteWait) {
+        uint64 usec = timeout.GetTimeoutUSec();
+        timeoutSpec.tv_sec = static_cast<time_t>(usec / 1000000u);
+        timeoutSpec.tv_nsec = static_cast<long>((usec % 1000000u) * 1000u);
+        timeoutSpecPtr = &timeoutSpec;
+    }
+    //Returns immediately if *address != value (EAGAIN). Timeouts, signals and spurious wake-ups are handled by the caller.
+    /*lint -e{9130} -e{970} -e{923} syscall interface*/
+    (void) syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, value, timeoutSpecPtr, static_cast<int32 *>(NULL), 0);
+}
+
+void FastAdaptiveMutexSem::OsWake(volatile int32 * const address) {
+    /*lint -e{9130} -e{970} -e{923} syscall interface*/
+    (void) syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, 1, static_cast<struct timespec *>(NULL), static_cast<int32 *>(NULL), 0);
+}
+
+}
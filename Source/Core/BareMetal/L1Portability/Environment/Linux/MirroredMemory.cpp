@@ -0,0 +1,167 @@
+/**
+ * @file MirroredMemory.cpp
+ * @brief Source file for module MirroredMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the Linux (memfd and mmap based) definition of the
+ * module MirroredMemory.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "MirroredMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Maps \a length bytes of the file \a fd, starting at \a fileOffset, at the fixed address \a address.
+ * @return true if the memory was mapped at \a address.
+ */
+static bool MirroredMemoryMapFixed(void * const address,
+                                   const uint64 length,
+                                   const int32 fd,
+                                   const uint64 fileOffset) {
+    /*lint -e{9130} -e{970} -e{923} mmap interface*/
+    void *mapped = mmap(address, static_cast<size_t>(length), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED | MAP_POPULATE, fd, static_cast<off_t>(fileOffset));
+    return (mapped == address);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+uint32 MirroredMemory::GetGranularity() {
+#ifdef SYS_memfd_create
+    uint32 granularity = static_cast<uint32>(sysconf(_SC_PAGESIZE));
+#else
+    uint32 granularity = 0u;
+#endif
+    return granularity;
+}
+
+void *MirroredMemory::Allocate(const uint32 numberOfRegions,
+                               const uint32 * const regionSizes,
+                               const bool * const mirrored) {
+    uint32 pageSize = GetGranularity();
+    bool ok = (pageSize > 0u);
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "Mirrored memory is not supported.");
+    }
+    if (ok) {
+        ok = (numberOfRegions > 0u);
+    }
+    uint64 fileSize = 0u;
+    uint64 virtualSize = 0u;
+    for (uint32 r = 0u; (r < numberOfRegions) && (ok); r++) {
+        ok = (regionSizes[r] > 0u);
+        if (ok) {
+            ok = ((regionSizes[r] % pageSize) == 0u);
+        }
+        if (ok) {
+            fileSize += regionSizes[r];
+            virtualSize += (mirrored[r] ? (2u * static_cast<uint64>(regionSizes[r])) : static_cast<uint64>(regionSizes[r]));
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "The size of the regions must be a positive multiple of the page size.");
+        }
+    }
+    int32 fd = -1;
+#ifdef SYS_memfd_create
+    if (ok) {
+        /*lint -e{970} -e{9130} syscall interface*/
+        fd = static_cast<int32>(syscall(SYS_memfd_create, "MARTe2MirroredMemory", 0u));
+        ok = (fd >= 0);
+    }
+#endif
+    if (ok) {
+        ok = (ftruncate(fd, static_cast<off_t>(fileSize)) == 0);
+    }
+    //The first page stores the total mapped length, so that Free does not need the region sizes.
+    uint64 length = static_cast<uint64>(pageSize) + virtualSize;
+    void *base = MAP_FAILED;
+    if (ok) {
+        /*lint -e{9130} -e{970} -e{923} mmap interface*/
+        base = mmap(NULL_PTR(void *), static_cast<size_t>(length), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ok = (base != MAP_FAILED);
+    }
+    /*lint -e{9016} pointer arithmetic needed to lay out the regions*/
+    char8 *address = ok ? &(static_cast<char8 *>(base)[pageSize]) : NULL_PTR(char8 *);
+    uint64 virtualOffset = 0u;
+    uint64 fileOffset = 0u;
+    for (uint32 r = 0u; (r < numberOfRegions) && (ok); r++) {
+        ok = MirroredMemoryMapFixed(&address[virtualOffset], regionSizes[r], fd, fileOffset);
+        virtualOffset += regionSizes[r];
+        if ((ok) && (mirrored[r])) {
+            ok = MirroredMemoryMapFixed(&address[virtualOffset], regionSizes[r], fd, fileOffset);
+            virtualOffset += regionSizes[r];
+        }
+        fileOffset += regionSizes[r];
+    }
+    //The mappings keep a reference to the memory file.
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    if (ok) {
+        *static_cast<uint64 *>(base) = length;
+    }
+    else {
+        if (base != MAP_FAILED) {
+            (void) munmap(base, static_cast<size_t>(length));
+        }
+        address = NULL_PTR(char8 *);
+        if (pageSize > 0u) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Could not map the mirrored memory.");
+        }
+    }
+    return address;
+}
+
+bool MirroredMemory::Free(void *&address) {
+    bool ok = (address != NULL_PTR(void *));
+    if (ok) {
+        /*lint -e{9016} pointer arithmetic needed to reach the header*/
+        void *base = &(static_cast<char8 *>(address)[-static_cast<int32>(GetGranularity())]);
+        uint64 length = *static_cast<uint64 *>(base);
+        ok = (munmap(base, static_cast<size_t>(length)) == 0);
+        address = NULL_PTR(void *);
+    }
+    return ok;
+}
+
+}
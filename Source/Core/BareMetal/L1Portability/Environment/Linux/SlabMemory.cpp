@@ -0,0 +1,127 @@
+/**
+ * @file SlabMemory.cpp
+ * @brief Source file for module SlabMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the Linux (mmap based) definition of the
+ * module SlabMemory.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "SlabMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Huge page size used to round the length of MAP_HUGETLB mappings.
+ */
+static const uint64 SLAB_MEMORY_HUGE_PAGE_SIZE = 2097152u;
+
+/**
+ * @brief Maps \a length bytes of anonymous memory, faulting in all the pages.
+ * @return the mapped address or MAP_FAILED.
+ */
+static void *SlabMemoryMap(const uint64 length,
+                           const int32 extraFlags) {
+    /*lint -e{9130} -e{970} -e{923} mmap interface*/
+    return mmap(NULL_PTR(void *), static_cast<size_t>(length), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE | extraFlags, -1, 0);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+void *SlabMemory::Allocate(const uint32 size,
+                           const bool hugePages,
+                           const bool lockMemory) {
+    //The mapped length is stored in the first ALIGNMENT bytes, so that Free does not need the size.
+    uint64 length = static_cast<uint64>(size) + ALIGNMENT;
+    void *base = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (hugePages) {
+        uint64 hugeLength = ((length + SLAB_MEMORY_HUGE_PAGE_SIZE) - 1u) & ~(SLAB_MEMORY_HUGE_PAGE_SIZE - 1u);
+        base = SlabMemoryMap(hugeLength, MAP_HUGETLB);
+        if (base != MAP_FAILED) {
+            length = hugeLength;
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "Could not allocate the slab on huge pages. Using the standard pages.");
+        }
+    }
+#else
+    if (hugePages) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "Huge pages are not supported. Using the standard pages.");
+    }
+#endif
+    if (base == MAP_FAILED) {
+        uint64 pageSize = static_cast<uint64>(sysconf(_SC_PAGESIZE));
+        length = ((length + pageSize) - 1u) & ~(pageSize - 1u);
+        base = SlabMemoryMap(length, 0);
+    }
+    void *address = NULL_PTR(void *);
+    if (base != MAP_FAILED) {
+        if (lockMemory) {
+            if (mlock(base, static_cast<size_t>(length)) != 0) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "Could not lock the slab in memory.");
+            }
+        }
+        *static_cast<uint64 *>(base) = length;
+        /*lint -e{9016} pointer arithmetic needed to skip the header*/
+        address = &(static_cast<char8 *>(base)[ALIGNMENT]);
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Could not map the slab memory.");
+    }
+    return address;
+}
+
+bool SlabMemory::Free(void *&address) {
+    bool ok = (address != NULL_PTR(void *));
+    if (ok) {
+        /*lint -e{9016} pointer arithmetic needed to reach the header*/
+        void *base = &(static_cast<char8 *>(address)[-static_cast<int32>(ALIGNMENT)]);
+        uint64 length = *static_cast<uint64 *>(base);
+        //munmap also unlocks the pages
+        ok = (munmap(base, static_cast<size_t>(length)) == 0);
+        address = NULL_PTR(void *);
+    }
+    return ok;
+}
+
+}
@@ -43,6 +43,8 @@
 
 namespace MARTe {
 
+class AnyType;
+
 namespace ErrorManagement {
 
 /**
@@ -51,11 +53,28 @@ namespace ErrorManagement {
 typedef void (*ErrorProcessFunctionType)(const ErrorInformation &errorInfo,
                                          const char8 * const errorDescription);
 
+/**
+ * @brief The type of a user provided function that stores an error message to be formatted later.
+ * @details The function receives the format and the parameters of the message (terminated by a void AnyType) and
+ * must copy everything it needs, as the parameters are only valid during the call.
+ * @return true if the message was taken (stored or deliberately discarded), false if it must be formatted immediately
+ * and sent to the ErrorProcessFunctionType function.
+ */
+typedef bool (*DeferredErrorProcessFunctionType)(const ErrorInformation &errorInfo,
+                                                 const char8 * const format,
+                                                 const AnyType * const parameters,
+                                                 const uint32 numberOfParameters);
+
 /**
  * @brief A pointer to the function that will process the errors.
  */
 extern DLL_API ErrorProcessFunctionType errorMessageProcessFunction;
 
+/**
+ * @brief A pointer to the function that will store the errors whose formatting is deferred (NULL if disabled).
+ */
+extern DLL_API DeferredErrorProcessFunctionType deferredErrorProcessFunction;
+
 /**
  * @brief A null ErrorProcessing function
  * @details This function is compatible with the function prototype defined
@@ -110,10 +129,17 @@ const char8 * const functionName = static_cast<const char8 *>(NULL));
 
 /**
  * @brief Sets the routine for error managing.
+ * @details Also disables the deferred formatting (see SetDeferredErrorProcessFunction), as the new routine expects formatted messages.
  * @param[in] userFun is a pointer to the function called by ReportError.
  */
 DLL_API void SetErrorProcessFunction(const ErrorProcessFunctionType userFun);
 
+/**
+ * @brief Sets the routine that stores the messages with parameters so that they can be formatted later, outside of the calling thread.
+ * @param[in] userFun is a pointer to the function called by ReportErrorDeferred. NULL disables the deferred formatting.
+ */
+DLL_API void SetDeferredErrorProcessFunction(const DeferredErrorProcessFunctionType userFun);
+
 }
 
 /*---------------------------------------------------------------------------*/
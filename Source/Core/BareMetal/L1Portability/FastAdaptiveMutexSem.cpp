@@ -0,0 +1,115 @@
+/**
+ * @file FastAdaptiveMutexSem.cpp
+ * @brief Source file for class FastAdaptiveMutexSem
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FastAdaptiveMutexSem (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "FastAdaptiveMutexSem.h"
+#include "HighResolutionTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+FastAdaptiveMutexSem::FastAdaptiveMutexSem() {
+    internalFlag = 0;
+    flag = &internalFlag;
+}
+
+FastAdaptiveMutexSem::FastAdaptiveMutexSem(volatile int32 &externalFlag) {
+    internalFlag = 0;
+    flag = &externalFlag;
+}
+
+void FastAdaptiveMutexSem::Create(const bool locked) {
+    if (locked) {
+        *flag = 1;
+    }
+    else {
+        *flag = 0;
+    }
+}
+
+bool FastAdaptiveMutexSem::Locked() const {
+    return (*flag != 0);
+}
+
+ErrorManagement::ErrorType FastAdaptiveMutexSem::FastLock(const TimeoutType &timeout,
+                                                          const uint32 maxSpins) {
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+    bool locked = Atomic::CompareAndSwap(flag, 0, 1);
+    uint32 n;
+    for (n = 0u; (n < maxSpins) && (!locked); n++) {
+        Atomic::SpinPause();
+        if (*flag == 0) {
+            locked = Atomic::CompareAndSwap(flag, 0, 1);
+        }
+    }
+    if (!locked) {
+        uint64 ticksStop = timeout.HighResolutionTimerTicks();
+        ticksStop += HighResolutionTimer::Counter();
+        //Mark the semaphore as having waiters, so that FastUnLock wakes them. If the semaphore was meanwhile unlocked, it is now owned by this thread.
+        while ((err == ErrorManagement::NoError) && (Atomic::Exchange(flag, 2) != 0)) {
+            if (timeout == TTInfiniteWait) {
+                OsWait(flag, 2, timeout);
+            }
+            else {
+                uint64 ticks = HighResolutionTimer::Counter();
+                if (ticks > ticksStop) {
+                    err = ErrorManagement::Timeout;
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "FastAdaptiveMutexSem: Timeout expired");
+                }
+                else {
+                    TimeoutType remaining;
+                    remaining.SetTimeoutHighResolutionTimerTicks(ticksStop - ticks);
+                    OsWait(flag, 2, remaining);
+                }
+            }
+        }
+    }
+    return err;
+}
+
+bool FastAdaptiveMutexSem::FastTryLock() {
+    return Atomic::CompareAndSwap(flag, 0, 1);
+}
+
+void FastAdaptiveMutexSem::FastUnLock() {
+    if (Atomic::Exchange(flag, 0) == 2) {
+        OsWake(flag);
+    }
+}
+
+}
@@ -0,0 +1,160 @@
+/**
+ * @file FastAdaptiveMutexSem.h
+ * @brief Header file for class FastAdaptiveMutexSem
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FastAdaptiveMutexSem
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FASTADAPTIVEMUTEXSEM_H_
+#define FASTADAPTIVEMUTEXSEM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "Atomic.h"
+#include "ErrorManagement.h"
+#include "ErrorType.h"
+#include "GeneralDefinitions.h"
+#include "HighResolutionTimer.h"
+#include "TimeoutType.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Default number of times that FastAdaptiveMutexSem::FastLock polls the lock before asking the operating system to wait.
+ */
+static const uint32 FAST_ADAPTIVE_MUTEX_SEM_DEFAULT_SPINS = 100u;
+
+/**
+ * @brief Mutex semaphore which spins for a bounded number of times and then asks the operating system to
+ * sleep until the semaphore is released.
+ *
+ * @details Offers the same FastLock/FastTryLock/FastUnLock interface of the FastPollingMutexSem. Uncontended locks and
+ * unlocks are a single atomic operation. When the semaphore is locked, FastLock polls it (with a processor pause hint
+ * between attempts) and, if it is still locked, the calling thread is put to sleep by the operating system
+ * (a futex on Linux) and is woken as soon as the semaphore is unlocked, i.e. without the sleep/poll latency of the FastPollingMutexSem.
+ * On operating systems without such a primitive the thread yields the CPU between polls.
+ *
+ * The internal flag is 0 when unlocked, 1 when locked without waiters and 2 when locked and other threads may be waiting.
+ *
+ * This semaphore is not recursive i.e if the same thread locks two times sequentially it causes a deadlock.
+ * Moreover a thread can unlock the semaphore locked by another thread.
+ * @warning The semaphore can only be shared between the threads of the same process.
+ */
+class DLL_API FastAdaptiveMutexSem {
+
+public:
+
+    /**
+     * @brief Initialises the semaphore as unlocked.
+     */
+    FastAdaptiveMutexSem();
+
+    /**
+     * @brief Constructor by external flag.
+     * @param[in] externalFlag is the flag which will drive the semaphore. It shall only be accessed through FastAdaptiveMutexSem instances.
+     */
+    FastAdaptiveMutexSem(volatile int32 &externalFlag);
+
+    /**
+     * @brief Initialises the semaphore as locked or unlocked.
+     * @param[in] locked defines if the semaphore is to be initialised in a locked in an unlocked state (default locked=false)
+     */
+    void Create(const bool locked = false);
+
+    /**
+     * @brief Returns the status of the semaphore.
+     * @return true if the semaphore is locked, false if it is unlocked.
+     */
+    bool Locked() const;
+
+    /**
+     * @brief Locks the semaphore.
+     * @details If the semaphore is locked polls it \a maxSpins times and then sleeps until the semaphore is unlocked or the timeout expires.
+     * A double consecutive lock by the same thread causes a deadlock.
+     * @param[in] timeout is the desired timeout.
+     * @param[in] maxSpins is the number of times the semaphore is polled before the thread goes to sleep.
+     * @return ErrorManagement::Timeout if the semaphore is locked for a period which is greater than the
+     * specified timeout. Otherwise ErrorManagement::NoError is returned.
+     */
+    ErrorManagement::ErrorType FastLock(const TimeoutType &timeout = TTInfiniteWait,
+                                        const uint32 maxSpins = FAST_ADAPTIVE_MUTEX_SEM_DEFAULT_SPINS);
+
+    /**
+     * @brief Tries to lock and in case of failure returns immediately.
+     * @return true if the semaphore was unlocked and the thread locks it, false if it was
+     * already locked.
+     */
+    bool FastTryLock();
+
+    /**
+     * @brief Unlocks the semaphore and wakes one of the threads that are waiting (if any).
+     * @details A thread could unlock the semaphore locked by another thread.
+     */
+    void FastUnLock();
+
+private:
+
+    /**
+     * @brief Sleeps while *address == value, until woken by OsWake or until the timeout expires.
+     * @details Operating system dependent. May return earlier (spurious wake-up).
+     * @param[in] address the address of the flag.
+     * @param[in] value the value of the flag for which the thread is to sleep.
+     * @param[in] timeout the maximum time to sleep.
+     */
+    static void OsWait(volatile int32 * const address,
+                       const int32 value,
+                       const TimeoutType &timeout);
+
+    /**
+     * @brief Wakes one of the threads sleeping in OsWait on the given address.
+     * @details Operating system dependent.
+     * @param[in] address the address of the flag.
+     */
+    static void OsWake(volatile int32 * const address);
+
+    /**
+     * The internal flag
+     */
+    volatile int32 internalFlag;
+
+    /**
+     * Pointer to the used flag
+     */
+    volatile int32 *flag;
+
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FASTADAPTIVEMUTEXSEM_H_ */
@@ -46,6 +46,7 @@ namespace MemoryOperationsHelper {
 /**
  * @brief Copies a block of memory into another.
  * @details A copy of size bytes from source location to destination position.
+ * Depending on the architecture (see MemoryOperationsHelperA.h) large memory areas are copied with non-temporal stores.
  * @param[in,out] destination is the pointer to the destination memory location.
  * @param[in] source is the pointer to the source memory location.
  * @param[in] size is the size of the memory to be copied.
@@ -0,0 +1,93 @@
+/**
+ * @file MirroredMemory.h
+ * @brief Header file for module MirroredMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module MirroredMemory
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MIRROREDMEMORY_H_
+#define MIRROREDMEMORY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Allocation of memory regions which are followed, in the virtual address space, by a mirror of themselves.
+ * @details A mirrored region of size S is mapped twice on consecutive virtual addresses, so that writing at the address A + x
+ * (with x < S) is the same as writing at the address A + S + x. A circular buffer that is allocated in a mirrored region can
+ * thus always be read (or written) as a single contiguous block of at most S bytes, starting from any position inside the buffer,
+ * without having to split the access at the end of the buffer.
+ *
+ * Allocate reserves a single contiguous block of virtual memory for a list of regions, which are laid out one after the other.
+ * A mirrored region uses twice its size of virtual memory (but not of physical memory); a region which is not mirrored uses its size.
+ * The size of all the regions must be a multiple of GetGranularity() (i.e. of the page size).
+ *
+ * The mirroring requires the operating system to map the same physical pages at two different virtual addresses.
+ * In environments where this is not supported GetGranularity() returns 0 and Allocate fails.
+ */
+class DLL_API MirroredMemory {
+public:
+
+    /**
+     * @brief Gets the granularity of the regions which can be mirrored.
+     * @return the size (in bytes) that all the region sizes must be a multiple of, or 0 if the mirroring is not supported.
+     */
+    static uint32 GetGranularity();
+
+    /**
+     * @brief Allocates \a numberOfRegions consecutive regions.
+     * @details The region i starts at the address returned plus the sum of the virtual sizes of all the regions before i, where
+     * the virtual size of a region is regionSizes[i] * 2 if mirrored[i] is true and regionSizes[i] otherwise.
+     * @param[in] numberOfRegions the number of elements of \a regionSizes and of \a mirrored.
+     * @param[in] regionSizes the size in bytes of each region. Must be > 0 and a multiple of GetGranularity().
+     * @param[in] mirrored true for the regions that are to be followed by a mirror of themselves.
+     * @return the address of the zeroed memory or NULL if the memory could not be allocated.
+     */
+    static void *Allocate(const uint32 numberOfRegions,
+                          const uint32 * const regionSizes,
+                          const bool * const mirrored);
+
+    /**
+     * @brief Frees the memory allocated with Allocate.
+     * @param[in,out] address the address returned by Allocate. Set to NULL on return.
+     * @return true if the memory was freed.
+     */
+    static bool Free(void *&address);
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MIRROREDMEMORY_H_ */
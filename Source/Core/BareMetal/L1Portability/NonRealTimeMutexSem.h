@@ -0,0 +1,62 @@
+/**
+ * @file NonRealTimeMutexSem.h
+ * @brief Header file for the NonRealTimeMutexSem type
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the NonRealTimeMutexSem type,
+ * which selects the mutex that protects the containers shared by the non real-time threads.
+ */
+
+#ifndef NONREALTIMEMUTEXSEM_H_
+#define NONREALTIMEMUTEXSEM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "FastAdaptiveMutexSem.h"
+#include "FastPollingMutexSem.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief The mutex which protects the containers that are only shared by non real-time threads
+ * (e.g. ReferenceContainer, ConfigurationDatabase, ObjectRegistryDatabase and QueueingMessageFilter).
+ * @details By default it is the FastPollingMutexSem. If the core is compiled with MARTe2_USE_FAST_ADAPTIVE_MUTEX
+ * defined (e.g. make MARTe2_USE_FAST_ADAPTIVE_MUTEX=1) it is the FastAdaptiveMutexSem, so that a thread waiting
+ * for a contended lock sleeps until the lock is released, instead of polling it.
+ */
+#ifdef MARTe2_USE_FAST_ADAPTIVE_MUTEX
+typedef FastAdaptiveMutexSem NonRealTimeMutexSem;
+#else
+typedef FastPollingMutexSem NonRealTimeMutexSem;
+#endif
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* NONREALTIMEMUTEXSEM_H_ */
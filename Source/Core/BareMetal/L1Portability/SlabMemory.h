@@ -0,0 +1,84 @@
+/**
+ * @file SlabMemory.h
+ * @brief Header file for module SlabMemory
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module SlabMemory
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SLABMEMORY_H_
+#define SLABMEMORY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Allocation of large, contiguous and cache-line aligned memory areas (slabs) for real-time buffers.
+ * @details The memory of a slab is zeroed and, where the operating system allows it, is backed by pages which
+ * are faulted in at allocation time, so that the first real-time accesses do not page fault.
+ * Optionally the slab can be backed by huge pages (less TLB misses) and locked in memory. These options are
+ * a best effort: if the operating system does not support them (or the huge page pool is exhausted) the slab
+ * is allocated with the standard pages and Allocate still succeeds.
+ */
+class DLL_API SlabMemory {
+public:
+
+    /**
+     * Alignment (in bytes) of the address returned by Allocate.
+     */
+    static const uint32 ALIGNMENT = 64u;
+
+    /**
+     * @brief Allocates a slab of \a size bytes.
+     * @param[in] size the number of bytes to allocate.
+     * @param[in] hugePages if true try to back the slab with huge pages.
+     * @param[in] lockMemory if true try to lock the slab in memory (i.e. it is never paged out).
+     * @return the ALIGNMENT aligned address of the zeroed slab or NULL if the memory could not be allocated.
+     */
+    static void *Allocate(const uint32 size,
+                          const bool hugePages = false,
+                          const bool lockMemory = false);
+
+    /**
+     * @brief Frees a slab allocated with Allocate.
+     * @param[in,out] address the address returned by Allocate. Set to NULL on return.
+     * @return true if the slab was freed.
+     */
+    static bool Free(void *&address);
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SLABMEMORY_H_ */
@@ -40,11 +40,19 @@
 #include "ClassRegistryItem.h"
 #include "ClassRegistryDatabase.h"
 #include "ErrorManagement.h"
+#include "Fnv1aHashFunction.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+/**
+ * Number of items allocated the first time a class is registered.
+ */
+const MARTe::uint32 CLASS_REGISTRY_DATABASE_INITIAL_CAPACITY = 128u;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -62,10 +70,16 @@ ClassRegistryDatabase *ClassRegistryDatabase::Instance() {
 
 ClassRegistryDatabase::ClassRegistryDatabase() {
     classUniqueIdentifier = 0u;
+    items = NULL_PTR(ClassRegistryItem **);
+    itemsCapacity = 0u;
+    classNameIndex = NULL_PTR(uint32 *);
+    typeIdNameIndex = NULL_PTR(uint32 *);
+    indexCapacity = 0u;
 }
 
 ClassRegistryDatabase::~ClassRegistryDatabase() {
     //automatic LinkedListHolder::CleanUp
+    ResetIndexes();
 }
 
 void ClassRegistryDatabase::Add(ClassRegistryItem * const p) {
@@ -78,12 +92,126 @@ void ClassRegistryDatabase::Add(ClassRegistryItem * const p) {
         p->SetUniqueIdentifier(classUniqueIdentifier);
 
         classDatabase.ListInsert(p, classUniqueIdentifier);
+        uint32 identifier = classUniqueIdentifier;
+        if (GrowIndexes(identifier)) {
+            items[identifier] = p;
+            IndexItem(classNameIndex, identifier, false);
+            IndexItem(typeIdNameIndex, identifier, true);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed to allocate the indexes");
+        }
         classUniqueIdentifier = classUniqueIdentifier + 1u;
 
         UnLock();
     }
 }
 
+uint32 ClassRegistryDatabase::Hash(const char8 * const name) {
+    Fnv1aHashFunction hashFunction;
+    return hashFunction.Compute(name);
+}
+
+void ClassRegistryDatabase::IndexItem(uint32 * const nameIndex,
+                                      const uint32 identifier,
+                                      const bool useTypeIdName) {
+    const ClassProperties *classProperties = items[identifier]->GetClassProperties();
+    const char8 *name = NULL_PTR(const char8 *);
+    if (classProperties != NULL_PTR(const ClassProperties *)) {
+        name = useTypeIdName ? classProperties->GetTypeIdName() : classProperties->GetName();
+    }
+    if (name != NULL) {
+        //Only the first class registered with a given name is indexed (as it would be found by a linear search)
+        if (FindIndexed(name, useTypeIdName) == NULL) {
+            uint32 mask = indexCapacity - 1u;
+            uint32 i = Hash(name) & mask;
+            while (nameIndex[i] != 0u) {
+                i = (i + 1u) & mask;
+            }
+            nameIndex[i] = identifier + 1u;
+        }
+    }
+}
+
+ClassRegistryItem *ClassRegistryDatabase::FindIndexed(const char8 * const name,
+                                                      const bool useTypeIdName) const {
+    ClassRegistryItem *registryItem = NULL_PTR(ClassRegistryItem *);
+    const uint32 *nameIndex = useTypeIdName ? typeIdNameIndex : classNameIndex;
+    if ((nameIndex != NULL) && (name != NULL)) {
+        uint32 mask = indexCapacity - 1u;
+        uint32 i = Hash(name) & mask;
+        while ((nameIndex[i] != 0u) && (registryItem == NULL)) {
+            ClassRegistryItem *p = items[nameIndex[i] - 1u];
+            const ClassProperties *classProperties = p->GetClassProperties();
+            if (classProperties != NULL_PTR(const ClassProperties *)) {
+                const char8 *itemName = useTypeIdName ? classProperties->GetTypeIdName() : classProperties->GetName();
+                if (StringHelper::Compare(itemName, name) == 0) {
+                    registryItem = p;
+                }
+            }
+            i = (i + 1u) & mask;
+        }
+    }
+    return registryItem;
+}
+
+bool ClassRegistryDatabase::GrowIndexes(const uint32 identifier) {
+    bool ok = true;
+    if (identifier >= itemsCapacity) {
+        uint32 newCapacity = (itemsCapacity > 0u) ? (itemsCapacity * 2u) : CLASS_REGISTRY_DATABASE_INITIAL_CAPACITY;
+        while (identifier >= newCapacity) {
+            newCapacity *= 2u;
+        }
+        ClassRegistryItem **newItems = new ClassRegistryItem*[newCapacity];
+        //The hash tables are kept at most half full
+        uint32 newIndexCapacity = newCapacity * 2u;
+        uint32 *newClassNameIndex = new uint32[newIndexCapacity];
+        uint32 *newTypeIdNameIndex = new uint32[newIndexCapacity];
+        ok = ((newItems != NULL) && (newClassNameIndex != NULL) && (newTypeIdNameIndex != NULL));
+        if (ok) {
+            for (uint32 i = 0u; i < newCapacity; i++) {
+                newItems[i] = (i < itemsCapacity) ? items[i] : NULL_PTR(ClassRegistryItem *);
+            }
+            for (uint32 i = 0u; i < newIndexCapacity; i++) {
+                newClassNameIndex[i] = 0u;
+                newTypeIdNameIndex[i] = 0u;
+            }
+            uint32 numberOfItems = itemsCapacity;
+            ResetIndexes();
+            items = newItems;
+            itemsCapacity = newCapacity;
+            classNameIndex = newClassNameIndex;
+            typeIdNameIndex = newTypeIdNameIndex;
+            indexCapacity = newIndexCapacity;
+            //Rehash in identifier order, so that the first of the classes with the same name is kept
+            for (uint32 i = 0u; i < numberOfItems; i++) {
+                if (items[i] != NULL) {
+                    IndexItem(classNameIndex, i, false);
+                    IndexItem(typeIdNameIndex, i, true);
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+void ClassRegistryDatabase::ResetIndexes() {
+    if (items != NULL) {
+        delete[] items;
+    }
+    if (classNameIndex != NULL) {
+        delete[] classNameIndex;
+    }
+    if (typeIdNameIndex != NULL) {
+        delete[] typeIdNameIndex;
+    }
+    items = NULL_PTR(ClassRegistryItem **);
+    itemsCapacity = 0u;
+    classNameIndex = NULL_PTR(uint32 *);
+    typeIdNameIndex = NULL_PTR(uint32 *);
+    indexCapacity = 0u;
+}
+
 ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
     const uint32 maxSize = 129u;
     char8 dllName[maxSize];
@@ -115,20 +243,8 @@ ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
         if (!Lock()) {
             REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
         }
-        uint32 i;
-        uint32 databaseSize = classDatabase.ListSize();
-        for (i = 0u; (i < databaseSize) && (!found); i++) {
-            ClassRegistryItem *p = classDatabase.ListPeek(i);
-            if (p != NULL) {
-                const ClassProperties *classProperties = p->GetClassProperties();
-                if (classProperties != NULL_PTR(ClassProperties *)) {
-                    if (StringHelper::Compare(classProperties->GetName(), className) == 0) {
-                        registryItem = p;
-                        found = true;
-                    }
-                }
-            }
-        }
+        registryItem = FindIndexed(className, false);
+        found = (registryItem != NULL);
         //Must unlock as the loader->Open below might trigger the registration of new classes which will call on the
         //Add method and thus Lock the database.
         UnLock();
@@ -167,19 +283,10 @@ ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
             if (!Lock()) {
                 REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
             }
-            uint32 databaseSize = classDatabase.ListSize();
-            for (i = 0u; (i < databaseSize) && (!found); i++) {
-                ClassRegistryItem *p = classDatabase.ListPeek(i);
-                if (p != NULL) {
-                    const ClassProperties *classProperties = p->GetClassProperties();
-                    if (classProperties != NULL_PTR(ClassProperties *)) {
-                        if (StringHelper::Compare(classProperties->GetName(), className) == 0) {
-                            registryItem = p;
-                            registryItem->SetLoadableLibrary(loader);
-                            found = true;
-                        }
-                    }
-                }
+            registryItem = FindIndexed(className, false);
+            found = (registryItem != NULL);
+            if (found) {
+                registryItem->SetLoadableLibrary(loader);
             }
             UnLock();
         }
@@ -200,22 +307,8 @@ ClassRegistryItem *ClassRegistryDatabase::FindTypeIdName(const char8 * const typ
     if (!Lock()) {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
     }
-    bool found = false;
     if (typeidName != NULL) {
-        uint32 i;
-        uint32 databaseSize = classDatabase.ListSize();
-        for (i = 0u; (i < databaseSize) && (!found); i++) {
-            ClassRegistryItem *p = classDatabase.ListPeek(i);
-            if (p != NULL) {
-                const ClassProperties *classProperties = p->GetClassProperties();
-                if (classProperties != NULL_PTR(ClassProperties *)) {
-                    if (StringHelper::Compare(classProperties->GetTypeIdName(), typeidName) == 0) {
-                        registryItem = p;
-                        found = true;
-                    }
-                }
-            }
-        }
+        registryItem = FindIndexed(typeidName, true);
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: NULL pointer in input");
@@ -240,7 +333,9 @@ uint32 ClassRegistryDatabase::GetSize() {
 const ClassRegistryItem *ClassRegistryDatabase::Peek(const uint32 &idx) {
     ClassRegistryItem *item = NULL_PTR(ClassRegistryItem *);
     if (Lock()) {
-        item = classDatabase.ListPeek(idx);
+        if (idx < itemsCapacity) {
+            item = items[idx];
+        }
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
@@ -254,7 +349,13 @@ const char8 * const ClassRegistryDatabase::GetClassName() const {
 }
 
 void ClassRegistryDatabase::CleanUp() {
+    if (!Lock()) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+    }
     classDatabase.CleanUp();
+    ResetIndexes();
+    classUniqueIdentifier = 0u;
+    UnLock();
 }
 
 bool ClassRegistryDatabase::Lock() {
@@ -33,7 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "GlobalObjectsDatabase.h"
-#include "FastPollingMutexSem.h"
+#include "NonRealTimeMutexSem.h"
 #include "ClassRegistryItem.h"
 #include "StaticList.h"
 #include "FractionalInteger.h"
@@ -53,6 +53,11 @@ namespace MARTe {
  * Every class that inherits from Object will be described by a
  * ClassRegistryItem and automatically added to a ClassRegistryDatabase. This
  * database can then be used to retrieve information about the registered classes.
+ *
+ * The items are indexed when they are added: Peek is a direct lookup of the unique identifier
+ * (which is also the TypeDescriptor::structuredDataIdCode of the registered structured types) and
+ * Find and FindTypeIdName use open addressing hash tables of the class names and of the typeid names.
+ * If more than one class is registered with the same name, the first one to be registered is found.
  */
 class DLL_API ClassRegistryDatabase: public GlobalObjectI {
 
@@ -116,6 +121,7 @@ public:
 
     /**
      * @brief Cleanup the database.
+     * @details The unique identifiers of the classes added afterwards restart from zero.
      */
     void CleanUp();
 
@@ -148,12 +154,73 @@ private:
     /**
      * Protects the concurrent access to the database
      */
-    FastPollingMutexSem mux;
+    NonRealTimeMutexSem mux;
 
     /**
      * Unique identifier of the latest registered class;
      */
     ClassUID classUniqueIdentifier;
+
+    /**
+     * @brief Computes the hash of a class name or of a typeid name.
+     */
+    static uint32 Hash(const char8 * const name);
+
+    /**
+     * @brief Stores the identifier of an item in one of the name indexes.
+     * @details Does nothing if \a name is NULL or if another item with the same name is already indexed.
+     * @param[in] nameIndex the table where to store the identifier.
+     * @param[in] identifier the unique identifier of the item.
+     * @param[in] useTypeIdName true if the table is indexed by typeid name, false if it is indexed by class name.
+     */
+    void IndexItem(uint32 * const nameIndex,
+                   const uint32 identifier,
+                   const bool useTypeIdName);
+
+    /**
+     * @brief Finds an item in one of the name indexes (which shall be called with the database locked).
+     * @param[in] name the class name or the typeid name to search.
+     * @param[in] useTypeIdName true to search the typeid names, false to search the class names.
+     * @return the item or NULL if \a name is not registered.
+     */
+    ClassRegistryItem *FindIndexed(const char8 * const name,
+                                   const bool useTypeIdName) const;
+
+    /**
+     * @brief Makes room in the indexes for the item with unique identifier \a identifier.
+     * @return true if the indexes could be allocated.
+     */
+    bool GrowIndexes(const uint32 identifier);
+
+    /**
+     * @brief Frees the indexes.
+     */
+    void ResetIndexes();
+
+    /**
+     * The registered items, indexed by unique identifier.
+     */
+    ClassRegistryItem **items;
+
+    /**
+     * Number of elements allocated in items.
+     */
+    uint32 itemsCapacity;
+
+    /**
+     * Hash table of the class names. Each slot holds the unique identifier + 1 of an item (0 if empty).
+     */
+    uint32 *classNameIndex;
+
+    /**
+     * Hash table of the typeid names. Each slot holds the unique identifier + 1 of an item (0 if empty).
+     */
+    uint32 *typeIdNameIndex;
+
+    /**
+     * Number of slots of the hash tables (a power of 2).
+     */
+    uint32 indexCapacity;
 };
 
 }
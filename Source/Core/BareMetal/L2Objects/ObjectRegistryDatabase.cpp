@@ -32,9 +32,11 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ErrorType.h"
+#include "Fnv1aHashFunction.h"
 #include "ObjectRegistryDatabase.h"
 #include "ReferenceContainerFilterObjectName.h"
 #include "ReferenceContainerFilterReferences.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -58,6 +60,12 @@ ObjectRegistryDatabase *ObjectRegistryDatabase::Instance() {
 
 ObjectRegistryDatabase::ObjectRegistryDatabase() :
         ReferenceContainer() {
+    cacheMux.Create();
+    for (uint32 i = 0u; i < OBJECT_REGISTRY_DATABASE_CACHE_SIZE; i++) {
+        cache[i].path[0] = '\0';
+        cache[i].depth = 0u;
+        cache[i].object = NULL_PTR(Object *);
+    }
 }
 
 /*lint -e{1551} Guarantees that all the nodes are cleared before destroying the application.*/
@@ -110,13 +118,10 @@ Reference ObjectRegistryDatabase::Find(const char8 * const path,
     // now search from the domain forward
     Reference ret;
     if (ok) {
-        ReferenceContainerFilterObjectName filterName(1, ReferenceContainerFilterMode::SHALLOW, &path[backSteps]);
-        ReferenceContainer resultSingle;
-
         if (isSearchDomain) {
             if (domain.IsValid()) {
                 // already safe
-                domain->Find(resultSingle, filterName);
+                ret = domain->Find(&path[backSteps], false);
             }
             else {
                 REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Find: Invalid domain");
@@ -124,14 +129,96 @@ Reference ObjectRegistryDatabase::Find(const char8 * const path,
         }
         else {
             // search from the beginning
-            ReferenceContainer::Find(resultSingle, filterName);
+            const char8 * const absolutePath = &path[backSteps];
+            if (path != NULL) {
+                Fnv1aHashFunction hashFunction;
+                uint32 hash = hashFunction.Compute(absolutePath);
+                ret = FindCached(absolutePath, hash);
+                if (!ret.IsValid()) {
+                    ret = FindAndCache(absolutePath, hash);
+                }
+            }
+            if (!ret.IsValid()) {
+                ReferenceContainerFilterObjectName filterName(1, ReferenceContainerFilterMode::SHALLOW, absolutePath);
+                ReferenceContainer resultSingle;
+                ReferenceContainer::Find(resultSingle, filterName);
+                ok = (resultSingle.Size() > 0u);
+                if (ok) {
+                    //Invalidate move to leafs
+                    ret = resultSingle.Get(resultSingle.Size() - 1u);
+                }
+            }
         }
+    }
+    return ret;
+}
 
-        ok = (resultSingle.Size() > 0u);
+Reference ObjectRegistryDatabase::FindCached(const char8 * const path,
+                                             const uint32 hash) {
+    Reference ret;
+    ObjectRegistryDatabaseCacheEntry entry;
+    bool ok = (cacheMux.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        const ObjectRegistryDatabaseCacheEntry &cached = cache[hash % OBJECT_REGISTRY_DATABASE_CACHE_SIZE];
+        ok = (StringHelper::Compare(&cached.path[0], path) == 0);
+        if (ok) {
+            entry = cached;
+        }
+    }
+    cacheMux.FastUnLock();
+    if (ok) {
+        ok = (entry.depth > 0u);
+    }
+    if (ok) {
+        ok = (entry.containers[0] == this);
+    }
+    //Check top-down that no container in the path was modified. A container is only accessed after checking,
+    //with its parent locked, that the parent still holds it (from then on it is kept alive by the holder reference).
+    Reference holder;
+    for (uint32 i = 0u; (i < entry.depth) && (ok); i++) {
+        ReferenceContainer *container = entry.containers[i];
+        Reference nextHolder;
+        ok = container->Lock();
         if (ok) {
-            //Invalidate move to leafs
-            ret = resultSingle.Get(resultSingle.Size() - 1u);
+            ok = (container->GetGeneration() == entry.generations[i]);
+        }
+        if (ok) {
+            if ((i + 1u) < entry.depth) {
+                nextHolder = entry.containers[i + 1u];
+            }
+            else {
+                ret = entry.object;
+            }
+        }
+        container->UnLock();
+        holder = nextHolder;
+    }
+    return ret;
+}
+
+Reference ObjectRegistryDatabase::FindAndCache(const char8 * const path,
+                                               const uint32 hash) {
+    ObjectRegistryDatabaseCacheEntry entry;
+    Reference ret = FindChildPath(path, &entry.containers[0], &entry.generations[0], OBJECT_REGISTRY_DATABASE_CACHE_MAX_DEPTH, entry.depth);
+    bool ok = ret.IsValid();
+    if (ok) {
+        ok = (entry.depth <= OBJECT_REGISTRY_DATABASE_CACHE_MAX_DEPTH);
+    }
+    if (ok) {
+        ok = (StringHelper::Length(path) < OBJECT_REGISTRY_DATABASE_CACHE_MAX_PATH_SIZE);
+    }
+    if (ok) {
+        ok = (cacheMux.FastLock() == ErrorManagement::NoError);
+        if (ok) {
+            ObjectRegistryDatabaseCacheEntry &cached = cache[hash % OBJECT_REGISTRY_DATABASE_CACHE_SIZE];
+            cached = entry;
+            cached.object = ret.operator->();
+            ok = StringHelper::Copy(&cached.path[0], path);
+            if (!ok) {
+                cached.path[0] = '\0';
+            }
         }
+        cacheMux.FastUnLock();
     }
     return ret;
 }
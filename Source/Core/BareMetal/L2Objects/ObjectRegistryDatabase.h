@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "NonRealTimeMutexSem.h"
 #include "ReferenceContainer.h"
 #include "ReferenceT.h"
 
@@ -41,8 +42,58 @@
 
 namespace MARTe {
 
+/**
+ * Number of entries of the ObjectRegistryDatabase path cache.
+ */
+const uint32 OBJECT_REGISTRY_DATABASE_CACHE_SIZE = 64u;
+
+/**
+ * Maximum number of nodes of the paths stored in the ObjectRegistryDatabase path cache.
+ */
+const uint32 OBJECT_REGISTRY_DATABASE_CACHE_MAX_DEPTH = 8u;
+
+/**
+ * Maximum length (including the terminator) of the paths stored in the ObjectRegistryDatabase path cache.
+ */
+const uint32 OBJECT_REGISTRY_DATABASE_CACHE_MAX_PATH_SIZE = 128u;
+
+/**
+ * @brief Entry of the ObjectRegistryDatabase path cache.
+ */
+struct ObjectRegistryDatabaseCacheEntry {
+    /**
+     * The path (empty if the entry is not used).
+     */
+    char8 path[OBJECT_REGISTRY_DATABASE_CACHE_MAX_PATH_SIZE];
+
+    /**
+     * Number of containers walked to reach the object.
+     */
+    uint32 depth;
+
+    /**
+     * The containers walked to reach the object (the first is the ObjectRegistryDatabase).
+     */
+    ReferenceContainer *containers[OBJECT_REGISTRY_DATABASE_CACHE_MAX_DEPTH];
+
+    /**
+     * The ReferenceContainer::GetGeneration of each of the containers when the path was walked.
+     */
+    uint32 generations[OBJECT_REGISTRY_DATABASE_CACHE_MAX_DEPTH];
+
+    /**
+     * The object found at the end of the path.
+     */
+    Object *object;
+};
+
 /**
  * @brief Singleton database of References to MARTe Objects.
+ * @details The absolute paths resolved by Find are remembered in a direct-mapped cache together with the
+ * containers that were walked and their ReferenceContainer::GetGeneration. A cached path is only used if
+ * none of these containers was modified since (the check starts from the database, so that a container is
+ * never accessed if its parent has changed). As for the ReferenceContainer name index, Objects shall not be
+ * renamed after being inserted in the database.
  */
 class DLL_API ObjectRegistryDatabase: public ReferenceContainer, public GlobalObjectI {
 
@@ -101,6 +152,34 @@ private:
     /*lint -e{1704} private constructor for singleton implementation*/
     ObjectRegistryDatabase();
 
+    /**
+     * @brief Looks for \a path in the cache.
+     * @param[in] path the absolute path of the object.
+     * @param[in] hash the hash of \a path.
+     * @return the cached object or an invalid reference if \a path is not cached or if the cached entry is no longer valid.
+     */
+    Reference FindCached(const char8 * const path,
+                         const uint32 hash);
+
+    /**
+     * @brief Resolves \a path with ReferenceContainer::FindChildPath and stores the result in the cache.
+     * @param[in] path the absolute path of the object.
+     * @param[in] hash the hash of \a path.
+     * @return the object or an invalid reference if the path could not be walked.
+     */
+    Reference FindAndCache(const char8 * const path,
+                           const uint32 hash);
+
+    /**
+     * The path cache.
+     */
+    ObjectRegistryDatabaseCacheEntry cache[OBJECT_REGISTRY_DATABASE_CACHE_SIZE];
+
+    /**
+     * Protects the path cache.
+     */
+    NonRealTimeMutexSem cacheMux;
+
 };
 
 }
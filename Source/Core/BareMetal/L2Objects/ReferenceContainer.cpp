@@ -59,10 +59,12 @@ ReferenceContainer::ReferenceContainer() :
         Object() {
     mux.Create();
     muxTimeout = TTInfiniteWait;
+    generation = 0u;
 }
 
 ReferenceContainer::ReferenceContainer(ReferenceContainer &copy) :
         Object(copy) {
+    generation = 0u;
     SetTimeout(copy.GetTimeout());
     uint32 nChildren = copy.Size();
     for (uint32 i = 0u; i < nChildren; i++) {
@@ -137,6 +139,10 @@ bool ReferenceContainer::Insert(Reference ref, const int32 &position) {
             else {
                 list.ListInsert(newItem, static_cast<uint32>(position));
             }
+            if (!nameIndex.Add(newItem)) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "ReferenceContainer: Failed to index the element name. Falling back to linear search.");
+            }
+            generation++;
         }
         else {
             delete newItem;
@@ -170,13 +176,8 @@ bool ReferenceContainer::Insert(const char8 * const path, Reference ref) {
                 ok = (StringHelper::Length(token) > 0u);
                 if (ok) {
                     //Check if a node with this name already exists
-                    bool found = false;
-                    Reference foundReference;
-                    uint32 i;
-                    for (i = 0u; (i < currentNode->Size()) && (!found); i++) {
-                        foundReference = currentNode->Get(i);
-                        found = (StringHelper::Compare(foundReference->GetName(), token) == 0);
-                    }
+                    Reference foundReference = currentNode->FindChild(token, StringHelper::Length(token));
+                    bool found = foundReference.IsValid();
                     // take the next token
 
                     next = StringHelper::TokenizeByChars(toTokenize, ".", nextToken);
@@ -253,15 +254,20 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
     bool ok = Lock();
     if (ok) {
         if (list.ListSize() > 0u) {
+            ReferenceContainerNode *currentNode = list.List();
             if (filter.IsReverse()) {
                 index = static_cast<int32>(list.ListSize()) - 1;
+                currentNode = list.ListPeek(static_cast<uint32>(index));
             }
 
             //The filter will be finished when the correct occurrence has been found (otherwise it will walk all the list)
-            //lint -e{9007} no side-effects on the right of the && operator
-            while ((!filter.IsFinished()) && ((filter.IsReverse() && (index > -1)) || ((!filter.IsReverse()) && (index < static_cast<int32>(list.ListSize()))))) {
+            //The forward walk follows the node links (ListPeek is O(index)). The index is still tracked to resume
+            //the walk if the list is modified while unlocked (i.e. while branching into a sub-container).
+            while ((!filter.IsFinished()) && (currentNode != NULL)) {
 
-                ReferenceContainerNode *currentNode = (list.ListPeek(static_cast<uint32>(index)));
+                ReferenceContainerNode *nextNode = static_cast<ReferenceContainerNode *>(currentNode->Next());
+                ReferenceContainerNode *removedNode = NULL_PTR(ReferenceContainerNode *);
+                bool listChanged = false;
                 Reference const & currentNodeReference = currentNode->GetReference();
                 //Check if the current node meets the filter criteria
                 bool found = filter.Test(result, currentNodeReference);
@@ -272,8 +278,11 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                     if (filter.IsSearchAll() || filter.IsFinished()) {
                         if (result.Insert(currentNodeReference)) {
                             if (filter.IsRemove()) {
-                                //Only delete the exact node index
-                                if (list.ListDelete(currentNode)) {
+                                //Only remove the exact node. It is deleted once its reference is no longer needed.
+                                nameIndex.Remove(currentNode);
+                                if (list.ListExtract(currentNode)) {
+                                    removedNode = currentNode;
+                                    generation++;
                                     //Given that the index will be incremented, but we have removed an element, the index should stay in the same position
                                     if (!filter.IsReverse()) {
                                         index--;
@@ -292,6 +301,7 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
 
                 // no other stack waste!!
                 if (filter.IsFinished()) {
+                    delete removedNode;
                     break;
                 }
 
@@ -305,22 +315,22 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                     if (ok) {
                         ReferenceT<ReferenceContainer> currentNodeContainer = currentNodeReference;
                         uint32 sizeBeforeBranching = result.list.ListSize();
+                        uint32 generationBeforeBranching = generation;
                         UnLock();
                         currentNodeContainer->Find(result, filter);
                         if (Lock()) {
+                            listChanged = (generation != generationBeforeBranching);
                             //Recursion was aborted. Remove all the elements from the test results
                             if (!filter.IsRecursive()) {
                                 while (result.list.ListSize() > 0u) {
-                                    LinkedListable *node = result.list.ListExtract(result.list.ListSize() - 1u);
-                                    delete node;
+                                    result.ExtractLast();
                                 }
                             }
                             //Something was found if the result size has changed
                             else if (sizeBeforeBranching == result.list.ListSize()) {
                                 //Nothing found. Remove the stored path (which led to nowhere).
                                 if (filter.IsStorePath()) {
-                                    LinkedListable *node = result.list.ListExtract(result.list.ListSize() - 1u);
-                                    delete node;
+                                    result.ExtractLast();
                                 }
                             }
                             else {
@@ -334,12 +344,23 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed StaticList::Insert()");
                     }
                 }
+                delete removedNode;
                 if (!filter.IsReverse()) {
                     index++;
                 }
                 else {
                     index--;
                 }
+                //lint -e{9007} no side-effects on the right of the || operator
+                if ((filter.IsReverse()) || (listChanged)) {
+                    currentNode = NULL_PTR(ReferenceContainerNode *);
+                    if ((index > -1) && (index < static_cast<int32>(list.ListSize()))) {
+                        currentNode = list.ListPeek(static_cast<uint32>(index));
+                    }
+                }
+                else {
+                    currentNode = nextNode;
+                }
             }
         }
     }
@@ -352,19 +373,131 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
 
 Reference ReferenceContainer::Find(const char8 * const path, const bool recursive) {
     Reference ret;
-    uint32 mode = ReferenceContainerFilterMode::SHALLOW;
-    if (recursive) {
-        mode = ReferenceContainerFilterMode::RECURSIVE;
+    if (!recursive) {
+        uint32 depth = 0u;
+        ret = FindChildPath(path, NULL_PTR(ReferenceContainer **), NULL_PTR(uint32 *), 0u, depth);
+    }
+    if (!ret.IsValid()) {
+        uint32 mode = ReferenceContainerFilterMode::SHALLOW;
+        if (recursive) {
+            mode = ReferenceContainerFilterMode::RECURSIVE;
+        }
+        ReferenceContainerFilterObjectName filter(1, mode, path);
+        ReferenceContainer resultSingle;
+        Find(resultSingle, filter);
+        if (resultSingle.Size() > 0u) {
+            ret = resultSingle.Get(resultSingle.Size() - 1u);
+        }
+    }
+    return ret;
+}
+
+Reference ReferenceContainer::FindChild(const char8 * const name,
+                                        const uint32 nameLength) {
+    uint32 currentGeneration = 0u;
+    return FindChild(name, nameLength, currentGeneration);
+}
+
+Reference ReferenceContainer::FindChild(const char8 * const name,
+                                        const uint32 nameLength,
+                                        uint32 &currentGeneration) {
+    Reference ret;
+    if (Lock()) {
+        currentGeneration = generation;
+        if ((!nameIndex.IsBuilt()) && (list.ListSize() >= REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD)) {
+            if (!nameIndex.Build(list.List())) {
+                nameIndex.Reset();
+            }
+        }
+        ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+        uint32 numberOfMatches = 0u;
+        if (nameIndex.IsBuilt()) {
+            numberOfMatches = nameIndex.Find(name, nameLength, node);
+        }
+        //The first of many elements with the same name can only be known from the list order.
+        //Misses are also confirmed in the list, given that an Object may have been renamed after being indexed.
+        if (numberOfMatches != 1u) {
+            node = list.List();
+            while ((node != NULL) && (!ReferenceContainerNameIndex::IsNamed(node, name, nameLength))) {
+                node = static_cast<ReferenceContainerNode *>(node->Next());
+            }
+        }
+        if (node != NULL) {
+            ret = node->GetReference();
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed FastLock()");
+    }
+    UnLock();
+    return ret;
+}
+
+Reference ReferenceContainer::FindChildPath(const char8 * const path,
+                                            ReferenceContainer ** const containers,
+                                            uint32 * const generations,
+                                            const uint32 maxDepth,
+                                            uint32 &depth) {
+    Reference ret;
+    depth = 0u;
+    bool ok = (path != NULL);
+    if (ok) {
+        //Leading dots and empty paths are left to the ReferenceContainerFilterObjectName
+        ok = ((path[0] != '\0') && (path[0] != '.'));
     }
-    ReferenceContainerFilterObjectName filter(1, mode, path);
-    ReferenceContainer resultSingle;
-    Find(resultSingle, filter);
-    if (resultSingle.Size() > 0u) {
-        ret = resultSingle.Get(resultSingle.Size() - 1u);
+    ReferenceContainer *currentContainer = this;
+    //Keeps the container being searched alive
+    Reference currentReference;
+    uint32 start = 0u;
+    while (ok) {
+        uint32 end = start;
+        while ((path[end] != '\0') && (path[end] != '.')) {
+            end++;
+        }
+        ok = (end > start);
+        if ((ok) && (path[end] == '.')) {
+            //Trailing and consecutive dots are left to the ReferenceContainerFilterObjectName
+            ok = (path[end + 1u] != '\0');
+        }
+        if (ok) {
+            uint32 currentGeneration = 0u;
+            Reference child = currentContainer->FindChild(&path[start], end - start, currentGeneration);
+            if (depth < maxDepth) {
+                if (containers != NULL) {
+                    containers[depth] = currentContainer;
+                }
+                if (generations != NULL) {
+                    generations[depth] = currentGeneration;
+                }
+            }
+            depth++;
+            ok = child.IsValid();
+            if (ok) {
+                if (path[end] == '\0') {
+                    ret = child;
+                    break;
+                }
+                currentContainer = dynamic_cast<ReferenceContainer *>(child.operator->());
+                ok = (currentContainer != NULL);
+                currentReference = child;
+                start = end + 1u;
+            }
+        }
     }
     return ret;
 }
 
+uint32 ReferenceContainer::GetGeneration() const {
+    return generation;
+}
+
+void ReferenceContainer::ExtractLast() {
+    ReferenceContainerNode *node = list.ListExtract(list.ListSize() - 1u);
+    nameIndex.Remove(node);
+    generation++;
+    delete node;
+}
+
 uint32 ReferenceContainer::Size() {
     uint32 size = 0u;
     if (Lock()) {
@@ -32,11 +32,12 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
-#include "FastPollingMutexSem.h"
+#include "NonRealTimeMutexSem.h"
 #include "LinkedListHolder.h"
 #include "Object.h"
 #include "Reference.h"
 #include "ReferenceContainerFilter.h"
+#include "ReferenceContainerNameIndex.h"
 #include "ReferenceContainerNode.h"
 #include "TimeoutType.h"
 
@@ -50,11 +51,22 @@ namespace MARTe {
  * lint -esym(551, MARTe::REFERENCE_CONTAINER_NUMBER_OF_TOKENS) the symbol is used to define the size of the token arrays
  */
 const uint32 REFERENCE_CONTAINER_NUMBER_OF_TOKENS = 5u;
+/**
+ * Number of elements from which a ReferenceContainer indexes the names of its elements (see ReferenceContainer::FindChild).
+ */
+const uint32 REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD = 8u;
 /**
  * @brief Container of references.
  * @details One of the basilar classes of the framework. Linear container of references which may also
  * include other containers of references (generating a tree). The access to the container is protected
- * by an internal FastPollingMutexSem whose timeout can be specified.
+ * by an internal NonRealTimeMutexSem whose timeout can be specified.
+ *
+ * The lookup of an element by name (FindChild, Find(path) with recursive = false and Insert(path)) is
+ * accelerated by a hash index of the element names (see ReferenceContainerNameIndex), which is built the first time a
+ * name is searched in a container with at least REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD elements and which is then kept
+ * up to date by Insert and by the removals. The index records the name of the Object when it is inserted: Objects
+ * are expected to be named before being inserted and not to be renamed afterwards. A renamed Object is still found
+ * by its new name (with a linear search), but it may be found after another element with the same name.
  */
 /*lint -e{9109} forward declaration in ReferenceContainerFilter.h is required to define the class*/
 /*lint -e{763} forward declaration in ReferenceContainerFilter.h is required to define the class*/
@@ -146,6 +158,26 @@ ReferenceContainer    ();
      */
     Reference Find(const char8 * const path, const bool recursive=false);
 
+    /**
+     * @brief Finds the first element (not recursively) whose name is equal to \a name.
+     * @details Uses the name index if the container has at least REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD elements.
+     * If more than one element has the same name, the first in the container is returned.
+     * @param[in] name the name of the element to be found (does not have to be zero terminated).
+     * @param[in] nameLength the number of characters of \a name.
+     * @return the element if it is found or an invalid reference if not.
+     */
+    Reference FindChild(const char8 * const name,
+                        const uint32 nameLength);
+
+    /**
+     * @brief Gets the number of modifications of the container.
+     * @details The value is incremented every time an element is inserted or removed. It can be used to detect
+     * that a result previously obtained from the container (e.g. the address of an element) is still valid.
+     * A consistent value is only guaranteed if the container is locked (see Lock).
+     * @return the number of modifications of the container.
+     */
+    uint32 GetGeneration() const;
+
     /**
      * @brief Checks if \a ref holds a container.
      * @param[in] ref the reference to check.
@@ -275,6 +307,26 @@ ReferenceContainer    ();
      */
     static void RemoveDomainToken(char8 token);
 
+protected:
+
+    /**
+     * @brief Finds the element identified by a \a path by searching each node of the path with FindChild.
+     * @details Only paths without leading, trailing or consecutive dots are walked. The result is the same
+     * of the Find(path, false) when the first element found at each level leads to the final node; otherwise
+     * an invalid reference is returned and the caller shall fall back to a Find with a ReferenceContainerFilterObjectName.
+     * @param[in] path the path of the element to be found.
+     * @param[out] containers if not NULL, the containers walked (this first). Up to \a maxDepth are written.
+     * @param[out] generations if not NULL, the GetGeneration of each of the \a containers read before searching its child.
+     * @param[in] maxDepth the size of the \a containers and \a generations arrays.
+     * @param[out] depth the number of containers walked (which may be greater than \a maxDepth).
+     * @return the element if it is found or an invalid reference if not.
+     */
+    Reference FindChildPath(const char8 * const path,
+                            ReferenceContainer ** const containers,
+                            uint32 * const generations,
+                            const uint32 maxDepth,
+                            uint32 &depth);
+
 private:
     /**
      * @brief The tokens that identify in the first character of an Object name, that a new object is to be built.
@@ -309,16 +361,39 @@ private:
      */
     static void RemoveToken(char8 * const tokenList, char8 token);
 
+    /**
+     * @brief @see FindChild(const char8 * const, const uint32)
+     * @param[out] currentGeneration the GetGeneration of the container when the child was searched.
+     */
+    Reference FindChild(const char8 * const name,
+                        const uint32 nameLength,
+                        uint32 &currentGeneration);
+
+    /**
+     * @brief Removes and destroys the last node of the list (without locking).
+     */
+    void ExtractLast();
+
     /**
      * The list of references
      */
     LinkedListHolderT<ReferenceContainerNode> list;
 
+    /**
+     * Index of the names of the elements in the list
+     */
+    ReferenceContainerNameIndex nameIndex;
+
+    /**
+     * Number of modifications of the list
+     */
+    uint32 generation;
+
     
     /**
      * Protects multiple access to the internal resources
      */
-    FastPollingMutexSem mux;
+    NonRealTimeMutexSem mux;
 
     /**
      * Timeout
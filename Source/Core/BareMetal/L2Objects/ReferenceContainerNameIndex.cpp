@@ -0,0 +1,254 @@
+/**
+ * @file ReferenceContainerNameIndex.cpp
+ * @brief Source file for class ReferenceContainerNameIndex
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReferenceContainerNameIndex (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ReferenceContainerNameIndex.h"
+#include "ErrorManagement.h"
+#include "Fnv1aHashFunction.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Number of slots allocated when the index is built.
+ */
+const MARTe::uint32 REFERENCE_CONTAINER_NAME_INDEX_INITIAL_CAPACITY = 16u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ReferenceContainerNameIndex::ReferenceContainerNameIndex() {
+    slots = NULL_PTR(Slot *);
+    capacity = 0u;
+    numberOfEntries = 0u;
+    numberOfUsedSlots = 0u;
+}
+
+ReferenceContainerNameIndex::~ReferenceContainerNameIndex() {
+    Reset();
+}
+
+uint32 ReferenceContainerNameIndex::Hash(const char8 * const name,
+                                         const uint32 nameLength) {
+    Fnv1aHashFunction hashFunction;
+    //Compute(name, 0u) would hash up to the terminator
+    uint32 hash = 0u;
+    if (nameLength > 0u) {
+        hash = hashFunction.Compute(name, nameLength);
+    }
+    return hash;
+}
+
+const char8 *ReferenceContainerNameIndex::GetNodeName(const ReferenceContainerNode * const node) {
+    const char8 *name = NULL_PTR(const char8 *);
+    Reference const &ref = node->GetReference();
+    if (ref.IsValid()) {
+        name = ref->GetName();
+    }
+    return name;
+}
+
+bool ReferenceContainerNameIndex::IsNamed(const ReferenceContainerNode * const node,
+                                          const char8 * const name,
+                                          const uint32 nameLength) {
+    const char8 *nodeName = GetNodeName(node);
+    bool equal = (nodeName != NULL);
+    if (equal) {
+        equal = (StringHelper::CompareN(nodeName, name, nameLength) == 0);
+    }
+    if (equal) {
+        equal = (nodeName[nameLength] == '\0');
+    }
+    return equal;
+}
+
+bool ReferenceContainerNameIndex::Build(ReferenceContainerNode * const firstNode) {
+    Reset();
+    bool ok = Rehash(REFERENCE_CONTAINER_NAME_INDEX_INITIAL_CAPACITY);
+    ReferenceContainerNode *node = firstNode;
+    while ((node != NULL) && (ok)) {
+        ok = Add(node);
+        node = static_cast<ReferenceContainerNode *>(node->Next());
+    }
+    return ok;
+}
+
+void ReferenceContainerNameIndex::Reset() {
+    if (slots != NULL) {
+        delete[] slots;
+    }
+    slots = NULL_PTR(Slot *);
+    capacity = 0u;
+    numberOfEntries = 0u;
+    numberOfUsedSlots = 0u;
+}
+
+bool ReferenceContainerNameIndex::IsBuilt() const {
+    return (slots != NULL);
+}
+
+uint32 ReferenceContainerNameIndex::GetNumberOfEntries() const {
+    return numberOfEntries;
+}
+
+void ReferenceContainerNameIndex::Store(ReferenceContainerNode * const node,
+                                        const uint32 hash) {
+    uint32 mask = capacity - 1u;
+    uint32 i = hash & mask;
+    while (slots[i].node != NULL) {
+        i = (i + 1u) & mask;
+    }
+    if (!slots[i].removed) {
+        numberOfUsedSlots++;
+    }
+    slots[i].node = node;
+    slots[i].hash = hash;
+    slots[i].removed = false;
+    numberOfEntries++;
+}
+
+bool ReferenceContainerNameIndex::Rehash(const uint32 newCapacity) {
+    Slot *oldSlots = slots;
+    uint32 oldCapacity = capacity;
+    slots = new Slot[newCapacity];
+    bool ok = (slots != NULL);
+    if (ok) {
+        capacity = newCapacity;
+        numberOfEntries = 0u;
+        numberOfUsedSlots = 0u;
+        for (uint32 i = 0u; i < capacity; i++) {
+            slots[i].node = NULL_PTR(ReferenceContainerNode *);
+            slots[i].hash = 0u;
+            slots[i].removed = false;
+        }
+        for (uint32 i = 0u; i < oldCapacity; i++) {
+            if (oldSlots[i].node != NULL) {
+                Store(oldSlots[i].node, oldSlots[i].hash);
+            }
+        }
+    }
+    else {
+        slots = oldSlots;
+    }
+    if ((ok) && (oldSlots != NULL)) {
+        delete[] oldSlots;
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndex::Add(ReferenceContainerNode * const node) {
+    bool ok = true;
+    if ((IsBuilt()) && (node != NULL)) {
+        const char8 *name = GetNodeName(node);
+        if (name != NULL) {
+            //Keep the load factor (including the removed slots) below 3/4
+            if (((numberOfUsedSlots + 1u) * 4u) > (capacity * 3u)) {
+                uint32 newCapacity = capacity;
+                //Only grow if the table is not mostly filled with removed slots
+                if (((numberOfEntries + 1u) * 2u) > capacity) {
+                    newCapacity *= 2u;
+                }
+                ok = Rehash(newCapacity);
+            }
+            if (ok) {
+                Store(node, Hash(name, StringHelper::Length(name)));
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainerNameIndex: Failed to grow the table");
+                Reset();
+            }
+        }
+    }
+    return ok;
+}
+
+void ReferenceContainerNameIndex::Remove(const ReferenceContainerNode * const node) {
+    if ((IsBuilt()) && (node != NULL)) {
+        uint32 mask = capacity - 1u;
+        bool found = false;
+        uint32 i = 0u;
+        const char8 *name = GetNodeName(node);
+        if (name != NULL) {
+            //Follow the probing sequence of the current name
+            i = Hash(name, StringHelper::Length(name)) & mask;
+            while ((!found) && ((slots[i].node != NULL) || (slots[i].removed))) {
+                found = (slots[i].node == node);
+                if (!found) {
+                    i = (i + 1u) & mask;
+                }
+            }
+        }
+        //The Object might have been renamed after being indexed
+        for (uint32 j = 0u; (j < capacity) && (!found); j++) {
+            found = (slots[j].node == node);
+            if (found) {
+                i = j;
+            }
+        }
+        if (found) {
+            slots[i].node = NULL_PTR(ReferenceContainerNode *);
+            slots[i].removed = true;
+            numberOfEntries--;
+        }
+    }
+}
+
+uint32 ReferenceContainerNameIndex::Find(const char8 * const name,
+                                         const uint32 nameLength,
+                                         ReferenceContainerNode *&node) const {
+    uint32 numberOfMatches = 0u;
+    node = NULL_PTR(ReferenceContainerNode *);
+    if ((IsBuilt()) && (name != NULL)) {
+        uint32 mask = capacity - 1u;
+        uint32 hash = Hash(name, nameLength);
+        uint32 i = hash & mask;
+        uint32 probed = 0u;
+        while (((slots[i].node != NULL) || (slots[i].removed)) && (probed < capacity)) {
+            if ((slots[i].node != NULL) && (slots[i].hash == hash)) {
+                if (IsNamed(slots[i].node, name, nameLength)) {
+                    node = slots[i].node;
+                    numberOfMatches++;
+                }
+            }
+            i = (i + 1u) & mask;
+            probed++;
+        }
+    }
+    return numberOfMatches;
+}
+
+}
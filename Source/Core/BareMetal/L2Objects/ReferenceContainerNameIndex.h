@@ -0,0 +1,222 @@
+/**
+ * @file ReferenceContainerNameIndex.h
+ * @brief Header file for class ReferenceContainerNameIndex
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReferenceContainerNameIndex
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REFERENCECONTAINERNAMEINDEX_H_
+#define REFERENCECONTAINERNAMEINDEX_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ReferenceContainerNode.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Open addressing hash table that maps the names of the elements of a
+ * ReferenceContainer to the ReferenceContainerNode holding them.
+ * @details The names are hashed with the Fnv1aHashFunction and collisions are resolved
+ * with linear probing. Removed entries are marked (and not emptied) so that the probing
+ * sequence of the entries inserted afterwards is not broken; the table is rehashed when
+ * the used slots (including the removed ones) exceed 3/4 of its capacity.
+ *
+ * The hash of each node is computed when the node is added. Renaming an Object after
+ * it was inserted in a container is thus not tracked by the index, which is why Find
+ * always verifies the current name of the candidate nodes and why the ReferenceContainer
+ * falls back to a linear search when Find does not return exactly one node.
+ *
+ * This class is not thread-safe: the owning ReferenceContainer shall hold its lock
+ * while calling any of the methods.
+ */
+class DLL_API ReferenceContainerNameIndex {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   !IsBuilt()
+     */
+    ReferenceContainerNameIndex();
+
+    /**
+     * @brief Destructor. Frees the table.
+     */
+    ~ReferenceContainerNameIndex();
+
+    /**
+     * @brief Indexes all the nodes of a list.
+     * @param[in] firstNode the head of the list of nodes to be indexed.
+     * @return true if the table could be allocated.
+     * @post
+     *   IsBuilt()
+     */
+    bool Build(ReferenceContainerNode * const firstNode);
+
+    /**
+     * @brief Frees the table.
+     * @post
+     *   !IsBuilt()
+     */
+    void Reset();
+
+    /**
+     * @brief Checks if the index was built.
+     * @return true if Build was successfully called and Reset was not called since.
+     */
+    bool IsBuilt() const;
+
+    /**
+     * @brief Adds a node to the index.
+     * @details Nodes holding an invalid Reference or an Object without name are not indexed.
+     * Does nothing if the index is not built.
+     * @param[in] node the node to be added.
+     * @return false if the table could not be grown (in which case the index is Reset).
+     */
+    bool Add(ReferenceContainerNode * const node);
+
+    /**
+     * @brief Removes a node from the index.
+     * @details Does nothing if the index is not built or if the \a node is not indexed.
+     * @param[in] node the node to be removed.
+     */
+    void Remove(const ReferenceContainerNode * const node);
+
+    /**
+     * @brief Finds the nodes whose Object name is equal to \a name.
+     * @param[in] name the name to search (does not have to be zero terminated).
+     * @param[in] nameLength the number of characters of \a name.
+     * @param[out] node the last node found (NULL if none).
+     * @return the number of indexed nodes named \a name.
+     */
+    uint32 Find(const char8 * const name,
+                const uint32 nameLength,
+                ReferenceContainerNode *&node) const;
+
+    /**
+     * @brief Gets the number of indexed nodes.
+     * @return the number of indexed nodes.
+     */
+    uint32 GetNumberOfEntries() const;
+
+    /**
+     * @brief Checks if the Object held by \a node is named \a name.
+     * @param[in] node the node to check.
+     * @param[in] name the name to compare (does not have to be zero terminated).
+     * @param[in] nameLength the number of characters of \a name.
+     * @return true if \a node holds a valid Reference to an Object named \a name.
+     */
+    static bool IsNamed(const ReferenceContainerNode * const node,
+                        const char8 * const name,
+                        const uint32 nameLength);
+
+private:
+
+    /**
+     * A slot of the table.
+     */
+    struct Slot {
+        /**
+         * The indexed node (NULL if the slot is empty or removed).
+         */
+        ReferenceContainerNode *node;
+
+        /**
+         * The hash of the node name.
+         */
+        uint32 hash;
+
+        /**
+         * true if the node was removed from this slot.
+         */
+        bool removed;
+    };
+
+    /**
+     * @brief Disallow the copy (the table is owned by the index).
+     */
+    ReferenceContainerNameIndex(const ReferenceContainerNameIndex &other);
+
+    /**
+     * @brief Disallow the copy (the table is owned by the index).
+     */
+    ReferenceContainerNameIndex &operator=(const ReferenceContainerNameIndex &other);
+
+    /**
+     * @brief Computes the hash of a name.
+     */
+    static uint32 Hash(const char8 * const name,
+                       const uint32 nameLength);
+
+    /**
+     * @brief Gets the name of the Object held by a node.
+     * @return the name or NULL if the node holds an invalid Reference.
+     */
+    static const char8 *GetNodeName(const ReferenceContainerNode * const node);
+
+    /**
+     * @brief Stores a node in the first free slot of its probing sequence.
+     */
+    void Store(ReferenceContainerNode * const node,
+               const uint32 hash);
+
+    /**
+     * @brief Reallocates the table with \a newCapacity slots and stores all the indexed nodes.
+     * @return true if the table could be allocated.
+     */
+    bool Rehash(const uint32 newCapacity);
+
+    /**
+     * The table.
+     */
+    Slot *slots;
+
+    /**
+     * The number of slots (a power of 2).
+     */
+    uint32 capacity;
+
+    /**
+     * The number of indexed nodes.
+     */
+    uint32 numberOfEntries;
+
+    /**
+     * The number of slots that are either used or marked as removed.
+     */
+    uint32 numberOfUsedSlots;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REFERENCECONTAINERNAMEINDEX_H_ */
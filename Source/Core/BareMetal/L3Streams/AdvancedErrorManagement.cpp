@@ -0,0 +1,83 @@
+/**
+ * @file AdvancedErrorManagement.cpp
+ * @brief Source file for class AdvancedErrorManagement
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the ReportErrorFormatted function,
+ * used by the REPORT_ERROR macros to report messages with parameters.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace ErrorManagement {
+
+void ReportErrorFormatted(const ErrorType &code,
+                          const char8 * const clsName,
+                          const char8 * const objName,
+                          const void * const objPtr,
+                          const char8 * const fileName,
+                          const int16 lineNumber,
+                          const char8 * const functionName,
+                          const char8 * const format,
+                          const AnyType * const parameters,
+                          const uint32 numberOfParameters) {
+    bool done = false;
+    if (deferredErrorProcessFunction != static_cast<DeferredErrorProcessFunctionType>(NULL)) {
+        ErrorInformation errorInfo;
+        errorInfo.header.errorType = code;
+        errorInfo.header.lineNumber = lineNumber;
+        errorInfo.header.isObject = (objPtr != static_cast<const char8 *>(NULL));
+        errorInfo.className = clsName;
+        errorInfo.objectName = objName;
+        errorInfo.objectPointer = objPtr;
+        errorInfo.fileName = fileName;
+        errorInfo.functionName = functionName;
+        errorInfo.hrtTime = HighResolutionTimer::Counter();
+        errorInfo.timeSeconds = Sleep::GetDateSeconds();
+        done = deferredErrorProcessFunction(errorInfo, format, parameters, numberOfParameters);
+    }
+    if (!done) {
+        char8 buffer[MAX_ERROR_MESSAGE_SIZE + 1u];
+        StreamMemoryReference smr(&buffer[0], MAX_ERROR_MESSAGE_SIZE);
+        (void) (smr.PrintFormatted(format, parameters));
+        buffer[smr.Size()] = '\0';
+        ReportError(code, &buffer[0], clsName, objName, objPtr, fileName, lineNumber, functionName);
+    }
+}
+
+}
+
+}
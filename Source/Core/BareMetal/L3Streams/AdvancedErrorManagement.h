@@ -46,6 +46,167 @@ namespace MARTe {
  */
 static const uint32 MAX_ERROR_MESSAGE_SIZE = 200u;
 
+namespace ErrorManagement {
+
+/**
+ * @brief Reports an error whose description is still to be formatted with \a format and \a parameters.
+ * @details If a DeferredErrorProcessFunctionType is set (see SetDeferredErrorProcessFunction) and it accepts the message, the
+ * formatting is left to whoever consumes the stored message (e.g. the LoggerService thread). Otherwise the message is formatted
+ * immediately (up to MAX_ERROR_MESSAGE_SIZE characters) and reported with ReportError.
+ * @param[in] code is the error code.
+ * @param[in] clsName is the name of the class (if relevant).
+ * @param[in] objName is the name of the Object (if relevant).
+ * @param[in] objPtr is the address of the Object (if relevant).
+ * @param[in] fileName is the file name where the error was triggered.
+ * @param[in] lineNumber is the line number where the error was triggered.
+ * @param[in] functionName is the name of the function where the error is triggered.
+ * @param[in] format is the Printf format of the error description.
+ * @param[in] parameters the Printf parameters, terminated by a void AnyType.
+ * @param[in] numberOfParameters the number of parameters (excluding the terminator).
+ */
+DLL_API void ReportErrorFormatted(const ErrorType &code,
+                                  const char8 * const clsName,
+                                  const char8 * const objName,
+                                  const void * const objPtr,
+                                  const char8 * const fileName,
+                                  const int16 lineNumber,
+                                  const char8 * const functionName,
+                                  const char8 * const format,
+                                  const AnyType * const parameters,
+                                  const uint32 numberOfParameters);
+
+/**
+ * @see ReportErrorFormatted.
+ */
+inline void ReportErrorDeferred(const ErrorType &code,
+                                const char8 * const clsName,
+                                const char8 * const objName,
+                                const void * const objPtr,
+                                const char8 * const fileName,
+                                const int16 lineNumber,
+                                const char8 * const functionName,
+                                const char8 * const format,
+                                const AnyType& par1);
+
+/**
+ * @see ReportErrorFormatted.
+ */
+inline void ReportErrorDeferred(const ErrorType &code,
+                                const char8 * const clsName,
+                                const char8 * const objName,
+                                const void * const objPtr,
+                                const char8 * const fileName,
+                                const int16 lineNumber,
+                                const char8 * const functionName,
+                                const char8 * const format,
+                                const AnyType& par1, const AnyType& par2);
+
+/**
+ * @see ReportErrorFormatted.
+ */
+inline void ReportErrorDeferred(const ErrorType &code,
+                                const char8 * const clsName,
+                                const char8 * const objName,
+                                const void * const objPtr,
+                                const char8 * const fileName,
+                                const int16 lineNumber,
+                                const char8 * const functionName,
+                                const char8 * const format,
+                                const AnyType& par1, const AnyType& par2, const AnyType& par3);
+
+/**
+ * @see ReportErrorFormatted.
+ */
+inline void ReportErrorDeferred(const ErrorType &code,
+                                const char8 * const clsName,
+                                const char8 * const objName,
+                                const void * const objPtr,
+                                const char8 * const fileName,
+                                const int16 lineNumber,
+                                const char8 * const functionName,
+                                const char8 * const format,
+                                const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4);
+
+/**
+ * @see ReportErrorFormatted.
+ */
+inline void ReportErrorDeferred(const ErrorType &code,
+                                const char8 * const clsName,
+                                const char8 * const objName,
+                                const void * const objPtr,
+                                const char8 * const fileName,
+                                const int16 lineNumber,
+                                const char8 * const functionName,
+                                const char8 * const format,
+                                const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5);
+
+/**
+ * @see ReportErrorFormatted.
+ */
+inline void ReportErrorDeferred(const ErrorType &code,
+                                const char8 * const clsName,
+                                const char8 * const objName,
+                                const void * const objPtr,
+                                const char8 * const fileName,
+                                const int16 lineNumber,
+                                const char8 * const functionName,
+                                const char8 * const format,
+                                const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6);
+
+/**
+ * @see ReportErrorFormatted.
+ */
+inline void ReportErrorDeferred(const ErrorType &code,
+                                const char8 * const clsName,
+                                const char8 * const objName,
+                                const void * const objPtr,
+                                const char8 * const fileName,
+                                const int16 lineNumber,
+                                const char8 * const functionName,
+                                const char8 * const format,
+                                const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7);
+
+/**
+ * @see ReportErrorFormatted.
+ */
+inline void ReportErrorDeferred(const ErrorType &code,
+                                const char8 * const clsName,
+                                const char8 * const objName,
+                                const void * const objPtr,
+                                const char8 * const fileName,
+                                const int16 lineNumber,
+                                const char8 * const functionName,
+                                const char8 * const format,
+                                const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7, const AnyType& par8);
+
+/**
+ * @see ReportErrorFormatted.
+ */
+inline void ReportErrorDeferred(const ErrorType &code,
+                                const char8 * const clsName,
+                                const char8 * const objName,
+                                const void * const objPtr,
+                                const char8 * const fileName,
+                                const int16 lineNumber,
+                                const char8 * const functionName,
+                                const char8 * const format,
+                                const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7, const AnyType& par8, const AnyType& par9);
+
+/**
+ * @see ReportErrorFormatted.
+ */
+inline void ReportErrorDeferred(const ErrorType &code,
+                                const char8 * const clsName,
+                                const char8 * const objName,
+                                const void * const objPtr,
+                                const char8 * const fileName,
+                                const int16 lineNumber,
+                                const char8 * const functionName,
+                                const char8 * const format,
+                                const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7, const AnyType& par8, const AnyType& par9, const AnyType& par10);
+
+}
+
 /**
  * @brief The REPORT_ERROR_STATIC_U is not to be used. It serves as the one parameter choice for the REPORT_ERROR_STATIC_MACRO_CHOOSER macro.
  */
@@ -64,11 +225,7 @@ do {                                                                        \
 #define REPORT_ERROR_STATIC_PARAMETERS(code, message,...)                              \
 /*lint -save -e717 Let lint know that we know that we are doing while(0)*/             \
 do {                                                                                   \
-    MARTe::char8 buffer[MARTe::MAX_ERROR_MESSAGE_SIZE+1u];                             \
-    MARTe::StreamMemoryReference smr(&buffer[0],MARTe::MAX_ERROR_MESSAGE_SIZE);        \
-    (void) (smr.Printf(reinterpret_cast<const MARTe::char8 *>(message),__VA_ARGS__));  \
-    buffer[smr.Size()]='\0';                                                           \
-    MARTe::ErrorManagement::ReportError(code,&buffer[0], NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+    MARTe::ErrorManagement::ReportErrorDeferred(code, NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__, reinterpret_cast<const MARTe::char8 *>(message),__VA_ARGS__); \
 } while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 
 /**
@@ -118,16 +275,12 @@ do {                                                                        \
 #define REPORT_ERROR_PARAMETERS(code, message,...)                                     \
 /*lint -save -e717 Let lint know that we know that we are doing while(0)*/             \
 do {                                                                                   \
-    MARTe::char8 buffer[MARTe::MAX_ERROR_MESSAGE_SIZE+1u];                             \
-    MARTe::StreamMemoryReference smr(&buffer[0],MARTe::MAX_ERROR_MESSAGE_SIZE);        \
-    (void) (smr.Printf(reinterpret_cast<const MARTe::char8 *>(message),__VA_ARGS__));  \
-    buffer[smr.Size()]='\0';                                                           \
     const MARTe::char8 *pClassName = "Unknown";                                        \
     const MARTe::ClassProperties *cProperties = GetClassProperties();                  \
     if (cProperties != NULL_PTR(const MARTe::ClassProperties *)) {                     \
         pClassName = cProperties->GetName();                                           \
     }                                                                                  \
-    MARTe::ErrorManagement::ReportError(code, &buffer[0], pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+    MARTe::ErrorManagement::ReportErrorDeferred(code, pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__, reinterpret_cast<const MARTe::char8 *>(message),__VA_ARGS__); \
 } while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 
 /**
@@ -177,16 +330,12 @@ do {                                                                        \
 #define REPORT_ERROR_PROXY_PARAMETERS(code, ref, message, ...)                          \
 /*lint -save -e717 Let lint know that we know that we are doing while(0)*/             \
 do {                                                                                   \
-    MARTe::char8 buffer[MARTe::MAX_ERROR_MESSAGE_SIZE+1u];                             \
-    MARTe::StreamMemoryReference smr(&buffer[0],MARTe::MAX_ERROR_MESSAGE_SIZE);        \
-    (void) (smr.Printf(reinterpret_cast<const MARTe::char8 *>(message),__VA_ARGS__));  \
-    buffer[smr.Size()]='\0';                                                           \
     const MARTe::char8 *pClassName = "Unknown";                                        \
     const MARTe::ClassProperties *cProperties = ref->GetClassProperties();             \
     if (cProperties != NULL_PTR(const MARTe::ClassProperties *)) {                     \
         pClassName = cProperties->GetName();                                           \
     }                                                                                  \
-    MARTe::ErrorManagement::ReportError(code, &buffer[0], pClassName, ref->GetName(), this, __FILE__, __LINE__,__ERROR_FUNCTION_NAME__); \
+    MARTe::ErrorManagement::ReportErrorDeferred(code, pClassName, ref->GetName(), this, __FILE__, __LINE__,__ERROR_FUNCTION_NAME__, reinterpret_cast<const MARTe::char8 *>(message),__VA_ARGS__); \
 } while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 
 /**
@@ -208,5 +357,142 @@ do {
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace ErrorManagement {
+
+void ReportErrorDeferred(const ErrorType &code,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const char8 * const format,
+                         const AnyType& par1) {
+    AnyType pars[2] = { par1, voidAnyType };
+    ReportErrorFormatted(code, clsName, objName, objPtr, fileName, lineNumber, functionName, format, &pars[0], 1u);
+}
+
+void ReportErrorDeferred(const ErrorType &code,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const char8 * const format,
+                         const AnyType& par1, const AnyType& par2) {
+    AnyType pars[3] = { par1, par2, voidAnyType };
+    ReportErrorFormatted(code, clsName, objName, objPtr, fileName, lineNumber, functionName, format, &pars[0], 2u);
+}
+
+void ReportErrorDeferred(const ErrorType &code,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const char8 * const format,
+                         const AnyType& par1, const AnyType& par2, const AnyType& par3) {
+    AnyType pars[4] = { par1, par2, par3, voidAnyType };
+    ReportErrorFormatted(code, clsName, objName, objPtr, fileName, lineNumber, functionName, format, &pars[0], 3u);
+}
+
+void ReportErrorDeferred(const ErrorType &code,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const char8 * const format,
+                         const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4) {
+    AnyType pars[5] = { par1, par2, par3, par4, voidAnyType };
+    ReportErrorFormatted(code, clsName, objName, objPtr, fileName, lineNumber, functionName, format, &pars[0], 4u);
+}
+
+void ReportErrorDeferred(const ErrorType &code,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const char8 * const format,
+                         const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5) {
+    AnyType pars[6] = { par1, par2, par3, par4, par5, voidAnyType };
+    ReportErrorFormatted(code, clsName, objName, objPtr, fileName, lineNumber, functionName, format, &pars[0], 5u);
+}
+
+void ReportErrorDeferred(const ErrorType &code,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const char8 * const format,
+                         const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6) {
+    AnyType pars[7] = { par1, par2, par3, par4, par5, par6, voidAnyType };
+    ReportErrorFormatted(code, clsName, objName, objPtr, fileName, lineNumber, functionName, format, &pars[0], 6u);
+}
+
+void ReportErrorDeferred(const ErrorType &code,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const char8 * const format,
+                         const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7) {
+    AnyType pars[8] = { par1, par2, par3, par4, par5, par6, par7, voidAnyType };
+    ReportErrorFormatted(code, clsName, objName, objPtr, fileName, lineNumber, functionName, format, &pars[0], 7u);
+}
+
+void ReportErrorDeferred(const ErrorType &code,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const char8 * const format,
+                         const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7, const AnyType& par8) {
+    AnyType pars[9] = { par1, par2, par3, par4, par5, par6, par7, par8, voidAnyType };
+    ReportErrorFormatted(code, clsName, objName, objPtr, fileName, lineNumber, functionName, format, &pars[0], 8u);
+}
+
+void ReportErrorDeferred(const ErrorType &code,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const char8 * const format,
+                         const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7, const AnyType& par8, const AnyType& par9) {
+    AnyType pars[10] = { par1, par2, par3, par4, par5, par6, par7, par8, par9, voidAnyType };
+    ReportErrorFormatted(code, clsName, objName, objPtr, fileName, lineNumber, functionName, format, &pars[0], 9u);
+}
+
+void ReportErrorDeferred(const ErrorType &code,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const char8 * const format,
+                         const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7, const AnyType& par8, const AnyType& par9, const AnyType& par10) {
+    AnyType pars[11] = { par1, par2, par3, par4, par5, par6, par7, par8, par9, par10, voidAnyType };
+    ReportErrorFormatted(code, clsName, objName, objPtr, fileName, lineNumber, functionName, format, &pars[0], 10u);
+}
+
+}
+
+}
 
 #endif /* ADVANCEDERRORMANAGEMENT_H_ */
@@ -49,6 +49,7 @@ CharBuffer::CharBuffer() {
     readOnly = true;
     allocated = false;
     allocationGranularityMask = 0xFFFFFFFFu;
+    heap = NULL_PTR(HeapI *);
 }
 
 CharBuffer::CharBuffer(const uint32 allocationGranularity) {
@@ -56,6 +57,7 @@ CharBuffer::CharBuffer(const uint32 allocationGranularity) {
     buffer = NULL_PTR(char8 *);
     readOnly = true;
     allocated = false;
+    heap = NULL_PTR(HeapI *);
 
     {
         uint32 granularity = 1u;
@@ -90,9 +92,16 @@ CharBuffer::CharBuffer(const uint32 allocationGranularity) {
 void CharBuffer::Reset() {
     if (allocated) {
         if (buffer != NULL) {
-            if (HeapManager::Free(reinterpret_cast<void *&>(buffer))) {
+            if (heap != NULL) {
+                heap->Free(reinterpret_cast<void *&>(buffer));
                 bufferSize = 0u;
             }
+            else if (HeapManager::Free(reinterpret_cast<void *&>(buffer))) {
+                bufferSize = 0u;
+            }
+            else {
+                //NOOP
+            }
         }
     }
     bufferSize = 0u;
@@ -136,7 +145,15 @@ bool CharBuffer::SetBufferSize(const uint32 desiredSize) {
         neededMemory -= 1u;
         neededMemory &= allocationGranularityMask;
 
-        if (buffer == NULL) {
+        if (heap != NULL) {
+            if (buffer == NULL) {
+                buffer = static_cast<char8 *>(heap->Malloc(neededMemory));
+            }
+            else {
+                buffer = static_cast<char8 *>(heap->Realloc(reinterpret_cast<void *&>(buffer), neededMemory));
+            }
+        }
+        else if (buffer == NULL) {
             buffer = static_cast<char8 *>(HeapManager::Malloc(neededMemory));
         }
         else {
@@ -157,6 +174,14 @@ bool CharBuffer::SetBufferSize(const uint32 desiredSize) {
     return ok;
 }
 
+bool CharBuffer::SetHeap(HeapI * const heapIn) {
+    bool ok = ((!allocated) || (heapIn == heap));
+    if (ok) {
+        heap = heapIn;
+    }
+    return ok;
+}
+
 void CharBuffer::SetBufferReference(char8 * const buff,
                                     const uint32 buffSize) {
     Reset();
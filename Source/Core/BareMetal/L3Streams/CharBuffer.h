@@ -36,6 +36,7 @@
 #include "GeneralDefinitions.h"
 #include "BitBoolean.h"
 #include "ErrorManagement.h"
+#include "HeapI.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -170,6 +171,22 @@ public:
      */
     uint32 AllocationGranularity() const;
 
+    /**
+     * @brief Sets the heap where SetBufferSize allocates the memory.
+     * @details The heap cannot be changed while the buffer holds memory allocated by this class (as the memory
+     * must be freed by the same heap).
+     * @param[in] heapIn the heap to be used. NULL to use the HeapManager (i.e. the heap which owns the address or the
+     * standard heap).
+     * @return false if IsAllocated() and \a heapIn is not the current heap.
+     */
+    bool SetHeap(HeapI * const heapIn);
+
+    /**
+     * @brief Gets the heap set with SetHeap.
+     * @return the heap set with SetHeap or NULL if the memory is allocated with the HeapManager.
+     */
+    inline HeapI *GetHeap() const;
+
 private:
 
     /**
@@ -200,6 +217,11 @@ private:
     /*lint -sem(MARTe::CharBuffer::Reset,cleanup)*/
     char8 *buffer;
 
+    /**
+     * The heap where the memory is allocated (NULL for the HeapManager).
+     */
+    HeapI *heap;
+
     /**
      * @brief Resets the buffer, releasing any memory previously allocated in
      * the heap if it was allocated by the class itself.
@@ -248,6 +270,10 @@ inline uint32 CharBuffer::AllocationGranularity() const {
     return ((~allocationGranularityMask) + 1u);
 }
 
+inline HeapI *CharBuffer::GetHeap() const {
+    return heap;
+}
+
 }
 
 #endif /* CHAR_BUFFER_H */
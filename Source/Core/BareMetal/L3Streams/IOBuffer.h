@@ -185,6 +185,14 @@ public:
             const uint32 bufferSize,
             const uint32 reservedSpaceAtEnd);
 
+    /**
+     * @brief Sets the heap used by SetBufferHeapMemory.
+     * @param[in] heap the heap to be used (NULL for the HeapManager).
+     * @return false if the buffer already holds memory allocated from a heap.
+     * @see CharBuffer::SetHeap
+     */
+    inline bool SetAllocationHeap(HeapI * const heap);
+
     /*---------------------------------------------------------------------------*/
 
     /**
@@ -565,6 +573,10 @@ uint32 IOBuffer::AllocationGranularity() const {
     return internalBuffer.AllocationGranularity();
 }
 
+bool IOBuffer::SetAllocationHeap(HeapI * const heap) {
+    return internalBuffer.SetHeap(heap);
+}
+
 uint32 IOBuffer::UndoLevel() const {
     return undoLevel;
 }
@@ -43,7 +43,8 @@
 namespace MARTe {
 
 StreamString::StreamString() :
-        BufferedStreamI() {
+        BufferedStreamI(),
+        buffer(64u, true) {
     //Initialise and terminate an empty string
     bool ret;
     ret = buffer.SetBufferAllocationSize(0u);
@@ -54,7 +55,8 @@ StreamString::StreamString() :
 }
 
 StreamString::StreamString(const char8 * const initialisationString) :
-        BufferedStreamI() {
+        BufferedStreamI(),
+        buffer(64u, true) {
     //Initialise and terminate an empty string
     bool ret;
     ret = buffer.SetBufferAllocationSize(0u);
@@ -71,7 +73,8 @@ StreamString::StreamString(const char8 * const initialisationString) :
 }
 
 StreamString::StreamString(CCString initialisationString) :
-        BufferedStreamI() {
+        BufferedStreamI(),
+        buffer(64u, true) {
     //Initialise and terminate an empty string
     bool ret;
     ret = buffer.SetBufferAllocationSize(0u);
@@ -89,7 +92,8 @@ StreamString::StreamString(CCString initialisationString) :
 
 /*lint -e{1738} . Justification: StreamI is only an interface there is nothing to be copied. */
 StreamString::StreamString(const StreamString &toCopy) :
-        BufferedStreamI() {
+        BufferedStreamI(),
+        buffer(64u, true) {
     //Initialise and terminate an empty string
     bool ret;
     ret = buffer.SetBufferAllocationSize(0u);
@@ -324,4 +328,8 @@ int32 StreamString::Locate(const StreamString &x) const {
     return static_cast<int32>(ret);
 }
 
+bool StreamString::SetHeap(HeapI * const heap) {
+    return buffer.SetAllocationHeap(heap);
+}
+
 }
@@ -50,6 +50,8 @@ namespace MARTe {
 /**
  * @brief A basic implementation of a stream which allows reading and writing
  * to an underlying unbounded string, which can grow dynamically.
+ * @details Short strings (see STREAM_STRING_IO_BUFFER_SMALL_SIZE) are stored inside the object and do not
+ * allocate any memory.
  */
 class DLL_API StreamString: public BufferedStreamI {
 
@@ -345,6 +347,16 @@ public:
      */
     virtual int32 Locate(const StreamString &x) const;
 
+    /**
+     * @brief Sets the heap where the string is allocated once it no longer fits in the embedded small buffer.
+     * @details Strings shorter than STREAM_STRING_IO_BUFFER_SMALL_SIZE do not allocate any memory. Longer strings are
+     * allocated from \a heap (e.g. an arena for short-lived strings), which must outlive this StreamString. The heap
+     * is not propagated by the copy constructor nor by the assignment operators.
+     * @param[in] heap the heap to be used (NULL for the HeapManager).
+     * @return false if the string already holds memory allocated from another heap.
+     */
+    bool SetHeap(HeapI * const heap);
+
 protected:
 
     /**
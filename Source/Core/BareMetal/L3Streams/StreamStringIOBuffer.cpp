@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include <StreamStringIOBuffer.h>
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -44,12 +45,18 @@ namespace MARTe {
 
 StreamStringIOBuffer::StreamStringIOBuffer() :
         IOBuffer(64u, 0u) {
-
+    smallBufferEnabled = false;
 }
 
 StreamStringIOBuffer::StreamStringIOBuffer(const uint32 granularity) :
         IOBuffer(granularity, 0u) {
+    smallBufferEnabled = false;
+}
 
+StreamStringIOBuffer::StreamStringIOBuffer(const uint32 granularity,
+                                           const bool smallBufferEnabledIn) :
+        IOBuffer(granularity, 0u) {
+    smallBufferEnabled = smallBufferEnabledIn;
 }
 
 StreamStringIOBuffer::~StreamStringIOBuffer() {
@@ -58,14 +65,43 @@ StreamStringIOBuffer::~StreamStringIOBuffer() {
 
 bool StreamStringIOBuffer::SetBufferAllocationSize(const uint32 desiredSize) {
 
-    bool ret;
+    bool ret = true;
+    bool usingSmallBuffer = IsUsingSmallBuffer();
+    bool fitsSmallBuffer = (desiredSize < STREAM_STRING_IO_BUFFER_SMALL_SIZE);
 
-    //add one to desired size for the terminator character.
-    ret = SetBufferHeapMemory(desiredSize + 1U, 1U);
+    if ((smallBufferEnabled) && (fitsSmallBuffer) && ((usingSmallBuffer) || (Buffer() == NULL))) {
+        if (!usingSmallBuffer) {
+            SetBufferReferencedMemory(&smallBuffer[0], STREAM_STRING_IO_BUFFER_SMALL_SIZE, 1U);
+        }
+    }
+    else {
+        uint32 usedSize = UsedSize();
+        uint32 position = Position();
+
+        //add one to desired size for the terminator character.
+        ret = SetBufferHeapMemory(desiredSize + 1U, 1U);
+
+        //SetBufferHeapMemory starts from an empty buffer when leaving the (referenced) small buffer
+        if ((ret) && (usingSmallBuffer)) {
+            if (usedSize > desiredSize) {
+                usedSize = desiredSize;
+            }
+            if (usedSize > 0u) {
+                ret = MemoryOperationsHelper::Copy(BufferReference(), &smallBuffer[0], usedSize);
+            }
+            SetUsedSize(usedSize);
+            if (ret) {
+                ret = Seek((position > usedSize) ? (usedSize) : (position));
+            }
+        }
+    }
 
     if (ret) {
         if (desiredSize < UsedSize()) {
             SetUsedSize(desiredSize);
+            if (Position() > desiredSize) {
+                ret = Seek(desiredSize);
+            }
         }
 
         Terminate();
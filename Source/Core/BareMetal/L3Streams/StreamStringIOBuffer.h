@@ -43,6 +43,13 @@
 
 namespace MARTe {
 
+/**
+ * Size of the memory embedded in the StreamStringIOBuffer (including the final '\0') which can be used, before
+ * allocating any memory from the heap, to store short strings.
+ * @details This memory is part of the StreamString object, whose size must fit in the TypeDescriptor::numberOfBits.
+ */
+const uint32 STREAM_STRING_IO_BUFFER_SMALL_SIZE = 32u;
+
 /**
  * @brief The StreamString buffer.
  *
@@ -51,6 +58,10 @@ namespace MARTe {
  *
  * For memory allocations it adds one to the desired size passed by argument and sets reservedSpaceAtEnd = 1 for the
  * final '\0' character.
+ *
+ * If the small buffer is enabled (see StreamStringIOBuffer(const uint32, const bool)) the strings shorter than
+ * STREAM_STRING_IO_BUFFER_SMALL_SIZE are stored in memory embedded in the object and the heap is only used (and then
+ * kept) once the string grows beyond it. The heap can be selected with IOBuffer::SetAllocationHeap.
  */
 class DLL_API StreamStringIOBuffer: public IOBuffer {
 
@@ -90,6 +101,18 @@ public:
      */
     StreamStringIOBuffer(const uint32 granularity);
 
+    /**
+     * @brief Constructor specifying granularity and if the embedded small buffer is to be used.
+     * @param[in] granularity the heap allocation granularity.
+     * @param[in] smallBufferEnabledIn if true SetBufferAllocationSize uses the embedded memory while the desired size
+     * is smaller than STREAM_STRING_IO_BUFFER_SMALL_SIZE and no heap memory was allocated yet.
+     * @post
+     *   Buffer() == NULL &&
+     *   AllocationGranularity() == granularity
+     */
+    StreamStringIOBuffer(const uint32 granularity,
+                         const bool smallBufferEnabledIn);
+
     /**
      * @brief Destructor.
      */
@@ -98,7 +121,9 @@ public:
     /**
      * @brief Sets the size of the buffer to be desiredSize.
      * @details Truncates stringSize to desiredSize-1.\n
-     * Calls IOBuffer::SetBufferHeapMemory with desiredSize+1 and reservedSpaceAtEnd=1.
+     * Calls IOBuffer::SetBufferHeapMemory with desiredSize+1 and reservedSpaceAtEnd=1, unless the small buffer is
+     * enabled, no heap memory was allocated yet and desiredSize+1 <= STREAM_STRING_IO_BUFFER_SMALL_SIZE.
+     * When moving from the small buffer to the heap the content and the position are preserved.
      * @param[in] desiredSize is the desired size to allocate without considering the final '\0'.
      * @return false in case of errors in the allocation.
      */
@@ -126,6 +151,24 @@ public:
      */
     virtual bool NoMoreSpaceToWrite(const uint32 neededSize);
 
+    /**
+     * @brief Checks if the string is stored in the embedded small buffer.
+     * @return true if Buffer() points at the embedded small buffer.
+     */
+    inline bool IsUsingSmallBuffer() const;
+
+private:
+
+    /**
+     * Memory used for short strings (if smallBufferEnabled).
+     */
+    char8 smallBuffer[STREAM_STRING_IO_BUFFER_SMALL_SIZE];
+
+    /**
+     * True if the smallBuffer can be used.
+     */
+    bool smallBufferEnabled;
+
 };
 
 }
@@ -133,5 +176,13 @@ public:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+bool StreamStringIOBuffer::IsUsingSmallBuffer() const {
+    return (Buffer() == &smallBuffer[0]);
+}
+
+}
+
 #endif /* STRINGIOBUFFER_H_ */
 
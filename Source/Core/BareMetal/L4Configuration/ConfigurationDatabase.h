@@ -34,6 +34,7 @@
 
 #include "AnyObject.h"
 #include "ConfigurationDatabaseNode.h"
+#include "NonRealTimeMutexSem.h"
 #include "ReferenceT.h"
 #include "ReferenceContainer.h"
 #include "ReferenceContainerFilterObjectName.h"
@@ -234,7 +235,7 @@ private:
     /**
      * The shared mutex semaphore.
      */
-    FastPollingMutexSem mux;
+    NonRealTimeMutexSem mux;
 
 };
 
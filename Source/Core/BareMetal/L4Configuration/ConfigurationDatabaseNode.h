@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "BinaryTree.h"
+#include "NonRealTimeMutexSem.h"
 #include "Fnv1aHashFunction.h"
 #include "Object.h"
 #include "ReferenceContainer.h"
@@ -168,7 +169,7 @@ private:
     /**
      * Protects multiple access to the internal resources
      */
-    FastPollingMutexSem mux;
+    NonRealTimeMutexSem mux;
 
     /**
      * Timeout
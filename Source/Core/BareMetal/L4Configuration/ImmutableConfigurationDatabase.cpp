@@ -0,0 +1,1032 @@
+/**
+ * @file ImmutableConfigurationDatabase.cpp
+ * @brief Source file for class ImmutableConfigurationDatabase
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ImmutableConfigurationDatabase (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#define DLL_API
+
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "Fnv1aHashFunction.h"
+#include "HeapManager.h"
+#include "ImmutableConfigurationDatabase.h"
+#include "MemoryOperationsHelper.h"
+#include "Reference.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief The storage of an ImmutableConfigurationDatabase.
+ */
+struct ImmutableConfigurationDatabase::Storage {
+    /**
+     * All the entries. The root node is the entry 0.
+     */
+    ImmutableConfigurationDatabaseEntry *entries;
+
+    /**
+     * Number of entries.
+     */
+    uint32 numberOfEntries;
+
+    /**
+     * Number of elements allocated in entries.
+     */
+    uint32 entriesCapacity;
+
+    /**
+     * The values of the leafs.
+     */
+    AnyType *values;
+
+    /**
+     * Number of values.
+     */
+    uint32 numberOfValues;
+
+    /**
+     * Number of elements allocated in values.
+     */
+    uint32 valuesCapacity;
+
+    /**
+     * The interned names.
+     */
+    const char8 **names;
+
+    /**
+     * Number of names.
+     */
+    uint32 numberOfNames;
+
+    /**
+     * Number of elements allocated in names.
+     */
+    uint32 namesCapacity;
+
+    /**
+     * Hash table of the names. Each slot holds the name index + 1 (0 if empty).
+     */
+    uint32 *nameIndex;
+
+    /**
+     * Number of slots of nameIndex (a power of 2).
+     */
+    uint32 nameIndexSize;
+
+    /**
+     * Hash table of the (parent, name) of the entries. Each slot holds the entry index + 1 (0 if empty).
+     */
+    uint32 *entryIndex;
+
+    /**
+     * Number of slots of entryIndex (a power of 2).
+     */
+    uint32 entryIndexSize;
+
+    /**
+     * The children of all the nodes (after Freeze), where the children of a node are contiguous.
+     */
+    uint32 *children;
+
+    /**
+     * The memory blocks. The first pointer of each block is the address of the previous block.
+     */
+    void *blocks;
+
+    /**
+     * The first free byte of the latest block.
+     */
+    char8 *freeMemory;
+
+    /**
+     * Number of free bytes in the latest block.
+     */
+    uint32 freeMemorySize;
+
+    /**
+     * Total number of bytes allocated in blocks.
+     */
+    uint32 blocksSize;
+
+    /**
+     * Number of ImmutableConfigurationDatabase sharing this storage.
+     */
+    volatile int32 references;
+
+    /**
+     * True if Freeze was called.
+     */
+    bool frozen;
+};
+
+/**
+ * Alignment of the memory allocated in the blocks.
+ */
+static const uint32 IMMUTABLE_CONFIGURATION_DATABASE_ALIGNMENT = 8u;
+
+/**
+ * @brief Grows an array to hold at least \a required elements (doubling its capacity).
+ * @return true if the array could be allocated.
+ */
+template<typename T>
+static bool GrowArray(T *&array,
+                      uint32 &capacity,
+                      const uint32 numberOfElements,
+                      const uint32 required) {
+    bool ok = true;
+    if (required > capacity) {
+        uint32 newCapacity = (capacity > 0u) ? (capacity * 2u) : 64u;
+        while (newCapacity < required) {
+            newCapacity *= 2u;
+        }
+        T *newArray = new T[newCapacity];
+        ok = (newArray != NULL);
+        if (ok) {
+            for (uint32 i = 0u; i < numberOfElements; i++) {
+                newArray[i] = array[i];
+            }
+            if (array != NULL) {
+                delete[] array;
+            }
+            array = newArray;
+            capacity = newCapacity;
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Hash of a (parent, name) pair.
+ */
+static uint32 HashEntry(const uint32 parent,
+                        const uint32 name) {
+    uint32 hash = (parent * 0x9E3779B1u) ^ (name * 0x85EBCA77u);
+    hash ^= (hash >> 16u);
+    hash *= 0x7FEB352Du;
+    hash ^= (hash >> 15u);
+    return hash;
+}
+
+/**
+ * @brief Hash of a name.
+ */
+static uint32 HashName(const char8 * const name,
+                       const uint32 nameSize) {
+    Fnv1aHashFunction hashFunction;
+    uint32 hash = 0u;
+    if (nameSize > 0u) {
+        hash = hashFunction.Compute(name, nameSize);
+    }
+    return hash;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ImmutableConfigurationDatabase::ImmutableConfigurationDatabase() :
+        StructuredDataI(),
+        Object() {
+    storage = new Storage;
+    storage->entries = NULL_PTR(ImmutableConfigurationDatabaseEntry *);
+    storage->numberOfEntries = 0u;
+    storage->entriesCapacity = 0u;
+    storage->values = NULL_PTR(AnyType *);
+    storage->numberOfValues = 0u;
+    storage->valuesCapacity = 0u;
+    storage->names = NULL_PTR(const char8 **);
+    storage->numberOfNames = 0u;
+    storage->namesCapacity = 0u;
+    storage->nameIndex = NULL_PTR(uint32 *);
+    storage->nameIndexSize = 0u;
+    storage->entryIndex = NULL_PTR(uint32 *);
+    storage->entryIndexSize = 0u;
+    storage->children = NULL_PTR(uint32 *);
+    storage->blocks = NULL_PTR(void *);
+    storage->freeMemory = NULL_PTR(char8 *);
+    storage->freeMemorySize = 0u;
+    storage->blocksSize = 0u;
+    storage->references = 1;
+    storage->frozen = false;
+    currentNode = 0u;
+    //The root node
+    if (GrowArray(storage->entries, storage->entriesCapacity, 0u, 1u)) {
+        ImmutableConfigurationDatabaseEntry &root = storage->entries[0u];
+        root.name = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+        root.parent = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+        root.firstChild = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+        root.lastChild = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+        root.nextSibling = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+        root.numberOfChildren = 0u;
+        root.children = 0u;
+        root.value = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+        storage->numberOfEntries = 1u;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "ImmutableConfigurationDatabase: Failed to allocate the root node");
+    }
+}
+
+ImmutableConfigurationDatabase::ImmutableConfigurationDatabase(const ImmutableConfigurationDatabase &toCopy) :
+        StructuredDataI(),
+        Object(toCopy) {
+    storage = toCopy.storage;
+    Atomic::Increment(&storage->references);
+    currentNode = toCopy.currentNode;
+}
+
+/*lint -e{1551} by design memory if freed in the destructor.*/
+ImmutableConfigurationDatabase::~ImmutableConfigurationDatabase() {
+    int32 references;
+    do {
+        references = storage->references;
+    }
+    while (!Atomic::CompareAndSwap(&storage->references, references, references - 1));
+    if (references == 1) {
+        if (storage->entries != NULL) {
+            delete[] storage->entries;
+        }
+        if (storage->values != NULL) {
+            delete[] storage->values;
+        }
+        if (storage->names != NULL) {
+            delete[] storage->names;
+        }
+        if (storage->nameIndex != NULL) {
+            delete[] storage->nameIndex;
+        }
+        if (storage->entryIndex != NULL) {
+            delete[] storage->entryIndex;
+        }
+        if (storage->children != NULL) {
+            delete[] storage->children;
+        }
+        while (storage->blocks != NULL) {
+            void *block = storage->blocks;
+            storage->blocks = *static_cast<void **>(block);
+            if (!HeapManager::Free(block)) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "ImmutableConfigurationDatabase: Failed to free a memory block");
+            }
+        }
+        delete storage;
+    }
+    storage = NULL_PTR(Storage *);
+}
+
+void ImmutableConfigurationDatabase::Freeze() {
+    if (!storage->frozen) {
+        uint32 numberOfEntries = storage->numberOfEntries;
+        storage->children = new uint32[numberOfEntries];
+        if (storage->children != NULL) {
+            uint32 position = 0u;
+            for (uint32 e = 0u; e < numberOfEntries; e++) {
+                ImmutableConfigurationDatabaseEntry &entry = storage->entries[e];
+                entry.children = position;
+                uint32 child = entry.firstChild;
+                while (child != IMMUTABLE_CONFIGURATION_DATABASE_NONE) {
+                    storage->children[position] = child;
+                    position++;
+                    child = storage->entries[child].nextSibling;
+                }
+            }
+            storage->frozen = true;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "ImmutableConfigurationDatabase: Failed to allocate the children array");
+        }
+    }
+}
+
+bool ImmutableConfigurationDatabase::IsFrozen() const {
+    return storage->frozen;
+}
+
+uint32 ImmutableConfigurationDatabase::GetMemorySize() const {
+    uint32 size = static_cast<uint32>(sizeof(Storage));
+    size += storage->entriesCapacity * static_cast<uint32>(sizeof(ImmutableConfigurationDatabaseEntry));
+    size += storage->valuesCapacity * static_cast<uint32>(sizeof(AnyType));
+    size += storage->namesCapacity * static_cast<uint32>(sizeof(const char8 *));
+    size += (storage->nameIndexSize + storage->entryIndexSize) * static_cast<uint32>(sizeof(uint32));
+    if (storage->frozen) {
+        size += storage->numberOfEntries * static_cast<uint32>(sizeof(uint32));
+    }
+    size += storage->blocksSize;
+    return size;
+}
+
+void *ImmutableConfigurationDatabase::Allocate(const uint32 size) {
+    const uint32 alignment = IMMUTABLE_CONFIGURATION_DATABASE_ALIGNMENT;
+    uint32 alignedSize = ((size + (alignment - 1u)) / alignment) * alignment;
+    if (alignedSize == 0u) {
+        alignedSize = alignment;
+    }
+    void *ret = NULL_PTR(void *);
+    //Large values get a block of their own, so that the free memory of the current block is not lost
+    bool dedicatedBlock = (alignedSize > (IMMUTABLE_CONFIGURATION_DATABASE_BLOCK_SIZE / 4u));
+    if ((dedicatedBlock) || (alignedSize > storage->freeMemorySize)) {
+        //The first bytes of the block hold the address of the previous block
+        uint32 blockSize = (dedicatedBlock) ? (alignedSize + alignment) : (IMMUTABLE_CONFIGURATION_DATABASE_BLOCK_SIZE);
+        char8 *block = static_cast<char8 *>(HeapManager::Malloc(blockSize));
+        if (block != NULL) {
+            *reinterpret_cast<void **>(block) = storage->blocks;
+            storage->blocks = block;
+            storage->blocksSize += blockSize;
+            if (dedicatedBlock) {
+                ret = &block[alignment];
+            }
+            else {
+                storage->freeMemory = &block[alignment];
+                storage->freeMemorySize = blockSize - alignment;
+            }
+        }
+    }
+    if ((!dedicatedBlock) && (alignedSize <= storage->freeMemorySize)) {
+        ret = storage->freeMemory;
+        storage->freeMemory = &storage->freeMemory[alignedSize];
+        storage->freeMemorySize -= alignedSize;
+    }
+    return ret;
+}
+
+char8 *ImmutableConfigurationDatabase::CopyString(const char8 * const string,
+                                                  const uint32 size) {
+    char8 *copy = static_cast<char8 *>(Allocate(size + 1u));
+    if (copy != NULL) {
+        if (size > 0u) {
+            (void) MemoryOperationsHelper::Copy(copy, string, size);
+        }
+        copy[size] = '\0';
+    }
+    return copy;
+}
+
+uint32 ImmutableConfigurationDatabase::InternName(const char8 * const name,
+                                                  const uint32 nameSize,
+                                                  const bool create) {
+    uint32 ret = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+    uint32 hash = HashName(name, nameSize);
+    if ((nameSize > 0u) && (storage->nameIndexSize > 0u)) {
+        uint32 mask = storage->nameIndexSize - 1u;
+        uint32 slot = hash & mask;
+        while ((storage->nameIndex[slot] != 0u) && (ret == IMMUTABLE_CONFIGURATION_DATABASE_NONE)) {
+            uint32 candidate = storage->nameIndex[slot] - 1u;
+            const char8 *candidateName = storage->names[candidate];
+            if (StringHelper::CompareN(candidateName, name, nameSize) == 0) {
+                if (candidateName[nameSize] == '\0') {
+                    ret = candidate;
+                }
+            }
+            slot = (slot + 1u) & mask;
+        }
+    }
+    if ((nameSize > 0u) && (ret == IMMUTABLE_CONFIGURATION_DATABASE_NONE) && (create) && (!storage->frozen)) {
+        uint32 newName = storage->numberOfNames;
+        char8 *nameCopy = CopyString(name, nameSize);
+        bool ok = (nameCopy != NULL);
+        if (ok) {
+            ok = GrowArray(storage->names, storage->namesCapacity, newName, newName + 1u);
+        }
+        if (ok) {
+            storage->names[newName] = nameCopy;
+            storage->numberOfNames++;
+            //Keep the table at most half full
+            if ((storage->numberOfNames * 2u) > storage->nameIndexSize) {
+                uint32 newSize = (storage->nameIndexSize > 0u) ? (storage->nameIndexSize * 2u) : 256u;
+                uint32 *newIndex = new uint32[newSize];
+                ok = (newIndex != NULL);
+                if (ok) {
+                    for (uint32 i = 0u; i < newSize; i++) {
+                        newIndex[i] = 0u;
+                    }
+                    uint32 mask = newSize - 1u;
+                    for (uint32 n = 0u; n < newName; n++) {
+                        const char8 *existing = storage->names[n];
+                        uint32 slot = HashName(existing, StringHelper::Length(existing)) & mask;
+                        while (newIndex[slot] != 0u) {
+                            slot = (slot + 1u) & mask;
+                        }
+                        newIndex[slot] = n + 1u;
+                    }
+                    if (storage->nameIndex != NULL) {
+                        delete[] storage->nameIndex;
+                    }
+                    storage->nameIndex = newIndex;
+                    storage->nameIndexSize = newSize;
+                }
+            }
+        }
+        if (ok) {
+            uint32 mask = storage->nameIndexSize - 1u;
+            uint32 slot = hash & mask;
+            while (storage->nameIndex[slot] != 0u) {
+                slot = (slot + 1u) & mask;
+            }
+            storage->nameIndex[slot] = newName + 1u;
+            ret = newName;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "ImmutableConfigurationDatabase: Failed to allocate a name");
+        }
+    }
+    return ret;
+}
+
+uint32 ImmutableConfigurationDatabase::FindChild(const uint32 parent,
+                                                 const uint32 name) const {
+    uint32 ret = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+    if ((name != IMMUTABLE_CONFIGURATION_DATABASE_NONE) && (storage->entryIndexSize > 0u)) {
+        uint32 mask = storage->entryIndexSize - 1u;
+        uint32 slot = HashEntry(parent, name) & mask;
+        while ((storage->entryIndex[slot] != 0u) && (ret == IMMUTABLE_CONFIGURATION_DATABASE_NONE)) {
+            uint32 candidate = storage->entryIndex[slot] - 1u;
+            const ImmutableConfigurationDatabaseEntry &entry = storage->entries[candidate];
+            if ((entry.parent == parent) && (entry.name == name)) {
+                ret = candidate;
+            }
+            slot = (slot + 1u) & mask;
+        }
+    }
+    return ret;
+}
+
+uint32 ImmutableConfigurationDatabase::FindChild(const uint32 parent,
+                                                 const char8 * const name,
+                                                 const uint32 nameSize) {
+    return FindChild(parent, InternName(name, nameSize, false));
+}
+
+uint32 ImmutableConfigurationDatabase::GetChild(const uint32 parent,
+                                                const uint32 index) const {
+    uint32 ret = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+    const ImmutableConfigurationDatabaseEntry &entry = storage->entries[parent];
+    if (index < entry.numberOfChildren) {
+        if (storage->frozen) {
+            ret = storage->children[entry.children + index];
+        }
+        else {
+            ret = entry.firstChild;
+            for (uint32 i = 0u; i < index; i++) {
+                ret = storage->entries[ret].nextSibling;
+            }
+        }
+    }
+    return ret;
+}
+
+bool ImmutableConfigurationDatabase::IndexEntry(const uint32 entry) {
+    bool ok = true;
+    //Keep the table at most half full
+    if ((storage->numberOfEntries * 2u) > storage->entryIndexSize) {
+        uint32 newSize = (storage->entryIndexSize > 0u) ? (storage->entryIndexSize * 2u) : 256u;
+        uint32 *newIndex = new uint32[newSize];
+        ok = (newIndex != NULL);
+        if (ok) {
+            for (uint32 i = 0u; i < newSize; i++) {
+                newIndex[i] = 0u;
+            }
+            if (storage->entryIndex != NULL) {
+                delete[] storage->entryIndex;
+            }
+            storage->entryIndex = newIndex;
+            storage->entryIndexSize = newSize;
+            //The root (entry 0) is not the child of any node
+            for (uint32 e = 1u; e < storage->numberOfEntries; e++) {
+                if (e != entry) {
+                    ok = IndexEntry(e);
+                }
+            }
+        }
+    }
+    if (ok) {
+        uint32 mask = storage->entryIndexSize - 1u;
+        const ImmutableConfigurationDatabaseEntry &toIndex = storage->entries[entry];
+        uint32 slot = HashEntry(toIndex.parent, toIndex.name) & mask;
+        while (storage->entryIndex[slot] != 0u) {
+            slot = (slot + 1u) & mask;
+        }
+        storage->entryIndex[slot] = entry + 1u;
+    }
+    return ok;
+}
+
+uint32 ImmutableConfigurationDatabase::AddEntry(const uint32 parent,
+                                                const uint32 name,
+                                                const uint32 value) {
+    uint32 ret = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+    uint32 newEntry = storage->numberOfEntries;
+    bool ok = GrowArray(storage->entries, storage->entriesCapacity, newEntry, newEntry + 1u);
+    if (ok) {
+        ImmutableConfigurationDatabaseEntry &entry = storage->entries[newEntry];
+        entry.name = name;
+        entry.parent = parent;
+        entry.firstChild = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+        entry.lastChild = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+        entry.nextSibling = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+        entry.numberOfChildren = 0u;
+        entry.children = 0u;
+        entry.value = value;
+        ImmutableConfigurationDatabaseEntry &parentEntry = storage->entries[parent];
+        if (parentEntry.lastChild == IMMUTABLE_CONFIGURATION_DATABASE_NONE) {
+            parentEntry.firstChild = newEntry;
+        }
+        else {
+            storage->entries[parentEntry.lastChild].nextSibling = newEntry;
+        }
+        parentEntry.lastChild = newEntry;
+        parentEntry.numberOfChildren++;
+        storage->numberOfEntries++;
+        ok = IndexEntry(newEntry);
+    }
+    if (ok) {
+        ret = newEntry;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "ImmutableConfigurationDatabase: Failed to allocate an entry");
+    }
+    return ret;
+}
+
+uint32 ImmutableConfigurationDatabase::FindNode(const uint32 start,
+                                                const char8 * const path) {
+    uint32 node = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+    if (path != NULL) {
+        uint32 candidate = start;
+        uint32 begin = 0u;
+        bool found = false;
+        bool ok = true;
+        //Empty tokens (i.e. consecutive, leading and trailing dots) are skipped
+        while ((ok) && (path[begin] != '\0')) {
+            uint32 end = begin;
+            while ((path[end] != '\0') && (path[end] != '.')) {
+                end++;
+            }
+            if (end > begin) {
+                candidate = FindChild(candidate, &path[begin], end - begin);
+                ok = (candidate != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+                if (ok) {
+                    ok = (storage->entries[candidate].value == IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+                }
+                found = ok;
+            }
+            begin = (path[end] == '.') ? (end + 1u) : (end);
+        }
+        if ((ok) && (found)) {
+            node = candidate;
+        }
+    }
+    return node;
+}
+
+bool ImmutableConfigurationDatabase::CreateNodes(const char8 * const path) {
+    bool ok = (!storage->frozen) && (path != NULL);
+    bool created = false;
+    uint32 oldCurrentNode = currentNode;
+    uint32 begin = 0u;
+    while ((ok) && (path[begin] != '\0')) {
+        uint32 end = begin;
+        while ((path[end] != '\0') && (path[end] != '.')) {
+            end++;
+        }
+        if (end > begin) {
+            uint32 name = InternName(&path[begin], end - begin, true);
+            ok = (name != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+            if (ok) {
+                uint32 child = FindChild(currentNode, name);
+                if (child != IMMUTABLE_CONFIGURATION_DATABASE_NONE) {
+                    //A leaf with this name already exists
+                    ok = (storage->entries[child].value == IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+                }
+                else {
+                    child = AddEntry(currentNode, name, IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+                    ok = (child != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+                    created = ok;
+                }
+                if (ok) {
+                    currentNode = child;
+                }
+            }
+        }
+        begin = (path[end] == '.') ? (end + 1u) : (end);
+    }
+    if (ok) {
+        ok = created;
+    }
+    if (!ok) {
+        currentNode = oldCurrentNode;
+    }
+    return ok;
+}
+
+/*lint -e{9025} [MISRA C++ Rule 5-0-19]. Justification: Three pointer indirection levels required for matrices of char *. */
+bool ImmutableConfigurationDatabase::SerialiseValue(const AnyType &typeIn,
+                                                    AnyType &typeOut) {
+    //Same memory layout of AnyObject::Serialise, so that the values can be read with the same TypeConvert rules
+    uint32 numberOfDimensions = typeIn.GetNumberOfDimensions();
+    TypeDescriptor sourceDescriptor = typeIn.GetTypeDescriptor();
+    void *sourcePointer = typeIn.GetDataPointer();
+    bool isString = (sourceDescriptor.type == SString);
+    bool isCCString = (sourceDescriptor.type == BT_CCString);
+    bool isStaticDeclared = typeIn.IsStaticDeclared();
+    bool isCArrayOnHeap = ((sourceDescriptor.type == CArray) && (!isStaticDeclared));
+    uint32 numberOfColumns = typeIn.GetNumberOfElements(0u);
+    uint32 numberOfRows = typeIn.GetNumberOfElements(1u);
+    void *destPointer = NULL_PTR(void *);
+    bool ok = true;
+    if (numberOfDimensions == 0u) {
+        if ((isString) || (isCCString) || (isCArrayOnHeap)) {
+            const char8 *token = (isString) ? (static_cast<StreamString *>(sourcePointer)->Buffer()) : (static_cast<const char8 *>(sourcePointer));
+            destPointer = CopyString(token, StringHelper::Length(token));
+        }
+        else if (sourceDescriptor.type == Pointer) {
+            destPointer = sourcePointer;
+        }
+        else {
+            uint32 size = typeIn.GetByteSize();
+            destPointer = Allocate(size);
+            if (destPointer != NULL) {
+                ok = MemoryOperationsHelper::Copy(destPointer, sourcePointer, size);
+            }
+        }
+        ok = (ok) && ((destPointer != NULL) || (sourcePointer == NULL));
+    }
+    else if (numberOfDimensions == 1u) {
+        if ((isString) || (isCCString) || (isCArrayOnHeap)) {
+            char8 **destBegin = static_cast<char8 **>(Allocate(static_cast<uint32>(sizeof(char8 *)) * numberOfColumns));
+            ok = (destBegin != NULL);
+            for (uint32 i = 0u; (i < numberOfColumns) && (ok); i++) {
+                const char8 *token = (isString) ? (static_cast<StreamString *>(sourcePointer)[i].Buffer()) : (static_cast<const char8 **>(sourcePointer)[i]);
+                destBegin[i] = CopyString(token, StringHelper::Length(token));
+                ok = (destBegin[i] != NULL);
+            }
+            destPointer = destBegin;
+        }
+        else {
+            uint32 size = typeIn.GetByteSize() * numberOfColumns;
+            destPointer = Allocate(size);
+            ok = (destPointer != NULL);
+            if (ok) {
+                ok = MemoryOperationsHelper::Copy(destPointer, sourcePointer, size);
+            }
+        }
+    }
+    else if (numberOfDimensions == 2u) {
+        if (isStaticDeclared) {
+            if ((isString) || (isCCString)) {
+                uint32 numberOfElements = numberOfRows * numberOfColumns;
+                char8 **destBegin = static_cast<char8 **>(Allocate(static_cast<uint32>(sizeof(char8 *)) * numberOfElements));
+                ok = (destBegin != NULL);
+                for (uint32 i = 0u; (i < numberOfElements) && (ok); i++) {
+                    const char8 *token = (isString) ? (static_cast<StreamString *>(sourcePointer)[i].Buffer()) : (static_cast<const char8 **>(sourcePointer)[i]);
+                    destBegin[i] = CopyString(token, StringHelper::Length(token));
+                    ok = (destBegin[i] != NULL);
+                }
+                destPointer = destBegin;
+            }
+            else {
+                uint32 size = typeIn.GetByteSize() * numberOfRows * numberOfColumns;
+                destPointer = Allocate(size);
+                ok = (destPointer != NULL);
+                if (ok) {
+                    ok = MemoryOperationsHelper::Copy(destPointer, sourcePointer, size);
+                }
+            }
+        }
+        else {
+            void **sourceRows = static_cast<void **>(sourcePointer);
+            void **destRows = static_cast<void **>(Allocate(static_cast<uint32>(sizeof(void *)) * numberOfRows));
+            ok = (destRows != NULL);
+            uint32 rowSize = ((isString) || (isCCString)) ? (static_cast<uint32>(sizeof(char8 *)) * numberOfColumns) : (typeIn.GetByteSize() * numberOfColumns);
+            for (uint32 r = 0u; (r < numberOfRows) && (ok); r++) {
+                destRows[r] = Allocate(rowSize);
+                ok = (destRows[r] != NULL);
+                if ((isString) || (isCCString)) {
+                    char8 **destRow = static_cast<char8 **>(destRows[r]);
+                    for (uint32 c = 0u; (c < numberOfColumns) && (ok); c++) {
+                        const char8 *token = (isString) ? (static_cast<StreamString *>(sourceRows[r])[c].Buffer()) : (static_cast<const char8 **>(sourceRows[r])[c]);
+                        destRow[c] = CopyString(token, StringHelper::Length(token));
+                        ok = (destRow[c] != NULL);
+                    }
+                }
+                else if (ok) {
+                    ok = MemoryOperationsHelper::Copy(destRows[r], sourceRows[r], rowSize);
+                }
+                else {
+                    //NOOP
+                }
+            }
+            destPointer = destRows;
+        }
+    }
+    else if (numberOfDimensions == 3u) {
+        ok = (isStaticDeclared) && (!isString) && (!isCCString);
+        if (ok) {
+            uint32 size = typeIn.GetByteSize() * numberOfRows * numberOfColumns * typeIn.GetNumberOfElements(2u);
+            destPointer = Allocate(size);
+            ok = (destPointer != NULL);
+            if (ok) {
+                ok = MemoryOperationsHelper::Copy(destPointer, sourcePointer, size);
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "Serialisation of non-static or string AnyType with dimension > 2 not supported!");
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Serialisation of AnyType with dimension > 3 not supported!");
+        ok = false;
+    }
+    if (ok) {
+        typeOut = typeIn;
+        //Strings are stored as arrays of CCString. The type as to be updated accordingly.
+        if (isString) {
+            typeOut = AnyType(static_cast<char8 *>(sourcePointer));
+            typeOut.SetNumberOfDimensions(typeIn.GetNumberOfDimensions());
+            typeOut.SetNumberOfElements(0u, typeIn.GetNumberOfElements(0u));
+            typeOut.SetNumberOfElements(1u, typeIn.GetNumberOfElements(1u));
+            typeOut.SetNumberOfElements(2u, typeIn.GetNumberOfElements(2u));
+        }
+        typeOut.SetDataPointer(destPointer);
+        typeOut.SetStaticDeclared(isStaticDeclared);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabase::Write(const char8 * const name,
+                                           const AnyType &value) {
+    bool ok = (!storage->frozen);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "The database is frozen");
+    }
+    //Conversion Object-StructuredDataI or StructuredDataI-StructuredDataI
+    bool isStructured = ((value.GetTypeDescriptor().isStructuredData) || (value.GetTypeDescriptor() == StructuredDataInterfaceType));
+    if (ok) {
+        if (!isStructured) {
+            ok = (name != NULL);
+            if (ok) {
+                ok = (StringHelper::Length(name) > 0u);
+            }
+            if (ok) {
+                uint32 nameId = InternName(name, StringHelper::Length(name), true);
+                ok = (nameId != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+                uint32 entry = IMMUTABLE_CONFIGURATION_DATABASE_NONE;
+                if (ok) {
+                    entry = FindChild(currentNode, nameId);
+                    if (entry != IMMUTABLE_CONFIGURATION_DATABASE_NONE) {
+                        //Cannot overwrite a node with a leaf
+                        ok = (storage->entries[entry].value != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+                    }
+                }
+                AnyType copy;
+                if (ok) {
+                    ok = SerialiseValue(value, copy);
+                }
+                if (ok) {
+                    if (entry != IMMUTABLE_CONFIGURATION_DATABASE_NONE) {
+                        //The memory of the previous value is only released with the storage
+                        storage->values[storage->entries[entry].value] = copy;
+                    }
+                    else {
+                        uint32 newValue = storage->numberOfValues;
+                        ok = GrowArray(storage->values, storage->valuesCapacity, newValue, newValue + 1u);
+                        if (ok) {
+                            storage->values[newValue] = copy;
+                            storage->numberOfValues++;
+                            ok = (AddEntry(currentNode, nameId, newValue) != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+                        }
+                    }
+                }
+            }
+        }
+        else {
+            uint32 oldCurrentNode = currentNode;
+            ok = CreateRelative(name);
+            if (ok) {
+                ok = TypeConvert((*this).operator AnyType(), value);
+            }
+            currentNode = oldCurrentNode;
+        }
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabase::Read(const char8 * const name,
+                                          const AnyType &value) {
+    bool ok = (name != NULL);
+    //Conversion Object-StructuredDataI or StructuredDataI-StructuredDataI
+    bool isStructured = ((value.GetTypeDescriptor().isStructuredData) || (value.GetTypeDescriptor() == StructuredDataInterfaceType));
+    if (ok) {
+        if (!isStructured) {
+            uint32 entry = FindChild(currentNode, name, StringHelper::Length(name));
+            ok = (entry != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+            if (ok) {
+                uint32 valueIdx = storage->entries[entry].value;
+                ok = (valueIdx != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+                if (ok) {
+                    ok = TypeConvert(value, storage->values[valueIdx]);
+                }
+            }
+        }
+        else {
+            uint32 oldCurrentNode = currentNode;
+            ok = MoveRelative(name);
+            if (ok) {
+                ok = TypeConvert(value, (*this).operator AnyType());
+            }
+            currentNode = oldCurrentNode;
+        }
+    }
+    return ok;
+}
+
+AnyType ImmutableConfigurationDatabase::GetType(const char8 * const name) {
+    AnyType ret = voidAnyType;
+    if (name != NULL) {
+        uint32 entry = FindChild(currentNode, name, StringHelper::Length(name));
+        if (entry != IMMUTABLE_CONFIGURATION_DATABASE_NONE) {
+            uint32 valueIdx = storage->entries[entry].value;
+            if (valueIdx != IMMUTABLE_CONFIGURATION_DATABASE_NONE) {
+                ret = storage->values[valueIdx];
+            }
+        }
+    }
+    return ret;
+}
+
+bool ImmutableConfigurationDatabase::Copy(StructuredDataI &destination) {
+    uint32 oldCurrentNode = currentNode;
+    uint32 numberOfChildren = storage->entries[oldCurrentNode].numberOfChildren;
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        uint32 child = GetChild(oldCurrentNode, i);
+        const ImmutableConfigurationDatabaseEntry &entry = storage->entries[child];
+        const char8 *childName = storage->names[entry.name];
+        if (entry.value == IMMUTABLE_CONFIGURATION_DATABASE_NONE) {
+            ok = destination.CreateRelative(childName);
+            if (ok) {
+                currentNode = child;
+                ok = Copy(destination);
+                currentNode = oldCurrentNode;
+            }
+            if (ok) {
+                ok = destination.MoveToAncestor(1u);
+            }
+        }
+        else {
+            ok = destination.Write(childName, storage->values[entry.value]);
+        }
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabase::MoveToRoot() {
+    currentNode = 0u;
+    return true;
+}
+
+bool ImmutableConfigurationDatabase::MoveToAncestor(const uint32 generations) {
+    bool ok = (generations > 0u);
+    uint32 node = currentNode;
+    for (uint32 i = 0u; (i < generations) && (ok); i++) {
+        node = storage->entries[node].parent;
+        ok = (node != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+    }
+    if (ok) {
+        currentNode = node;
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabase::MoveAbsolute(const char8 * const path) {
+    uint32 node = FindNode(0u, path);
+    bool ok = (node != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+    if (ok) {
+        currentNode = node;
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabase::MoveRelative(const char8 * const path) {
+    uint32 node = FindNode(currentNode, path);
+    bool ok = (node != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+    if (ok) {
+        currentNode = node;
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabase::MoveToChild(const uint32 childIdx) {
+    uint32 node = GetChild(currentNode, childIdx);
+    bool ok = (node != IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+    if (ok) {
+        ok = (storage->entries[node].value == IMMUTABLE_CONFIGURATION_DATABASE_NONE);
+    }
+    if (ok) {
+        currentNode = node;
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabase::CreateAbsolute(const char8 * const path) {
+    uint32 oldCurrentNode = currentNode;
+    currentNode = 0u;
+    bool ok = CreateNodes(path);
+    if (!ok) {
+        currentNode = oldCurrentNode;
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabase::CreateRelative(const char8 * const path) {
+    return CreateNodes(path);
+}
+
+/*lint -e{715} node not referenced. Not supported by this implementation.*/
+bool ImmutableConfigurationDatabase::AddToCurrentNode(Reference node) {
+    REPORT_ERROR(ErrorManagement::UnsupportedFeature, "AddToCurrentNode is not supported by the ImmutableConfigurationDatabase");
+    return false;
+}
+
+/*lint -e{715} name not referenced. Not supported by this implementation.*/
+bool ImmutableConfigurationDatabase::Delete(const char8 * const name) {
+    REPORT_ERROR(ErrorManagement::UnsupportedFeature, "Delete is not supported by the ImmutableConfigurationDatabase");
+    return false;
+}
+
+const char8 *ImmutableConfigurationDatabase::GetName() {
+    const char8 *name = NULL_PTR(const char8 *);
+    uint32 nameId = storage->entries[currentNode].name;
+    if (nameId != IMMUTABLE_CONFIGURATION_DATABASE_NONE) {
+        name = storage->names[nameId];
+    }
+    return name;
+}
+
+const char8 *ImmutableConfigurationDatabase::GetChildName(const uint32 index) {
+    const char8 *name = NULL_PTR(const char8 *);
+    uint32 child = GetChild(currentNode, index);
+    if (child != IMMUTABLE_CONFIGURATION_DATABASE_NONE) {
+        name = storage->names[storage->entries[child].name];
+    }
+    return name;
+}
+
+uint32 ImmutableConfigurationDatabase::GetNumberOfChildren() {
+    return storage->entries[currentNode].numberOfChildren;
+}
+
+bool ImmutableConfigurationDatabase::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        ok = data.Copy(*this);
+    }
+    if (ok) {
+        const char8 *rootName = data.GetName();
+        if (rootName != NULL) {
+            storage->entries[0u].name = InternName(rootName, StringHelper::Length(rootName), true);
+        }
+        Freeze();
+        ok = MoveToRoot();
+    }
+    return ok;
+}
+
+CLASS_REGISTER(ImmutableConfigurationDatabase, "1.0")
+
+}
@@ -0,0 +1,366 @@
+/**
+ * @file ImmutableConfigurationDatabase.h
+ * @brief Header file for class ImmutableConfigurationDatabase
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ImmutableConfigurationDatabase
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef IMMUTABLECONFIGURATIONDATABASE_H_
+#define IMMUTABLECONFIGURATIONDATABASE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Object.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Value of the ImmutableConfigurationDatabase indexes which do not point at any entry.
+ */
+const uint32 IMMUTABLE_CONFIGURATION_DATABASE_NONE = 0xFFFFFFFFu;
+
+/**
+ * Size of the memory blocks where the names and the leaf values are stored.
+ */
+const uint32 IMMUTABLE_CONFIGURATION_DATABASE_BLOCK_SIZE = 65536u;
+
+/**
+ * @brief A node or a leaf of an ImmutableConfigurationDatabase.
+ */
+struct ImmutableConfigurationDatabaseEntry {
+    /**
+     * Index of the (interned) name.
+     */
+    uint32 name;
+
+    /**
+     * Index of the parent node.
+     */
+    uint32 parent;
+
+    /**
+     * Index of the first child (while building the database).
+     */
+    uint32 firstChild;
+
+    /**
+     * Index of the last child (while building the database).
+     */
+    uint32 lastChild;
+
+    /**
+     * Index of the next sibling (while building the database).
+     */
+    uint32 nextSibling;
+
+    /**
+     * Number of children.
+     */
+    uint32 numberOfChildren;
+
+    /**
+     * Position of the first child in the children array (after ImmutableConfigurationDatabase::Freeze).
+     */
+    uint32 children;
+
+    /**
+     * Index of the value if this is a leaf, IMMUTABLE_CONFIGURATION_DATABASE_NONE if it is a node.
+     */
+    uint32 value;
+};
+
+/**
+ * @brief A compact, write once, implementation of StructuredDataI with the same path semantics of the ConfigurationDatabase.
+ * @details The ConfigurationDatabase stores each node and each leaf as an Object (with its Reference counting, semaphore and
+ * heap allocated AnyObject). This implementation stores instead:
+ * - all the nodes and leafs in a single array of ImmutableConfigurationDatabaseEntry (indexed by position);
+ * - the names only once (interned), so that two entries with the same name share the same name index;
+ * - the leaf values (AnyType) in a single array and their data (including the strings) in large memory blocks;
+ * - a single hash table from (parent, name) to entry, used by all the Find operations.
+ *
+ * The database is built (by a parser, by StructuredDataI::Copy, by Initialise or with Write and Create*) and then frozen
+ * with Freeze. After Freeze the children of each node are stored contiguously and Write, CreateAbsolute, CreateRelative and
+ * Delete fail. Delete and AddToCurrentNode are never supported. Writing a leaf which already exists replaces its value
+ * (the leaf keeps its position amongst the children of the node).
+ *
+ * The database can be read by any consumer of a StructuredDataI (e.g. the Initialise methods and the
+ * RealTimeApplicationConfigurationBuilder). Being immutable, after Freeze it can be read concurrently by different threads
+ * as long as each one moves its own instance (see ImmutableConfigurationDatabase(const ImmutableConfigurationDatabase &)).
+ */
+class DLL_API ImmutableConfigurationDatabase: public StructuredDataI, public Object {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Creates an empty database with the root node.
+     * @post
+     *   MoveToRoot() == true &&
+     *   IsFrozen() == false
+     */
+    ImmutableConfigurationDatabase();
+
+    /**
+     * @brief Copy constructor.
+     * @details The copy shares the storage of \a toCopy but moves independently on the database (i.e. it has its own
+     * current node, starting at the current node of \a toCopy). The storage is freed when the last instance is destroyed.
+     * @param[in] toCopy the database to be shared.
+     */
+    ImmutableConfigurationDatabase(const ImmutableConfigurationDatabase &toCopy);
+
+    /**
+     * @brief Destructor. Frees the storage if it is not shared with other instances.
+     */
+    virtual ~ImmutableConfigurationDatabase();
+
+    /**
+     * @brief Stores the children of each node contiguously and disables any further modification.
+     * @post
+     *   IsFrozen() == true
+     */
+    void Freeze();
+
+    /**
+     * @brief Checks if Freeze was called.
+     * @return true if the database can no longer be modified.
+     */
+    bool IsFrozen() const;
+
+    /**
+     * @brief Gets the number of bytes used to store the database.
+     * @return the number of bytes allocated for the entries, the values, the indexes and the memory blocks.
+     */
+    uint32 GetMemorySize() const;
+
+    /**
+     * @see StructuredDataI::Read
+     * @details As ConfigurationDatabase::Read.
+     */
+    virtual bool Read(const char8 * const name,
+                      const AnyType &value);
+
+    /**
+     * @see StructuredDataI::GetType
+     */
+    virtual AnyType GetType(const char8 * const name);
+
+    /**
+     * @see StructuredDataI::Write
+     * @details As ConfigurationDatabase::Write. Fails if the database is frozen.
+     */
+    virtual bool Write(const char8 * const name,
+                       const AnyType &value);
+
+    /**
+     * @see StructuredDataI::Copy
+     */
+    virtual bool Copy(StructuredDataI &destination);
+
+    /**
+     * @see StructuredDataI::MoveToRoot
+     */
+    virtual bool MoveToRoot();
+
+    /**
+     * @see StructuredDataI::MoveToAncestor
+     */
+    virtual bool MoveToAncestor(const uint32 generations);
+
+    /**
+     * @see StructuredDataI::MoveAbsolute
+     */
+    virtual bool MoveAbsolute(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::MoveRelative
+     */
+    virtual bool MoveRelative(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::MoveToChild
+     */
+    virtual bool MoveToChild(const uint32 childIdx);
+
+    /**
+     * @see StructuredDataI::CreateAbsolute
+     * @details Fails if the database is frozen.
+     */
+    virtual bool CreateAbsolute(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::CreateRelative
+     * @details Fails if the database is frozen.
+     */
+    virtual bool CreateRelative(const char8 * const path);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool AddToCurrentNode(Reference node);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool Delete(const char8 * const name);
+
+    /**
+     * @see StructuredDataI::GetName
+     */
+    virtual const char8 *GetName();
+
+    /**
+     * @see StructuredDataI::GetChildName
+     */
+    virtual const char8 *GetChildName(const uint32 index);
+
+    /**
+     * @see StructuredDataI::GetNumberOfChildren
+     */
+    virtual uint32 GetNumberOfChildren();
+
+    /**
+     * @brief Builds the database from a StructuredDataI and freezes it.
+     * @details Calls data.Copy(*this) and Freeze.
+     * @return true if data.Copy(*this) is successful.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+private:
+
+    /**
+     * @brief The storage of the database, which is shared by the copies of a frozen database.
+     */
+    struct Storage;
+
+    /**
+     * @brief Disallow the assignment.
+     */
+    ImmutableConfigurationDatabase &operator=(const ImmutableConfigurationDatabase &toCopy);
+
+    /**
+     * @brief Allocates \a size bytes in the memory blocks.
+     * @return the 8 bytes aligned memory or NULL if it could not be allocated.
+     */
+    void *Allocate(const uint32 size);
+
+    /**
+     * @brief Gets the index of the interned name.
+     * @param[in] name the name to search.
+     * @param[in] nameSize the number of characters of the name.
+     * @param[in] create if true interns the name if it does not exist yet.
+     * @return the index of the name or IMMUTABLE_CONFIGURATION_DATABASE_NONE if it does not exist (or could not be created).
+     */
+    uint32 InternName(const char8 * const name,
+                      const uint32 nameSize,
+                      const bool create);
+
+    /**
+     * @brief Gets the child of \a parent with the name \a name.
+     * @return the index of the child or IMMUTABLE_CONFIGURATION_DATABASE_NONE if it does not exist.
+     */
+    uint32 FindChild(const uint32 parent,
+                     const uint32 name) const;
+
+    /**
+     * @brief Gets the child of \a parent with the name \a name (not interned).
+     * @return the index of the child or IMMUTABLE_CONFIGURATION_DATABASE_NONE if it does not exist.
+     */
+    uint32 FindChild(const uint32 parent,
+                     const char8 * const name,
+                     const uint32 nameSize);
+
+    /**
+     * @brief Gets the \a index child of \a parent.
+     * @return the index of the child or IMMUTABLE_CONFIGURATION_DATABASE_NONE if it does not exist.
+     */
+    uint32 GetChild(const uint32 parent,
+                    const uint32 index) const;
+
+    /**
+     * @brief Appends a new entry as the last child of \a parent.
+     * @return the index of the new entry or IMMUTABLE_CONFIGURATION_DATABASE_NONE if it could not be allocated.
+     */
+    uint32 AddEntry(const uint32 parent,
+                    const uint32 name,
+                    const uint32 value);
+
+    /**
+     * @brief Adds the entry \a entry to the (parent, name) hash table (growing it if needed).
+     * @return true if the table could be allocated.
+     */
+    bool IndexEntry(const uint32 entry);
+
+    /**
+     * @brief Walks a dot separated path of nodes starting from \a start.
+     * @return the index of the node or IMMUTABLE_CONFIGURATION_DATABASE_NONE if the path does not lead to a node.
+     */
+    uint32 FindNode(const uint32 start,
+                    const char8 * const path);
+
+    /**
+     * @brief Creates the nodes of a dot separated path relative to the current node.
+     * @return true if at least one node was created.
+     */
+    bool CreateNodes(const char8 * const path);
+
+    /**
+     * @brief Stores a copy of \a typeIn (with the same memory layout used by the AnyObject) in the memory blocks.
+     * @param[in] typeIn the value to be copied.
+     * @param[out] typeOut the copy.
+     * @return true if the value is supported and could be copied.
+     */
+    bool SerialiseValue(const AnyType &typeIn,
+                        AnyType &typeOut);
+
+    /**
+     * @brief Allocates and copies a string in the memory blocks.
+     * @return the copy or NULL if it could not be allocated.
+     */
+    char8 *CopyString(const char8 * const string,
+                      const uint32 size);
+
+    /**
+     * The storage of the database.
+     */
+    Storage *storage;
+
+    /**
+     * The index of the current node.
+     */
+    uint32 currentNode;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* IMMUTABLECONFIGURATIONDATABASE_H_ */
@@ -43,42 +43,81 @@
 namespace MARTe {
 
 /**
- * @brief Gets the next character from the stream.
- * @param[in] stream is the stream of characters to be read.
- * @param[out] c is the read character.
- * @return false if EOF, true otherwise.
+ * @brief Builds the escape character in case when '\' is read.
+ * @param[out] c is the character in output.
+ * @return true if the character in input matches a known escape sequence, false otherwise.
  */
-static bool GetC(StreamI &stream,
-                 char8 &c) {
-    uint32 charSize = 1u;
-    bool ret = stream.Read(&c, charSize);
-    return (ret) && (charSize == 1u);
+static bool EscapeChar(char8 &c) {
+    bool ret = true;
+    switch (c) {
+    case ('n'): {
+        c = '\n';
+    }
+        break;
+    case ('t'): {
+        c = '\t';
+    }
+        break;
+    case ('r'): {
+        c = '\r';
+    }
+        break;
+    case ('"'): {
+        c = '"';
+    }
+        break;
+    case ('\\'): {
+        c = '\\';
+    }
+        break;
+    default: {
+        ret = false;
+    }
+    }
+    return ret;
 }
 
-/**
- * @brief Reads the comment on single lines.
- * @param[in] stream is the stream of characters to be read.
- */
-static void ReadCommentOneLine(StreamI &stream) {
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
+Token * LexicalAnalyzer::GetToken() {
+    // delete the previous token
+    if (token != NULL) {
+        delete token;
+    }
+    TokenizeInput();
+    if (!tokenQueue.Extract(0u, token)) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Extract() of the token from the token stack");
+    }
+    return token;
+}
+
+/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
+Token *LexicalAnalyzer::PeekToken(const uint32 position) {
+
+    TokenizeInput(position);
+    Token *peekToken = static_cast<Token*>(NULL);
+    if (!tokenQueue.Peek(position, peekToken)) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Peek() of the token from the token stack");
+    }
+    return peekToken;
+
+}
+
+void LexicalAnalyzer::ReadCommentOneLine() {
 
     char8 c = ' ';
     while (c != '\n') {
-        if (!GetC(stream, c)) {
+        if (!GetC(c)) {
             break;
         }
     }
 }
 
-/**
- * @brief Reads the comment on multiple lines.
- * @param[in] stream is the stream of characters to be read.
- * @param[out] lineNumber is the token line number.
- * @param[in] multipleLineEnd C-string containing the pattern
- * that it is used for marking the end of a multiple line comment.
- */
-static void ReadCommentMultipleLines(StreamI &stream,
-                                     uint32 &lineNumber,
-                                     const char8 * const multipleLineEnd) {
+void LexicalAnalyzer::ReadCommentMultipleLines() {
+    const char8 * const multipleLineEnd = multipleLineCommentEnd.Buffer();
 
     char8 c = ' ';
     uint32 size = StringHelper::Length(multipleLineEnd);
@@ -86,7 +125,7 @@ static void ReadCommentMultipleLines(StreamI &stream,
 
     // read the next characters to match the end of comment
     for (uint32 i = 0u; i < size; i++) {
-        if (!GetC(stream, c)) {
+        if (!GetC(c)) {
             break;
         }
         if (c == '\n') {
@@ -98,7 +137,7 @@ static void ReadCommentMultipleLines(StreamI &stream,
 
     while (StringHelper::Compare(&buffer[0], multipleLineEnd) != 0) {
 
-        if (!GetC(stream, c)) {
+        if (!GetC(c)) {
             break;
         }
         for (uint32 i = 1u; i < size; i++) {
@@ -113,33 +152,12 @@ static void ReadCommentMultipleLines(StreamI &stream,
     }
 }
 
-/**
- * @brief Skips the comments in the stream.
- * @param[in] stream is the stream of characters to be read.
- * @param[out] buffer contains the data read from the stream.
- * @param[out] bufferSize the actual size of the data in buffer
- * @param[out] lineNumber is the token line number.
- * @param[in] separators is the separator characters list.
- * @param[in] oneLineBegin C-string containing the pattern that
- * it is used for marking the beginning of a single line comment.
- * @param[in] multipleLineBegin C-string containing the pattern that
- * it is used for marking the beginning of a multiple line comment.
- * @param[in] multipleLineEnd C-string containing the pattern that
- * it is used for marking the end of a multiple line comment.
- * @param[out] separator returns the separator char found at the end of the comment.
- * @param[in] isNewToken specifies if the separators at the beginning must be skipped or not.
- * @return false if EOF, true otherwise.
- */
-static bool SkipComment(StreamI &stream,
-                        char8 * const buffer,
-                        uint32 &bufferSize,
-                        uint32 &lineNumber,
-                        const char8 * const separators,
-                        const char8 * const oneLineBegin,
-                        const char8 * const multipleLineBegin,
-                        const char8 * const multipleLineEnd,
-                        char8 &separator,
-                        const bool isNewToken) {
+bool LexicalAnalyzer::SkipComment(char8 * const buffer,
+                                  uint32 &bufferSize,
+                                  char8 &separator,
+                                  const bool isNewToken) {
+    const char8 * const oneLineBegin = oneLineCommentBegin.Buffer();
+    const char8 * const multipleLineBegin = multipleLineCommentBegin.Buffer();
 
     char8 c = '\0';
     bufferSize = 0u;
@@ -152,9 +170,9 @@ static bool SkipComment(StreamI &stream,
 
     // skip separators before
     while (skip) {
-        if (GetC(stream, c)) {
+        if (GetC(c)) {
             //stop loop, not a separator
-            if (StringHelper::SearchChar(separators, c) == NULL) {
+            if (!IsSeparator(c)) {
                 skip = false;
             }
             else {
@@ -190,7 +208,7 @@ static bool SkipComment(StreamI &stream,
                 isComment = (c == oneLineBegin[i]);
                 buffer[i] = c;
                 if (isComment) {
-                    if (!GetC(stream, c)) {
+                    if (!GetC(c)) {
                         isComment = false;
                         isEOF = true;
                         c = '\0';
@@ -209,7 +227,7 @@ static bool SkipComment(StreamI &stream,
         buffer[i] = '\0';
         if (isComment) {
             // comment on one line
-            ReadCommentOneLine(stream);
+            ReadCommentOneLine();
             buffer[0] = '\0';
             separator = '\n';
         }
@@ -224,7 +242,7 @@ static bool SkipComment(StreamI &stream,
                         c = buffer[i];
                     }
                     else {
-                        if (!GetC(stream, c)) {
+                        if (!GetC(c)) {
                             isComment = false;
                             isEOF = true;
                             c = '\0';
@@ -244,7 +262,7 @@ static bool SkipComment(StreamI &stream,
 
             if (isComment) {
                 // comment on multiple line
-                ReadCommentMultipleLines(stream, lineNumber, multipleLineEnd);
+                ReadCommentMultipleLines();
                 buffer[0] = '\0';
             }
             else {
@@ -263,70 +281,6 @@ static bool SkipComment(StreamI &stream,
     return !isEOF;
 }
 
-/**
- * @brief Builds the escape character in case when '\' is read.
- * @param[out] c is the character in output.
- * @return true if the character in input matches a known escape sequence, false otherwise.
- */
-static bool EscapeChar(char8 &c) {
-    bool ret = true;
-    switch (c) {
-    case ('n'): {
-        c = '\n';
-    }
-        break;
-    case ('t'): {
-        c = '\t';
-    }
-        break;
-    case ('r'): {
-        c = '\r';
-    }
-        break;
-    case ('"'): {
-        c = '"';
-    }
-        break;
-    case ('\\'): {
-        c = '\\';
-    }
-        break;
-    default: {
-        ret = false;
-    }
-    }
-    return ret;
-}
-
-/*---------------------------------------------------------------------------*/
-/*                           Method definitions                              */
-/*---------------------------------------------------------------------------*/
-
-/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
-Token * LexicalAnalyzer::GetToken() {
-    // delete the previous token
-    if (token != NULL) {
-        delete token;
-    }
-    TokenizeInput();
-    if (!tokenQueue.Extract(0u, token)) {
-        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Extract() of the token from the token stack");
-    }
-    return token;
-}
-
-/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
-Token *LexicalAnalyzer::PeekToken(const uint32 position) {
-
-    TokenizeInput(position);
-    Token *peekToken = static_cast<Token*>(NULL);
-    if (!tokenQueue.Peek(position, peekToken)) {
-        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Peek() of the token from the token stack");
-    }
-    return peekToken;
-
-}
-
 LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
                                  const char8 * const terminalsIn,
                                  const char8 * const separatorsIn,
@@ -347,6 +301,7 @@ LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
     tokenInfo[2].Set(NUMBER_TOKEN, "NUMBER");
     tokenInfo[3].Set(ERROR_TOKEN, "ERROR");
     tokenInfo[4].Set(TERMINAL_TOKEN, "TERMINAL");
+    Initialise();
 }
 
 LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
@@ -370,6 +325,35 @@ LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
     tokenInfo[2].Set(NUMBER_TOKEN, "NUMBER");
     tokenInfo[3].Set(ERROR_TOKEN, "ERROR");
     tokenInfo[4].Set(TERMINAL_TOKEN, "TERMINAL");
+    Initialise();
+}
+
+void LexicalAnalyzer::Initialise() {
+    readBuffer = new char8[LEXICAL_ANALYZER_READ_BLOCK_SIZE];
+    readIndex = 0u;
+    readSize = 0u;
+    uint32 i;
+    for (i = 0u; i < 256u; i++) {
+        characterClass[i] = 0u;
+    }
+    //StringHelper::SearchChar also matches the string terminator
+    characterClass[0] = (LEXICAL_ANALYZER_SEPARATOR | LEXICAL_ANALYZER_TERMINAL);
+    const char8 *characters = separators.Buffer();
+    for (i = 0u; characters[i] != '\0'; i++) {
+        characterClass[static_cast<uint8>(characters[i])] |= LEXICAL_ANALYZER_SEPARATOR;
+    }
+    characters = terminals.Buffer();
+    for (i = 0u; characters[i] != '\0'; i++) {
+        characterClass[static_cast<uint8>(characters[i])] |= LEXICAL_ANALYZER_TERMINAL;
+    }
+}
+
+bool LexicalAnalyzer::FillReadBuffer() {
+    uint32 size = LEXICAL_ANALYZER_READ_BLOCK_SIZE;
+    bool ok = inputStream->Read(readBuffer, size);
+    readIndex = 0u;
+    readSize = (ok) ? (size) : (0u);
+    return (readSize > 0u);
 }
 
 /*lint -e{1551} Justification: Memory has to be freed in the destructor.
@@ -388,6 +372,14 @@ LexicalAnalyzer::~LexicalAnalyzer() {
     if (token != NULL) {
         delete token;
     }
+    //Give back to the stream the characters which were read but not consumed
+    if (readIndex < readSize) {
+        uint64 unreadSize = static_cast<uint64>(readSize - readIndex);
+        if (!inputStream->Seek(inputStream->Position() - unreadSize)) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed Seek() while restoring the position of the input stream.");
+        }
+    }
+    delete[] readBuffer;
     inputStream = static_cast<StreamI*>(NULL);
 }
 
@@ -481,8 +473,8 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
     bool ok = true;
     bool isEOF = false;
 
-    StreamString separatorsUsed = separators.Buffer();
-    StreamString terminalsUsed = terminals.Buffer();
+    //When reading a string started with " only the " (or the string terminator) are separators
+    bool inString = false;
 
     while (tokenQueue.GetSize() < (level + 1u)) {
         char8 c = '\0';
@@ -493,8 +485,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         uint32 bufferSize = 0u;
         // skips one or consecutive comments and controls EOF
         while ((ok) && (c == '\0')) {
-            ok = SkipComment(*inputStream, &buffer[0], bufferSize, lineNumber, separators.Buffer(), oneLineCommentBegin.Buffer(),
-                             multipleLineCommentBegin.Buffer(), multipleLineCommentEnd.Buffer(), separator, true);
+            ok = SkipComment(&buffer[0], bufferSize, separator, true);
             c = buffer[0];
             // need to do this for one line comments at the end of the tokens
             if (separator == '\n') {
@@ -518,12 +509,13 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         while (ok) {
             
             //std::cout << tokenString.Buffer() << "\n";
-            if ((StringHelper::SearchChar(separatorsUsed.Buffer(), c) != NULL) && (!escape)) {
+            bool isSeparator = (inString) ? ((c == '"') || (c == '\0')) : (IsSeparator(c));
+            bool isTerminal = (inString) ? ((c == '"') || (c == '\0')) : (IsTerminal(c));
+            if ((isSeparator) && (!escape)) {
                 // this means that a string is found! Read everything until another " is found
                 if (isString1) {
                     tokenString += c;
-                    separatorsUsed = separators;
-                    terminalsUsed = terminals;
+                    inString = false;
                     ok = false;
                 }
                 else {
@@ -532,7 +524,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                 }
                 separator = c;
             }
-            else if ((StringHelper::SearchChar(terminalsUsed.Buffer(), c) != NULL) && (!escape)) {
+            else if ((isTerminal) && (!escape)) {
                 terminal = c;
                 if(bufferSize>0u) {
                     AddToken(tokenString.BufferReference(), isString1);
@@ -555,8 +547,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                     // found a string! read everything until another "
                     if (c == '"') {
                         if (tokenString.Size() == 0u) {
-                            separatorsUsed = "\"";
-                            terminalsUsed = "\"";
+                            inString = true;
                             isString1 = true;
                         }
                     }
@@ -580,11 +571,10 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                 }
                 else {
                     if (isString1) {
-                        ok = GetC(*inputStream, c);
+                        ok = GetC(c);
                     }
                     else {
-                        ok = SkipComment(*inputStream, &buffer[0], bufferSize, lineNumber, separators.Buffer(), oneLineCommentBegin.Buffer(),
-                        multipleLineCommentBegin.Buffer(), multipleLineCommentEnd.Buffer(), separator, false);
+                        ok = SkipComment(&buffer[0], bufferSize, separator, false);
                         if (ok) {
                             // not a comment with a terminal as the next char!
                             bufferIndex=1u;
@@ -630,13 +620,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                     
                     // terminal may be followed by another terminal and their combination may be a keyword, so:
                     char8 nextChar = '\0';
-                    uint32 charSize = 1u;
-                    
-                    uint64  pos = inputStream->Position();
-                    bool readOk = inputStream->Read(&nextChar, charSize);
-                    if (!readOk) {
-                        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Read() while looking ahead in input stream.");
-                    }
+                    (void) PeekC(nextChar);
                     
                     multiCharToken = "";
                     multiCharToken += terminal;
@@ -646,14 +630,13 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                     
                     if ( (StringHelper::SearchString(keywords.Buffer(), multiCharToken.Buffer()) != NULL) && (StringHelper::Compare("", multiCharToken.Buffer()) != 0) ) {
                         AddTerminal(multiCharToken.Buffer());
+                        // the look ahead character is part of the keyword
+                        char8 consumed = '\0';
+                        (void) GetC(consumed);
                     }
-                    // if the terminal is alone, just add it (and reset the stream pointer)
+                    // if the terminal is alone, just add it (the look ahead character is not consumed)
                     else {
                         AddTerminal(terminal);
-                        bool seekOk = inputStream->Seek(pos);
-                        if (!seekOk) {
-                            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Seek() while restoring pointer to current position.");
-                        }
                     }
                 }
         }
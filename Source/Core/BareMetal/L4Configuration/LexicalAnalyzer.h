@@ -43,6 +43,21 @@
 
 namespace MARTe {
 
+/**
+ * Number of characters read from the stream at each StreamI::Read.
+ */
+const uint32 LEXICAL_ANALYZER_READ_BLOCK_SIZE = 16384u;
+
+/**
+ * characterClass flag of the separators.
+ */
+const uint8 LEXICAL_ANALYZER_SEPARATOR = 1u;
+
+/**
+ * characterClass flag of the terminals.
+ */
+const uint8 LEXICAL_ANALYZER_TERMINAL = 2u;
+
 /**
  * @brief Generic lexical analyzer (lexer) which allows to interpret a stream
  * of characters as a sequence of tokens, applying specific lexical rules set
@@ -68,6 +83,11 @@ namespace MARTe {
  * - TERMINAL_TOKEN: If the token is a terminal.
  * - EOF_TOKEN: If the read operation from the stream fails.
  *
+ * The stream is read in blocks of LEXICAL_ANALYZER_READ_BLOCK_SIZE characters
+ * (and the characters are classified as separators or terminals with a table
+ * built at construction time), so the stream must not be read by anyone else
+ * while the lexer is alive. When the lexer is destroyed the stream is moved
+ * back to the position of the first character which was not consumed.
  */
 /*lint -e1712 . Justification: This class must be as per the only defined
  * constructor. No need for a default constructor.*/
@@ -157,7 +177,75 @@ private:
      * @param[in] terminalBuffer is the terminal data.
      */
     void AddTerminal(const char8* const terminalBuffer);
-    
+
+    /**
+     * Disallow the copy of the lexer (the read buffer is owned by the instance).
+     */
+    LexicalAnalyzer(const LexicalAnalyzer &other);
+
+    /**
+     * Disallow the copy of the lexer (the read buffer is owned by the instance).
+     */
+    LexicalAnalyzer &operator=(const LexicalAnalyzer &other);
+
+    /**
+     * @brief Builds the characterClass table and allocates the read buffer.
+     */
+    void Initialise();
+
+    /**
+     * @brief Reads the next block of characters from the stream.
+     * @return false if EOF, true otherwise.
+     */
+    bool FillReadBuffer();
+
+    /**
+     * @brief Gets the next character from the stream.
+     * @param[out] c is the read character.
+     * @return false if EOF, true otherwise.
+     */
+    inline bool GetC(char8 &c);
+
+    /**
+     * @brief Gets the next character from the stream without consuming it.
+     * @param[out] c is the read character.
+     * @return false if EOF, true otherwise.
+     */
+    inline bool PeekC(char8 &c);
+
+    /**
+     * @brief Checks if \a c is one of the separators.
+     */
+    inline bool IsSeparator(const char8 c) const;
+
+    /**
+     * @brief Checks if \a c is one of the terminals.
+     */
+    inline bool IsTerminal(const char8 c) const;
+
+    /**
+     * @brief Reads the comment on single lines.
+     */
+    void ReadCommentOneLine();
+
+    /**
+     * @brief Reads the comment on multiple lines.
+     */
+    void ReadCommentMultipleLines();
+
+    /**
+     * @brief Skips the comments in the stream.
+     * @param[out] buffer contains the data read from the stream.
+     * @param[out] bufferSize the actual size of the data in buffer
+     * @param[out] separator returns the separator char found at the end of the comment.
+     * @param[in] isNewToken specifies if the separators at the beginning must be skipped or not.
+     * @return false if EOF, true otherwise.
+     */
+    bool SkipComment(char8 * const buffer,
+                     uint32 &bufferSize,
+                     char8 &separator,
+                     const bool isNewToken);
+
     /**
      * Internal token queue
      */
@@ -213,6 +301,26 @@ private:
      */
     uint32 lineNumber;
 
+    /**
+     * The characters read from the stream and not yet consumed.
+     */
+    char8 *readBuffer;
+
+    /**
+     * Index of the next character to consume in readBuffer.
+     */
+    uint32 readIndex;
+
+    /**
+     * Number of characters in readBuffer.
+     */
+    uint32 readSize;
+
+    /**
+     * For each character, LEXICAL_ANALYZER_SEPARATOR if it is a separator and LEXICAL_ANALYZER_TERMINAL if it is a terminal.
+     */
+    uint8 characterClass[256];
+
 };
 
 }
@@ -221,5 +329,40 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+bool LexicalAnalyzer::GetC(char8 &c) {
+    bool ok = (readIndex < readSize);
+    if (!ok) {
+        ok = FillReadBuffer();
+    }
+    if (ok) {
+        c = readBuffer[readIndex];
+        readIndex++;
+    }
+    return ok;
+}
+
+bool LexicalAnalyzer::PeekC(char8 &c) {
+    bool ok = (readIndex < readSize);
+    if (!ok) {
+        ok = FillReadBuffer();
+    }
+    if (ok) {
+        c = readBuffer[readIndex];
+    }
+    return ok;
+}
+
+bool LexicalAnalyzer::IsSeparator(const char8 c) const {
+    return ((characterClass[static_cast<uint8>(c)] & LEXICAL_ANALYZER_SEPARATOR) != 0u);
+}
+
+bool LexicalAnalyzer::IsTerminal(const char8 c) const {
+    return ((characterClass[static_cast<uint8>(c)] & LEXICAL_ANALYZER_TERMINAL) != 0u);
+}
+
+}
+
 #endif /* LEXICALANALYZER_H_ */
 
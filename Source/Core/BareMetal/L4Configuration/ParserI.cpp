@@ -33,6 +33,7 @@
 
 #include "ParserI.h"
 #include "AdvancedErrorManagement.h"
+#include "Fnv1aHashFunction.h"
 #include "TypeConversion.h"
 
 /*---------------------------------------------------------------------------*/
@@ -59,6 +60,11 @@ static uint32 GetCurrentTokenLineNumber(const Token *const token) {
     return (token != NULL) ? (token->GetLineNumber()) : 0u;
 }
 
+static uint32 HashSymbolName(const char8 *const name) {
+    Fnv1aHashFunction hashFunction;
+    return hashFunction.Compute(name);
+}
+
 } // namespace MARTe
 
 /*---------------------------------------------------------------------------*/
@@ -78,6 +84,8 @@ ParserI::ParserI(StreamI &stream, BufferedStreamI *const err,
     grammar = grammarIn;
     currentToken = static_cast<Token *>(NULL);
     isError = false;
+    symbolIndex = static_cast<uint32 *>(NULL);
+    symbolIndexSize = 0u;
 
     uint64 pos = stream.Position();
     bool ok = stream.Seek(0ull);
@@ -89,6 +97,66 @@ ParserI::ParserI(StreamI &stream, BufferedStreamI *const err,
 ParserI::~ParserI() {
     currentToken = static_cast<Token *>(NULL);
     errorStream = static_cast<BufferedStreamI *>(NULL);
+    if (symbolIndex != NULL) {
+        delete[] symbolIndex;
+    }
+}
+
+void ParserI::BuildSymbolIndex() {
+    uint32 numberOfSymbols = GetConstant(ParserConstant::START_SYMBOL);
+    uint32 size = 16u;
+    while (size < (numberOfSymbols * 2u)) {
+        size *= 2u;
+    }
+    bool done = false;
+    while (!done) {
+        if (symbolIndex != NULL) {
+            delete[] symbolIndex;
+        }
+        symbolIndex = new uint32[size];
+        symbolIndexSize = size;
+        uint32 mask = size - 1u;
+        uint32 i;
+        for (i = 0u; i < size; i++) {
+            symbolIndex[i] = 0u;
+        }
+        bool collision = false;
+        for (i = 0u; i < numberOfSymbols; i++) {
+            const char8 *name = GetSymbolName(i);
+            if (name != NULL) {
+                uint32 slot = HashSymbolName(name) & mask;
+                while ((symbolIndex[slot] != 0u) && (StringHelper::Compare(GetSymbolName(symbolIndex[slot] - 1u), name) != 0)) {
+                    collision = true;
+                    slot = (slot + 1u) & mask;
+                }
+                // as in a linear search, the last symbol with a given name wins
+                symbolIndex[slot] = i + 1u;
+            }
+        }
+        done = ((!collision) || (size >= ParserConstant::SYMBOL_INDEX_MAX_SIZE));
+        size *= 2u;
+    }
+}
+
+uint32 ParserI::GetSymbolId(const char8 *const name) {
+    if (symbolIndex == NULL) {
+        BuildSymbolIndex();
+    }
+    uint32 ret = 0u;
+    if (name != NULL) {
+        uint32 mask = symbolIndexSize - 1u;
+        uint32 slot = HashSymbolName(name) & mask;
+        bool found = false;
+        while ((!found) && (symbolIndex[slot] != 0u)) {
+            uint32 symbol = symbolIndex[slot] - 1u;
+            if (StringHelper::Compare(GetSymbolName(symbol), name) == 0) {
+                ret = symbol;
+                found = true;
+            }
+            slot = (slot + 1u) & mask;
+        }
+    }
+    return ret;
 }
 
 uint32 ParserI::GetNextTokenType() {
@@ -96,8 +164,6 @@ uint32 ParserI::GetNextTokenType() {
 
     currentToken = tokenProducer.GetToken();
 
-    uint32 endTokendId = GetConstant(
-            ParserConstant::START_SYMBOL); // StringHelper::Length(terminals)+2u;
     const char8 *toCompare = static_cast<const char8 *>(NULL);
 
     // if it is a terminal use the data
@@ -109,11 +175,7 @@ uint32 ParserI::GetNextTokenType() {
         toCompare = currentToken->GetDescription();
     }
     // return the slk token number
-    for (uint32 i = 0u; i < endTokendId; i++) {
-        if (StringHelper::Compare(toCompare, GetSymbolName(i)) == 0) {
-            ret = i;
-        }
-    }
+    ret = GetSymbolId(toCompare);
     return ret;
 }
 
@@ -121,7 +183,6 @@ uint32 ParserI::PeekNextTokenType(const uint32 position) {
     uint32 ret = 0u;
 
     Token *tok = tokenProducer.PeekToken(position);
-    uint32 endTokendId = GetConstant(ParserConstant::START_SYMBOL);
     const char8 *toCompare = static_cast<const char8 *>(NULL);
 
     if (tok->GetId() == TERMINAL_TOKEN) {
@@ -129,11 +190,7 @@ uint32 ParserI::PeekNextTokenType(const uint32 position) {
     } else {
         toCompare = tok->GetDescription();
     }
-    for (uint32 i = 0u; i < endTokendId; i++) {
-        if (StringHelper::Compare(toCompare, GetSymbolName(i)) == 0) {
-            ret = i;
-        }
-    }
+    ret = GetSymbolId(toCompare);
 
     return ret;
 }
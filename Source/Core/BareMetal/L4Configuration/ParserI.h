@@ -231,6 +231,43 @@ protected:
      */
     GrammarInfo grammar;
 
+private:
+
+    /**
+     * @brief Retrieves the identifier of the symbol with name \a name.
+     * @details Builds the symbol index at the first call.
+     * @param[in] name the terminal or the token description to search.
+     * @return the identifier of the symbol or 0 if \a name is not a symbol.
+     */
+    uint32 GetSymbolId(const char8 * const name);
+
+    /**
+     * @brief Builds the hash table of the symbol names.
+     * @details The table is doubled (up to ParserConstant::SYMBOL_INDEX_MAX_SIZE slots)
+     * until no two symbols share a slot, so that each lookup is a single string compare.
+     */
+    void BuildSymbolIndex();
+
+    /**
+     * Disallow the copy of the parser.
+     */
+    ParserI(const ParserI &other);
+
+    /**
+     * Disallow the copy of the parser.
+     */
+    ParserI &operator=(const ParserI &other);
+
+    /**
+     * Hash table of the symbol names. Each slot holds the symbol identifier + 1 (0 if empty).
+     */
+    uint32 *symbolIndex;
+
+    /**
+     * Number of slots of symbolIndex (a power of 2).
+     */
+    uint32 symbolIndexSize;
+
 };
 
 
@@ -281,6 +318,11 @@ static const uint32 TOTAL_CONFLICTS = 7u;
  */
 static const uint32 PARSE_STACK_SIZE = 512u;
 
+/**
+ * The maximum number of slots of the symbol index.
+ */
+static const uint32 SYMBOL_INDEX_MAX_SIZE = 4096u;
+
 }
 
 }
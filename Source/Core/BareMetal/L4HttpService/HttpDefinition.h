@@ -83,6 +83,11 @@ static const int32 HSHCReply = 0x10000000;
  */
 static const int32 HSHCReplyOK = (HSHCReply + 200);
 
+/**
+ * HTTP REPLY NOT MODIFIED
+ */
+static const int32 HSHCReplyNotModified = (HSHCReply + 304);
+
 /**
  * HTTP REPLY BAD REQUEST
  */
@@ -198,6 +203,10 @@ const char8 *GetErrorCodeString(const int32 httpErrorCode) {
         ret = "No Response";
     }
         break;
+    case 304: {
+        ret = "Not Modified";
+    }
+        break;
     case 400: {
         ret = "Bad request";
     }
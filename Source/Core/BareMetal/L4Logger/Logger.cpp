@@ -31,7 +31,10 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "../../BareMetal/L4Logger/Logger.h"
+#include "Sleep.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -51,11 +54,130 @@ void LoggerErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &
         LoggerPage *page = loggerService->GetPage();
         if (page != NULL_PTR(LoggerPage *)) {
             page->errorInfo = errorInfo;
+            page->isDeferred = false;
             (void)MemoryOperationsHelper::Copy(&page->errorStrBuffer[0u], errorDescription, MAX_ERROR_MESSAGE_SIZE);
             loggerService->AddLogEntry(page);
         }
     }
 }
+
+/**
+ * @brief Gets the number of bytes required to store the value of a parameter of a deferred message.
+ * @param[in] parameter the parameter.
+ * @return the number of bytes or 0 if the parameter cannot be stored by value.
+ */
+static uint32 LoggerDeferredParameterSize(const AnyType &parameter) {
+    uint32 size = 0u;
+    TypeDescriptor descriptor = parameter.GetTypeDescriptor();
+    bool isScalar = (!descriptor.isStructuredData);
+    if (isScalar) {
+        isScalar = ((parameter.GetNumberOfDimensions() == 0u) && (parameter.GetBitAddress() == 0u));
+    }
+    if (isScalar) {
+        if (descriptor.type == BT_CCString) {
+            const char8 * const str = static_cast<const char8 *>(parameter.GetDataPointer());
+            if (str != NULL_PTR(const char8 *)) {
+                size = StringHelper::Length(str) + 1u;
+            }
+        }
+        else {
+            bool isValue = ((descriptor.type == SignedInteger) || (descriptor.type == UnsignedInteger) || (descriptor.type == Float));
+            if (!isValue) {
+                isValue = ((descriptor.type == BT_Boolean) || (descriptor.type == Pointer) || (descriptor.type == CArray));
+            }
+            if (isValue) {
+                uint32 numberOfBits = descriptor.numberOfBits;
+                if ((numberOfBits == 8u) || (numberOfBits == 16u) || (numberOfBits == 32u) || (numberOfBits == 64u)) {
+                    size = (numberOfBits / 8u);
+                }
+            }
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Callback function for the deferred formatting. Copies the format and the raw parameters to a page.
+ * @param[in] errorInfo the error information.
+ * @param[in] format the Printf format.
+ * @param[in] parameters the Printf parameters.
+ * @param[in] numberOfParameters the number of parameters.
+ * @return false if the message cannot be stored by value and must be formatted immediately.
+ */
+/*lint -estring(459, "*LoggerDeferredErrorProcessFunction*") this function is supposed to have access to the Logger singleton and to the error information.*/
+static bool LoggerDeferredErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
+                                               const char8 * const format,
+                                               const AnyType * const parameters,
+                                               const uint32 numberOfParameters) {
+    uint32 sizes[MAX_DEFERRED_LOG_PARAMETERS];
+    uint32 offsets[MAX_DEFERRED_LOG_PARAMETERS];
+    bool ok = (format != NULL_PTR(const char8 *)) && (numberOfParameters <= MAX_DEFERRED_LOG_PARAMETERS);
+    uint32 offset = 0u;
+    if (ok) {
+        offset = StringHelper::Length(format) + 1u;
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfParameters) && (ok); i++) {
+        sizes[i] = LoggerDeferredParameterSize(parameters[i]);
+        ok = (sizes[i] > 0u);
+        //Keep the values aligned so that they can be read in place after being copied to an aligned buffer
+        offset = ((offset + 7u) & ~7u);
+        offsets[i] = offset;
+        offset += sizes[i];
+    }
+    if (ok) {
+        ok = (offset <= MAX_ERROR_MESSAGE_SIZE);
+    }
+    if (ok) {
+        Logger *loggerService = Logger::Instance();
+        //If there are no free pages the message is discarded, as it would be if it was formatted immediately
+        LoggerPage *page = loggerService->GetPage();
+        if (page != NULL_PTR(LoggerPage *)) {
+            page->errorInfo = errorInfo;
+            page->isDeferred = true;
+            page->numberOfParameters = numberOfParameters;
+            (void) MemoryOperationsHelper::Copy(&page->errorStrBuffer[0u], format, StringHelper::Length(format) + 1u);
+            for (i = 0u; i < numberOfParameters; i++) {
+                TypeDescriptor descriptor = parameters[i].GetTypeDescriptor();
+                page->parameterTypes[i] = descriptor;
+                page->parameterOffsets[i] = static_cast<uint16>(offsets[i]);
+                void * const dataPointer = parameters[i].GetDataPointer();
+                if (descriptor.type == Pointer) {
+                    //The AnyType of a pointer holds the pointer value itself
+                    (void) MemoryOperationsHelper::Copy(&page->errorStrBuffer[offsets[i]], &dataPointer, sizes[i]);
+                }
+                else {
+                    (void) MemoryOperationsHelper::Copy(&page->errorStrBuffer[offsets[i]], dataPointer, sizes[i]);
+                }
+            }
+            loggerService->AddLogEntry(page);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Formats a deferred message, replacing the format and the raw parameters in the page by the formatted message.
+ * @param[in, out] page the page to format.
+ */
+static void LoggerFormatDeferredPage(LoggerPage &page) {
+    uint64 raw[(MAX_ERROR_MESSAGE_SIZE + 7u) / 8u];
+    (void) MemoryOperationsHelper::Copy(&raw[0], &page.errorStrBuffer[0u], MAX_ERROR_MESSAGE_SIZE);
+    char8 * const rawBytes = reinterpret_cast<char8 *>(&raw[0]);
+    AnyType parameters[MAX_DEFERRED_LOG_PARAMETERS + 1u];
+    uint32 i;
+    for (i = 0u; (i < page.numberOfParameters) && (i < MAX_DEFERRED_LOG_PARAMETERS); i++) {
+        void *dataPointer = &rawBytes[page.parameterOffsets[i]];
+        if (page.parameterTypes[i].type == Pointer) {
+            (void) MemoryOperationsHelper::Copy(&dataPointer, &rawBytes[page.parameterOffsets[i]], static_cast<uint32>(sizeof(void *)));
+        }
+        parameters[i] = AnyType(page.parameterTypes[i], 0u, dataPointer);
+    }
+    StreamMemoryReference smr(&page.errorStrBuffer[0u], MAX_ERROR_MESSAGE_SIZE - 1u);
+    (void) (smr.PrintFormatted(&rawBytes[0], &parameters[0]));
+    page.errorStrBuffer[smr.Size()] = '\0';
+    page.isDeferred = false;
+}
 }
 
 /*---------------------------------------------------------------------------*/
@@ -71,6 +193,10 @@ Logger::Logger(const uint32 numberOfPages) :
         nOfPages(numberOfPages),
         logsIndex(nOfPages, true),
         pagesIndex(nOfPages, false) {
+    wakeUpFunction = NULL_PTR(LoggerWakeUpFunctionType);
+    wakeUpParameter = NULL_PTR(void *);
+    wakeUpCallers = 0;
+    waitingForLogs = 0;
     /*lint -e{1732} -e{1733} new in constructor safe as this class can only be used as a singleton*/
     pages = new LoggerPage[nOfPages];
     SetErrorProcessFunction(&LoggerErrorProcessFunction);
@@ -90,6 +216,7 @@ LoggerPage *Logger::GetPage() {
         if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
             page = &pages[pageNo];
             page->index = pageNo;
+            page->isDeferred = false;
         }
     }
     return page;
@@ -106,6 +233,17 @@ void Logger::ReturnPage(const LoggerPage * const page) {
 void Logger::AddLogEntry(const LoggerPage * const page) {
     if (pages != NULL_PTR(LoggerPage *)) {
         logsIndex.Return(page->index);
+        //Only the first log after PrepareWait wakes up the consumer
+        if (Atomic::Exchange(&waitingForLogs, 0) == 1) {
+            //Announce the call before reading the function, so that SetWakeUpFunction waits for it to complete
+            Atomic::Increment(&wakeUpCallers);
+            LoggerWakeUpFunctionType function = wakeUpFunction;
+            Atomic::AcquireBarrier();
+            if (function != NULL_PTR(LoggerWakeUpFunctionType)) {
+                function(wakeUpParameter);
+            }
+            Atomic::Decrement(&wakeUpCallers);
+        }
     }
 }
 
@@ -115,6 +253,9 @@ LoggerPage *Logger::GetLogEntry() {
         uint32 pageNo = logsIndex.Take();
         if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
             page = &pages[pageNo];
+            if (page->isDeferred) {
+                LoggerFormatDeferredPage(*page);
+            }
         }
     }
     return page;
@@ -128,5 +269,46 @@ uint32 Logger::GetNumberOfLogs() const {
     return logsIndex.GetSize();
 }
 
+void Logger::SetDeferredFormatting(const bool enable) {
+    if (enable) {
+        SetErrorProcessFunction(&LoggerErrorProcessFunction);
+        ErrorManagement::SetDeferredErrorProcessFunction(&LoggerDeferredErrorProcessFunction);
+    }
+    else {
+        ErrorManagement::SetDeferredErrorProcessFunction(NULL_PTR(ErrorManagement::DeferredErrorProcessFunctionType));
+    }
+}
+
+void Logger::SetWakeUpFunction(const LoggerWakeUpFunctionType function,
+                               void * const parameter) {
+    CancelWait();
+    wakeUpFunction = NULL_PTR(LoggerWakeUpFunctionType);
+    //The compare and swap is a full barrier: an AddLogEntry that was not counted will read the NULL function
+    while (!Atomic::CompareAndSwap(&wakeUpCallers, 0, 0)) {
+        Sleep::MSec(1u);
+    }
+    wakeUpParameter = parameter;
+    Atomic::ReleaseBarrier();
+    wakeUpFunction = function;
+}
+
+bool Logger::PrepareWait() {
+    (void) Atomic::Exchange(&waitingForLogs, 1);
+    bool canWait = (logsIndex.GetSize() == 0u);
+    if (!canWait) {
+        CancelWait();
+    }
+    return canWait;
+}
+
+void Logger::CancelWait() {
+    (void) Atomic::Exchange(&waitingForLogs, 0);
+}
+
+/*lint -e{1762} the deferred formatting is a property of the Logger singleton.*/
+bool Logger::IsDeferredFormatting() const {
+    return (ErrorManagement::deferredErrorProcessFunction == &LoggerDeferredErrorProcessFunction);
+}
+
 }
 
@@ -39,6 +39,11 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief The maximum number of parameters of a message whose formatting can be deferred (see Logger::SetDeferredFormatting).
+ */
+static const uint32 MAX_DEFERRED_LOG_PARAMETERS = 10u;
+
 /**
  * @brief Structure to hold information about a log event.
  */
@@ -57,6 +62,27 @@ struct LoggerPage {
      * The page index.
      */
     uint32 index;
+
+    /**
+     * True if errorStrBuffer does not yet hold the message but its format string followed by the
+     * raw parameter values (see Logger::SetDeferredFormatting). Such pages are formatted by GetLogEntry.
+     */
+    bool isDeferred;
+
+    /**
+     * Number of parameters of a deferred message.
+     */
+    uint32 numberOfParameters;
+
+    /**
+     * Type of each parameter of a deferred message.
+     */
+    TypeDescriptor parameterTypes[MAX_DEFERRED_LOG_PARAMETERS];
+
+    /**
+     * Offset in errorStrBuffer of the raw value of each parameter of a deferred message.
+     */
+    uint16 parameterOffsets[MAX_DEFERRED_LOG_PARAMETERS];
     /*lint -e{9150} [MISRA C++ Rule 11-0-1]. Justification this structure behaves like a POD.*/
 };
 
@@ -65,6 +91,11 @@ struct LoggerPage {
  */
 static const uint32 DEFAULT_NUMBER_OF_LOG_PAGES = 128u;
 
+/**
+ * @brief Function called to wake up a consumer that is waiting for logs (see Logger::SetWakeUpFunction).
+ */
+typedef void (*LoggerWakeUpFunctionType)(void * const parameter);
+
 /**
  * @brief The Logger class registers a callback to the SetErrorProcessFunction and adds
  * the logs to a FastResourceContainer queue. These are expected to be consumed by
@@ -88,6 +119,7 @@ public:
 
     /**
      * @brief Returns the oldest LoggerPage available or NULL if no LoggerPage is available.
+     * @details If the formatting of the message was deferred, the message is formatted here, i.e. in the consumer thread.
      * @return the oldest LoggerPage available or NULL if no LoggerPage is available.
      * @warning this page must be later returned to the Logger (see ReturnPage)
      */
@@ -122,6 +154,55 @@ public:
      * @return the number of LoggerPage elements that were not consumed.
      */
     uint32 GetNumberOfLogs() const;
+
+    /**
+     * @brief Enables or disables the deferred formatting of the messages with parameters.
+     * @details When enabled the thread that calls REPORT_ERROR (with parameters) only copies the format string,
+     * a timestamp and the raw value of the parameters into a LoggerPage; the Printf formatting is executed by
+     * GetLogEntry, i.e. by the consumer of the logs (e.g. the LoggerService thread).
+     * Only scalar numbers, booleans, characters, pointers and C strings are stored by value. Messages with other
+     * parameters (e.g. a StreamString or an array), with more than MAX_DEFERRED_LOG_PARAMETERS parameters, or that
+     * do not fit in the page are formatted immediately, as when the deferred formatting is disabled.
+     * @param[in] enable true to enable the deferred formatting.
+     * @post
+     *   IsDeferredFormatting() == enable
+     * @warning calling SetErrorProcessFunction disables the deferred formatting.
+     */
+    void SetDeferredFormatting(const bool enable);
+
+    /**
+     * @brief Checks if the deferred formatting is enabled.
+     * @return true if the deferred formatting is enabled.
+     */
+    bool IsDeferredFormatting() const;
+
+    /**
+     * @brief Sets the function that AddLogEntry calls to wake up a consumer waiting for logs (see PrepareWait).
+     * @details The function is called by the thread that adds the log, at most once for each PrepareWait.
+     * Only one consumer can be woken up: a new call replaces the previous function.
+     * This method only returns when no AddLogEntry is calling the previous function, so that the previous
+     * parameter may be destroyed afterwards (e.g. after setting a NULL function).
+     * @param[in] function the function to call (NULL to disable the wake up).
+     * @param[in] parameter the parameter to pass to \a function.
+     */
+    void SetWakeUpFunction(const LoggerWakeUpFunctionType function,
+                           void * const parameter);
+
+    /**
+     * @brief Announces that the consumer is about to wait for logs.
+     * @details After this call the next AddLogEntry calls the wake up function. The consumer shall therefore reset
+     * its wake up condition before calling this method and only wait if it returns true. Lost wake ups are not
+     * possible as the pending logs are checked after the wait is announced.
+     * @return true if there are no logs to consume, i.e. if the caller may wait.
+     * @post
+     *   if the return value is false the wait is cancelled (see CancelWait).
+     */
+    bool PrepareWait();
+
+    /**
+     * @brief Cancels the wait announced by PrepareWait, so that AddLogEntry does not call the wake up function.
+     */
+    void CancelWait();
 private:
 
     /**
@@ -154,6 +235,26 @@ private:
      */
     FastResourceContainer pagesIndex;
 
+    /**
+     * The function called to wake up a waiting consumer. Published (with release semantics) after wakeUpParameter.
+     */
+    volatile LoggerWakeUpFunctionType wakeUpFunction;
+
+    /**
+     * The parameter of wakeUpFunction. Only changed while wakeUpFunction is NULL and no thread is calling it.
+     */
+    void * volatile wakeUpParameter;
+
+    /**
+     * Number of AddLogEntry calls that are reading or calling wakeUpFunction.
+     */
+    volatile int32 wakeUpCallers;
+
+    /**
+     * 1 if a consumer is waiting for logs (see PrepareWait).
+     */
+    volatile int32 waitingForLogs;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the numberOfPages must be defined on construction and remain constant
      * during object's lifetime*/
@@ -0,0 +1,163 @@
+/**
+ * @file BrokerBufferPool.cpp
+ * @brief Source file for class BrokerBufferPool
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BrokerBufferPool (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BrokerBufferPool.h"
+#include "SlabMemory.h"
+#include "TypeCharacteristics.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Alignment of the entries inside a buffer.
+ */
+static const uint64 BROKER_BUFFER_POOL_ENTRY_ALIGNMENT = 8u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+BrokerBufferPool::BrokerBufferPool() {
+    slab = NULL_PTR(void *);
+    entryOffsets = NULL_PTR(uint32 *);
+    bufferStride = 0u;
+    numberOfBuffers = 0u;
+    numberOfEntries = 0u;
+    hugePageMemory = false;
+    lockedMemory = false;
+}
+
+/*lint -e{1551} the slab must be freed by the destructor*/
+BrokerBufferPool::~BrokerBufferPool() {
+    Free();
+}
+
+bool BrokerBufferPool::Allocate(const uint32 numberOfBuffersIn,
+                                const uint32 * const entrySizes,
+                                const uint32 numberOfEntriesIn,
+                                const bool hugePages,
+                                const bool lockMemory) {
+    Free();
+    bool ok = ((numberOfBuffersIn > 0u) && (numberOfEntriesIn > 0u) && (entrySizes != NULL_PTR(const uint32 *)));
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The number of buffers and the number of entries shall be > 0");
+    }
+    uint64 stride = 0u;
+    if (ok) {
+        entryOffsets = new uint32[numberOfEntriesIn];
+        uint32 e;
+        for (e = 0u; e < numberOfEntriesIn; e++) {
+            entryOffsets[e] = static_cast<uint32>(stride);
+            stride += static_cast<uint64>(entrySizes[e]);
+            stride = ((stride + BROKER_BUFFER_POOL_ENTRY_ALIGNMENT) - 1u) & ~(BROKER_BUFFER_POOL_ENTRY_ALIGNMENT - 1u);
+        }
+        //Each buffer starts on a cache line
+        const uint64 lineSize = static_cast<uint64>(SlabMemory::ALIGNMENT);
+        stride = ((stride + lineSize) - 1u) & ~(lineSize - 1u);
+        ok = ((stride * static_cast<uint64>(numberOfBuffersIn)) <= static_cast<uint64>(MAX_UINT32 - SlabMemory::ALIGNMENT));
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The size of the buffers exceeds %u bytes", MAX_UINT32);
+        }
+    }
+    if (ok) {
+        bufferStride = static_cast<uint32>(stride);
+        numberOfBuffers = numberOfBuffersIn;
+        numberOfEntries = numberOfEntriesIn;
+        slab = SlabMemory::Allocate(bufferStride * numberOfBuffers, hugePages, lockMemory);
+        ok = (slab != NULL_PTR(void *));
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not allocate %u bytes for the broker buffers", bufferStride * numberOfBuffers);
+        }
+    }
+    if (ok) {
+        hugePageMemory = hugePages;
+        lockedMemory = lockMemory;
+    }
+    if (!ok) {
+        Free();
+    }
+    return ok;
+}
+
+void BrokerBufferPool::Free() {
+    if (slab != NULL_PTR(void *)) {
+        if (!SlabMemory::Free(slab)) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Could not free the broker buffers");
+        }
+    }
+    if (entryOffsets != NULL_PTR(uint32 *)) {
+        delete[] entryOffsets;
+        entryOffsets = NULL_PTR(uint32 *);
+    }
+    bufferStride = 0u;
+    numberOfBuffers = 0u;
+    numberOfEntries = 0u;
+    hugePageMemory = false;
+    lockedMemory = false;
+}
+
+void *BrokerBufferPool::GetEntry(const uint32 bufferIdx,
+                                 const uint32 entryIdx) const {
+    void *entry = NULL_PTR(void *);
+    if ((slab != NULL_PTR(void *)) && (bufferIdx < numberOfBuffers) && (entryIdx < numberOfEntries)) {
+        /*lint -e{9016} pointer arithmetic on the slab*/
+        entry = &(static_cast<char8 *>(slab)[(bufferIdx * bufferStride) + entryOffsets[entryIdx]]);
+    }
+    return entry;
+}
+
+uint32 BrokerBufferPool::GetNumberOfBuffers() const {
+    return numberOfBuffers;
+}
+
+uint32 BrokerBufferPool::GetNumberOfEntries() const {
+    return numberOfEntries;
+}
+
+uint32 BrokerBufferPool::GetBufferStride() const {
+    return bufferStride;
+}
+
+bool BrokerBufferPool::IsHugePageMemory() const {
+    return hugePageMemory;
+}
+
+bool BrokerBufferPool::IsLockedMemory() const {
+    return lockedMemory;
+}
+
+}
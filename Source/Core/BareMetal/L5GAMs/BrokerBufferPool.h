@@ -0,0 +1,169 @@
+/**
+ * @file BrokerBufferPool.h
+ * @brief Header file for class BrokerBufferPool
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BrokerBufferPool
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BROKERBUFFERPOOL_H_
+#define BROKERBUFFERPOOL_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Memory of the buffers of a broker, allocated as a single slab (see SlabMemory).
+ * @details The pool holds GetNumberOfBuffers() buffers, each with GetNumberOfEntries() entries (typically one per copy table entry).
+ * The entries of a buffer are packed one after the other (8 byte aligned) and each buffer starts on a cache-line
+ * boundary, so that a consumer walking the buffers reads the memory sequentially and the producer and the consumer
+ * never share a cache line when working on different buffers.
+ * All the memory is zeroed and faulted in by Allocate.
+ */
+class DLL_API BrokerBufferPool {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    BrokerBufferPool();
+
+    /**
+     * @brief Destructor. Frees the slab.
+     */
+    ~BrokerBufferPool();
+
+    /**
+     * @brief Allocates the slab (freeing any previously allocated slab).
+     * @param[in] numberOfBuffersIn the number of buffers.
+     * @param[in] entrySizes the size in bytes of each entry of a buffer.
+     * @param[in] numberOfEntriesIn the number of elements in \a entrySizes.
+     * @param[in] hugePages if true try to allocate the slab on huge pages.
+     * @param[in] lockMemory if true try to lock the slab in memory.
+     * @return true if the slab was allocated.
+     * @pre
+     *   numberOfBuffersIn > 0 &&
+     *   numberOfEntriesIn > 0
+     */
+    bool Allocate(const uint32 numberOfBuffersIn,
+                  const uint32 * const entrySizes,
+                  const uint32 numberOfEntriesIn,
+                  const bool hugePages = false,
+                  const bool lockMemory = false);
+
+    /**
+     * @brief Frees the slab.
+     */
+    void Free();
+
+    /**
+     * @brief Gets the address of an entry.
+     * @param[in] bufferIdx the buffer index.
+     * @param[in] entryIdx the entry index.
+     * @return the address of the entry or NULL if the slab was not allocated or if the indexes are out of range.
+     */
+    void *GetEntry(const uint32 bufferIdx,
+                   const uint32 entryIdx) const;
+
+    /**
+     * @brief Gets the number of buffers.
+     * @return the number of buffers.
+     */
+    uint32 GetNumberOfBuffers() const;
+
+    /**
+     * @brief Gets the number of entries in each buffer.
+     * @return the number of entries in each buffer.
+     */
+    uint32 GetNumberOfEntries() const;
+
+    /**
+     * @brief Gets the distance in bytes between two consecutive buffers.
+     * @return the distance in bytes between two consecutive buffers.
+     */
+    uint32 GetBufferStride() const;
+
+    /**
+     * @brief Gets if the slab was requested to be allocated on huge pages.
+     * @return the hugePages value used in the last successful Allocate.
+     */
+    bool IsHugePageMemory() const;
+
+    /**
+     * @brief Gets if the slab was requested to be locked in memory.
+     * @return the lockMemory value used in the last successful Allocate.
+     */
+    bool IsLockedMemory() const;
+
+private:
+
+    /**
+     * The slab memory.
+     */
+    void *slab;
+
+    /**
+     * Offset of each entry with respect to the beginning of its buffer.
+     */
+    uint32 *entryOffsets;
+
+    /**
+     * Distance in bytes between two consecutive buffers.
+     */
+    uint32 bufferStride;
+
+    /**
+     * Number of buffers.
+     */
+    uint32 numberOfBuffers;
+
+    /**
+     * Number of entries in each buffer.
+     */
+    uint32 numberOfEntries;
+
+    /**
+     * True if the slab was requested on huge pages.
+     */
+    bool hugePageMemory;
+
+    /**
+     * True if the slab was requested to be locked in memory.
+     */
+    bool lockedMemory;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BROKERBUFFERPOOL_H_ */
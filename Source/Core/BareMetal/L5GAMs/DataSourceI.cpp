@@ -34,8 +34,10 @@
 #include "AdvancedErrorManagement.h"
 #include "ConfigurationDatabase.h"
 #include "DataSourceI.h"
+#include "Fnv1aHashFunction.h"
 #include "GAM.h"
 #include "MemoryMapBroker.h"
+#include "MemoryOperationsHelper.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "ReferenceContainerFilterReferences.h"
@@ -44,6 +46,115 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief Gets the index of a direction in the DataSourceIFunctionProperties arrays.
+ */
+static uint32 GetDirectionIndex(const SignalDirection direction) {
+    return (direction == OutputSignals) ? (1u) : (0u);
+}
+
+/**
+ * @brief Appends a string, and its terminator, to the string pool.
+ * @return true if the string could be written.
+ */
+static bool AddToPool(StreamString &pool,
+                      const char8 * const string,
+                      uint32 &offset) {
+    offset = static_cast<uint32>(pool.Size());
+    uint32 size = StringHelper::Length(string) + 1u;
+    return pool.Write(string, size);
+}
+
+/**
+ * @brief Reads a string from the current node of \a database into the string pool.
+ * @return true if \a name exists.
+ */
+static bool ReadToPool(ConfigurationDatabase &database,
+                       const char8 * const name,
+                       StreamString &pool,
+                       uint32 &offset) {
+    StreamString value;
+    bool ok = database.Read(name, value);
+    if (ok) {
+        ok = AddToPool(pool, value.Buffer(), offset);
+    }
+    return ok;
+}
+
+/**
+ * @brief Hashes a signal or function name.
+ */
+static uint32 HashName(const char8 * const name) {
+    Fnv1aHashFunction hashFunction;
+    return hashFunction.Compute(name, 0u);
+}
+
+/**
+ * @brief Builds an open addressing hash table with the index + 1 of each element of \a properties, keyed by its qualifiedName.
+ * @details Elements without name (offset 0) are not indexed. The table is kept at most half full.
+ */
+template<typename PropertiesType>
+static void BuildNameIndex(const PropertiesType * const properties,
+                           const uint32 numberOfProperties,
+                           const char8 * const pool,
+                           uint32 *&index,
+                           uint32 &indexSize) {
+    indexSize = 16u;
+    while (indexSize < (numberOfProperties * 2u)) {
+        indexSize *= 2u;
+    }
+    index = new uint32[indexSize];
+    uint32 i;
+    for (i = 0u; i < indexSize; i++) {
+        index[i] = 0u;
+    }
+    uint32 mask = indexSize - 1u;
+    for (i = 0u; i < numberOfProperties; i++) {
+        if (properties[i].qualifiedName != 0u) {
+            uint32 slot = HashName(&pool[properties[i].qualifiedName]) & mask;
+            while (index[slot] != 0u) {
+                slot = (slot + 1u) & mask;
+            }
+            index[slot] = (i + 1u);
+        }
+    }
+}
+
+/**
+ * @brief Searches \a name in a table built with BuildNameIndex.
+ * @return true if \a name was found.
+ */
+template<typename PropertiesType>
+static bool FindInNameIndex(const PropertiesType * const properties,
+                            const char8 * const pool,
+                            const uint32 * const index,
+                            const uint32 indexSize,
+                            const char8 * const name,
+                            uint32 &found) {
+    bool ok = (index != NULL_PTR(const uint32 *)) && (name != NULL_PTR(const char8 *));
+    if (ok) {
+        uint32 mask = indexSize - 1u;
+        uint32 slot = HashName(name) & mask;
+        bool done = false;
+        ok = false;
+        while (!done) {
+            uint32 entry = index[slot];
+            if (entry == 0u) {
+                done = true;
+            }
+            else if (StringHelper::Compare(&pool[properties[entry - 1u].qualifiedName], name) == 0) {
+                found = (entry - 1u);
+                ok = true;
+                done = true;
+            }
+            else {
+                slot = (slot + 1u) & mask;
+            }
+        }
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -52,10 +163,19 @@ DataSourceI::DataSourceI() :
         ReferenceContainer() {
     numberOfSignals = 0u;
     defaultBrokerOptim = false;
+    signalProperties = NULL_PTR(DataSourceISignalProperties *);
+    numberOfSignalProperties = 0u;
+    functionProperties = NULL_PTR(DataSourceIFunctionProperties *);
+    numberOfFunctions = 0u;
+    stringPool = NULL_PTR(char8 *);
+    signalNameIndex = NULL_PTR(uint32 *);
+    signalNameIndexSize = 0u;
+    functionNameIndex = NULL_PTR(uint32 *);
+    functionNameIndexSize = 0u;
 }
 
 DataSourceI::~DataSourceI() {
-
+    FreeCompiledProperties();
 }
 
 bool DataSourceI::Initialise(StructuredDataI & data) {
@@ -109,75 +229,275 @@ bool DataSourceI::SetConfiguredDatabase(StructuredDataI & data) {
         signalsDatabaseNode = configuredDatabase;
         numberOfSignals = configuredDatabase.GetNumberOfChildren();
     }
+    FreeCompiledProperties();
+    //Offset 0 is the empty string
+    StreamString pool;
+    if (ret) {
+        uint32 emptyOffset;
+        ret = AddToPool(pool, "", emptyOffset);
+    }
+    if (ret) {
+        ret = CompileSignalProperties(pool);
+    }
+    if (ret) {
+        ret = CompileFunctionProperties(pool);
+    }
+    //The derived classes expect the configuredDatabase to be left on the Signals node
+    if (ret) {
+        configuredDatabase = signalsDatabaseNode;
+    }
+    if (ret) {
+        uint32 poolSize = static_cast<uint32>(pool.Size());
+        stringPool = new char8[poolSize];
+        ret = MemoryOperationsHelper::Copy(stringPool, pool.Buffer(), poolSize);
+    }
+    if (ret) {
+        BuildNameIndex(signalProperties, numberOfSignalProperties, stringPool, signalNameIndex, signalNameIndexSize);
+        BuildNameIndex(functionProperties, numberOfFunctions, stringPool, functionNameIndex, functionNameIndexSize);
+    }
+    else {
+        FreeCompiledProperties();
+    }
+    return ret;
+}
+
+bool DataSourceI::CompileSignalProperties(StreamString &pool) {
+    bool ret = true;
+    numberOfSignalProperties = numberOfSignals;
+    if (numberOfSignalProperties > 0u) {
+        signalProperties = new DataSourceISignalProperties[numberOfSignalProperties];
+    }
     uint32 n;
-    for (n=0u; (n<numberOfSignals) && (ret); n++) {
-        StreamString signalName;
+    for (n = 0u; n < numberOfSignalProperties; n++) {
+        signalProperties[n].qualifiedName = 0u;
+        signalProperties[n].type = InvalidType;
+        signalProperties[n].numberOfElements = 0u;
+        signalProperties[n].byteSize = 0u;
+        signalProperties[n].numberOfDimensions = 0u;
+        signalProperties[n].hasNumberOfDimensions = false;
+        signalProperties[n].hasNumberOfElements = false;
+        signalProperties[n].hasByteSize = false;
+    }
+    for (n = 0u; (n < numberOfSignalProperties) && (ret); n++) {
+        DataSourceISignalProperties &properties = signalProperties[n];
+        configuredDatabase = signalsDatabaseNode;
         ret = configuredDatabase.MoveToChild(n);
         if (ret) {
-            ret = configuredDatabase.Read("QualifiedName", signalName);
+            ret = ReadToPool(configuredDatabase, "QualifiedName", pool, properties.qualifiedName);
         }
         if (ret) {
-            uint32 nn = n;
-            ret = signalNameCache.Write(signalName.Buffer(), nn);
+            StreamString signalType;
+            if (configuredDatabase.Read("Type", signalType)) {
+                properties.type = TypeDescriptor::GetTypeDescriptorFromTypeName(signalType.Buffer());
+            }
+            properties.hasNumberOfDimensions = configuredDatabase.Read("NumberOfDimensions", properties.numberOfDimensions);
+            properties.hasNumberOfElements = configuredDatabase.Read("NumberOfElements", properties.numberOfElements);
+            properties.hasByteSize = configuredDatabase.Read("MemberSize", properties.byteSize);
+            if (!properties.hasByteSize) {
+                properties.hasByteSize = configuredDatabase.Read("ByteSize", properties.byteSize);
+            }
         }
-        if (ret) {
-            ret = configuredDatabase.MoveToAncestor(1u);
+    }
+    return ret;
+}
+
+bool DataSourceI::CompileFunctionProperties(StreamString &pool) {
+    bool ret = true;
+    configuredDatabase = functionsDatabaseNode;
+    numberOfFunctions = configuredDatabase.GetNumberOfChildren();
+    if (numberOfFunctions > 0u) {
+        functionProperties = new DataSourceIFunctionProperties[numberOfFunctions];
+    }
+    uint32 f;
+    uint32 d;
+    for (f = 0u; f < numberOfFunctions; f++) {
+        functionProperties[f].qualifiedName = 0u;
+        functionProperties[f].hasQualifiedName = false;
+        for (d = 0u; d < 2u; d++) {
+            functionProperties[f].hasSignals[d] = false;
+            functionProperties[f].hasByteSize[d] = false;
+            functionProperties[f].numberOfChildren[d] = 0u;
+            functionProperties[f].byteSize[d] = 0u;
+            functionProperties[f].signals[d] = NULL_PTR(DataSourceIFunctionSignalProperties *);
+        }
+    }
+    const char8 * const directionNames[2u] = { "InputSignals", "OutputSignals" };
+    for (f = 0u; (f < numberOfFunctions) && (ret); f++) {
+        DataSourceIFunctionProperties &function = functionProperties[f];
+        configuredDatabase = functionsDatabaseNode;
+        bool isFunction = configuredDatabase.MoveToChild(f);
+        if (isFunction) {
+            function.hasQualifiedName = ReadToPool(configuredDatabase, "QualifiedName", pool, function.qualifiedName);
+        }
+        for (d = 0u; (d < 2u) && (ret) && (isFunction); d++) {
+            function.hasSignals[d] = configuredDatabase.MoveRelative(directionNames[d]);
+            if (function.hasSignals[d]) {
+                function.hasByteSize[d] = configuredDatabase.Read("ByteSize", function.byteSize[d]);
+                uint32 numberOfChildren = configuredDatabase.GetNumberOfChildren();
+                if (numberOfChildren > 0u) {
+                    function.signals[d] = new DataSourceIFunctionSignalProperties[numberOfChildren];
+                }
+                uint32 s;
+                for (s = 0u; s < numberOfChildren; s++) {
+                    DataSourceIFunctionSignalProperties &signal = function.signals[d][s];
+                    signal.qualifiedName = 0u;
+                    signal.alias = 0u;
+                    signal.broker = 0u;
+                    signal.byteOffsets = NULL_PTR(uint32 *);
+                    signal.numberOfByteOffsets = 0u;
+                    signal.samples = 1u;
+                    signal.frequency = -1.0F;
+                    signal.trigger = 0u;
+                    signal.gamMemoryOffset = 0u;
+                    signal.isSignal = false;
+                    signal.hasQualifiedName = false;
+                    signal.hasBroker = false;
+                    signal.hasGAMMemoryOffset = false;
+                    signal.zeroCopy = false;
+                }
+                function.numberOfChildren[d] = numberOfChildren;
+                for (s = 0u; (s < numberOfChildren) && (ret); s++) {
+                    DataSourceIFunctionSignalProperties &signal = function.signals[d][s];
+                    signal.isSignal = configuredDatabase.MoveToChild(s);
+                    if (signal.isSignal) {
+                        signal.hasQualifiedName = ReadToPool(configuredDatabase, "QualifiedName", pool, signal.qualifiedName);
+                        if (!ReadToPool(configuredDatabase, "Alias", pool, signal.alias)) {
+                            signal.alias = 0u;
+                        }
+                        signal.hasBroker = ReadToPool(configuredDatabase, "Broker", pool, signal.broker);
+                        if (!configuredDatabase.Read("Samples", signal.samples)) {
+                            signal.samples = 1u;
+                        }
+                        if (!configuredDatabase.Read("Frequency", signal.frequency)) {
+                            signal.frequency = -1.0F;
+                        }
+                        if (!configuredDatabase.Read("Trigger", signal.trigger)) {
+                            signal.trigger = 0u;
+                        }
+                        signal.hasGAMMemoryOffset = configuredDatabase.Read("GAMMemoryOffset", signal.gamMemoryOffset);
+                        uint32 zeroCopy;
+                        if (configuredDatabase.Read("ZeroCopy", zeroCopy)) {
+                            signal.zeroCopy = (zeroCopy == 1u);
+                        }
+                        AnyType byteOffset = configuredDatabase.GetType("ByteOffset");
+                        if (byteOffset.GetDataPointer() != NULL_PTR(void *)) {
+                            signal.numberOfByteOffsets = byteOffset.GetNumberOfElements(1u);
+                        }
+                        if (signal.numberOfByteOffsets > 0u) {
+                            signal.byteOffsets = new uint32[signal.numberOfByteOffsets * 2u];
+                            Matrix<uint32> byteOffsetMat(signal.byteOffsets, signal.numberOfByteOffsets, 2u);
+                            ret = configuredDatabase.Read("ByteOffset", byteOffsetMat);
+                        }
+                        if (ret) {
+                            ret = configuredDatabase.MoveToAncestor(1u);
+                        }
+                    }
+                }
+                if (ret) {
+                    ret = configuredDatabase.MoveToAncestor(1u);
+                }
+            }
         }
     }
     return ret;
 }
 
+void DataSourceI::FreeCompiledProperties() {
+    if (signalProperties != NULL_PTR(DataSourceISignalProperties *)) {
+        delete[] signalProperties;
+        signalProperties = NULL_PTR(DataSourceISignalProperties *);
+    }
+    numberOfSignalProperties = 0u;
+    if (functionProperties != NULL_PTR(DataSourceIFunctionProperties *)) {
+        uint32 f;
+        for (f = 0u; f < numberOfFunctions; f++) {
+            uint32 d;
+            for (d = 0u; d < 2u; d++) {
+                DataSourceIFunctionSignalProperties *signals = functionProperties[f].signals[d];
+                if (signals != NULL_PTR(DataSourceIFunctionSignalProperties *)) {
+                    uint32 s;
+                    for (s = 0u; s < functionProperties[f].numberOfChildren[d]; s++) {
+                        if (signals[s].byteOffsets != NULL_PTR(uint32 *)) {
+                            delete[] signals[s].byteOffsets;
+                        }
+                    }
+                    delete[] signals;
+                }
+            }
+        }
+        delete[] functionProperties;
+        functionProperties = NULL_PTR(DataSourceIFunctionProperties *);
+    }
+    numberOfFunctions = 0u;
+    if (stringPool != NULL_PTR(char8 *)) {
+        delete[] stringPool;
+        stringPool = NULL_PTR(char8 *);
+    }
+    if (signalNameIndex != NULL_PTR(uint32 *)) {
+        delete[] signalNameIndex;
+        signalNameIndex = NULL_PTR(uint32 *);
+    }
+    signalNameIndexSize = 0u;
+    if (functionNameIndex != NULL_PTR(uint32 *)) {
+        delete[] functionNameIndex;
+        functionNameIndex = NULL_PTR(uint32 *);
+    }
+    functionNameIndexSize = 0u;
+}
+
 uint32 DataSourceI::GetNumberOfSignals() const {
     return numberOfSignals;
 }
 
 bool DataSourceI::GetSignalName(const uint32 signalIdx, StreamString &signalName) {
-    bool ret = MoveToSignalIndex(signalIdx);
+    bool ret = (signalIdx < numberOfSignalProperties);
     if (ret) {
-        ret = configuredDatabase.Read("QualifiedName", signalName);
+        signalName = GetPoolString(signalProperties[signalIdx].qualifiedName);
     }
     return ret;
 }
 
 bool DataSourceI::GetSignalIndex(uint32 &signalIdx, const char8* const signalName) {
-    return signalNameCache.Read(signalName, signalIdx);
+    return FindInNameIndex(signalProperties, stringPool, signalNameIndex, signalNameIndexSize, signalName, signalIdx);
 }
 
 TypeDescriptor DataSourceI::GetSignalType(const uint32 signalIdx) {
     TypeDescriptor signalTypeDescriptor = InvalidType;
-    bool ret = MoveToSignalIndex(signalIdx);
-    StreamString signalType;
-    if (ret) {
-        ret = configuredDatabase.Read("Type", signalType);
-    }
-    if (ret) {
-        signalTypeDescriptor = TypeDescriptor::GetTypeDescriptorFromTypeName(signalType.Buffer());
+    if (signalIdx < numberOfSignalProperties) {
+        signalTypeDescriptor = signalProperties[signalIdx].type;
     }
     return signalTypeDescriptor;
 }
 
 bool DataSourceI::GetSignalNumberOfDimensions(const uint32 signalIdx, uint8 &numberOfDimensions) {
-    bool ret = MoveToSignalIndex(signalIdx);
+    bool ret = (signalIdx < numberOfSignalProperties);
     if (ret) {
-        ret = configuredDatabase.Read("NumberOfDimensions", numberOfDimensions);
+        ret = signalProperties[signalIdx].hasNumberOfDimensions;
+    }
+    if (ret) {
+        numberOfDimensions = signalProperties[signalIdx].numberOfDimensions;
     }
     return ret;
 }
 
 bool DataSourceI::GetSignalNumberOfElements(const uint32 signalIdx, uint32 &numberOfElements) {
-    bool ret = MoveToSignalIndex(signalIdx);
+    bool ret = (signalIdx < numberOfSignalProperties);
     if (ret) {
-        ret = configuredDatabase.Read("NumberOfElements", numberOfElements);
+        ret = signalProperties[signalIdx].hasNumberOfElements;
+    }
+    if (ret) {
+        numberOfElements = signalProperties[signalIdx].numberOfElements;
     }
     return ret;
 }
 
 bool DataSourceI::GetSignalByteSize(const uint32 signalIdx, uint32 &byteSize) {
-    bool ret = MoveToSignalIndex(signalIdx);
+    bool ret = (signalIdx < numberOfSignalProperties);
     if (ret) {
-        if (!configuredDatabase.Read("MemberSize", byteSize)) {
-            ret = configuredDatabase.Read("ByteSize", byteSize);
-        }
+        ret = signalProperties[signalIdx].hasByteSize;
+    }
+    if (ret) {
+        byteSize = signalProperties[signalIdx].byteSize;
     }
     return ret;
 }
@@ -357,51 +677,34 @@ bool DataSourceI::MoveToSignalIndex(const uint32 signalIdx) {
 }
 
 uint32 DataSourceI::GetNumberOfFunctions() {
-    configuredDatabase = functionsDatabaseNode;
-    return configuredDatabase.GetNumberOfChildren();
+    return numberOfFunctions;
 }
 
 bool DataSourceI::GetFunctionName(const uint32 functionIdx, StreamString &functionName) {
-    bool ret = MoveToFunctionIndex(functionIdx);
+    bool ret = (functionIdx < numberOfFunctions);
+    if (ret) {
+        ret = functionProperties[functionIdx].hasQualifiedName;
+    }
     if (ret) {
-        ret = configuredDatabase.Read("QualifiedName", functionName);
+        functionName = GetPoolString(functionProperties[functionIdx].qualifiedName);
     }
     return ret;
 }
 
 bool DataSourceI::GetFunctionIndex(uint32 &functionIdx, const char8* const functionName) {
-
-    uint32 numberOfFunctions = GetNumberOfFunctions();
-    bool ret = true;
-    bool found = false;
-    uint32 i;
-    for (i = 0u; (i < numberOfFunctions) && (ret) && (!found); i++) {
-        StreamString searchName;
-        ret = GetFunctionName(i, searchName);
-        if (ret) {
-            found = (StringHelper::Compare(functionName, searchName.Buffer()) == 0);
-            functionIdx = i;
-        }
-    }
-    if (ret) {
-        ret = found;
-    }
-    return ret;
+    return FindInNameIndex(functionProperties, stringPool, functionNameIndex, functionNameIndexSize, functionName, functionIdx);
 }
 
 bool DataSourceI::GetFunctionNumberOfSignals(const SignalDirection direction, const uint32 functionIdx, uint32 &numSignals) {
-    const char8 *signalDirection = "InputSignals";
-    if (direction == OutputSignals) {
-        signalDirection = "OutputSignals";
-    }
+    uint32 d = GetDirectionIndex(direction);
     numSignals = 0u;
-    bool ret = MoveToFunctionIndex(functionIdx);
+    bool ret = (functionIdx < numberOfFunctions);
     if (ret) {
-        if (configuredDatabase.MoveRelative(signalDirection)) {
+        if (functionProperties[functionIdx].hasSignals[d]) {
             //Ignore the ByteSize
-            ret = (configuredDatabase.GetNumberOfChildren() > 1u);
+            ret = (functionProperties[functionIdx].numberOfChildren[d] > 1u);
             if (ret) {
-                numSignals = configuredDatabase.GetNumberOfChildren() - 1u;
+                numSignals = functionProperties[functionIdx].numberOfChildren[d] - 1u;
             }
         }
     }
@@ -409,15 +712,15 @@ bool DataSourceI::GetFunctionNumberOfSignals(const SignalDirection direction, co
 }
 
 bool DataSourceI::GetFunctionSignalsByteSize(const SignalDirection direction, const uint32 functionIdx, uint32 &byteSize) {
-    const char8 *signalDirection = "InputSignals";
-    if (direction == OutputSignals) {
-        signalDirection = "OutputSignals";
-    }
+    uint32 d = GetDirectionIndex(direction);
     byteSize = 0u;
-    bool ret = MoveToFunctionIndex(functionIdx);
+    bool ret = (functionIdx < numberOfFunctions);
     if (ret) {
-        if (configuredDatabase.MoveRelative(signalDirection)) {
-            ret = configuredDatabase.Read("ByteSize", byteSize);
+        if (functionProperties[functionIdx].hasSignals[d]) {
+            ret = functionProperties[functionIdx].hasByteSize[d];
+            if (ret) {
+                byteSize = functionProperties[functionIdx].byteSize[d];
+            }
         }
     }
 
@@ -425,21 +728,22 @@ bool DataSourceI::GetFunctionSignalsByteSize(const SignalDirection direction, co
 }
 
 bool DataSourceI::GetFunctionSignalName(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, StreamString &functionSignalName) {
-
-    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
+    const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(direction, functionIdx, functionSignalIdx);
+    bool ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
+    if (ret) {
+        ret = properties->hasQualifiedName;
+    }
     if (ret) {
-        ret = configuredDatabase.Read("QualifiedName", functionSignalName);
+        functionSignalName = GetPoolString(properties->qualifiedName);
     }
     return ret;
 }
 
 bool DataSourceI::GetFunctionSignalAlias(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, StreamString &functionSignalAlias) {
-
-    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
+    const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(direction, functionIdx, functionSignalIdx);
+    bool ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
     if (ret) {
-        if (!configuredDatabase.Read("Alias", functionSignalAlias)) {
-            functionSignalAlias = "";
-        }
+        functionSignalAlias = GetPoolString(properties->alias);
     }
     return ret;
 }
@@ -464,89 +768,104 @@ bool DataSourceI::GetFunctionSignalIndex(const SignalDirection direction, const
 }
 
 bool DataSourceI::GetFunctionSignalNumberOfByteOffsets(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, uint32 &numberOfByteOffsets) {
-    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
-    AnyType byteOffset;
+    const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(direction, functionIdx, functionSignalIdx);
+    bool ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
     numberOfByteOffsets = 0u;
     if (ret) {
-        byteOffset = configuredDatabase.GetType("ByteOffset");
-        if (byteOffset.GetDataPointer() != NULL_PTR(void *)) {
-            numberOfByteOffsets = byteOffset.GetNumberOfElements(1u);
-        }
+        numberOfByteOffsets = properties->numberOfByteOffsets;
     }
     return ret;
 }
 
 bool DataSourceI::GetFunctionSignalByteOffsetInfo(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, const uint32 byteOffsetIndex, uint32 &byteOffsetStart,
                                                   uint32 &byteOffsetSize) {
-    uint32 numberOfByteOffsets = 0u;
-    bool ret = GetFunctionSignalNumberOfByteOffsets(direction, functionIdx, functionSignalIdx, numberOfByteOffsets);
-    if (ret) {
-        ret = (numberOfByteOffsets > 0u);
-    }
+    const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(direction, functionIdx, functionSignalIdx);
+    bool ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
     if (ret) {
-        ret = (numberOfByteOffsets > byteOffsetIndex);
+        ret = (properties->numberOfByteOffsets > byteOffsetIndex);
     }
     if (ret) {
-        ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
-    }
-
-    Matrix<uint32> byteOffsetMat(numberOfByteOffsets, 2u);
-    if (ret) {
-        ret = configuredDatabase.Read("ByteOffset", byteOffsetMat);
-    }
-    if (ret) {
-        byteOffsetStart = byteOffsetMat(byteOffsetIndex, 0u);
-        byteOffsetSize = byteOffsetMat(byteOffsetIndex, 1u);
+        byteOffsetStart = properties->byteOffsets[byteOffsetIndex * 2u];
+        byteOffsetSize = properties->byteOffsets[(byteOffsetIndex * 2u) + 1u];
     }
 
     return ret;
 }
 
 bool DataSourceI::GetFunctionSignalSamples(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, uint32 &samples) {
-    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
-    if (!configuredDatabase.Read("Samples", samples)) {
-        samples = 1u;
-    }
+    const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(direction, functionIdx, functionSignalIdx);
+    bool ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
+    samples = (ret) ? (properties->samples) : (1u);
     return ret;
 }
 
 bool DataSourceI::GetFunctionSignalReadFrequency(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, float32 &frequency) {
-    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
-    if (!configuredDatabase.Read("Frequency", frequency)) {
-        frequency = -1.0F;
-    }
+    const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(direction, functionIdx, functionSignalIdx);
+    bool ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
+    frequency = (ret) ? (properties->frequency) : (-1.0F);
     return ret;
 }
 
 bool DataSourceI::GetFunctionSignalTrigger(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, uint32 &trigger) {
-    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
-    if (!configuredDatabase.Read("Trigger", trigger)) {
-        trigger = 0u;
-    }
+    const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(direction, functionIdx, functionSignalIdx);
+    bool ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
+    trigger = (ret) ? (properties->trigger) : (0u);
     return ret;
 }
 
 bool DataSourceI::GetFunctionSignalGAMMemoryOffset(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, uint32 &memoryOffset) {
-
-    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
+    const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(direction, functionIdx, functionSignalIdx);
+    bool ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
     if (ret) {
-        ret = configuredDatabase.Read("GAMMemoryOffset", memoryOffset);
+        ret = properties->hasGAMMemoryOffset;
+    }
+    if (ret) {
+        memoryOffset = properties->gamMemoryOffset;
     }
     return ret;
 }
 
 bool DataSourceI::IsSupportedBroker(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, const char8* const brokerClassName) {
-    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
+    const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(direction, functionIdx, functionSignalIdx);
+    bool ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
     if (ret) {
-        StreamString broker;
-        ret = configuredDatabase.Read("Broker", broker);
-        if (ret) {
-            ret = (broker == brokerClassName);
-        }
+        ret = (properties->hasBroker) && (brokerClassName != NULL_PTR(const char8 *));
+    }
+    if (ret) {
+        ret = (StringHelper::Compare(GetPoolString(properties->broker), brokerClassName) == 0);
+    }
+    if (ret) {
+        //The GAM directly accesses the memory of these signals
+        ret = !properties->zeroCopy;
+    }
+    return ret;
+}
+
+bool DataSourceI::IsZeroCopySignal(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx) {
+    const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(direction, functionIdx, functionSignalIdx);
+    bool ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
+    if (ret) {
+        ret = properties->zeroCopy;
     }
     return ret;
 }
 
+const DataSourceIFunctionSignalProperties *DataSourceI::GetFunctionSignalProperties(const SignalDirection direction,
+                                                                                    const uint32 functionIdx,
+                                                                                    const uint32 functionSignalIdx) const {
+    const DataSourceIFunctionSignalProperties *properties = NULL_PTR(const DataSourceIFunctionSignalProperties *);
+    uint32 d = GetDirectionIndex(direction);
+    if (functionIdx < numberOfFunctions) {
+        const DataSourceIFunctionProperties &function = functionProperties[functionIdx];
+        if (functionSignalIdx < function.numberOfChildren[d]) {
+            if (function.signals[d][functionSignalIdx].isSignal) {
+                properties = &function.signals[d][functionSignalIdx];
+            }
+        }
+    }
+    return properties;
+}
+
 bool DataSourceI::MoveToFunctionIndex(const uint32 functionIdx) {
     configuredDatabase = functionsDatabaseNode;
     return configuredDatabase.MoveToChild(functionIdx);
@@ -678,12 +997,15 @@ bool DataSourceI::GetInputBrokers(ReferenceContainer &inputBrokers,
     }
 
     for (uint32 i = 0u; (i < numSignals) && (ret); i++) {
-        //search the GAM in the configured database
-        ret = MoveToFunctionSignalIndex(InputSignals, functionIdx, i);
+        const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(InputSignals, functionIdx, i);
+        ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
         StreamString suggestedBrokerNameIn;
         if (ret) {
             //This was returned by GetBrokerName
-            ret = configuredDatabase.Read("Broker", suggestedBrokerNameIn);
+            ret = properties->hasBroker;
+        }
+        if (ret) {
+            suggestedBrokerNameIn = GetPoolString(properties->broker);
         }
 
         bool isSyncOrTrigger = false;
@@ -707,7 +1029,8 @@ bool DataSourceI::GetInputBrokers(ReferenceContainer &inputBrokers,
             StreamString signalName;
             ret = GetFunctionSignalAlias(InputSignals, functionIdx, i, signalName);
             if (ret) {
-                bool createBroker = true;
+                //The signals with ZeroCopy are directly accessed by the GAM
+                bool createBroker = !IsZeroCopySignal(InputSignals, functionIdx, i);
                 uint32 nBrokers = inputBrokers.Size();
                 for (uint32 j = 0u; (j < nBrokers) && (ret) && (createBroker); j++) {
                     Reference brokerRef = inputBrokers.Get(j);
@@ -773,12 +1096,14 @@ bool DataSourceI::GetOutputBrokers(ReferenceContainer &outputBrokers,
     }
 
     for (uint32 i = 0u; (i < numSignals) && (ret); i++) {
-        //search the gam in the configured database
-        ret = MoveToFunctionSignalIndex(OutputSignals, functionIdx, i);
+        const DataSourceIFunctionSignalProperties *properties = GetFunctionSignalProperties(OutputSignals, functionIdx, i);
+        ret = (properties != NULL_PTR(const DataSourceIFunctionSignalProperties *));
         StreamString suggestedBrokerNameIn;
         if (ret) {
-            //lets try...
-            ret = configuredDatabase.Read("Broker", suggestedBrokerNameIn);
+            ret = properties->hasBroker;
+        }
+        if (ret) {
+            suggestedBrokerNameIn = GetPoolString(properties->broker);
         }
 
         bool isSyncOrTrigger = false;
@@ -802,7 +1127,8 @@ bool DataSourceI::GetOutputBrokers(ReferenceContainer &outputBrokers,
             StreamString signalName;
             ret = GetFunctionSignalAlias(OutputSignals, functionIdx, i, signalName);
             if (ret) {
-                bool createBroker = true;
+                //The signals with ZeroCopy are directly accessed by the GAM
+                bool createBroker = !IsZeroCopySignal(OutputSignals, functionIdx, i);
                 uint32 nBrokers = outputBrokers.Size();
                 for (uint32 j = 0u; (j < nBrokers) && (ret) && (createBroker); j++) {
                     Reference brokerRef = outputBrokers.Get(j);
@@ -856,6 +1182,7 @@ bool DataSourceI::GetOutputBrokers(ReferenceContainer &outputBrokers,
 }
 
 void DataSourceI::Purge(ReferenceContainer &purgeList){
+    FreeCompiledProperties();
     signalsDatabaseNode.Purge();
     functionsDatabaseNode.Purge();
     ReferenceContainer::Purge(purgeList);
@@ -873,6 +1200,19 @@ uint32 DataSourceI::GetCurrentStateBuffer() {
     return 0u;
 }
 
+bool DataSourceI::IsZeroCopySupported() {
+    return false;
+}
+
+bool DataSourceI::IsSignalBufferHandoverSupported() {
+    return false;
+}
+
+/*lint -e{715} The symbols are not referenced because this is a default implementation, i.e. it is expected to be implemented on derived classes.*/
+bool DataSourceI::SynchroniseSignalBuffers(void * const * const signalAddresses) {
+    return false;
+}
+
 /*lint -estring(1960, "*external side-effects*") only the default implementation has no external side effects*/
 void DataSourceI::PrepareInputOffsets() {
 }
@@ -880,6 +1220,15 @@ void DataSourceI::PrepareInputOffsets() {
 void DataSourceI::PrepareOutputOffsets() {
 }
 
+bool DataSourceI::IsOffsetCachingSupported() {
+    return false;
+}
+
+/*lint -e{715} The symbols are not referenced because this is a default implementation, i.e. it is expected to be implemented on derived classes.*/
+bool DataSourceI::IsSignalMemoryMirrored(const uint32 signalIdx) {
+    return false;
+}
+
 /*lint -e{715} The symbols are not referenced because this is a default implementation, i.e. it is expected to be implemented on derived classes.*/
 bool DataSourceI::GetInputOffset(const uint32 signalIdx, const uint32 numberOfSamples, uint32 &offset) {
     return false;
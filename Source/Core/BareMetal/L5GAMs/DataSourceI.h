@@ -50,6 +50,169 @@ enum SignalDirection {
     InputSignals, OutputSignals, None
 };
 
+/**
+ * @brief Properties of a DataSourceI signal, compiled from the configured database.
+ * @details The strings are offsets in the DataSourceI string pool.
+ */
+struct DataSourceISignalProperties {
+    /**
+     * Offset of the QualifiedName.
+     */
+    uint32 qualifiedName;
+
+    /**
+     * The Type.
+     */
+    TypeDescriptor type;
+
+    /**
+     * The NumberOfElements.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * The MemberSize or, if not set, the ByteSize.
+     */
+    uint32 byteSize;
+
+    /**
+     * The NumberOfDimensions.
+     */
+    uint8 numberOfDimensions;
+
+    /**
+     * True if the NumberOfDimensions is set.
+     */
+    bool hasNumberOfDimensions;
+
+    /**
+     * True if the NumberOfElements is set.
+     */
+    bool hasNumberOfElements;
+
+    /**
+     * True if the MemberSize or the ByteSize is set.
+     */
+    bool hasByteSize;
+};
+
+/**
+ * @brief Properties of a signal of a function (i.e. GAM) which interacts with a DataSourceI, compiled from the configured database.
+ * @details The strings are offsets in the DataSourceI string pool. Samples, Frequency and Trigger hold the default values (1, -1 and 0) if not set.
+ */
+struct DataSourceIFunctionSignalProperties {
+    /**
+     * Offset of the QualifiedName.
+     */
+    uint32 qualifiedName;
+
+    /**
+     * Offset of the Alias (the empty string if not set).
+     */
+    uint32 alias;
+
+    /**
+     * Offset of the Broker.
+     */
+    uint32 broker;
+
+    /**
+     * The ByteOffset matrix as {start, size} pairs.
+     */
+    uint32 *byteOffsets;
+
+    /**
+     * Number of rows of the ByteOffset matrix.
+     */
+    uint32 numberOfByteOffsets;
+
+    /**
+     * The Samples.
+     */
+    uint32 samples;
+
+    /**
+     * The Frequency.
+     */
+    float32 frequency;
+
+    /**
+     * The Trigger.
+     */
+    uint32 trigger;
+
+    /**
+     * The GAMMemoryOffset.
+     */
+    uint32 gamMemoryOffset;
+
+    /**
+     * False if the child of the InputSignals/OutputSignals node is not a signal (i.e. the ByteSize).
+     */
+    bool isSignal;
+
+    /**
+     * True if the QualifiedName is set.
+     */
+    bool hasQualifiedName;
+
+    /**
+     * True if the Broker is set.
+     */
+    bool hasBroker;
+
+    /**
+     * True if the GAMMemoryOffset is set.
+     */
+    bool hasGAMMemoryOffset;
+
+    /**
+     * True if ZeroCopy = 1.
+     */
+    bool zeroCopy;
+};
+
+/**
+ * @brief Properties of a function (i.e. GAM) which interacts with a DataSourceI, compiled from the configured database.
+ * @details The arrays are indexed by SignalDirection (InputSignals or OutputSignals).
+ */
+struct DataSourceIFunctionProperties {
+    /**
+     * Offset of the QualifiedName.
+     */
+    uint32 qualifiedName;
+
+    /**
+     * True if the QualifiedName is set.
+     */
+    bool hasQualifiedName;
+
+    /**
+     * True if the InputSignals/OutputSignals node exists.
+     */
+    bool hasSignals[2u];
+
+    /**
+     * True if the ByteSize of the InputSignals/OutputSignals node is set.
+     */
+    bool hasByteSize[2u];
+
+    /**
+     * Number of children of the InputSignals/OutputSignals node (i.e. the signals and the ByteSize).
+     */
+    uint32 numberOfChildren[2u];
+
+    /**
+     * The ByteSize of the InputSignals/OutputSignals node.
+     */
+    uint32 byteSize[2u];
+
+    /**
+     * The children of the InputSignals/OutputSignals node.
+     */
+    DataSourceIFunctionSignalProperties *signals[2u];
+};
+
 /**
  * @brief Interface for the components that interact with hardware.
  * @details The main role of components that implement this interface is to
@@ -82,7 +245,7 @@ public:
     DataSourceI();
 
     /**
-     * @brief NOOP
+     * @brief Frees the compiled signal and function properties.
      */
     virtual ~DataSourceI();
 
@@ -144,6 +307,10 @@ public:
      *        }
      *      }
      *    }
+     *
+     *  The properties of the signals and of the functions are compiled into arrays, so that the GetSignal* (with the exception of the states and of the default value)
+     *  and the GetFunction* methods are answered in constant time (the signal and function names are hashed), without browsing the configured database.
+     *  As these arrays are not modified until the next call to SetConfiguredDatabase, the methods that use them can be safely called from any thread without locking.
      *  @param[in] data the configured database of parameters.
      *  @return true if the \a data can be successfully copied.
      */
@@ -485,6 +652,18 @@ public:
      */
     bool IsSupportedBroker(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, const char8* const brokerClassName);
 
+    /**
+     * @brief Checks if the GAM directly accesses the DataSourceI memory of the signal with index \a functionSignalIdx.
+     * @details These signals are not handled by any broker (see RealTimeApplicationConfigurationBuilder::ResolveZeroCopySignals).
+     * @param[in] direction the signal direction.
+     * @param[in] functionIdx the index of the function.
+     * @param[in] functionSignalIdx the index of the signal in this function.
+     * @return true if the signal was set with ZeroCopy = 1.
+     * @pre
+     *   SetConfiguredDatabase
+     */
+    bool IsZeroCopySignal(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx);
+
     /**
      * @brief For every signal in the provided direction assign a Broker that knows how to copy from the DataSourceI memory to the GAM memory.
      * @param[in] direction are the signal directions.
@@ -584,6 +763,33 @@ public:
      */
     virtual uint32 GetCurrentStateBuffer();
 
+    /**
+     * @brief Returns true if the GAMs can directly access the memory of the signals of this DataSourceI (i.e. without broker copies).
+     * @details A DataSourceI shall only return true if the address returned by GetSignalMemoryBuffer(signalIdx, 0, ...) does not change
+     * after AllocateMemory and if the signal memory is only updated by the real-time thread that executes the GAMs (i.e. never asynchronously).
+     * The signals that can be accessed without copies are selected by RealTimeApplicationConfigurationBuilder::ResolveZeroCopySignals.
+     * @return false (default implementation).
+     */
+    virtual bool IsZeroCopySupported();
+
+    /**
+     * @brief Returns true if this DataSourceI can consume signal memory which is owned by a BrokerI (see SynchroniseSignalBuffers).
+     * @details Allows the brokers that keep their own copies of the signals (e.g. MemoryMapAsyncTriggerOutputBroker) to hand over
+     * a full buffer by reference, instead of copying it into the memory returned by GetSignalMemoryBuffer and then calling Synchronise.
+     * @return false (default implementation).
+     */
+    virtual bool IsSignalBufferHandoverSupported();
+
+    /**
+     * @brief Synchronises the DataSourceI against signal memory which is owned by a BrokerI.
+     * @details Only called if IsSignalBufferHandoverSupported() returns true. The memory is only guaranteed to be valid (and not to be
+     * modified by the real-time thread) until this method returns. Brokers that cannot map every signal to a full buffer (e.g. signals
+     * with ranges or with more than one sample) fall back to the copy and Synchronise.
+     * @param[in] signalAddresses the address of each signal (indexed by signalIdx, i.e. GetNumberOfSignals() elements).
+     * @return false (default implementation).
+     */
+    virtual bool SynchroniseSignalBuffers(void * const * const signalAddresses);
+
     /**
      * @brief Warns the DataSourceI that GetInputOffset will be called.
      * @details Only meaningful for DataSources whose signal offsets vary over time (i.e. multi-buffer DataSources).
@@ -596,6 +802,26 @@ public:
      */
     virtual void PrepareOutputOffsets();
 
+    /**
+     * @brief Returns true if the offsets of a signal only change in PrepareInputOffsets, PrepareOutputOffsets or Synchronise.
+     * @details If true, the value returned by GetInputOffset (or GetOutputOffset) for a given signal and number of samples
+     * is the same for all the copies of that signal in a cycle, so that a BrokerI may query it only once per signal and cycle
+     * (instead of once per copy). TerminateInputCopy and TerminateOutputCopy are still called once per copy but shall not modify the offsets.
+     * Any computation which is common to all the signals should be performed in PrepareInputOffsets (or PrepareOutputOffsets).
+     * @return false (default implementation).
+     */
+    virtual bool IsOffsetCachingSupported();
+
+    /**
+     * @brief Returns true if the GetNumberOfMemoryBuffers() buffers of a signal are followed in memory by a mirror of themselves.
+     * @details If true, the N bytes (with N = GetNumberOfMemoryBuffers() * signal byte size) which follow the buffers of the signal
+     * (as returned by GetSignalMemoryBuffer) map to the same memory as the buffers (see MirroredMemory). A BrokerI can then copy up to N bytes,
+     * starting at any offset inside the buffers, with a single copy (i.e. without splitting the copy when the end of the buffers is reached).
+     * @param[in] signalIdx the index of the signal.
+     * @return false (default implementation).
+     */
+    virtual bool IsSignalMemoryMirrored(const uint32 signalIdx);
+
 
     /**
      * @brief Gets the memory offset (in bytes) from where a given signal should be copied from w.r.t. to the pointer returned by GetSignalMemoryBuffer for the same signalIdx.
@@ -694,9 +920,86 @@ private:
     ConfigurationDatabase functionsDatabaseNode;
 
     /**
-     * Accelerator for the signal names.
+     * @brief Compiles the signalProperties from the Signals node of the configured database.
+     * @param[out] pool where to append the strings.
+     * @return true if all the signals have a QualifiedName and if the memory could be allocated.
      */
-    ConfigurationDatabase signalNameCache;
+    bool CompileSignalProperties(StreamString &pool);
+
+    /**
+     * @brief Compiles the functionProperties from the Functions node of the configured database.
+     * @param[out] pool where to append the strings.
+     * @return true if the memory could be allocated.
+     */
+    bool CompileFunctionProperties(StreamString &pool);
+
+    /**
+     * @brief Frees the compiled properties and the name indexes.
+     */
+    void FreeCompiledProperties();
+
+    /**
+     * @brief Gets the compiled properties of a function signal.
+     * @param[in] direction the signal direction.
+     * @param[in] functionIdx the index of the function.
+     * @param[in] functionSignalIdx the index of the signal in the function.
+     * @return the properties or NULL if the function signal does not exist.
+     */
+    const DataSourceIFunctionSignalProperties *GetFunctionSignalProperties(const SignalDirection direction,
+                                                                           const uint32 functionIdx,
+                                                                           const uint32 functionSignalIdx) const;
+
+    /**
+     * @brief Gets a string from the string pool.
+     * @param[in] offset the offset of the string in the pool.
+     * @return the string at \a offset.
+     */
+    inline const char8 *GetPoolString(const uint32 offset) const;
+
+    /**
+     * The compiled properties of the signals.
+     */
+    DataSourceISignalProperties *signalProperties;
+
+    /**
+     * Number of elements in signalProperties.
+     */
+    uint32 numberOfSignalProperties;
+
+    /**
+     * The compiled properties of the functions.
+     */
+    DataSourceIFunctionProperties *functionProperties;
+
+    /**
+     * Number of elements in functionProperties.
+     */
+    uint32 numberOfFunctions;
+
+    /**
+     * Zero terminated strings referenced by the compiled properties.
+     */
+    char8 *stringPool;
+
+    /**
+     * Open addressing hash table (linear probing) with the signal index + 1 of each signal name (0 for empty slots).
+     */
+    uint32 *signalNameIndex;
+
+    /**
+     * Number of slots in signalNameIndex (a power of two).
+     */
+    uint32 signalNameIndexSize;
+
+    /**
+     * Open addressing hash table (linear probing) with the function index + 1 of each function name (0 for empty slots).
+     */
+    uint32 *functionNameIndex;
+
+    /**
+     * Number of slots in functionNameIndex (a power of two).
+     */
+    uint32 functionNameIndexSize;
 
     /**
      * Default broker optimisation
@@ -708,6 +1011,13 @@ private:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+const char8 *DataSourceI::GetPoolString(const uint32 offset) const {
+    return &stringPool[offset];
+}
+
+}
 
 #endif /* DATASOURCE_H_ */
 
@@ -0,0 +1,194 @@
+/**
+ * @file ExecutableStatistics.cpp
+ * @brief Source file for class ExecutableStatistics
+ * @date 16/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutableStatistics (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ExecutableStatistics.h"
+#include "HeapManager.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Maximum number of times that GetSnapshot retries to get a consistent copy.
+ */
+static const uint32 EXECUTABLE_STATISTICS_MAX_SNAPSHOT_RETRIES = 1000u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ExecutableStatistics *ExecutableStatistics::Allocate(const uint32 numberOfElements,
+                                                     void *&memory) {
+    ExecutableStatistics *statistics = NULL_PTR(ExecutableStatistics *);
+    uint32 memorySize = (numberOfElements * static_cast<uint32>(sizeof(ExecutableStatistics))) + EXECUTABLE_STATISTICS_CACHE_LINE_SIZE;
+    memory = HeapManager::Malloc(memorySize);
+    if (memory != NULL_PTR(void *)) {
+        uintp address = reinterpret_cast<uintp>(memory);
+        uintp misalignment = (address % EXECUTABLE_STATISTICS_CACHE_LINE_SIZE);
+        if (misalignment != 0u) {
+            address += (EXECUTABLE_STATISTICS_CACHE_LINE_SIZE - misalignment);
+        }
+        /*lint -e{923} -e{9091} the address is aligned to the cache line size, which is compatible with the alignment of the class.*/
+        statistics = reinterpret_cast<ExecutableStatistics *>(address);
+        for (uint32 i = 0u; i < numberOfElements; i++) {
+            statistics[i].Initialise();
+        }
+    }
+    return statistics;
+}
+
+void ExecutableStatistics::Free(void *&memory) {
+    if (memory != NULL_PTR(void *)) {
+        (void) HeapManager::Free(memory);
+        memory = NULL_PTR(void *);
+    }
+}
+
+void ExecutableStatistics::Initialise() {
+    sequence = 0u;
+    resetRequested = 0u;
+    ResetCounters();
+}
+
+void ExecutableStatistics::ResetCounters() {
+    numberOfSamples = 0ull;
+    minimum = 0ull;
+    maximum = 0ull;
+    accumulated = 0ull;
+    for (uint32 i = 0u; i < EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS; i++) {
+        histogram[i] = 0u;
+    }
+}
+
+void ExecutableStatistics::RequestReset() {
+    resetRequested = 1u;
+}
+
+bool ExecutableStatistics::GetSnapshot(ExecutableStatistics &snapshot) const {
+    bool ok = false;
+    for (uint32 n = 0u; (n < EXECUTABLE_STATISTICS_MAX_SNAPSHOT_RETRIES) && (!ok); n++) {
+        uint32 before = Atomic::LoadAcquire(&sequence);
+        if ((before & 0x1u) == 0u) {
+            snapshot.numberOfSamples = numberOfSamples;
+            snapshot.minimum = minimum;
+            snapshot.maximum = maximum;
+            snapshot.accumulated = accumulated;
+            for (uint32 i = 0u; i < EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS; i++) {
+                snapshot.histogram[i] = histogram[i];
+            }
+            Atomic::AcquireBarrier();
+            ok = (Atomic::LoadAcquire(&sequence) == before);
+        }
+    }
+    if (ok) {
+        snapshot.sequence = 0u;
+        snapshot.resetRequested = 0u;
+    }
+    return ok;
+}
+
+uint64 ExecutableStatistics::GetNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+uint64 ExecutableStatistics::GetMinimum() const {
+    return minimum;
+}
+
+uint64 ExecutableStatistics::GetMaximum() const {
+    return maximum;
+}
+
+float64 ExecutableStatistics::GetMean() const {
+    float64 mean = 0.0;
+    if (numberOfSamples > 0ull) {
+        mean = static_cast<float64>(accumulated) / static_cast<float64>(numberOfSamples);
+    }
+    return mean;
+}
+
+uint64 ExecutableStatistics::GetPercentile(const float64 percentile) const {
+    uint64 value = 0ull;
+    if (numberOfSamples > 0ull) {
+        float64 target = (percentile * static_cast<float64>(numberOfSamples)) / 100.0;
+        uint64 targetSamples = static_cast<uint64>(target);
+        if (static_cast<float64>(targetSamples) < target) {
+            targetSamples++;
+        }
+        if (targetSamples == 0ull) {
+            targetSamples = 1ull;
+        }
+        uint64 cumulative = 0ull;
+        bool found = false;
+        for (uint32 i = 0u; (i < EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS) && (!found); i++) {
+            cumulative += histogram[i];
+            found = (cumulative >= targetSamples);
+            if (found) {
+                value = GetBucketUpperLimit(i);
+            }
+        }
+        if ((!found) || (value > maximum)) {
+            value = maximum;
+        }
+        if (value < minimum) {
+            value = minimum;
+        }
+    }
+    return value;
+}
+
+uint32 ExecutableStatistics::GetBucketCounter(const uint32 bucketIdx) const {
+    uint32 counter = 0u;
+    if (bucketIdx < EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS) {
+        counter = histogram[bucketIdx];
+    }
+    return counter;
+}
+
+uint64 ExecutableStatistics::GetBucketUpperLimit(const uint32 bucketIdx) {
+    const uint32 subBuckets = (1u << EXECUTABLE_STATISTICS_SUB_BUCKET_BITS);
+    uint64 limit;
+    if (bucketIdx < subBuckets) {
+        limit = static_cast<uint64>(bucketIdx);
+    }
+    else {
+        uint32 msb = (bucketIdx >> EXECUTABLE_STATISTICS_SUB_BUCKET_BITS) + EXECUTABLE_STATISTICS_SUB_BUCKET_BITS - 1u;
+        uint64 sub = static_cast<uint64>(bucketIdx & (subBuckets - 1u));
+        uint32 width = msb - EXECUTABLE_STATISTICS_SUB_BUCKET_BITS;
+        limit = (((static_cast<uint64>(subBuckets) + sub + 1ull) << width) - 1ull);
+    }
+    return limit;
+}
+
+}
@@ -0,0 +1,278 @@
+/**
+ * @file ExecutableStatistics.h
+ * @brief Header file for class ExecutableStatistics
+ * @date 16/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutableStatistics
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTABLESTATISTICS_H_
+#define EXECUTABLESTATISTICS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "CompilerTypes.h"
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Size of a cache line. The ExecutableStatistics arrays are aligned to this boundary so that
+ * the statistics of different threads never share a cache line.
+ */
+static const uint32 EXECUTABLE_STATISTICS_CACHE_LINE_SIZE = 64u;
+
+/**
+ * Number of sub-buckets per power of two in the execution time histogram (log2 of).
+ * With 2 bits each octave is split in 4 buckets, i.e. the relative error of any percentile is at most 25%.
+ */
+static const uint32 EXECUTABLE_STATISTICS_SUB_BUCKET_BITS = 2u;
+
+/**
+ * Number of buckets in the execution time histogram. Covers execution times up to 2^40 ticks.
+ */
+static const uint32 EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS = 160u;
+
+/**
+ * @brief Execution time statistics of a single ExecutableI (GAM or BrokerI).
+ * @details Keeps the number of samples, the minimum, the maximum, the accumulated execution time (to compute the mean)
+ * and a log-linear histogram of the execution times, all expressed in HighResolutionTimer ticks.
+ *
+ * The statistics are updated, without locks, by a single writer (the real-time thread that executes the ExecutableI)
+ * and can be read at any time by any other thread with GetSnapshot. The consistency of the snapshot is guaranteed
+ * by a sequence counter which is odd while the writer is updating the values (i.e. the reader retries).
+ *
+ * The class has no constructor so that arrays of ExecutableStatistics can be placed in pre-allocated, cache-line
+ * aligned, memory (see Allocate). Initialise shall be called before using an instance that was not created with Allocate.
+ * The size of the class is a multiple of EXECUTABLE_STATISTICS_CACHE_LINE_SIZE.
+ */
+class DLL_API ExecutableStatistics {
+public:
+
+    /**
+     * @brief Allocates a cache-line aligned array of ExecutableStatistics and initialises all of its elements.
+     * @param[in] numberOfElements the number of elements in the array.
+     * @param[out] memory the address of the allocated memory (to be freed with Free).
+     * @return the address of the first element of the array or NULL if the memory could not be allocated.
+     */
+    static ExecutableStatistics *Allocate(const uint32 numberOfElements,
+                                          void *&memory);
+
+    /**
+     * @brief Frees the memory previously allocated with Allocate.
+     * @param[in,out] memory the memory returned by Allocate. Set to NULL after being freed.
+     */
+    static void Free(void *&memory);
+
+    /**
+     * @brief Sets all the counters to their initial values.
+     * @warning Not thread safe. Use RequestReset to reset the statistics while the writer is active.
+     */
+    void Initialise();
+
+    /**
+     * @brief Adds a new execution time sample.
+     * @details Shall only be called by the (single) writer thread.
+     * @param[in] elapsedTicks the execution time in HighResolutionTimer ticks.
+     */
+    inline void Update(const uint64 elapsedTicks);
+
+    /**
+     * @brief Asks the writer to reset all the counters before adding the next sample.
+     * @details Can be called from any thread.
+     */
+    void RequestReset();
+
+    /**
+     * @brief Copies a consistent view of the statistics into \a snapshot.
+     * @details Can be called from any thread while the writer is updating the statistics.
+     * @param[out] snapshot where to copy the statistics.
+     * @return true if a consistent snapshot could be taken within a bounded number of retries.
+     */
+    bool GetSnapshot(ExecutableStatistics &snapshot) const;
+
+    /**
+     * @brief Gets the number of samples.
+     * @return the number of samples.
+     */
+    uint64 GetNumberOfSamples() const;
+
+    /**
+     * @brief Gets the minimum execution time.
+     * @return the minimum execution time in ticks (0 if there are no samples).
+     */
+    uint64 GetMinimum() const;
+
+    /**
+     * @brief Gets the maximum execution time.
+     * @return the maximum execution time in ticks.
+     */
+    uint64 GetMaximum() const;
+
+    /**
+     * @brief Gets the mean execution time.
+     * @return the mean execution time in ticks (0 if there are no samples).
+     */
+    float64 GetMean() const;
+
+    /**
+     * @brief Gets the execution time below which \a percentile % of the samples fall.
+     * @details The returned value is the upper limit of the histogram bucket that contains the percentile, bounded by the maximum.
+     * @param[in] percentile the percentile in the range [0, 100].
+     * @return the percentile in ticks (0 if there are no samples).
+     */
+    uint64 GetPercentile(const float64 percentile) const;
+
+    /**
+     * @brief Gets the number of samples in a given histogram bucket.
+     * @param[in] bucketIdx the index of the bucket.
+     * @return the number of samples in the bucket or 0 if \a bucketIdx >= EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS.
+     */
+    uint32 GetBucketCounter(const uint32 bucketIdx) const;
+
+    /**
+     * @brief Gets the histogram bucket where a given execution time is to be stored.
+     * @param[in] ticks the execution time.
+     * @return the bucket index.
+     */
+    static inline uint32 GetBucketIndex(const uint64 ticks);
+
+    /**
+     * @brief Gets the largest execution time that is stored in a given bucket.
+     * @param[in] bucketIdx the index of the bucket.
+     * @return the largest execution time (in ticks) stored in the bucket.
+     */
+    static uint64 GetBucketUpperLimit(const uint32 bucketIdx);
+
+private:
+
+    /**
+     * @brief Sets the number of samples, the minimum, the maximum, the accumulated time and the histogram to zero.
+     */
+    void ResetCounters();
+
+    /**
+     * Odd while the writer is updating the values.
+     */
+    volatile uint32 sequence;
+
+    /**
+     * Set by RequestReset and cleared by the writer.
+     */
+    volatile uint32 resetRequested;
+
+    /**
+     * The number of samples.
+     */
+    uint64 numberOfSamples;
+
+    /**
+     * The minimum execution time.
+     */
+    uint64 minimum;
+
+    /**
+     * The maximum execution time.
+     */
+    uint64 maximum;
+
+    /**
+     * The sum of all the execution times.
+     */
+    uint64 accumulated;
+
+    /**
+     * The execution time histogram.
+     */
+    uint32 histogram[EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS];
+
+    /**
+     * Pads the class to a multiple of the cache line size.
+     */
+    uint8 padding[EXECUTABLE_STATISTICS_CACHE_LINE_SIZE
+            - (((2u * sizeof(uint32)) + (4u * sizeof(uint64)) + (EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS * sizeof(uint32)))
+                    % EXECUTABLE_STATISTICS_CACHE_LINE_SIZE)];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+uint32 ExecutableStatistics::GetBucketIndex(const uint64 ticks) {
+    const uint64 subBuckets = (1ull << EXECUTABLE_STATISTICS_SUB_BUCKET_BITS);
+    uint32 idx;
+    if (ticks < subBuckets) {
+        idx = static_cast<uint32>(ticks);
+    }
+    else {
+        //Find the most significant bit (binary search)
+        uint32 msb = 0u;
+        uint64 value = ticks;
+        uint32 shift = 32u;
+        while (shift > 0u) {
+            if ((value >> shift) != 0ull) {
+                value >>= shift;
+                msb += shift;
+            }
+            shift >>= 1u;
+        }
+        uint32 sub = static_cast<uint32>((ticks >> (msb - EXECUTABLE_STATISTICS_SUB_BUCKET_BITS)) & (subBuckets - 1ull));
+        idx = ((msb - EXECUTABLE_STATISTICS_SUB_BUCKET_BITS + 1u) << EXECUTABLE_STATISTICS_SUB_BUCKET_BITS) + sub;
+        if (idx >= EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS) {
+            idx = (EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS - 1u);
+        }
+    }
+    return idx;
+}
+
+void ExecutableStatistics::Update(const uint64 elapsedTicks) {
+    uint32 seq = sequence + 1u;
+    sequence = seq;
+    Atomic::ReleaseBarrier();
+    if (resetRequested != 0u) {
+        ResetCounters();
+        resetRequested = 0u;
+    }
+    if ((numberOfSamples == 0ull) || (elapsedTicks < minimum)) {
+        minimum = elapsedTicks;
+    }
+    if (elapsedTicks > maximum) {
+        maximum = elapsedTicks;
+    }
+    numberOfSamples++;
+    accumulated += elapsedTicks;
+    histogram[GetBucketIndex(elapsedTicks)]++;
+    Atomic::StoreRelease(&sequence, seq + 1u);
+}
+
+}
+
+#endif /* EXECUTABLESTATISTICS_H_ */
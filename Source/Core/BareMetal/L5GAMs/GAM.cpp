@@ -232,6 +232,27 @@ void* GAM::GetOutputSignalMemory(const uint32 signalIdx) const {
     return ret;
 }
 
+bool GAM::AliasSignalMemory(const SignalDirection direction,
+                            const uint32 signalIdx,
+                            void * const signalAddress) {
+    bool ret = (signalAddress != NULL_PTR(void*));
+    if (ret) {
+        if (direction == InputSignals) {
+            ret = ((signalIdx < numberOfInputSignals) && (inputSignalsMemoryIndexer != NULL_PTR(void**)));
+            if (ret) {
+                inputSignalsMemoryIndexer[signalIdx] = signalAddress;
+            }
+        }
+        else {
+            ret = ((signalIdx < numberOfOutputSignals) && (outputSignalsMemoryIndexer != NULL_PTR(void**)));
+            if (ret) {
+                outputSignalsMemoryIndexer[signalIdx] = signalAddress;
+            }
+        }
+    }
+    return ret;
+}
+
 bool GAM::SetConfiguredDatabase(const ConfigurationDatabase &data) {
     configuredDatabase = data;
     configuredDatabase.SetCurrentNodeAsRootNode();
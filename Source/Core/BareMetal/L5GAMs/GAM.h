@@ -351,6 +351,22 @@ public:
      */
     bool AllocateOutputSignalsMemory();
 
+    /**
+     * @brief Points the signal with index \a signalIdx to memory which is not owned by this GAM (typically the DataSourceI memory).
+     * @details Used by the RealTimeApplication to remove the broker copies of the signals which can be directly accessed
+     * in the DataSourceI memory (see RealTimeApplicationConfigurationBuilder::ResolveZeroCopySignals).
+     * @param[in] direction the signal direction.
+     * @param[in] signalIdx the index of the signal.
+     * @param[in] signalAddress the address to be returned by GetInputSignalMemory(signalIdx) or GetOutputSignalMemory(signalIdx).
+     * @return true if the signal memory was allocated and \a signalIdx is a valid index.
+     * @pre
+     *   AllocateInputSignalsMemory() && AllocateOutputSignalsMemory() &&
+     *   Setup() was not yet called (as the GAM may store the signal addresses).
+     */
+    bool AliasSignalMemory(const SignalDirection direction,
+                           const uint32 signalIdx,
+                           void * const signalAddress);
+
     /**
      * @brief Adds a list of input BrokerI components to this GAM.
      * @details These BrokerI components will be responsible from copying the data from the
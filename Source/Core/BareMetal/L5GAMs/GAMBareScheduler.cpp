@@ -66,20 +66,21 @@ ErrorManagement::ErrorType GAMBareScheduler::StartNextStateExecution() {
     
     ScheduledState *nextState = GetSchedulableStates()[realTimeApplication->GetIndex()];
     uint64 lastCycleTimeStamp = 0u;
+    //Allows the TimingDataSource to select the raw ticks tables of this state.
+    *currentStateIdentifier = nextStateIdentifier;
 
     while(isAlive) { 
         Cycle(0u); 
 
-        uint32 absTime = 0u;
+        uint64 elapsedTicks = 0u;
         if (lastCycleTimeStamp != 0u) {
-            uint64 tmp = (HighResolutionTimer::Counter() - lastCycleTimeStamp);
-            float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-            absTime = static_cast<uint32>(ticksToTime);  //us
+            elapsedTicks = (HighResolutionTimer::Counter() - lastCycleTimeStamp);
         }
-        uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-        if (!MemoryOperationsHelper::Copy(nextState->threads[0].cycleTime, &absTime, sizeToCopy)) {
-            REPORT_ERROR(ErrorManagement::FatalError, "Could not copy cycle time information.");
+        uint64 *cycleTicks = NULL_PTR(uint64 *);
+        if (nextState->threads[0].timingTicks != NULL_PTR(uint64 *)) {
+            cycleTicks = &nextState->threads[0].timingTicks[nextState->threads[0].numberOfExecutables];
         }
+        StoreCycleTime(nextState->threads[0].cycleTime, cycleTicks, elapsedTicks);
         lastCycleTimeStamp = HighResolutionTimer::Counter();
 
         if (maxCycles != 0u) {
@@ -116,7 +117,9 @@ void GAMBareScheduler::Cycle(const uint32 threadId) {
     /*lint -e{613} scheduledStates != NULL as otherwise StartNextStateExecution (and thus Cycle) would never be called.*/
     (void) ExecuteSingleCycle(
         scheduledStates[rtAppIndex]->threads[threadId].executables, 
-        scheduledStates[rtAppIndex]->threads[threadId].numberOfExecutables);
+        scheduledStates[rtAppIndex]->threads[threadId].numberOfExecutables,
+        scheduledStates[rtAppIndex]->threads[threadId].statistics,
+        scheduledStates[rtAppIndex]->threads[threadId].timingTicks);
 }
 CLASS_REGISTER(GAMBareScheduler, "1.0")
 }
@@ -317,14 +317,17 @@ bool GAMDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
                                     const char8 *const functionName,
                                     void *const gamMemPtr) {
 //generally a loop for each supported broker
-    ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
-    bool ret = broker.IsValid();
-    if (ret) {
-        ret = broker->Init(InputSignals, *this, functionName, gamMemPtr, true);
-    }
-    if (ret) {
-        if (broker->GetNumberOfCopies() > 0u) {
-            ret = inputBrokers.Insert(broker);
+    bool ret = true;
+    if (HasBrokeredSignals(InputSignals, functionName)) {
+        ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(InputSignals, *this, functionName, gamMemPtr, true);
+        }
+        if (ret) {
+            if (broker->GetNumberOfCopies() > 0u) {
+                ret = inputBrokers.Insert(broker);
+            }
         }
     }
     return ret;
@@ -333,19 +336,44 @@ bool GAMDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
 bool GAMDataSource::GetOutputBrokers(ReferenceContainer &outputBrokers,
                                      const char8 *const functionName,
                                      void *const gamMemPtr) {
-    ReferenceT<MemoryMapOutputBroker> broker("MemoryMapOutputBroker");
-    bool ret = broker.IsValid();
-    if (ret) {
-        ret = broker->Init(OutputSignals, *this, functionName, gamMemPtr, true);
-    }
-    if (ret) {
-        if (broker->GetNumberOfCopies() > 0u) {
-            ret = outputBrokers.Insert(broker);
+    bool ret = true;
+    if (HasBrokeredSignals(OutputSignals, functionName)) {
+        ReferenceT<MemoryMapOutputBroker> broker("MemoryMapOutputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(OutputSignals, *this, functionName, gamMemPtr, true);
+        }
+        if (ret) {
+            if (broker->GetNumberOfCopies() > 0u) {
+                ret = outputBrokers.Insert(broker);
+            }
         }
     }
     return ret;
 }
 
+bool GAMDataSource::IsZeroCopySupported() {
+    return true;
+}
+
+bool GAMDataSource::HasBrokeredSignals(const SignalDirection direction,
+                                       const char8 *const functionName) {
+    uint32 functionIdx = 0u;
+    uint32 numberOfSignals = 0u;
+    //If the function cannot be found (or has no signals) let the broker report the error
+    bool brokered = !GetFunctionIndex(functionIdx, functionName);
+    if (!brokered) {
+        brokered = !GetFunctionNumberOfSignals(direction, functionIdx, numberOfSignals);
+    }
+    if (!brokered) {
+        brokered = (numberOfSignals == 0u);
+    }
+    for (uint32 i = 0u; (i < numberOfSignals) && (!brokered); i++) {
+        brokered = !IsZeroCopySignal(direction, functionIdx, i);
+    }
+    return brokered;
+}
+
 bool GAMDataSource::SetConfiguredDatabase(StructuredDataI &data) {
     bool ret = DataSourceI::SetConfiguredDatabase(data);
     uint32 nSignals = GetNumberOfSignals();
@@ -131,6 +131,7 @@ public:
      * @param[in] functionName name of the function being queried.
      * @param[in] gamMemPtr the GAM memory where the signals will be read from.
      * @return true if a the MemoryMapInputBroker can be successfully initialised (see MemoryMapInputBroker::Init)
+     * @details No broker is added if all the signals of the function are directly accessed by the GAM (see DataSourceI::IsZeroCopySignal).
      */
     virtual bool GetInputBrokers(
             ReferenceContainer &inputBrokers,
@@ -143,6 +144,7 @@ public:
      * @param[in] functionName name of the function being queried.
      * @param[in] gamMemPtr the GAM memory where the signals will be read from.
      * @return true if a the MemoryMapOutputBroker can be successfully initialised (see MemoryMapOutputBroker::Init)
+     * @details No broker is added if all the signals of the function are directly accessed by the GAM (see DataSourceI::IsZeroCopySignal).
      */
     virtual bool GetOutputBrokers(
             ReferenceContainer &outputBrokers,
@@ -164,6 +166,13 @@ public:
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
 
+    /**
+     * @brief See DataSourceI::IsZeroCopySupported.
+     * @details The signal memory is allocated once (single buffer) and only accessed by the GAMs executing in the same real-time thread.
+     * @return true.
+     */
+    virtual bool IsZeroCopySupported();
+
 protected:
     /**
      * The single buffer memory.
@@ -195,6 +204,16 @@ protected:
      */
     bool forceResetUnusedVariablesAtStateChange;
 
+private:
+    /**
+     * @brief Checks if at least one of the signals of the function \a functionName requires a broker copy.
+     * @param[in] direction the signal direction.
+     * @param[in] functionName name of the function being queried.
+     * @return true if at least one of the signals is not directly accessed by the GAM (see DataSourceI::IsZeroCopySignal).
+     */
+    bool HasBrokeredSignals(const SignalDirection direction,
+                            const char8 * const functionName);
+
 };
 
 }
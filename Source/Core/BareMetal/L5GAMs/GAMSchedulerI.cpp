@@ -60,10 +60,20 @@ GAMSchedulerI::GAMSchedulerI() :
     numberOfStates = 0u;
     currentStateIdentifier = NULL_PTR(uint32 *);
     nextStateIdentifier = 0u;
+    collectStatistics = false;
+    rawTicksTiming = false;
+    ticksToTimeFactor = clockPeriod * 1e6;
 }
 
 /*lint -e{1740} currentStateIdentifier is a pointer to a memory block allocated elsewhere*/
 GAMSchedulerI::~GAMSchedulerI() {
+    FreeStates();
+}
+
+void GAMSchedulerI::FreeStates() {
+    if (timingDataSource.IsValid()) {
+        timingDataSource->RemoveRawTicksTables();
+    }
     if (states != NULL) {
         if (numberOfStates > 0u) {
             uint32 s;
@@ -75,6 +85,13 @@ GAMSchedulerI::~GAMSchedulerI() {
                         if (states[s].threads[t].executables != NULL_PTR(ExecutableI **)) {
                             delete [] states[s].threads[t].executables;
                         }
+                        ExecutableStatistics::Free(states[s].threads[t].statisticsMemory);
+                        if (states[s].threads[t].timingTicks != NULL_PTR(uint64 *)) {
+                            delete [] states[s].threads[t].timingTicks;
+                        }
+                        if (states[s].threads[t].timingSignals != NULL_PTR(uint32 **)) {
+                            delete [] states[s].threads[t].timingSignals;
+                        }
                     }
                     delete [] states[s].threads;
                 }
@@ -83,6 +100,9 @@ GAMSchedulerI::~GAMSchedulerI() {
         delete[] states;
         states = NULL_PTR(ScheduledState *);
     }
+    numberOfStates = 0u;
+    scheduledStates[0] = NULL_PTR(ScheduledState *);
+    scheduledStates[1] = NULL_PTR(ScheduledState *);
 }
 
 bool GAMSchedulerI::Initialise(StructuredDataI & data) {
@@ -94,10 +114,52 @@ bool GAMSchedulerI::Initialise(StructuredDataI & data) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Please specify the TimingDataSource address");
         }
     }
+    if (ret) {
+        uint32 collectStatisticsU = 0u;
+        if (data.Read("CollectStatistics", collectStatisticsU)) {
+            collectStatistics = (collectStatisticsU == 1u);
+        }
+        uint32 rawTicksTimingU = 0u;
+        if (data.Read("RawTicksTiming", rawTicksTimingU)) {
+            rawTicksTiming = (rawTicksTimingU == 1u);
+        }
+        StreamString timingResolution;
+        if (data.Read("TimingResolution", timingResolution)) {
+            if (timingResolution == "Nanoseconds") {
+                ticksToTimeFactor = clockPeriod * 1e9;
+            }
+            else if (timingResolution == "Microseconds") {
+                ticksToTimeFactor = clockPeriod * 1e6;
+            }
+            else {
+                ret = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Invalid TimingResolution %s. Must be either Microseconds or Nanoseconds", timingResolution.Buffer());
+            }
+        }
+    }
 
     return ret;
 }
 
+bool GAMSchedulerI::ConfigureTimingDataSource(Reference realTimeAppIn) {
+    bool ret = true;
+    if (rawTicksTiming) {
+        ReferenceT<RealTimeApplication> rtApp = realTimeAppIn;
+        ret = rtApp.IsValid();
+        if (ret) {
+            timingDataSource = rtApp->Find(timingDataSourceAddress.Buffer());
+            ret = timingDataSource.IsValid();
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "TimingDataSource %s not found", timingDataSourceAddress.Buffer());
+            }
+        }
+        if (ret) {
+            timingDataSource->SetRawTicksTiming(true);
+        }
+    }
+    return ret;
+}
+
 bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
     realTimeApp = realTimeAppIn;
     ReferenceT<RealTimeApplication> rtApp = realTimeApp;
@@ -109,6 +171,8 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
         ret = statesContainer.IsValid();
     }
 
+    //Release the tables of any previous configuration
+    FreeStates();
     if (ret) {
         timingDataSource = rtApp->Find(timingDataSourceAddress.Buffer());
         ret = timingDataSource.IsValid();
@@ -137,6 +201,14 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                     states[i].name = stateElement->GetName();
 
                     states[i].threads = new ScheduledThread[numberOfThreads];
+                    for (uint32 j = 0u; j < numberOfThreads; j++) {
+                        states[i].threads[j].executables = NULL_PTR(ExecutableI **);
+                        states[i].threads[j].numberOfExecutables = 0u;
+                        states[i].threads[j].statistics = NULL_PTR(ExecutableStatistics *);
+                        states[i].threads[j].statisticsMemory = NULL_PTR(void *);
+                        states[i].threads[j].timingTicks = NULL_PTR(uint64 *);
+                        states[i].threads[j].timingSignals = NULL_PTR(uint32 **);
+                    }
 
                     for (uint32 j = 0u; (j < numberOfThreads) && (ret); j++) {
                         ReferenceT<RealTimeThread> threadElement = threadContainer->Get(j);
@@ -174,6 +246,14 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                                 states[i].threads[j].name = threadElement->GetName();
                                 states[i].threads[j].cpu = threadElement->GetCPU();
                                 states[i].threads[j].stackSize = threadElement->GetStackSize();
+                                if (collectStatistics) {
+                                    states[i].threads[j].statistics = ExecutableStatistics::Allocate(numberOfExecutables,
+                                                                                                     states[i].threads[j].statisticsMemory);
+                                    ret = (states[i].threads[j].statistics != NULL_PTR(ExecutableStatistics *));
+                                    if (!ret) {
+                                        REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the execution statistics");
+                                    }
+                                }
                             }
                             uint32 c = 0u;
                             for (uint32 k = 0u; (k < numberOfGams) && (ret); k++) {
@@ -219,6 +299,11 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                                     ret = timingDataSource->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void*&>(currentStateIdentifier));
                                 }
                             }
+
+                            //Register the raw ticks to be converted by the TimingDataSource
+                            if ((ret) && (rawTicksTiming)) {
+                                ret = InsertRawTicksTable(i, j);
+                            }
                         }
                     }
                 }
@@ -232,6 +317,33 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
     return ret;
 }
 
+bool GAMSchedulerI::InsertRawTicksTable(const uint32 stateIdx,
+                                        const uint32 threadIdx) {
+    bool ret = (states != NULL_PTR(ScheduledState *));
+    if (ret) {
+        //lint -e{613} states != NULL checked before entering here.
+        ScheduledThread &thread = states[stateIdx].threads[threadIdx];
+        uint32 numberOfElements = thread.numberOfExecutables + 1u;
+        thread.timingTicks = new uint64[numberOfElements];
+        thread.timingSignals = new uint32*[numberOfElements];
+        for (uint32 e = 0u; e < thread.numberOfExecutables; e++) {
+            thread.timingTicks[e] = 0u;
+            thread.timingSignals[e] = thread.executables[e]->GetTimingSignalAddress();
+        }
+        thread.timingTicks[thread.numberOfExecutables] = 0u;
+        thread.timingSignals[thread.numberOfExecutables] = thread.cycleTime;
+
+        TimingDataSourceRawTicksTable table;
+        table.stateIdentifier = stateIdx;
+        table.ticks = thread.timingTicks;
+        table.signals = thread.timingSignals;
+        table.numberOfElements = numberOfElements;
+        table.ticksToTime = ticksToTimeFactor;
+        ret = timingDataSource->AddRawTicksTable(table);
+    }
+    return ret;
+}
+
 bool GAMSchedulerI::InsertInputBrokers(ReferenceT<GAM> gam,
                                        const char8 * const gamFullName,
                                        const uint32 stateIdx,
@@ -398,11 +510,19 @@ bool GAMSchedulerI::PrepareNextState(const char8 * const currentStateName,
 
 bool GAMSchedulerI::ExecuteSingleCycle(ExecutableI * const * const executables,
                                        const uint32 numberOfExecutables) const {
+    return ExecuteSingleCycle(executables, numberOfExecutables, NULL_PTR(ExecutableStatistics *), NULL_PTR(uint64 *));
+}
+
+bool GAMSchedulerI::ExecuteSingleCycle(ExecutableI * const * const executables,
+                                       const uint32 numberOfExecutables,
+                                       ExecutableStatistics * const statistics,
+                                       uint64 * const timingTicks) const {
     // warning: possible segmentation faults if the previous operations
     // lack or fail and the pointers are invalid.
 
     bool ret = true;
     uint64 absTicks = HighResolutionTimer::Counter();
+    uint64 lastTicks = absTicks;
     for (uint32 i = 0u; (i < numberOfExecutables) && (ret); i++) {
         // save the time before
         // execute the gam/broker
@@ -410,12 +530,23 @@ bool GAMSchedulerI::ExecuteSingleCycle(ExecutableI * const * const executables,
             ret = executables[i]->Execute();
         }
 
-        uint64 tmp = (HighResolutionTimer::Counter() - absTicks);
-        float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-        uint32 absTime = static_cast<uint32>(ticksToTime);  //us
+        uint64 nowTicks = HighResolutionTimer::Counter();
+        if ((statistics != NULL_PTR(ExecutableStatistics *)) && (ret)) {
+            statistics[i].Update(nowTicks - lastTicks);
+        }
+        lastTicks = nowTicks;
+        uint64 tmp = (nowTicks - absTicks);
         if (ret) {
-            uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-            ret = MemoryOperationsHelper::Copy(executables[i]->GetTimingSignalAddress(), &absTime, sizeToCopy);
+            if (timingTicks != NULL_PTR(uint64 *)) {
+                //Converted by the TimingDataSource when read
+                timingTicks[i] = tmp;
+            }
+            else {
+                float64 ticksToTime = static_cast<float64>(tmp) * ticksToTimeFactor;
+                uint32 absTime = static_cast<uint32>(ticksToTime);
+                uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
+                ret = MemoryOperationsHelper::Copy(executables[i]->GetTimingSignalAddress(), &absTime, sizeToCopy);
+            }
         }
         else {
             BrokerI *broker = dynamic_cast<BrokerI *>(executables[i]);
@@ -466,6 +597,127 @@ uint32 GAMSchedulerI::GetNumberOfExecutables(const char8 * const stateName,
     return numberOfExecutables;
 }
 
+bool GAMSchedulerI::GetExecutableStatistics(const char8 * const stateName,
+                                            const char8 * const threadName,
+                                            const uint32 executableIdx,
+                                            ExecutableStatistics &snapshot) const {
+    bool ok = false;
+    if (states != NULL) {
+        bool foundState = false;
+        for (uint32 i = 0u; (i < numberOfStates) && (!foundState); i++) {
+            foundState = StringHelper::Compare(stateName, states[i].name) == 0;
+            if ((foundState) && (states[i].threads != NULL)) {
+                bool foundThread = false;
+                for (uint32 j = 0u; (j < states[i].numberOfThreads) && (!foundThread); j++) {
+                    foundThread = StringHelper::Compare(threadName, states[i].threads[j].name) == 0;
+                    if (foundThread) {
+                        ok = (states[i].threads[j].statistics != NULL_PTR(ExecutableStatistics *));
+                        if (ok) {
+                            ok = (executableIdx < states[i].threads[j].numberOfExecutables);
+                        }
+                        if (ok) {
+                            ok = states[i].threads[j].statistics[executableIdx].GetSnapshot(snapshot);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+void GAMSchedulerI::ResetStatistics() {
+    if (states != NULL) {
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            if (states[i].threads != NULL) {
+                for (uint32 j = 0u; j < states[i].numberOfThreads; j++) {
+                    if (states[i].threads[j].statistics != NULL_PTR(ExecutableStatistics *)) {
+                        for (uint32 e = 0u; e < states[i].threads[j].numberOfExecutables; e++) {
+                            states[i].threads[j].statistics[e].RequestReset();
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+bool GAMSchedulerI::ExportData(StructuredDataI & data) {
+    bool ok = ReferenceContainer::ExportData(data);
+    if ((ok) && (collectStatistics) && (states != NULL)) {
+        ok = data.CreateRelative("Statistics");
+        //Convert ticks to microseconds
+        const float64 ticksToUs = clockPeriod * 1e6;
+        for (uint32 i = 0u; (i < numberOfStates) && (ok); i++) {
+            ok = data.CreateRelative(states[i].name);
+            for (uint32 j = 0u; (j < states[i].numberOfThreads) && (ok); j++) {
+                ScheduledThread &thread = states[i].threads[j];
+                ok = data.CreateRelative(thread.name);
+                for (uint32 e = 0u; (e < thread.numberOfExecutables) && (ok) && (thread.statistics != NULL_PTR(ExecutableStatistics *)); e++) {
+                    StreamString executableName;
+                    BrokerI *broker = dynamic_cast<BrokerI *>(thread.executables[e]);
+                    if (broker != NULL_PTR(BrokerI *)) {
+                        StreamString ownerFunctionName = broker->GetOwnerFunctionName();
+                        StreamString ownerDataSourceName = broker->GetOwnerDataSourceName();
+                        ok = executableName.Printf("%s_%s_%s", ownerFunctionName.Buffer(), ownerDataSourceName.Buffer(),
+                                                   broker->GetClassProperties()->GetName());
+                    }
+                    else {
+                        Object *obj = dynamic_cast<Object *>(thread.executables[e]);
+                        if (obj != NULL_PTR(Object *)) {
+                            executableName = obj->GetName();
+                        }
+                    }
+                    ExecutableStatistics snapshot;
+                    snapshot.Initialise();
+                    if (ok) {
+                        //If a consistent copy cannot be taken export the zeroed statistics
+                        (void) thread.statistics[e].GetSnapshot(snapshot);
+                        ok = data.CreateRelative(executableName.Buffer());
+                    }
+                    if (ok) {
+                        ok = data.Write("Samples", snapshot.GetNumberOfSamples());
+                    }
+                    if (ok) {
+                        ok = data.Write("Min", static_cast<float64>(snapshot.GetMinimum()) * ticksToUs);
+                    }
+                    if (ok) {
+                        ok = data.Write("Max", static_cast<float64>(snapshot.GetMaximum()) * ticksToUs);
+                    }
+                    if (ok) {
+                        ok = data.Write("Mean", snapshot.GetMean() * ticksToUs);
+                    }
+                    if (ok) {
+                        ok = data.Write("P50", static_cast<float64>(snapshot.GetPercentile(50.0)) * ticksToUs);
+                    }
+                    if (ok) {
+                        ok = data.Write("P90", static_cast<float64>(snapshot.GetPercentile(90.0)) * ticksToUs);
+                    }
+                    if (ok) {
+                        ok = data.Write("P99", static_cast<float64>(snapshot.GetPercentile(99.0)) * ticksToUs);
+                    }
+                    if (ok) {
+                        ok = data.Write("P999", static_cast<float64>(snapshot.GetPercentile(99.9)) * ticksToUs);
+                    }
+                    if (ok) {
+                        ok = data.MoveToAncestor(1u);
+                    }
+                }
+                if (ok) {
+                    ok = data.MoveToAncestor(1u);
+                }
+            }
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+        }
+        if (ok) {
+            ok = data.MoveToAncestor(1u);
+        }
+    }
+    return ok;
+}
+
 ScheduledState * const * GAMSchedulerI::GetSchedulableStates() {
     return scheduledStates;
 
@@ -473,6 +725,7 @@ ScheduledState * const * GAMSchedulerI::GetSchedulableStates() {
 
 void GAMSchedulerI::Purge(ReferenceContainer &purgeList) {
     if (timingDataSource.IsValid()) {
+        timingDataSource->RemoveRawTicksTables();
         timingDataSource->Purge(purgeList);
     }
     ReferenceContainer::Purge(purgeList);
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ExecutableI.h"
+#include "ExecutableStatistics.h"
 #include "GAM.h"
 #include "ProcessorType.h"
 #include "ReferenceContainer.h"
@@ -79,6 +80,27 @@ struct ScheduledThread {
      * This thread name.
      */
     const char8 * name;
+
+    /**
+     * The execution time statistics of each ExecutableI (NULL if the statistics are not being collected).
+     */
+    ExecutableStatistics * statistics;
+
+    /**
+     * The memory where the statistics are allocated.
+     */
+    void * statisticsMemory;
+
+    /**
+     * Raw HighResolutionTimer ticks elapsed since the beginning of the cycle until the end of each ExecutableI, followed by the
+     * thread cycle time in ticks (i.e. numberOfExecutables + 1 elements). NULL if RawTicksTiming = 0.
+     */
+    uint64 * timingTicks;
+
+    /**
+     * The timing signal where each element of timingTicks is to be converted to. NULL if RawTicksTiming = 0.
+     */
+    uint32 ** timingSignals;
 };
 
 /**
@@ -113,9 +135,22 @@ struct ScheduledState {
  *    Class = Scheduler_name
  *     ...\n
  *    TimingDataSource = "Name of the TimingDataSource"
+ *    CollectStatistics = 0 //Optional. If 1 the execution time statistics of every ExecutableI are collected. Default is 0.
+ *    RawTicksTiming = 0 //Optional. If 1 the timing signals are stored as raw ticks and only converted when the TimingDataSource is read. Default is 0.
+ *    TimingResolution = Microseconds //Optional. The time unit of the timing signals: Microseconds or Nanoseconds. Default is Microseconds.
  * }\n
  *
  * and it has to be contained in the [RealTimeApplication] declaration.
+ *
+ * @details When CollectStatistics = 1 the minimum, maximum, mean and a log-linear histogram of the execution time of every
+ * ExecutableI (GAM and BrokerI) are kept in pre-allocated, cache-line aligned, per-thread ExecutableStatistics.
+ * These are updated without locks by the real-time threads and can be read from any other thread
+ * (see GetExecutableStatistics and ExportData).
+ *
+ * @details When RawTicksTiming = 1 the real-time threads only store the raw HighResolutionTimer ticks of every ExecutableI (and of the
+ * thread cycle time) in a contiguous per-thread array (see ScheduledThread::timingTicks). The conversion to the TimingResolution
+ * is performed by the TimingDataSource only when its signals are read by a GAM (see TimingDataSource::Synchronise).
+ * With TimingResolution = Nanoseconds the uint32 timing signals overflow for times larger than ~4.29 s.
  */
 class DLL_API GAMSchedulerI: public ReferenceContainer, public StatefulI {
 
@@ -132,7 +167,7 @@ public:
     virtual ~GAMSchedulerI();
 
     /**
-     * @brief Reads the TimingDataSource name.
+     * @brief Reads the TimingDataSource name and the optional CollectStatistics flag.
      * @param[in] data the StructuredDataI with the TimingDataSource.
      * @return false if the TimingDataSource is not defined.
      */
@@ -146,6 +181,14 @@ public:
      */
     virtual bool ConfigureScheduler(Reference realTimeAppIn);
 
+    /**
+     * @brief Informs the TimingDataSource that the timing signals are stored as raw ticks (see TimingDataSource::SetRawTicksTiming).
+     * @details Called by the RealTimeApplication before the brokers are created. NOOP if RawTicksTiming = 0.
+     * @param[in] realTimeAppIn the RealTimeApplication using this scheduler.
+     * @return true if RawTicksTiming = 0 or if the TimingDataSource exists.
+     */
+    bool ConfigureTimingDataSource(Reference realTimeAppIn);
+
     /**
      * @brief Stores the GAMSchedulerRecord for the new state in the next buffer.
      * @param[in] currentStateName is the name of the current state
@@ -163,6 +206,43 @@ public:
      */
     bool ExecuteSingleCycle(ExecutableI * const * const executables, const uint32 numberOfExecutables) const;
 
+    /**
+     * @brief As ExecuteSingleCycle above, also updating the execution time statistics of each ExecutableI.
+     * @param[in] executables the list of ExecutablesIs to be executed
+     * @param[in] numberOfExecutables how many ExecutableIs have to be executed.
+     * @param[in] statistics the statistics of each ExecutableI (see ScheduledThread::statistics). If NULL no statistics are updated.
+     * @param[in] timingTicks where to store the raw execution times (see ScheduledThread::timingTicks). If NULL the execution times
+     * are converted and written directly in the timing signals.
+     */
+    bool ExecuteSingleCycle(ExecutableI * const * const executables, const uint32 numberOfExecutables, ExecutableStatistics * const statistics,
+                            uint64 * const timingTicks) const;
+
+    /**
+     * @brief Gets a consistent copy of the execution time statistics of an ExecutableI.
+     * @param[in] stateName the name of the state.
+     * @param[in] threadName the name of the thread.
+     * @param[in] executableIdx the index of the ExecutableI in the thread (see GetNumberOfExecutables).
+     * @param[out] snapshot where to copy the statistics.
+     * @return true if CollectStatistics = 1, the ExecutableI exists and a consistent copy could be taken.
+     */
+    bool GetExecutableStatistics(const char8 * const stateName, const char8 * const threadName, const uint32 executableIdx,
+                                 ExecutableStatistics &snapshot) const;
+
+    /**
+     * @brief Resets the execution time statistics of all the ExecutableI components in all states.
+     * @details Can be called while the real-time threads are running (the reset is performed by the real-time threads).
+     */
+    void ResetStatistics();
+
+    /**
+     * @brief Exports as ReferenceContainer::ExportData and, if CollectStatistics = 1, adds a node named Statistics
+     * with the execution time statistics (Samples, Min, Max, Mean, P50, P90, P99 and P999 in microseconds) of every ExecutableI,
+     * organised by state and by thread. Brokers are named GAMName_DataSourceName_BrokerClassName.
+     * @param[out] data see ReferenceContainer::ExportData.
+     * @return true if all the information could be exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
     /**
      * @brief Gets the number of ExecutableI components for this \a threadName in this \a stateName.
      * @param[in] stateName the name of the state.
@@ -202,6 +282,20 @@ protected:
      */
     virtual void CustomPrepareNextState()=0;
 
+    /**
+     * @brief Stores the thread cycle time.
+     * @param[out] cycleTime the cycle time signal (written only if \a cycleTicks is NULL).
+     * @param[out] cycleTicks where to store the raw cycle time (see ScheduledThread::timingTicks). If NULL the cycle time is converted
+     * to the TimingResolution and written in \a cycleTime.
+     * @param[in] elapsedTicks the cycle time in ticks.
+     */
+    inline void StoreCycleTime(uint32 * const cycleTime, uint64 * const cycleTicks, const uint64 elapsedTicks) const;
+
+    /**
+     * Factor to convert ticks to the TimingResolution.
+     */
+    float64 ticksToTimeFactor;
+
     /**
      * Clock period
      */
@@ -249,6 +343,30 @@ protected:
      */
     uint32 numberOfStates;
 
+    /**
+     * True if the execution time statistics are to be collected.
+     */
+    bool collectStatistics;
+
+    /**
+     * True if the timing signals are to be stored as raw ticks.
+     */
+    bool rawTicksTiming;
+
+    /**
+     * @brief Helper function to allocate the raw ticks of a thread and to register them in the TimingDataSource.
+     * @param[in] stateIdx the index of the state.
+     * @param[in] threadIdx the index of the thread.
+     * @return true if the table could be registered in the TimingDataSource.
+     */
+    bool InsertRawTicksTable(const uint32 stateIdx, const uint32 threadIdx);
+
+    /**
+     * @brief Frees the scheduled states and removes their raw ticks tables from the TimingDataSource.
+     * @details Called by the destructor and before configuring the scheduler again.
+     */
+    void FreeStates();
+
     /**
      * @brief Helper function to add the input brokers of the \a gam to the table of states to be executed.
      * @param[in] gamFullName the GAM fully qualified name.
@@ -287,5 +405,24 @@ protected:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+void GAMSchedulerI::StoreCycleTime(uint32 * const cycleTime,
+                                   uint64 * const cycleTicks,
+                                   const uint64 elapsedTicks) const {
+    if (cycleTicks != NULL_PTR(uint64 *)) {
+        *cycleTicks = elapsedTicks;
+    }
+    else if (cycleTime != NULL_PTR(uint32 *)) {
+        float64 ticksToTime = static_cast<float64>(elapsedTicks) * ticksToTimeFactor;
+        *cycleTime = static_cast<uint32>(ticksToTime);
+    }
+    else {
+        //NOOP
+    }
+}
+
+}
+
 #endif /* GAMSCHEDULERI_H_ */
 
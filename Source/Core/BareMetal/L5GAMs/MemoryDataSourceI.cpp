@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "MemoryDataSourceI.h"
+#include "MirroredMemory.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -51,9 +52,17 @@ MemoryDataSourceI::MemoryDataSourceI() :
     signalOffsets = NULL_PTR(uint32 *);
     memoryHeap = NULL_PTR(HeapI *);
     signalSize = NULL_PTR(uint32 *);
+    signalMirrored = NULL_PTR(bool *);
+    mirroredBuffers = false;
+    memoryMirrored = false;
 }
 
 MemoryDataSourceI::~MemoryDataSourceI() {
+    if (memoryMirrored) {
+        void *mirroredMemory = reinterpret_cast<void *>(memory);
+        (void) MirroredMemory::Free(mirroredMemory);
+        memory = NULL_PTR(uint8 *);
+    }
     if (memoryHeap != NULL_PTR(HeapI *)) {
         if (memory != NULL_PTR(uint8 *)) {
             /*lint -e{1551} HeapManager::Free is expected to be exception free*/
@@ -71,6 +80,10 @@ MemoryDataSourceI::~MemoryDataSourceI() {
         delete[] signalSize;
         signalSize = NULL_PTR(uint32 *);
     }
+    if (signalMirrored != NULL_PTR(bool *)) {
+        delete[] signalMirrored;
+        signalMirrored = NULL_PTR(bool *);
+    }
 }
 
 bool MemoryDataSourceI::AllocateMemory() {
@@ -111,7 +124,13 @@ bool MemoryDataSourceI::AllocateMemory() {
     if (ret) {
         ret = (numberOfStateBuffers > 0u);
     }
-    if (ret) {
+    if ((ret) && (mirroredBuffers)) {
+        memoryMirrored = AllocateMirroredMemory(numberOfStateBuffers);
+        if (!memoryMirrored) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not allocate the mirrored buffers. Using the heap memory.");
+        }
+    }
+    if ((ret) && (!memoryMirrored)) {
         totalMemorySize = stateMemorySize * numberOfStateBuffers;
         if (memoryHeap != NULL_PTR(HeapI *)) {
             memory = reinterpret_cast<uint8 *>(memoryHeap->Malloc(totalMemorySize));
@@ -122,6 +141,116 @@ bool MemoryDataSourceI::AllocateMemory() {
 
 }
 
+bool MemoryDataSourceI::AllocateMirroredMemory(const uint32 numberOfStateBuffers) {
+    uint32 nOfSignals = GetNumberOfSignals();
+    uint32 granularity = MirroredMemory::GetGranularity();
+    bool ret = ((granularity > 0u) && (nOfSignals > 0u));
+    if (ret) {
+        signalMirrored = new bool[nOfSignals];
+        ret = (signalMirrored != NULL_PTR(bool *));
+    }
+    //The signals which cannot be mirrored are packed at the beginning of each state buffer, followed by the mirrored signals.
+    uint32 plainSize = 0u;
+    uint32 numberOfMirroredSignals = 0u;
+    for (uint32 s = 0u; (s < nOfSignals) && (ret); s++) {
+        /*lint -e{613} signalSize and signalMirrored cannot be NULL as otherwise ret would be false*/
+        uint32 signalBuffersSize = signalSize[s] * numberOfBuffers;
+        signalMirrored[s] = ((signalBuffersSize % granularity) == 0u);
+        if (signalMirrored[s]) {
+            numberOfMirroredSignals++;
+        }
+        else {
+            plainSize += signalBuffersSize;
+        }
+    }
+    if (ret) {
+        ret = (numberOfMirroredSignals > 0u);
+    }
+    uint32 plainRegionSize = (((plainSize + granularity) - 1u) / granularity) * granularity;
+    uint32 numberOfRegionsPerState = numberOfMirroredSignals;
+    if (plainRegionSize > 0u) {
+        numberOfRegionsPerState++;
+    }
+    uint32 numberOfRegions = numberOfRegionsPerState * numberOfStateBuffers;
+    uint32 *regionSizes = NULL_PTR(uint32 *);
+    bool *regionMirrored = NULL_PTR(bool *);
+    if (ret) {
+        regionSizes = new uint32[numberOfRegions];
+        regionMirrored = new bool[numberOfRegions];
+        ret = ((regionSizes != NULL_PTR(uint32 *)) && (regionMirrored != NULL_PTR(bool *)));
+    }
+    uint32 mirroredStateMemorySize = plainRegionSize;
+    uint32 r = 0u;
+    if ((ret) && (plainRegionSize > 0u)) {
+        regionSizes[r] = plainRegionSize;
+        regionMirrored[r] = false;
+        r++;
+    }
+    for (uint32 s = 0u; (s < nOfSignals) && (ret); s++) {
+        /*lint -e{613} signalSize and signalMirrored cannot be NULL as otherwise ret would be false*/
+        if (signalMirrored[s]) {
+            regionSizes[r] = signalSize[s] * numberOfBuffers;
+            regionMirrored[r] = true;
+            mirroredStateMemorySize += (2u * regionSizes[r]);
+            r++;
+        }
+    }
+    //The state buffers have all the same layout
+    for (r = numberOfRegionsPerState; (r < numberOfRegions) && (ret); r++) {
+        /*lint -e{613} regionSizes and regionMirrored cannot be NULL as otherwise ret would be false*/
+        regionSizes[r] = regionSizes[r - numberOfRegionsPerState];
+        regionMirrored[r] = regionMirrored[r - numberOfRegionsPerState];
+    }
+    void *mirroredMemory = NULL_PTR(void *);
+    if (ret) {
+        mirroredMemory = MirroredMemory::Allocate(numberOfRegions, regionSizes, regionMirrored);
+        ret = (mirroredMemory != NULL_PTR(void *));
+    }
+    if (ret) {
+        memory = reinterpret_cast<uint8 *>(mirroredMemory);
+        stateMemorySize = mirroredStateMemorySize;
+        totalMemorySize = mirroredStateMemorySize * numberOfStateBuffers;
+        uint32 plainOffset = 0u;
+        uint32 mirroredOffset = plainRegionSize;
+        for (uint32 s = 0u; s < nOfSignals; s++) {
+            /*lint -e{613} signalOffsets, signalSize and signalMirrored cannot be NULL as otherwise ret would be false*/
+            uint32 signalBuffersSize = signalSize[s] * numberOfBuffers;
+            if (signalMirrored[s]) {
+                signalOffsets[s] = mirroredOffset;
+                mirroredOffset += (2u * signalBuffersSize);
+            }
+            else {
+                signalOffsets[s] = plainOffset;
+                plainOffset += signalBuffersSize;
+            }
+        }
+    }
+    else {
+        if (signalMirrored != NULL_PTR(bool *)) {
+            delete[] signalMirrored;
+            signalMirrored = NULL_PTR(bool *);
+        }
+    }
+    if (regionSizes != NULL_PTR(uint32 *)) {
+        delete[] regionSizes;
+    }
+    if (regionMirrored != NULL_PTR(bool *)) {
+        delete[] regionMirrored;
+    }
+    return ret;
+}
+
+bool MemoryDataSourceI::IsSignalMemoryMirrored(const uint32 signalIdx) {
+    bool mirrored = (signalMirrored != NULL_PTR(bool *));
+    if (mirrored) {
+        mirrored = (signalIdx < GetNumberOfSignals());
+    }
+    if (mirrored) {
+        mirrored = signalMirrored[signalIdx];
+    }
+    return mirrored;
+}
+
 uint32 MemoryDataSourceI::GetNumberOfMemoryBuffers() {
     return numberOfBuffers;
 }
@@ -151,6 +280,13 @@ bool MemoryDataSourceI::Initialise(StructuredDataI & data) {
             memoryHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
         }
     }
+    if (ret) {
+        uint8 mirroredBuffersTemp = 0u;
+        if (!data.Read("MirroredBuffers", mirroredBuffersTemp)) {
+            mirroredBuffersTemp = 0u;
+        }
+        mirroredBuffers = (mirroredBuffersTemp > 0u);
+    }
     return ret;
 }
 
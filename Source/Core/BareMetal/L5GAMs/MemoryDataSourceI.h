@@ -42,12 +42,17 @@ namespace MARTe {
  *
  * @details The memory is allocated in a contiguous memory region: S_1|S_2|...|S_N, where S_N has sufficient space to hold the signal N x number of buffers.
  *
+ * If MirroredBuffers = 1, the buffers of each signal whose size (signal byte size x number of buffers) is a multiple of MirroredMemory::GetGranularity()
+ * are allocated with MirroredMemory, i.e. they are followed in memory by a mirror of themselves (see IsSignalMemoryMirrored). The other signals are packed
+ * together as before. If the mirrored memory cannot be allocated (or no signal has a suitable size) the memory is allocated from the heap as if MirroredBuffers = 0.
+ *
  * A possible configuration structure is:
  * <pre>
  * +ThisDataSourceIObjectName = {
  *    Class = ClassThatImplementsDataSourceI
  *    NumberOfBuffers = 3 //Optional. Default = 1. Each buffer contains a copy of each signal.
  *    HeapName = "Default" //Optional. Default = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+ *    MirroredBuffers = 0|1 //Optional. Default = 0. If 1, try to allocate the buffers of the signals in mirrored memory.
  *    Signals = {
  *        +*NAME = {
  *            +Type = BasicType|StructuredType
@@ -97,7 +102,14 @@ public:
     virtual bool GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void *&signalAddress);
 
     /**
-     * @brief See DataSourceI::Initialise. Reads the optional NumberOfBuffers and HeapName parameters.
+     * @brief See DataSourceI::IsSignalMemoryMirrored.
+     * @param[in] signalIdx the index of the signal.
+     * @return true if the buffers of the signal were allocated in mirrored memory.
+     */
+    virtual bool IsSignalMemoryMirrored(const uint32 signalIdx);
+
+    /**
+     * @brief See DataSourceI::Initialise. Reads the optional NumberOfBuffers, HeapName and MirroredBuffers parameters.
      * @param[in] data The configuration information which may include a Signals node.
      * @return true if the DataSourceI is successfully initialised.
      */
@@ -138,6 +150,30 @@ protected:
      * The size in bytes of each signal.
      */
     uint32 *signalSize;
+
+    /**
+     * True for the signals whose buffers are mirrored.
+     */
+    bool *signalMirrored;
+
+    /**
+     * True if the MirroredBuffers option was set.
+     */
+    bool mirroredBuffers;
+
+    /**
+     * True if the memory was allocated with MirroredMemory (and not with the memoryHeap).
+     */
+    bool memoryMirrored;
+
+private:
+
+    /**
+     * @brief Lays out the signals so that the buffers of each signal with a size multiple of MirroredMemory::GetGranularity() are mirrored and allocates the memory with MirroredMemory.
+     * @param[in] numberOfStateBuffers the number of state buffers.
+     * @return true if the memory was allocated. If false the signalOffsets, stateMemorySize and totalMemorySize are not modified.
+     */
+    bool AllocateMirroredMemory(const uint32 numberOfStateBuffers);
 };
 }
 
@@ -48,12 +48,17 @@ MemoryMapBroker::MemoryMapBroker() :
     copyTable = NULL_PTR(MemoryMapBrokerCopyTableEntry*);
     dataSource = NULL_PTR(DataSourceI*);
     numberOfCopies = 0u;
+    copyPlan = NULL_PTR(MemoryMapBrokerCopyPlanEntry*);
+    copyPlanSize = 0u;
 }
 
 MemoryMapBroker::~MemoryMapBroker() {
     if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
         delete[] copyTable;
     }
+    if (copyPlan != NULL_PTR(MemoryMapBrokerCopyPlanEntry*)) {
+        delete[] copyPlan;
+    }
     /*lint -e{1740} dataSource contains a copy of a pointer. No need to be freed.*/
 }
 
@@ -133,6 +138,121 @@ bool MemoryMapBroker::Init(const SignalDirection direction,
         }
 //        }
     }
+    if (ret) {
+        ret = CompileCopyPlan(direction, numberOfBuffers);
+    }
+    return ret;
+}
+
+uint32 MemoryMapBroker::GetCopyPlanSize() const {
+    return copyPlanSize;
+}
+
+bool MemoryMapBroker::CompileCopyPlan(const SignalDirection direction,
+                                      const uint32 numberOfBuffers) {
+    bool ret = (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*));
+    if (copyPlan != NULL_PTR(MemoryMapBrokerCopyPlanEntry*)) {
+        delete[] copyPlan;
+        copyPlan = NULL_PTR(MemoryMapBrokerCopyPlanEntry*);
+    }
+    if (ret) {
+        //Sort the copies by GAM address (insertion sort, the tables are small and this is only executed once)
+        uint32 *order = new uint32[numberOfCopies];
+        for (uint32 n = 0u; n < numberOfCopies; n++) {
+            uint32 k = n;
+            //lint -e{613} copyTable != NULL checked before.
+            const char8 *gamAddress = reinterpret_cast<const char8*>(copyTable[n].gamPointer);
+            while ((k > 0u) && (reinterpret_cast<const char8*>(copyTable[order[k - 1u]].gamPointer) > gamAddress)) {
+                order[k] = order[k - 1u];
+                k--;
+            }
+            order[k] = n;
+        }
+        //Mark the copies that can be merged with the previous one
+        bool *merge = new bool[numberOfCopies];
+        copyPlanSize = 0u;
+        for (uint32 n = 0u; n < numberOfCopies; n++) {
+            merge[n] = (n > 0u);
+            if (merge[n]) {
+                uint32 prev = order[n - 1u];
+                uint32 curr = order[n];
+                //lint -e{613} copyTable != NULL checked before.
+                merge[n] = (&(reinterpret_cast<char8*>(copyTable[prev].gamPointer)[copyTable[prev].copySize]) == copyTable[curr].gamPointer);
+                for (uint32 b = 0u; (b < numberOfBuffers) && (merge[n]); b++) {
+                    uint32 prevB = ((b * numberOfCopies) + prev);
+                    uint32 currB = ((b * numberOfCopies) + curr);
+                    merge[n] = (&(reinterpret_cast<char8*>(copyTable[prevB].dataSourcePointer)[copyTable[prev].copySize]) == copyTable[currB].dataSourcePointer);
+                }
+            }
+            if (!merge[n]) {
+                copyPlanSize++;
+            }
+        }
+        copyPlan = new MemoryMapBrokerCopyPlanEntry[copyPlanSize * numberOfBuffers];
+        for (uint32 b = 0u; b < numberOfBuffers; b++) {
+            uint32 p = (b * copyPlanSize);
+            for (uint32 n = 0u; n < numberOfCopies; n++) {
+                uint32 gamIdx = order[n];
+                uint32 dataSourceIdx = ((b * numberOfCopies) + gamIdx);
+                if (merge[n]) {
+                    copyPlan[p - 1u].copySize += copyTable[gamIdx].copySize;
+                }
+                else {
+                    if (direction == InputSignals) {
+                        copyPlan[p].destination = copyTable[gamIdx].gamPointer;
+                        copyPlan[p].source = copyTable[dataSourceIdx].dataSourcePointer;
+                    }
+                    else {
+                        copyPlan[p].destination = copyTable[dataSourceIdx].dataSourcePointer;
+                        copyPlan[p].source = copyTable[gamIdx].gamPointer;
+                    }
+                    copyPlan[p].copySize = copyTable[gamIdx].copySize;
+                    p++;
+                }
+            }
+        }
+        //Select the copy kernels. The same kernel shall be valid for all the buffers.
+        for (uint32 p = 0u; p < copyPlanSize; p++) {
+            MemoryMapBrokerCopyKernel kernel = MemoryMapBrokerCopyGeneric;
+            uint32 copySize = copyPlan[p].copySize;
+            if (copySize == 4u) {
+                kernel = MemoryMapBrokerCopy4Bytes;
+            }
+            else if (copySize == 8u) {
+                kernel = MemoryMapBrokerCopy8Bytes;
+            }
+            else if (copySize == 16u) {
+                kernel = MemoryMapBrokerCopy16Bytes;
+            }
+            else if (copySize == 32u) {
+                kernel = MemoryMapBrokerCopy32Bytes;
+            }
+            else if (copySize == 64u) {
+                kernel = MemoryMapBrokerCopy64Bytes;
+            }
+            else {
+                //Use the generic copy
+            }
+            uintp alignment = (copySize == 4u) ? (4u) : (8u);
+            for (uint32 b = 0u; (b < numberOfBuffers) && (kernel != MemoryMapBrokerCopyGeneric); b++) {
+                uint32 pB = ((b * copyPlanSize) + p);
+                /*lint -e{923} cast pointer to integer to check the alignment.*/
+                bool aligned = ((reinterpret_cast<uintp>(copyPlan[pB].destination) % alignment) == 0u);
+                if (aligned) {
+                    /*lint -e{923} cast pointer to integer to check the alignment.*/
+                    aligned = ((reinterpret_cast<uintp>(copyPlan[pB].source) % alignment) == 0u);
+                }
+                if (!aligned) {
+                    kernel = MemoryMapBrokerCopyGeneric;
+                }
+            }
+            for (uint32 b = 0u; b < numberOfBuffers; b++) {
+                copyPlan[(b * copyPlanSize) + p].kernel = kernel;
+            }
+        }
+        delete[] merge;
+        delete[] order;
+    }
     return ret;
 }
 
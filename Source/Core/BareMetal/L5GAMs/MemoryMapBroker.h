@@ -34,6 +34,7 @@
 
 #include "BrokerI.h"
 #include "DataSourceI.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -64,6 +65,62 @@ struct MemoryMapBrokerCopyTableEntry {
     TypeDescriptor type;
 };
 
+/**
+ * @brief Copy routine to be used by a MemoryMapBrokerCopyPlanEntry.
+ * @details The fixed size routines are only selected if the source and destination addresses of the entry are aligned
+ * to the size of the words being moved (4 bytes for MemoryMapBrokerCopy4Bytes, 8 bytes otherwise).
+ */
+enum MemoryMapBrokerCopyKernel {
+    /**
+     * Copy with MemoryOperationsHelper::Copy.
+     */
+    MemoryMapBrokerCopyGeneric,
+    /**
+     * Move one 32 bit word.
+     */
+    MemoryMapBrokerCopy4Bytes,
+    /**
+     * Move one 64 bit word.
+     */
+    MemoryMapBrokerCopy8Bytes,
+    /**
+     * Move two 64 bit words.
+     */
+    MemoryMapBrokerCopy16Bytes,
+    /**
+     * Move four 64 bit words.
+     */
+    MemoryMapBrokerCopy32Bytes,
+    /**
+     * Move eight 64 bit words.
+     */
+    MemoryMapBrokerCopy64Bytes
+};
+
+/**
+ * @brief One copy operation of the compiled copy plan (see MemoryMapBroker::CompileCopyPlan).
+ * @details Merges all the MemoryMapBrokerCopyTableEntry elements that are contiguous, both in the GAM and in the DataSourceI memory,
+ * and holds the direction resolved source and destination addresses.
+ */
+struct MemoryMapBrokerCopyPlanEntry {
+    /**
+     * Where to copy to.
+     */
+    void *destination;
+    /**
+     * Where to copy from.
+     */
+    const void *source;
+    /**
+     * The number of bytes to copy.
+     */
+    uint32 copySize;
+    /**
+     * The routine to be used to copy.
+     */
+    MemoryMapBrokerCopyKernel kernel;
+};
+
 /**
  * @brief Memory mapped BrokerI implementation.
  * @details This class knows how to copy from/to a DataSourceI memory address to/from a GAM signal memory address.
@@ -127,8 +184,33 @@ public:
                       void *const gamMemoryAddress,
                       const bool optim);
 
+    /**
+     * @brief Gets the number of copy operations, per stateful memory buffer, of the compiled copy plan.
+     * @return the number of copy operations of the compiled copy plan (<= GetNumberOfCopies()).
+     */
+    uint32 GetCopyPlanSize() const;
+
 protected:
 
+    /**
+     * @brief Compiles the copyTable into a plan with the smallest number of copy operations.
+     * @details The copyTable entries are sorted by GAM memory address and the entries that are contiguous both in the GAM memory and
+     * in the DataSourceI memory (for every stateful memory buffer) are merged in a single copy operation. For each copy operation a
+     * size specialised MemoryMapBrokerCopyKernel is selected, if possible.
+     * @param[in] direction the signal direction (InputSignals copies from the DataSourceI to the GAM, OutputSignals from the GAM to the DataSourceI).
+     * @param[in] numberOfBuffers the number of stateful memory buffers in the copyTable.
+     * @return true if the copyTable exists and the plan could be allocated.
+     */
+    bool CompileCopyPlan(const SignalDirection direction,
+                         const uint32 numberOfBuffers);
+
+    /**
+     * @brief Executes the compiled copy plan for the stateful memory buffer \a bufferIdx.
+     * @param[in] bufferIdx the stateful memory buffer (see DataSourceI::GetCurrentStateBuffer).
+     * @return true if all the copies were successfully performed.
+     */
+    inline bool ExecuteCopyPlan(const uint32 bufferIdx) const;
+
     /**
      * A table with all the elements to be copied
      */
@@ -139,6 +221,16 @@ protected:
      */
     DataSourceI *dataSource;
 
+    /**
+     * The compiled copy plan, with copyPlanSize entries for each stateful memory buffer.
+     */
+    MemoryMapBrokerCopyPlanEntry *copyPlan;
+
+    /**
+     * The number of copy operations per stateful memory buffer in the copyPlan.
+     */
+    uint32 copyPlanSize;
+
 };
 
 }
@@ -147,5 +239,55 @@ protected:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+bool MemoryMapBroker::ExecuteCopyPlan(const uint32 bufferIdx) const {
+    bool ret = true;
+    if (copyPlan != NULL_PTR(MemoryMapBrokerCopyPlanEntry *)) {
+        const MemoryMapBrokerCopyPlanEntry *entry = &copyPlan[bufferIdx * copyPlanSize];
+        for (uint32 n = 0u; (n < copyPlanSize) && (ret); n++) {
+            /*lint -e{925} -e{927} -e{9079} the kernel is only selected if the addresses are aligned to the size of the words being moved.*/
+            const uint64 *src64 = reinterpret_cast<const uint64 *>(entry[n].source);
+            /*lint -e{925} -e{927} -e{9079} see above.*/
+            uint64 *dst64 = reinterpret_cast<uint64 *>(entry[n].destination);
+            switch (entry[n].kernel) {
+            case MemoryMapBrokerCopy4Bytes:
+                /*lint -e{925} -e{927} -e{9079} see above.*/
+                *reinterpret_cast<uint32 *>(entry[n].destination) = *reinterpret_cast<const uint32 *>(entry[n].source);
+                break;
+            case MemoryMapBrokerCopy8Bytes:
+                dst64[0] = src64[0];
+                break;
+            case MemoryMapBrokerCopy16Bytes:
+                dst64[0] = src64[0];
+                dst64[1] = src64[1];
+                break;
+            case MemoryMapBrokerCopy32Bytes:
+                dst64[0] = src64[0];
+                dst64[1] = src64[1];
+                dst64[2] = src64[2];
+                dst64[3] = src64[3];
+                break;
+            case MemoryMapBrokerCopy64Bytes:
+                dst64[0] = src64[0];
+                dst64[1] = src64[1];
+                dst64[2] = src64[2];
+                dst64[3] = src64[3];
+                dst64[4] = src64[4];
+                dst64[5] = src64[5];
+                dst64[6] = src64[6];
+                dst64[7] = src64[7];
+                break;
+            default:
+                ret = MemoryOperationsHelper::Copy(entry[n].destination, entry[n].source, entry[n].copySize);
+                break;
+            }
+        }
+    }
+    return ret;
+}
+
+}
+
 #endif /* MEMORYMAPBROKER_H_ */
 
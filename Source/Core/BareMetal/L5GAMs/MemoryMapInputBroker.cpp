@@ -50,17 +50,9 @@ MemoryMapInputBroker::~MemoryMapInputBroker() {
 }
 
 bool MemoryMapInputBroker::Execute() {
-    uint32 n;
     /*lint -e{613} null pointer checked before.*/
     uint32 i = dataSource->GetCurrentStateBuffer();
-    bool ret = true;
-    if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
-        for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-            uint32 dataSourceIndex = ((i * numberOfCopies) + n);
-            ret = MemoryOperationsHelper::Copy(copyTable[n].gamPointer, copyTable[dataSourceIndex].dataSourcePointer, copyTable[n].copySize);
-        }
-    }
-    return ret;
+    return ExecuteCopyPlan(i);
 }
 
 CLASS_REGISTER(MemoryMapInputBroker, "1.0")
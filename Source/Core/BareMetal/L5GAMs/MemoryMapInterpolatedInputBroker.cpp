@@ -47,33 +47,23 @@ MemoryMapInterpolatedInputBroker::MemoryMapInterpolatedInputBroker() :
     interpolatedXAxis = 0LLU;
     reset = false;
     dataSourceXAxis = NULL_PTR(uint64*);
-    m = NULL_PTR(float64*);
-    y0 = NULL_PTR(void**);
-    y1 = NULL_PTR(void**);
-    numberOfElements = NULL_PTR(uint32*);
+    groups = NULL_PTR(MemoryMapInterpolatedInputBrokerTypeGroup*);
+    numberOfGroups = 0u;
 }
 
 /*lint -e{1551} memory is freed in the destructor*/
 MemoryMapInterpolatedInputBroker::~MemoryMapInterpolatedInputBroker() {
-    if (numberOfElements != NULL_PTR(uint32*)) {
-        delete [] numberOfElements;
-    }
-    if (y0 != NULL_PTR(void**)) {
-        uint32 i;
-        for (i = 0u; i < numberOfCopies; i++) {
-            GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(y0[i]);
-        }
-        delete [] y0;
-    }
-    if (y1 != NULL_PTR(void**)) {
-        uint32 i;
-        for (i = 0u; i < numberOfCopies; i++) {
-            GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(y1[i]);
+    if (groups != NULL_PTR(MemoryMapInterpolatedInputBrokerTypeGroup*)) {
+        uint32 g;
+        for (g = 0u; g < numberOfGroups; g++) {
+            if (groups[g].copyIdx != NULL_PTR(uint32*)) {
+                delete [] groups[g].copyIdx;
+            }
+            if (groups[g].elementIdx != NULL_PTR(uint32*)) {
+                delete [] groups[g].elementIdx;
+            }
         }
-        delete [] y1;
-    }
-    if (m != NULL_PTR(float64*)) {
-        delete [] m;
+        delete [] groups;
     }
     /*lint -e{1740} the dataSourceXAxis is freed by the DataSourceI*/
 }
@@ -84,23 +74,124 @@ bool MemoryMapInterpolatedInputBroker::Init(const SignalDirection direction,
                                             void *const gamMemoryAddress) {
     bool ok = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
 
+    uint32 i;
+    uint32 g;
     if (ok) {
-        numberOfElements = new uint32[numberOfCopies];
-        m = new float64[numberOfCopies];
-        y0 = new void*[numberOfCopies];
-        y1 = new void*[numberOfCopies];
+        //At most one group per copy
+        groups = new MemoryMapInterpolatedInputBrokerTypeGroup[numberOfCopies];
+        numberOfGroups = 0u;
+        /*lint -e{613} copyTable cannot be NULL as otherwise MemoryMapBroker::Init would have failed => ok = false*/
+        for (i = 0u; i < numberOfCopies; i++) {
+            uint32 byteSize = static_cast<uint32>(copyTable[i].type.numberOfBits);
+            byteSize /= 8u;
+            bool found = false;
+            for (g = 0u; (g < numberOfGroups) && (!found); g++) {
+                found = (groups[g].type == copyTable[i].type);
+                if (found) {
+                    groups[g].numberOfCopies++;
+                    groups[g].numberOfElements += (copyTable[i].copySize / byteSize);
+                }
+            }
+            if (!found) {
+                groups[numberOfGroups].type = copyTable[i].type;
+                groups[numberOfGroups].numberOfCopies = 1u;
+                groups[numberOfGroups].numberOfElements = (copyTable[i].copySize / byteSize);
+                groups[numberOfGroups].copyIdx = NULL_PTR(uint32*);
+                groups[numberOfGroups].elementIdx = NULL_PTR(uint32*);
+                groups[numberOfGroups].y0 = NULL_PTR(float64*);
+                groups[numberOfGroups].y1 = NULL_PTR(float64*);
+                groups[numberOfGroups].m = NULL_PTR(float64*);
+                groups[numberOfGroups].values = NULL_PTR(void*);
+                groups[numberOfGroups].interpolate = NULL_PTR(MemoryMapInterpolatedInputBrokerInterpolateFunction);
+                groups[numberOfGroups].changeSegment = NULL_PTR(MemoryMapInterpolatedInputBrokerChangeSegmentFunction);
+                numberOfGroups++;
+            }
+        }
+    }
+    for (g = 0u; (g < numberOfGroups) && (ok); g++) {
+        TypeDescriptor type = groups[g].type;
+        if (type == UnsignedInteger8Bit) {
+            ok = InitGroup<uint8>(groups[g]);
+        }
+        else if (type == UnsignedInteger16Bit) {
+            ok = InitGroup<uint16>(groups[g]);
+        }
+        else if (type == UnsignedInteger32Bit) {
+            ok = InitGroup<uint32>(groups[g]);
+        }
+        else if (type == UnsignedInteger64Bit) {
+            ok = InitGroup<uint64>(groups[g]);
+        }
+        else if (type == SignedInteger8Bit) {
+            ok = InitGroup<int8>(groups[g]);
+        }
+        else if (type == SignedInteger16Bit) {
+            ok = InitGroup<int16>(groups[g]);
+        }
+        else if (type == SignedInteger32Bit) {
+            ok = InitGroup<int32>(groups[g]);
+        }
+        else if (type == SignedInteger64Bit) {
+            ok = InitGroup<int64>(groups[g]);
+        }
+        else if (type == Float32Bit) {
+            ok = InitGroup<float32>(groups[g]);
+        }
+        else if (type == Float64Bit) {
+            ok = InitGroup<float64>(groups[g]);
+        }
+        else {
+            //Unsupported type. Should be stopped by the DataSourceI before... The group is not interpolated.
+        }
+    }
+    //The y0, y1, m and values of all the groups are stored in a single (zeroed) slab
+    if ((ok) && (numberOfGroups > 0u)) {
+        const uint32 entriesPerGroup = 4u;
+        uint32 *entrySizes = new uint32[numberOfGroups * entriesPerGroup];
+        for (g = 0u; g < numberOfGroups; g++) {
+            uint32 valuesSize = 0u;
+            uint32 segmentSize = 0u;
+            if (groups[g].interpolate != NULL_PTR(MemoryMapInterpolatedInputBrokerInterpolateFunction)) {
+                valuesSize = groups[g].numberOfElements * (static_cast<uint32>(groups[g].type.numberOfBits) / 8u);
+                segmentSize = groups[g].numberOfElements * static_cast<uint32>(sizeof(float64));
+            }
+            entrySizes[g * entriesPerGroup] = segmentSize;
+            entrySizes[(g * entriesPerGroup) + 1u] = segmentSize;
+            entrySizes[(g * entriesPerGroup) + 2u] = segmentSize;
+            entrySizes[(g * entriesPerGroup) + 3u] = valuesSize;
+        }
+        ok = bufferPool.Allocate(1u, entrySizes, numberOfGroups * entriesPerGroup);
+        delete[] entrySizes;
+        for (g = 0u; (g < numberOfGroups) && (ok); g++) {
+            if (groups[g].interpolate != NULL_PTR(MemoryMapInterpolatedInputBrokerInterpolateFunction)) {
+                groups[g].y0 = static_cast<float64 *>(bufferPool.GetEntry(0u, g * entriesPerGroup));
+                groups[g].y1 = static_cast<float64 *>(bufferPool.GetEntry(0u, (g * entriesPerGroup) + 1u));
+                groups[g].m = static_cast<float64 *>(bufferPool.GetEntry(0u, (g * entriesPerGroup) + 2u));
+                groups[g].values = bufferPool.GetEntry(0u, (g * entriesPerGroup) + 3u);
+            }
+        }
+    }
+    for (g = 0u; g < numberOfGroups; g++) {
+        //Filled below
+        groups[g].numberOfCopies = 0u;
+        groups[g].numberOfElements = 0u;
     }
-    uint32 i;
     /*lint -e{613} copyTable cannot be NULL as otherwise MemoryMapBroker::Init would have failed => ok = false*/
     for (i = 0u; (i < numberOfCopies) && (ok); i++) {
         uint32 byteSize = static_cast<uint32>(copyTable[i].type.numberOfBits);
         byteSize /= 8u;
-        numberOfElements[i] = copyTable[i].copySize;
-        numberOfElements[i] /= byteSize;
-        m[i] = 0.;
-        y0[i] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[i].copySize);
-        y1[i] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[i].copySize);
-        ok = MemoryOperationsHelper::Set(y1[i], '\0', copyTable[i].copySize);
+        bool found = false;
+        for (g = 0u; (g < numberOfGroups) && (!found); g++) {
+            found = (groups[g].type == copyTable[i].type);
+            if (found) {
+                if (groups[g].copyIdx != NULL_PTR(uint32*)) {
+                    groups[g].copyIdx[groups[g].numberOfCopies] = i;
+                    groups[g].elementIdx[groups[g].numberOfCopies] = groups[g].numberOfElements;
+                }
+                groups[g].numberOfCopies++;
+                groups[g].numberOfElements += (copyTable[i].copySize / byteSize);
+            }
+        }
     }
 
     return ok;
@@ -117,49 +208,19 @@ void MemoryMapInterpolatedInputBroker::ChangeInterpolationSegments() {
     if (dataSourceXAxis != NULL_PTR(uint64*)) {
         x0 = x1;
         x1 = *dataSourceXAxis;
-        uint32 i;
-        uint64 dt;
+        float64 dt;
         if (x1 == x0) {
             //kick-start the first assignment of y0
-            dt = 1LLU;
+            dt = 1.;
         }
         else {
-            dt = (x1 - x0);
+            dt = static_cast<float64>(x1 - x0);
         }
 
-        for (i = 0u; (i < numberOfCopies); i++) {
-            if (copyTable[i].type == UnsignedInteger8Bit) {
-                ChangeInterpolationSegment<uint8>(i, dt);
-            }
-            else if (copyTable[i].type == UnsignedInteger16Bit) {
-                ChangeInterpolationSegment<uint16>(i, dt);
-            }
-            else if (copyTable[i].type == UnsignedInteger32Bit) {
-                ChangeInterpolationSegment<uint32>(i, dt);
-            }
-            else if (copyTable[i].type == UnsignedInteger64Bit) {
-                ChangeInterpolationSegment<uint64>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger8Bit) {
-                ChangeInterpolationSegment<int8>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger16Bit) {
-                ChangeInterpolationSegment<int16>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger32Bit) {
-                ChangeInterpolationSegment<int32>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger64Bit) {
-                ChangeInterpolationSegment<int64>(i, dt);
-            }
-            else if (copyTable[i].type == Float32Bit) {
-                ChangeInterpolationSegment<float32>(i, dt);
-            }
-            else if (copyTable[i].type == Float64Bit) {
-                ChangeInterpolationSegment<float64>(i, dt);
-            }
-            else {
-                //Unreachable?
+        uint32 g;
+        for (g = 0u; g < numberOfGroups; g++) {
+            if (groups[g].changeSegment != NULL_PTR(MemoryMapInterpolatedInputBrokerChangeSegmentFunction)) {
+                groups[g].changeSegment(groups[g], copyTable, dt);
             }
         }
     }
@@ -212,39 +273,14 @@ bool MemoryMapInterpolatedInputBroker::Execute() {
             ChangeInterpolationSegments();
         }
 
-        for (i = 0u; (i < numberOfCopies) && (ok); i++) {
-            if (copyTable[i].type == UnsignedInteger8Bit) {
-                Interpolate<uint8>(i);
-            }
-            else if (copyTable[i].type == UnsignedInteger16Bit) {
-                Interpolate<uint16>(i);
-            }
-            else if (copyTable[i].type == UnsignedInteger32Bit) {
-                Interpolate<uint32>(i);
-            }
-            else if (copyTable[i].type == UnsignedInteger64Bit) {
-                Interpolate<uint64>(i);
-            }
-            else if (copyTable[i].type == SignedInteger8Bit) {
-                Interpolate<int8>(i);
-            }
-            else if (copyTable[i].type == SignedInteger16Bit) {
-                Interpolate<int16>(i);
-            }
-            else if (copyTable[i].type == SignedInteger32Bit) {
-                Interpolate<int32>(i);
-            }
-            else if (copyTable[i].type == SignedInteger64Bit) {
-                Interpolate<int64>(i);
-            }
-            else if (copyTable[i].type == Float32Bit) {
-                Interpolate<float32>(i);
-            }
-            else if (copyTable[i].type == Float64Bit) {
-                Interpolate<float64>(i);
-            }
-            else {
-                //Unreachable/unsupported type? Should be stopped by the DataSourceI before...
+        if (ok) {
+            //How long has elapsed in this interpolation segment
+            float64 elapsed = static_cast<float64>(interpolatedXAxis - x0);
+            uint32 g;
+            for (g = 0u; g < numberOfGroups; g++) {
+                if (groups[g].interpolate != NULL_PTR(MemoryMapInterpolatedInputBrokerInterpolateFunction)) {
+                    groups[g].interpolate(groups[g], copyTable, elapsed);
+                }
             }
         }
     }
@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "BrokerBufferPool.h"
 #include "MemoryMapInputBroker.h"
 
 /*---------------------------------------------------------------------------*/
@@ -38,6 +39,85 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+struct MemoryMapInterpolatedInputBrokerTypeGroup;
+
+/**
+ * @brief Interpolates all the elements of a MemoryMapInterpolatedInputBrokerTypeGroup and copies the interpolated values to the GAM memory.
+ */
+typedef void (*MemoryMapInterpolatedInputBrokerInterpolateFunction)(const MemoryMapInterpolatedInputBrokerTypeGroup &group,
+                                                                    const MemoryMapBrokerCopyTableEntry * const copyTable,
+                                                                    const float64 elapsed);
+
+/**
+ * @brief Reads the next data point of a MemoryMapInterpolatedInputBrokerTypeGroup from the DataSourceI memory and computes the slopes of the new interpolation segment.
+ */
+typedef void (*MemoryMapInterpolatedInputBrokerChangeSegmentFunction)(MemoryMapInterpolatedInputBrokerTypeGroup &group,
+                                                                      const MemoryMapBrokerCopyTableEntry * const copyTable,
+                                                                      const float64 dx);
+
+/**
+ * @brief Signals of the same type which are interpolated together by the MemoryMapInterpolatedInputBroker.
+ * @details The elements of all the signals in the group are stored contiguously (structure of arrays), so that
+ * the interpolation y = y0 + m * (x - x0) is evaluated by a single loop over all the elements of the group (which the
+ * compiler is free to vectorise). The slopes are only recomputed when a new interpolation segment is created.
+ */
+struct MemoryMapInterpolatedInputBrokerTypeGroup {
+    /**
+     * The type of all the signals in the group.
+     */
+    TypeDescriptor type;
+
+    /**
+     * Number of copy table entries in the group.
+     */
+    uint32 numberOfCopies;
+
+    /**
+     * The index (in the MemoryMapBroker copy table) of each copy in the group.
+     */
+    uint32 *copyIdx;
+
+    /**
+     * The index of the first element of each copy in the group arrays.
+     */
+    uint32 *elementIdx;
+
+    /**
+     * The total number of elements in the group.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * The y0 values of the current interpolation segment.
+     */
+    float64 *y0;
+
+    /**
+     * The y1 values of the current interpolation segment.
+     */
+    float64 *y1;
+
+    /**
+     * The slope of the current interpolation segment, for each element.
+     */
+    float64 *m;
+
+    /**
+     * Buffer, with numberOfElements of the group type, where the values are converted from/to the DataSourceI/GAM memory.
+     */
+    void *values;
+
+    /**
+     * Interpolates all the elements of the group and copies the interpolated values to the GAM memory.
+     */
+    MemoryMapInterpolatedInputBrokerInterpolateFunction interpolate;
+
+    /**
+     * Reads the next data point from the DataSourceI memory and computes the slopes of the new interpolation segment.
+     */
+    MemoryMapInterpolatedInputBrokerChangeSegmentFunction changeSegment;
+};
+
 /**
  * @brief Input MemoryMapBroker implementation which allows to automatically interpolate samples from any DataSourceI.
  * @details This class interpolates the signals from the DataSourceI and copies the interpolated values to the GAM memory.
@@ -57,7 +137,7 @@ public:CLASS_REGISTER_DECLARATION()
     MemoryMapInterpolatedInputBroker();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Frees the memory of the signal groups.
      */
     virtual ~MemoryMapInterpolatedInputBroker();
 
@@ -86,7 +166,7 @@ public:CLASS_REGISTER_DECLARATION()
                                 const uint64 interpolationPeriodIn);
 
     /**
-     * @brief See MemoryMapBroker::Init
+     * @brief See MemoryMapBroker::Init. Groups the signals by type (signals of unsupported types are not interpolated).
      */
     virtual bool Init(const SignalDirection direction,
                       DataSourceI &dataSourceIn,
@@ -100,20 +180,35 @@ public:CLASS_REGISTER_DECLARATION()
 
 private:
     /**
-     * @brief Interpolates between samples for any signal type.
-     * @param[in] copyIdx the index of the signal to be updated.
+     * @brief Interpolates all the signals of a group.
+     * @param[in] group the signals to be interpolated.
+     * @param[in] copyTable the MemoryMapBroker copy table.
+     * @param[in] elapsed how long has elapsed since the beginning of the interpolation segment.
      */
     template<typename valueType>
-    void Interpolate(uint32 copyIdx);
+    static void Interpolate(const MemoryMapInterpolatedInputBrokerTypeGroup &group,
+                            const MemoryMapBrokerCopyTableEntry * const copyTable,
+                            const float64 elapsed);
 
     /**
-     * @brief Generate a new interpolation segment. To be performed every time the interpolated vector is greater than the last time read from the data source.
-     * @param[in] copyIdx the index of the signal to be updated.
+     * @brief Generate a new interpolation segment for all the signals of a group. To be performed every time the interpolated vector is greater than the last time read from the data source.
+     * @param[in] group the signals to be updated.
+     * @param[in] copyTable the MemoryMapBroker copy table.
      * @param[in] dx the interpolation segment length.
      */
     template<typename valueType>
-    void ChangeInterpolationSegment(uint32 copyIdx,
-                                    uint64 dx);
+    static void ChangeInterpolationSegment(MemoryMapInterpolatedInputBrokerTypeGroup &group,
+                                           const MemoryMapBrokerCopyTableEntry * const copyTable,
+                                           const float64 dx);
+
+    /**
+     * @brief Allocates the copy tables of the group and sets the group interpolation functions for the given valueType.
+     * @details The y0, y1, m and values arrays are allocated afterwards in the broker bufferPool.
+     * @param[in] group the group to be initialised. The type, numberOfCopies and numberOfElements shall be already set.
+     * @return true if the memory was successfully allocated.
+     */
+    template<typename valueType>
+    static bool InitGroup(MemoryMapInterpolatedInputBrokerTypeGroup &group);
 
     /**
      * @brief Calls ChangeInterpolationSegment for all the broker signals.
@@ -146,24 +241,19 @@ private:
     uint64 interpolatedXAxis;
 
     /**
-     * Pointers to the addresses of the y0 values of the current interpolation segment
+     * The signals grouped by type.
      */
-    void **y0;
+    MemoryMapInterpolatedInputBrokerTypeGroup *groups;
 
     /**
-     * Pointers to the addresses of the y1 values of the current interpolation segment
+     * The number of groups (i.e. of different signal types).
      */
-    void **y1;
+    uint32 numberOfGroups;
 
     /**
-     * Pointers to the addresses of the m values
+     * The y0, y1, m and values arrays of all the groups (in this order, for each group).
      */
-    float64 *m;
-
-    /**
-     * Accelerator for number of elements in any given signal
-     */
-    uint32 *numberOfElements;
+    BrokerBufferPool bufferPool;
 
     /**
      * Was the broker reset
@@ -179,59 +269,64 @@ private:
 namespace MARTe {
 
 template<typename valueType>
-void MemoryMapInterpolatedInputBroker::Interpolate(uint32 copyIdx) {
-    uint32 i;
-    for (i = 0u; i < numberOfElements[copyIdx]; i++) {
-        valueType *y0p = (valueType*) (y0[copyIdx]);
-/**
- * Do not assume memory alignment... (see below)
-        float64 y = static_cast<float64>(y0p[i]);
- */
-        valueType ytemp;
-        (void) MemoryOperationsHelper::Copy(&ytemp, &y0p[i], sizeof(valueType));
-        float64 y = static_cast<float64>(ytemp);
-
-        //How long as elapsed in this interpolation segment
-        float64 cttns = static_cast<float64>(interpolatedXAxis - x0);
-        //y = y0p + m * (t - x0), where y0p and t0p are the initial values for the interpolation period
-        float64 newy = m[copyIdx] * cttns;
-        y += newy;
-        valueType *dest = static_cast<valueType*>(copyTable[copyIdx].gamPointer);
-        //dest[i] = static_cast<valueType>(y);
-        ytemp = static_cast<valueType>(y);
-        (void) MemoryOperationsHelper::Copy(&dest[i], &ytemp, sizeof(valueType));
+void MemoryMapInterpolatedInputBroker::Interpolate(const MemoryMapInterpolatedInputBrokerTypeGroup &group,
+                                                   const MemoryMapBrokerCopyTableEntry * const copyTable,
+                                                   const float64 elapsed) {
+    const float64 * const y0p = group.y0;
+    const float64 * const mp = group.m;
+    valueType * const values = static_cast<valueType *>(group.values);
+    uint32 k;
+    //y = y0 + m * (t - x0), where y0 and x0 are the initial values for the interpolation period
+    for (k = 0u; k < group.numberOfElements; k++) {
+        values[k] = static_cast<valueType>(y0p[k] + (mp[k] * elapsed));
+    }
+    /**
+     * Do not assume memory alignment of the GAM memory (see ChangeInterpolationSegment).
+     */
+    uint32 c;
+    for (c = 0u; c < group.numberOfCopies; c++) {
+        const MemoryMapBrokerCopyTableEntry &entry = copyTable[group.copyIdx[c]];
+        (void) MemoryOperationsHelper::Copy(entry.gamPointer, &values[group.elementIdx[c]], entry.copySize);
     }
 }
 
 template<typename valueType>
-void MemoryMapInterpolatedInputBroker::ChangeInterpolationSegment(uint32 copyIdx,
-                                                                  uint64 dx) {
-    uint32 i;
-    for (i = 0u; i < numberOfElements[copyIdx]; i++) {
-        valueType *y0p = (valueType*) (y0[copyIdx]);
-        valueType *y1p = (valueType*) (y1[copyIdx]);
-        valueType *y1pds = (valueType*) (copyTable[copyIdx].dataSourcePointer);
-
-        /**
-         * Do not assume memory alignment... (see e.g. https://stackoverflow.com/questions/13804215/arm-memcpy-and-alignment)
-         * This code was giving bus errors in arm targets when the memory was not aligned to four bytes (which may the case when
-         * the GAM/DataSource signals interleave with different byte sizes).
-         *      y0p[i] = y1p[i];
-         *      y1p[i] = y1pds[i];
-         */
-        (void) MemoryOperationsHelper::Copy(&y0p[i], &y1p[i], sizeof(valueType));
-        (void) MemoryOperationsHelper::Copy(&y1p[i], &y1pds[i], sizeof(valueType));
-        valueType y0v;
-        valueType y1v;
-        (void) MemoryOperationsHelper::Copy(&y0v, &y0p[i], sizeof(valueType));
-        (void) MemoryOperationsHelper::Copy(&y1v, &y1p[i], sizeof(valueType));
+void MemoryMapInterpolatedInputBroker::ChangeInterpolationSegment(MemoryMapInterpolatedInputBrokerTypeGroup &group,
+                                                                  const MemoryMapBrokerCopyTableEntry * const copyTable,
+                                                                  const float64 dx) {
+    valueType * const values = static_cast<valueType *>(group.values);
+    /**
+     * Do not assume memory alignment... (see e.g. https://stackoverflow.com/questions/13804215/arm-memcpy-and-alignment)
+     * This code was giving bus errors in arm targets when the memory was not aligned to four bytes (which may the case when
+     * the GAM/DataSource signals interleave with different byte sizes).
+     * The DataSourceI values are thus first copied to the (aligned) group buffer.
+     */
+    uint32 c;
+    for (c = 0u; c < group.numberOfCopies; c++) {
+        const MemoryMapBrokerCopyTableEntry &entry = copyTable[group.copyIdx[c]];
+        (void) MemoryOperationsHelper::Copy(&values[group.elementIdx[c]], entry.dataSourcePointer, entry.copySize);
+    }
+    float64 * const y0p = group.y0;
+    float64 * const y1p = group.y1;
+    float64 * const mp = group.m;
+    uint32 k;
+    for (k = 0u; k < group.numberOfElements; k++) {
+        y0p[k] = y1p[k];
+        y1p[k] = static_cast<float64>(values[k]);
         //Compute the derivative m = (y1-y0)/(x1-x0)
-        //m[copyIdx] = static_cast<float64>(y1p[i] - y0p[i]);
-        m[copyIdx] = static_cast<float64>(y1v - y0v);
-        m[copyIdx] /= dx;
+        mp[k] = (y1p[k] - y0p[k]) / dx;
     }
 }
 
+template<typename valueType>
+bool MemoryMapInterpolatedInputBroker::InitGroup(MemoryMapInterpolatedInputBrokerTypeGroup &group) {
+    group.copyIdx = new uint32[group.numberOfCopies];
+    group.elementIdx = new uint32[group.numberOfCopies];
+    group.interpolate = &Interpolate<valueType>;
+    group.changeSegment = &ChangeInterpolationSegment<valueType>;
+    return true;
+}
+
 }
 
 #endif /* L5GAMS_MEMORYMAPINTERPOLATEDINPUTBROKER_H_ */
@@ -49,6 +49,8 @@ MemoryMapMultiBufferBroker::MemoryMapMultiBufferBroker() :
     signalIdxArr = NULL_PTR(uint32*);
     samples = NULL_PTR(uint32*);
     maxOffset = NULL_PTR(int32*);
+    mirroredCopy = NULL_PTR(bool*);
+    offsetCaching = false;
 }
 
 MemoryMapMultiBufferBroker::~MemoryMapMultiBufferBroker() {
@@ -64,6 +66,10 @@ MemoryMapMultiBufferBroker::~MemoryMapMultiBufferBroker() {
         delete[] maxOffset;
         maxOffset = NULL_PTR(int32*);
     }
+    if (mirroredCopy != NULL_PTR(bool*)) {
+        delete[] mirroredCopy;
+        mirroredCopy = NULL_PTR(bool*);
+    }
 }
 
 /*lint -e{613} no NULL pointers expected at this stage as this would violate the pre-conditions to use this function (i.e. to have had a valid Init).*/
@@ -73,9 +79,18 @@ bool MemoryMapMultiBufferBroker::CopyInputs() {
     uint32 currentBuffer = dataSource->GetCurrentStateBuffer();
 
     if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
+        //The copies of the same signal are consecutive. If allowed by the DataSourceI, the offset is only queried for the first copy.
+        bool cachedOffsetValid = false;
+        uint32 uintoffset = 0u;
         for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-            uint32 uintoffset = 0u;
-            ret = dataSource->GetInputOffset(signalIdxArr[n], samples[n], uintoffset);
+            if (cachedOffsetValid) {
+                cachedOffsetValid = ((signalIdxArr[n] == signalIdxArr[n - 1u]) && (samples[n] == samples[n - 1u]));
+            }
+            if (!cachedOffsetValid) {
+                /*lint -e{613} null pointer checked before.*/
+                ret = dataSource->GetInputOffset(signalIdxArr[n], samples[n], uintoffset);
+                cachedOffsetValid = ((ret) && (offsetCaching));
+            }
             if (ret) {
                 uint32 dataSourceIndex = ((currentBuffer * numberOfCopies) + n);
                 int32 copySize = static_cast<int32>(copyTable[n].copySize);
@@ -86,61 +101,70 @@ bool MemoryMapMultiBufferBroker::CopyInputs() {
                 int32 offset = static_cast<int32>(uintoffset);
                 //copyOffsetN will take into account the number of samples to be copied. There will be one copy for every sample and some of the samples might be requesting the circular buffer to restart
                 //Copy would go over boundary? This is only possible if the number of samples is > than the number of memory buffers and assumes that a circular buffer is required.
-                //Only do (at most) one of the following whiles
-                bool offsetChanged = false;
-                while ((copyOffsetN + offset) >= maxOffset[n]) {
-                    offset = (offset - maxOffset[n]);
-                    offsetChanged = true;
+                if (mirroredCopy[n]) {
+                    //The signal buffers are followed by a mirror of themselves, so that the copy never has to be split.
+                    int32 position = ((copyOffsetN + offset) % maxOffset[n]);
+                    (void) MemoryOperationsHelper::Copy(&(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
+                                                        &((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[position - copyOffsetN]),
+                                                        static_cast<uint32>(copySize));
                 }
-                if (!offsetChanged) {
-                    //Circular buffer where one might need to copy the M samples from the end, N samples in the middle and the reminder of samples at the end again
-                    if (copySize > (maxOffset[n] - (copyOffsetN + offset))) {
-                        //copySize is the number of bytes that are to be copied from the data source: N samples x size of the type to be copied
-                        //maxOffset is the maximum number of bytes that can be copied from the data source at a time: Number of buffers x size of the type to be copied. If the copySize is greater than the maxOffset, the copy must restart from the beginning of the memory
-                        //overSize if how much bigger is the copySize w.r.t. to the overSize (e.g. copy 3 samples of an uint32 => copySize = 12, dual buffer in the data source => 2 x 4 = 8) => overSize = 4
-                        int32 overSize = copySize % maxOffset[n];
-
-                        //The copySize may be many times bigger than the maxOffset, so that the copy of all the data source memory may need to be performed many times
-                        int32 numberOfFullCopies = ((copySize - overSize) / maxOffset[n]);
-                        bool isMultiple = (((copySize - overSize) % maxOffset[n]) == 0);
-                        if (isMultiple) {
-                            isMultiple = (copySize > overSize);
-                        }
-
-                        //If the memory that is left to copy (less the oversize) is a multiple of the data source memory, do one less copy, because the memory left to be copied is already copied at the end of the routine.
-                        if (isMultiple) {
-                            overSize += maxOffset[n];
-                            numberOfFullCopies--;
-                        }
-                        int32 copySizePhase = 0;
-
-                        //Copy any oversize buffer and remember how much was copied in copySizePhase
-                        if (overSize > (maxOffset[n] - (copyOffsetN + offset))) {
-                            copySizePhase = (maxOffset[n] - offset);
-
-                            (void) MemoryOperationsHelper::Copy(&(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
-                                                                &((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                                static_cast<uint32>(copySizePhase));
-                            gamOffset = static_cast<uint32>(copySizePhase);
-                            offset = 0;
-                        }
-
-                        //Copy any multiples of full data source memory copies
-                        for (int32 z = 0; z < numberOfFullCopies; z++) {
-                            (void) MemoryOperationsHelper::Copy(&(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
-                                                                &((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                                static_cast<uint32>(maxOffset[n]));
-
-                            gamOffset += static_cast<uint32>(maxOffset[n]);
+                else {
+                    //Only do (at most) one of the following whiles
+                    bool offsetChanged = false;
+                    while ((copyOffsetN + offset) >= maxOffset[n]) {
+                        offset = (offset - maxOffset[n]);
+                        offsetChanged = true;
+                    }
+                    if (!offsetChanged) {
+                        //Circular buffer where one might need to copy the M samples from the end, N samples in the middle and the reminder of samples at the end again
+                        if (copySize > (maxOffset[n] - (copyOffsetN + offset))) {
+                            //copySize is the number of bytes that are to be copied from the data source: N samples x size of the type to be copied
+                            //maxOffset is the maximum number of bytes that can be copied from the data source at a time: Number of buffers x size of the type to be copied. If the copySize is greater than the maxOffset, the copy must restart from the beginning of the memory
+                            //overSize if how much bigger is the copySize w.r.t. to the overSize (e.g. copy 3 samples of an uint32 => copySize = 12, dual buffer in the data source => 2 x 4 = 8) => overSize = 4
+                            int32 overSize = copySize % maxOffset[n];
+
+                            //The copySize may be many times bigger than the maxOffset, so that the copy of all the data source memory may need to be performed many times
+                            int32 numberOfFullCopies = ((copySize - overSize) / maxOffset[n]);
+                            bool isMultiple = (((copySize - overSize) % maxOffset[n]) == 0);
+                            if (isMultiple) {
+                                isMultiple = (copySize > overSize);
+                            }
+
+                            //If the memory that is left to copy (less the oversize) is a multiple of the data source memory, do one less copy, because the memory left to be copied is already copied at the end of the routine.
+                            if (isMultiple) {
+                                overSize += maxOffset[n];
+                                numberOfFullCopies--;
+                            }
+                            int32 copySizePhase = 0;
+
+                            //Copy any oversize buffer and remember how much was copied in copySizePhase
+                            if (overSize > (maxOffset[n] - (copyOffsetN + offset))) {
+                                copySizePhase = (maxOffset[n] - offset);
+
+                                (void) MemoryOperationsHelper::Copy(&(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
+                                                                    &((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
+                                                                    static_cast<uint32>(copySizePhase));
+                                gamOffset = static_cast<uint32>(copySizePhase);
+                                offset = 0;
+                            }
+
+                            //Copy any multiples of full data source memory copies
+                            for (int32 z = 0; z < numberOfFullCopies; z++) {
+                                (void) MemoryOperationsHelper::Copy(&(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
+                                                                    &((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
+                                                                    static_cast<uint32>(maxOffset[n]));
+
+                                gamOffset += static_cast<uint32>(maxOffset[n]);
+                            }
+
+                            //Copy the size left in the beginning of the circular buffer. Discount the number of full copies and the size copied at the end of the buffer.
+                            copySize = (copySize - (maxOffset[n] * numberOfFullCopies)) - copySizePhase;
                         }
-
-                        //Copy the size left in the beginning of the circular buffer. Discount the number of full copies and the size copied at the end of the buffer.
-                        copySize = (copySize - (maxOffset[n] * numberOfFullCopies)) - copySizePhase;
                     }
+                    (void) MemoryOperationsHelper::Copy(&(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
+                                                        &((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
+                                                        static_cast<uint32>(copySize));
                 }
-                (void) MemoryOperationsHelper::Copy(&(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
-                                                    &((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                    static_cast<uint32>(copySize));
                 ret = dataSource->TerminateInputCopy(signalIdxArr[n], uintoffset, samples[n]);
             }
         }
@@ -156,10 +180,18 @@ bool MemoryMapMultiBufferBroker::CopyOutputs() {
     /*lint -e{613} null pointer checked before.*/
     uint32 currentBuffer = dataSource->GetCurrentStateBuffer();
     if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
+        //See comments on the offset caching above.
+        bool cachedOffsetValid = false;
+        uint32 uintoffset = 0u;
         for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-            uint32 uintoffset = 0u;
-            /*lint -e{613} null pointer checked before.*/
-            ret = dataSource->GetOutputOffset(signalIdxArr[n], samples[n], uintoffset);
+            if (cachedOffsetValid) {
+                cachedOffsetValid = ((signalIdxArr[n] == signalIdxArr[n - 1u]) && (samples[n] == samples[n - 1u]));
+            }
+            if (!cachedOffsetValid) {
+                /*lint -e{613} null pointer checked before.*/
+                ret = dataSource->GetOutputOffset(signalIdxArr[n], samples[n], uintoffset);
+                cachedOffsetValid = ((ret) && (offsetCaching));
+            }
             if (ret) {
                 uint32 dataSourceIndex = ((currentBuffer * numberOfCopies) + n);
                 int32 copySize = static_cast<int32>(copyTable[n].copySize);
@@ -168,47 +200,55 @@ bool MemoryMapMultiBufferBroker::CopyOutputs() {
 
                 //See comments on the algorithm above.
                 int32 offset = static_cast<int32>(uintoffset);
-                bool offsetChanged = false;
-                while ((copyOffsetN + offset) >= maxOffset[n]) {
-                    offset = (offset - maxOffset[n]);
-                    offsetChanged = true;
+                if (mirroredCopy[n]) {
+                    //See comments on the mirrored copy above.
+                    int32 position = ((copyOffsetN + offset) % maxOffset[n]);
+                    (void) MemoryOperationsHelper::Copy(&((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[position - copyOffsetN]),
+                                                        &(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]), static_cast<uint32>(copySize));
                 }
-                if (!offsetChanged) {
-                    if (copySize > (maxOffset[n] - (copyOffsetN + offset))) {
-                        int32 overSize = copySize % maxOffset[n];
-                        int32 numberOfFullCopies = ((copySize - overSize) / maxOffset[n]);
-                        bool isMultiple = (((copySize - overSize) % maxOffset[n]) == 0);
-                        if (isMultiple) {
-                            isMultiple = (copySize > overSize);
-                        }
-
-                        if (isMultiple) {
-                            overSize += maxOffset[n];
-                            numberOfFullCopies--;
-                        }
-                        int32 copySizePhase = 0;
-                        if (overSize > (maxOffset[n] - (copyOffsetN + offset))) {
-                            copySizePhase = (maxOffset[n] - offset);
-
-                            (void) MemoryOperationsHelper::Copy(&((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                                &(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
-                                                                static_cast<uint32>(copySizePhase));
-                            gamOffset = static_cast<uint32>(copySizePhase);
-                            offset = 0;
-                        }
-                        for (int32 z = 0; z < numberOfFullCopies; z++) {
-                            (void) MemoryOperationsHelper::Copy(&((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                                &(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
-                                                                static_cast<uint32>(maxOffset[n]));
-
-                            gamOffset += static_cast<uint32>(maxOffset[n]);
+                else {
+                    bool offsetChanged = false;
+                    while ((copyOffsetN + offset) >= maxOffset[n]) {
+                        offset = (offset - maxOffset[n]);
+                        offsetChanged = true;
+                    }
+                    if (!offsetChanged) {
+                        if (copySize > (maxOffset[n] - (copyOffsetN + offset))) {
+                            int32 overSize = copySize % maxOffset[n];
+                            int32 numberOfFullCopies = ((copySize - overSize) / maxOffset[n]);
+                            bool isMultiple = (((copySize - overSize) % maxOffset[n]) == 0);
+                            if (isMultiple) {
+                                isMultiple = (copySize > overSize);
+                            }
+
+                            if (isMultiple) {
+                                overSize += maxOffset[n];
+                                numberOfFullCopies--;
+                            }
+                            int32 copySizePhase = 0;
+                            if (overSize > (maxOffset[n] - (copyOffsetN + offset))) {
+                                copySizePhase = (maxOffset[n] - offset);
+
+                                (void) MemoryOperationsHelper::Copy(&((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
+                                                                    &(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
+                                                                    static_cast<uint32>(copySizePhase));
+                                gamOffset = static_cast<uint32>(copySizePhase);
+                                offset = 0;
+                            }
+                            for (int32 z = 0; z < numberOfFullCopies; z++) {
+                                (void) MemoryOperationsHelper::Copy(&((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
+                                                                    &(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]),
+                                                                    static_cast<uint32>(maxOffset[n]));
+
+                                gamOffset += static_cast<uint32>(maxOffset[n]);
+                            }
+
+                            copySize = (copySize - (maxOffset[n] * numberOfFullCopies)) - copySizePhase;
                         }
-
-                        copySize = (copySize - (maxOffset[n] * numberOfFullCopies)) - copySizePhase;
                     }
+                    (void) MemoryOperationsHelper::Copy(&((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
+                                                        &(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]), static_cast<uint32>(copySize));
                 }
-                (void) MemoryOperationsHelper::Copy(&((reinterpret_cast<uint8*>(copyTable[dataSourceIndex].dataSourcePointer))[offset]),
-                                                    &(reinterpret_cast<uint8*>(copyTable[n].gamPointer)[gamOffset]), static_cast<uint32>(copySize));
                 ret = dataSource->TerminateOutputCopy(signalIdxArr[n], uintoffset, samples[n]);
             }
         }
@@ -264,6 +304,13 @@ bool MemoryMapMultiBufferBroker::Init(const SignalDirection direction,
             maxOffset = new int32[numberOfCopies];
             ret = (maxOffset != NULL_PTR(int32*));
         }
+        if (ret) {
+            mirroredCopy = new bool[numberOfCopies];
+            ret = (mirroredCopy != NULL_PTR(bool*));
+        }
+    }
+    if (ret) {
+        offsetCaching = dataSource->IsOffsetCachingSupported();
     }
     uint32 functionIdx = 0u;
     if (ret) {
@@ -306,6 +353,11 @@ bool MemoryMapMultiBufferBroker::Init(const SignalDirection direction,
                     maxSignalOffset *= byteSize;
                 }
 
+                bool signalMirrored = false;
+                if (ret) {
+                    signalMirrored = dataSource->IsSignalMemoryMirrored(signalIdx);
+                }
+
                 bool noRanges = true;
                 if (ret) {
                     uint32 offsetStart;
@@ -335,6 +387,8 @@ bool MemoryMapMultiBufferBroker::Init(const SignalDirection direction,
                         signalIdxArr[c % (numberOfCopies)] = signalIdx;
                         samples[c % (numberOfCopies)] = nSamples;
                         maxOffset[c % (numberOfCopies)] = static_cast<int32>(maxSignalOffset);
+                        //A mirrored copy cannot be larger than the signal buffers (i.e. more samples than buffers).
+                        mirroredCopy[c % (numberOfCopies)] = ((signalMirrored) && (copyTable[c].copySize <= maxSignalOffset));
                         void *dataSourceSignalAddress;
                         ret = dataSource->GetSignalMemoryBuffer(signalIdx, c0, dataSourceSignalAddress);
                         char8 *dataSourceSignalAddressChar = reinterpret_cast<char8*>(dataSourceSignalAddress);
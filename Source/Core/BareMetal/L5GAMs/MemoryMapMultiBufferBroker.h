@@ -56,7 +56,10 @@ namespace MARTe {
  * If the number of samples provided by the DataSourceI is > than the number of memory buffers a circular buffer implementation will be assumed.
  *
  * The reason why the offset needs to be computed for every signal is that there might be DataSourceI implementations where a given signal is ready
- *  before others and thus can be copied in advanced.
+ *  before others and thus can be copied in advanced. If DataSourceI::IsOffsetCachingSupported the offset is computed only once per signal (and not for every range and sample of the signal).
+ *
+ * If DataSourceI::IsSignalMemoryMirrored the buffers of the signal are followed by a mirror of themselves and each copy is performed with a single memory copy
+ *  (provided that the number of samples is not greater than the number of buffers).
  */
 class MemoryMapMultiBufferBroker: public MemoryMapBroker {
 public:
@@ -119,6 +122,16 @@ protected:
      * The offset in bytes to be copied for each copy. Needed to trap out-of-bounds exceptions in circular buffer implementations.
      */
     int32 *maxOffset;
+
+    /**
+     * True for the copies that can be performed with a single memory copy from/to the mirrored signal buffers (see DataSourceI::IsSignalMemoryMirrored).
+     */
+    bool *mirroredCopy;
+
+    /**
+     * The value of DataSourceI::IsOffsetCachingSupported.
+     */
+    bool offsetCaching;
 };
 }
 
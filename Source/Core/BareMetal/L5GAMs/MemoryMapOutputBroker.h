@@ -60,6 +60,7 @@ public:
     /**
      * @brief Sequentially copies all the signals from the GAM memory to the DataSourceI memory.
      * @details This implementation supports multi-state buffers and will query the DataSource for the GetCurrentStateBuffer.
+     * The copies are performed using the compiled copy plan (see MemoryMapBroker::CompileCopyPlan).
      * @return true if all copies are successfully performed.
      */
     virtual bool Execute();
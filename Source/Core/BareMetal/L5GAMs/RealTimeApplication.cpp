@@ -64,6 +64,7 @@ RealTimeApplication::RealTimeApplication() :
     index=1u;
     checkSameGamInMoreThreads=true;
     checkMultipleProducersWrites=true;
+    zeroCopySignals=false;
 }
 
 /*lint -e{1551} Guarantess that the execution is stopped upon destrucion of the RealTimeApplication*/
@@ -93,6 +94,13 @@ bool RealTimeApplication::Initialise(StructuredDataI & data) {
         }
         checkMultipleProducersWrites=(checkMultipleProducersWritesT>0u);
     }
+    if(ret){
+        uint8 zeroCopySignalsT=0u;
+        if(!data.Read("ZeroCopySignals", zeroCopySignalsT)){
+            zeroCopySignalsT=0u;
+        }
+        zeroCopySignals=(zeroCopySignalsT>0u);
+    }
 
 
     if (data.MoveRelative("+Data")) {
@@ -209,11 +217,28 @@ bool RealTimeApplication::Initialise(StructuredDataI & data) {
 }
 
 bool RealTimeApplication::ConfigureApplication() {
+    bool ret = true;
+    if (scheduler.IsValid()) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to configure the scheduler TimingDataSource");
+        ret = scheduler->ConfigureTimingDataSource(this);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to configure the scheduler TimingDataSource");
+        }
+    }
     RealTimeApplicationConfigurationBuilder rtAppBuilder(*this, defaultDataSourceName.Buffer());
-    REPORT_ERROR(ErrorManagement::Information, "Going to rtAppBuilder.ConfigureAfterInitialisation()");
-    bool ret = rtAppBuilder.ConfigureAfterInitialisation();
-    if (!ret) {
-        REPORT_ERROR(ErrorManagement::ParametersError, "Failed to rtAppBuilder.ConfigureAfterInitialisation()");
+    if (ret) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to rtAppBuilder.ConfigureAfterInitialisation()");
+        ret = rtAppBuilder.ConfigureAfterInitialisation();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to rtAppBuilder.ConfigureAfterInitialisation()");
+        }
+    }
+    if ((ret) && (zeroCopySignals)) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to rtAppBuilder.ResolveZeroCopySignals()");
+        ret = rtAppBuilder.ResolveZeroCopySignals();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to rtAppBuilder.ResolveZeroCopySignals()");
+        }
     }
     if (ret) {
         REPORT_ERROR(ErrorManagement::Information, "Going to rtAppBuilder.PostConfigureDataSources()");
@@ -250,6 +275,20 @@ bool RealTimeApplication::ConfigureApplication() {
             REPORT_ERROR(ErrorManagement::ParametersError, "Failed to AllocateDataSourceMemory()");
         }
     }
+    if ((ret) && (zeroCopySignals)) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to AliasZeroCopySignals()");
+        ret = AliasZeroCopySignals();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to AliasZeroCopySignals()");
+        }
+    }
+    if ((ret) && (zeroCopySignals)) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to SetupGAMs()");
+        ret = SetupGAMs();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to SetupGAMs()");
+        }
+    }
     if (ret) {
         REPORT_ERROR(ErrorManagement::Information, "Going to AddBrokersToFunctions");
         ret = AddBrokersToFunctions();
@@ -280,8 +319,18 @@ bool RealTimeApplication::ConfigureApplication() {
 
 bool RealTimeApplication::ConfigureApplication(ConfigurationDatabase &functionsDatabaseIn, ConfigurationDatabase &dataDatabaseIn) {
 
+    bool ret = true;
+    if (scheduler.IsValid()) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to configure the scheduler TimingDataSource");
+        ret = scheduler->ConfigureTimingDataSource(this);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to configure the scheduler TimingDataSource");
+        }
+    }
     RealTimeApplicationConfigurationBuilder configuration(*this, "DDB1");
-    bool ret = configuration.Set(functionsDatabaseIn, dataDatabaseIn);
+    if (ret) {
+        ret = configuration.Set(functionsDatabaseIn, dataDatabaseIn);
+    }
     if (ret) {
         REPORT_ERROR(ErrorManagement::Information, "Going to configuration.AssignBrokersToFunctions()");
         ret = configuration.AssignBrokersToFunctions();
@@ -289,6 +338,13 @@ bool RealTimeApplication::ConfigureApplication(ConfigurationDatabase &functionsD
             REPORT_ERROR(ErrorManagement::ParametersError, "Failed to configuration.AssignBrokersToFunctions()");
         }
     }
+    if ((ret) && (zeroCopySignals)) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to configuration.ResolveZeroCopySignals()");
+        ret = configuration.ResolveZeroCopySignals();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to configuration.ResolveZeroCopySignals()");
+        }
+    }
     if (ret) {
         REPORT_ERROR(ErrorManagement::Information, "Going to configuration.Copy()");
         ret = configuration.Copy(functionsDatabase, dataSourcesDatabase);
@@ -331,6 +387,20 @@ bool RealTimeApplication::ConfigureApplication(ConfigurationDatabase &functionsD
             REPORT_ERROR(ErrorManagement::ParametersError, "Failed to AllocateDataSourceMemory()");
         }
     }
+    if ((ret) && (zeroCopySignals)) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to AliasZeroCopySignals()");
+        ret = AliasZeroCopySignals();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to AliasZeroCopySignals()");
+        }
+    }
+    if ((ret) && (zeroCopySignals)) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to SetupGAMs()");
+        ret = SetupGAMs();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to SetupGAMs()");
+        }
+    }
     if (ret) {
         REPORT_ERROR(ErrorManagement::Information, "Going to AddBrokersToFunctions()");
         ret = AddBrokersToFunctions();
@@ -377,7 +447,8 @@ bool RealTimeApplication::AllocateGAMMemory() {
                     if (ret) {
                         ret = gam->AllocateOutputSignalsMemory();
                     }
-                    if (ret) {
+                    //With zero-copy signals the Setup is deferred to SetupGAMs, after the signals are aliased.
+                    if ((ret) && (!zeroCopySignals)) {
                         ret = gam->Setup();
                         if (!ret) {
                             REPORT_ERROR(ErrorManagement::ParametersError, "GAM %s Setup failed", fullGAMName.Buffer());
@@ -393,6 +464,127 @@ bool RealTimeApplication::AllocateGAMMemory() {
     return ret;
 }
 
+bool RealTimeApplication::SetupGAMs() {
+
+    bool ret = functionsDatabase.MoveAbsolute("Functions");
+    uint32 numberOfFunctions = functionsDatabase.GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfFunctions) && (ret); i++) {
+        const char8 * functionId = functionsDatabase.GetChildName(i);
+        ret = functionsDatabase.MoveRelative(functionId);
+        if (ret) {
+            StreamString fullGAMName = "Functions.";
+            ret = functionsDatabase.Read("QualifiedName", fullGAMName);
+            if (ret) {
+                ReferenceT<GAM> gam = Find(fullGAMName.Buffer());
+                ret = gam.IsValid();
+
+                if (ret) {
+                    ret = gam->Setup();
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "GAM %s Setup failed", fullGAMName.Buffer());
+                    }
+                }
+            }
+        }
+        if (ret) {
+            ret = functionsDatabase.MoveToAncestor(1u);
+        }
+    }
+    return ret;
+}
+
+bool RealTimeApplication::AliasZeroCopySignals() {
+    bool ret = dataSourcesDatabase.MoveAbsolute("Data");
+    uint32 numberOfDs = dataSourcesDatabase.GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfDs) && (ret); i++) {
+        const char8* dsId = dataSourcesDatabase.GetChildName(i);
+        ret = dataSourcesDatabase.MoveRelative(dsId);
+        ReferenceT<DataSourceI> ds;
+        if (ret) {
+            StreamString fullDsName = "Data.";
+            ret = dataSourcesDatabase.Read("QualifiedName", fullDsName);
+            if (ret) {
+                ds = Find(fullDsName.Buffer());
+                ret = ds.IsValid();
+            }
+        }
+        uint32 numberOfFunctions = 0u;
+        if (ret) {
+            numberOfFunctions = ds->GetNumberOfFunctions();
+        }
+        for (uint32 f = 0u; (f < numberOfFunctions) && (ret); f++) {
+            StreamString fullGAMName = "Functions.";
+            StreamString functionName;
+            ret = ds->GetFunctionName(f, functionName);
+            ReferenceT<GAM> gam;
+            if (ret) {
+                fullGAMName += functionName;
+                gam = Find(fullGAMName.Buffer());
+                ret = gam.IsValid();
+            }
+            for (uint32 d = 0u; (d < 2u) && (ret); d++) {
+                SignalDirection direction = InputSignals;
+                if (d == 1u) {
+                    direction = OutputSignals;
+                }
+                uint32 numberOfSignals = 0u;
+                if (!ds->GetFunctionNumberOfSignals(direction, f, numberOfSignals)) {
+                    numberOfSignals = 0u;
+                }
+                for (uint32 n = 0u; (n < numberOfSignals) && (ret); n++) {
+                    if (ds->IsZeroCopySignal(direction, f, n)) {
+                        StreamString gamSignalName;
+                        StreamString dsSignalName;
+                        ret = ds->GetFunctionSignalName(direction, f, n, gamSignalName);
+                        if (ret) {
+                            ret = ds->GetFunctionSignalAlias(direction, f, n, dsSignalName);
+                        }
+                        uint32 dsSignalIdx = 0u;
+                        if (ret) {
+                            ret = ds->GetSignalIndex(dsSignalIdx, dsSignalName.Buffer());
+                        }
+                        void *dsSignalAddress = NULL_PTR(void *);
+                        if (ret) {
+                            ret = ds->GetSignalMemoryBuffer(dsSignalIdx, 0u, dsSignalAddress);
+                        }
+                        uint32 gamSignalIdx = 0u;
+                        if (ret) {
+                            ret = gam->GetSignalIndex(direction, gamSignalIdx, gamSignalName.Buffer());
+                        }
+                        //Double check that the layout is the same
+                        uint32 gamSignalByteSize = 0u;
+                        uint32 dsSignalByteSize = 0u;
+                        if (ret) {
+                            ret = gam->GetSignalByteSize(direction, gamSignalIdx, gamSignalByteSize);
+                        }
+                        if (ret) {
+                            ret = ds->GetSignalByteSize(dsSignalIdx, dsSignalByteSize);
+                        }
+                        if (ret) {
+                            ret = (gamSignalByteSize == dsSignalByteSize);
+                        }
+                        if (ret) {
+                            ret = gam->AliasSignalMemory(direction, gamSignalIdx, dsSignalAddress);
+                        }
+                        if (ret) {
+                            REPORT_ERROR(ErrorManagement::Information, "Signal %s of %s directly accesses the memory of %s.%s", gamSignalName.Buffer(),
+                                         functionName.Buffer(), ds->GetName(), dsSignalName.Buffer());
+                        }
+                        else {
+                            REPORT_ERROR(ErrorManagement::ParametersError, "Could not alias the signal %s of %s to the memory of %s.%s", gamSignalName.Buffer(),
+                                         functionName.Buffer(), ds->GetName(), dsSignalName.Buffer());
+                        }
+                    }
+                }
+            }
+        }
+        if (ret) {
+            ret = dataSourcesDatabase.MoveToAncestor(1u);
+        }
+    }
+    return ret;
+}
+
 bool RealTimeApplication::AllocateDataSourceMemory() {
     bool ret = dataSourcesDatabase.MoveAbsolute("Data");
     uint32 numberOfDs = dataSourcesDatabase.GetNumberOfChildren();
@@ -165,6 +165,7 @@ public:
      * @details The user can specify the following parameters
      *   CheckMultipleProducersWrites = 1 //enable-disable check multiple producers to write on the same data source signal. Default = 1
      *   CheckSameGamInMoreThreads = 1 //allow a GAM to be declared in more than one RTT per state. Default = 1
+     *   ZeroCopySignals = 0 //if 1 the GAMs directly access the DataSourceI memory of the signals that do not require a broker copy (see RealTimeApplicationConfigurationBuilder::ResolveZeroCopySignals). Default = 0
      * @param[in] data contains the initialisation data.
      * @return true if the parameters +Functions, +States, +Data and +Scheduler
      * exist and each inherit from ReferenceContainer.
@@ -250,8 +251,8 @@ public:
 private:
 
     /**
-     * @brief Calls GAM::AllocateInputSignalsMemory and GAM::AllocateOutputSignalsMemory on all the GAM components.
-     * @return true if all the GAM::AllocateInputSignalsMemory and GAM::AllocateOutputSignalsMemory calls return true.
+     * @brief Calls GAM::AllocateInputSignalsMemory, GAM::AllocateOutputSignalsMemory and (if ZeroCopySignals = 0) GAM::Setup on all the GAM components.
+     * @return true if all the GAM::AllocateInputSignalsMemory, GAM::AllocateOutputSignalsMemory and GAM::Setup calls return true.
      */
     bool AllocateGAMMemory();
 
@@ -261,6 +262,22 @@ private:
      */
     bool AllocateDataSourceMemory();
 
+    /**
+     * @brief Calls GAM::AliasSignalMemory for all the signals that were marked by RealTimeApplicationConfigurationBuilder::ResolveZeroCopySignals.
+     * @return true if the DataSourceI memory of all the marked signals can be assigned to the GAM signals.
+     * @pre
+     *   AllocateGAMMemory() && AllocateDataSourceMemory()
+     */
+    bool AliasZeroCopySignals();
+
+    /**
+     * @brief Calls GAM::Setup on all the GAM components (ZeroCopySignals = 1).
+     * @return true if all the GAM::Setup calls return true.
+     * @pre
+     *   AliasZeroCopySignals()
+     */
+    bool SetupGAMs();
+
     /**
      * @brief Calls DataSourceI::AddBrokers(Input/OutputSignals) on all the DataSourceI components.
      * @return true if all the DataSourceI::AddBrokers calls return true.
@@ -337,6 +354,11 @@ private:
      * Check if each signal has only one producer in each state
      */
     bool checkMultipleProducersWrites;
+
+    /**
+     * Allow the GAMs to directly access the DataSourceI memory
+     */
+    bool zeroCopySignals;
 };
 
 }
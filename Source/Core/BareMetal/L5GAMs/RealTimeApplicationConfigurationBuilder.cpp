@@ -61,7 +61,7 @@ RealTimeApplicationConfigurationBuilder::RealTimeApplicationConfigurationBuilder
     initialiseAfterInitialisation = true;
 }
 
-RealTimeApplicationConfigurationBuilder::RealTimeApplicationConfigurationBuilder(ConfigurationDatabase &globalDatabaseIn,
+RealTimeApplicationConfigurationBuilder::RealTimeApplicationConfigurationBuilder(StructuredDataI &globalDatabaseIn,
                                                                                  const char8 *const defaultDataSourceNameIn) :
         Object() {
     defaultDataSourceName = defaultDataSourceNameIn;
@@ -3060,6 +3060,175 @@ bool RealTimeApplicationConfigurationBuilder::AssignBrokersToSignals(const Signa
     return ret;
 }
 
+bool RealTimeApplicationConfigurationBuilder::ResolveZeroCopySignals() {
+    bool ret = (realTimeApplication != NULL);
+    if (!ret) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Invalid RealTimeApplication set");
+    }
+    if (ret) {
+        ret = dataSourcesDatabase.MoveAbsolute("Data");
+    }
+    uint32 numberOfDataSources = 0u;
+    if (ret) {
+        numberOfDataSources = dataSourcesDatabase.GetNumberOfChildren();
+    }
+
+    ConfigurationDatabase dataSourcesDatabaseBeforeMove = dataSourcesDatabase;
+    for (uint32 i = 0u; (i < numberOfDataSources) && (ret); i++) {
+        dataSourcesDatabase = dataSourcesDatabaseBeforeMove;
+        ret = dataSourcesDatabase.MoveToChild(i);
+        StreamString dsName;
+        if (ret) {
+            ret = dataSourcesDatabase.Read("QualifiedName", dsName);
+        }
+        ReferenceT<DataSourceI> dataSource;
+        if (ret) {
+            StreamString fullDsPath = "Data.";
+            fullDsPath += dsName;
+            /*lint -e{613} NULL pointer checking done before entering here */
+            dataSource = realTimeApplication->Find(fullDsPath.Buffer());
+            ret = dataSource.IsValid();
+            if (!ret) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s is not a valid DataSourceI", fullDsPath.Buffer());
+            }
+        }
+        bool supported = false;
+        if (ret) {
+            supported = dataSource->IsZeroCopySupported();
+            if (supported) {
+                supported = (dataSource->GetNumberOfStatefulMemoryBuffers() == 1u);
+            }
+        }
+        if (supported) {
+            ConfigurationDatabase dataSourceSignalsDatabase = dataSourcesDatabase;
+            ret = dataSourceSignalsDatabase.MoveRelative("Signals");
+            //Allow for empty DataSources...
+            if (ret) {
+                if (dataSourcesDatabase.MoveRelative("Functions")) {
+                    uint32 numberOfFunctions = dataSourcesDatabase.GetNumberOfChildren();
+                    ConfigurationDatabase dataSourcesDatabaseBeforeFunctionMove = dataSourcesDatabase;
+                    for (uint32 j = 0u; (j < numberOfFunctions) && (ret); j++) {
+                        dataSourcesDatabase = dataSourcesDatabaseBeforeFunctionMove;
+                        ret = dataSourcesDatabase.MoveToChild(j);
+                        if (ret) {
+                            ret = ResolveZeroCopyFunctionSignals(InputSignals, dataSourceSignalsDatabase);
+                        }
+                        if (ret) {
+                            ret = ResolveZeroCopyFunctionSignals(OutputSignals, dataSourceSignalsDatabase);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool RealTimeApplicationConfigurationBuilder::ResolveZeroCopyFunctionSignals(const SignalDirection direction,
+                                                                             const ConfigurationDatabase &dataSourceSignalsDatabase) {
+    const char8 *dirStr = "InputSignals";
+    const char8 *otherDirStr = "OutputSignals";
+    const char8 *brokerClassName = "MemoryMapInputBroker";
+    if (direction == OutputSignals) {
+        dirStr = "OutputSignals";
+        otherDirStr = "InputSignals";
+        brokerClassName = "MemoryMapOutputBroker";
+    }
+
+    bool ret = true;
+    ConfigurationDatabase otherDirectionDatabase = dataSourcesDatabase;
+    bool hasOtherDirection = otherDirectionDatabase.MoveRelative(otherDirStr);
+    ConfigurationDatabase functionSignalsDatabase = dataSourcesDatabase;
+    if (functionSignalsDatabase.MoveRelative(dirStr)) {
+        uint32 numberOfSignals = functionSignalsDatabase.GetNumberOfChildren();
+        for (uint32 n = 0u; (n < numberOfSignals) && (ret); n++) {
+            ConfigurationDatabase signalDatabase = functionSignalsDatabase;
+            //Only the signal nodes are relevant
+            bool zeroCopy = signalDatabase.MoveToChild(n);
+            if (zeroCopy) {
+                StreamString broker;
+                zeroCopy = signalDatabase.Read("Broker", broker);
+                if (zeroCopy) {
+                    zeroCopy = (broker == brokerClassName);
+                }
+            }
+            if (zeroCopy) {
+                uint32 samples;
+                if (!signalDatabase.Read("Samples", samples)) {
+                    samples = 1u;
+                }
+                float32 frequency;
+                if (!signalDatabase.Read("Frequency", frequency)) {
+                    frequency = -1.0F;
+                }
+                uint32 trigger;
+                if (!signalDatabase.Read("Trigger", trigger)) {
+                    trigger = 0u;
+                }
+                zeroCopy = ((samples == 1u) && (frequency < 0.0F) && (trigger == 0u));
+            }
+            StreamString alias;
+            if (zeroCopy) {
+                zeroCopy = signalDatabase.Read("Alias", alias);
+            }
+            //Get the byte size of the DataSourceI signal
+            uint32 byteSize = 0u;
+            if (zeroCopy) {
+                bool found = false;
+                ConfigurationDatabase dataSourceSignalsDatabaseBeforeMove = dataSourceSignalsDatabase;
+                uint32 numberOfDataSourceSignals = dataSourceSignalsDatabaseBeforeMove.GetNumberOfChildren();
+                for (uint32 s = 0u; (s < numberOfDataSourceSignals) && (!found); s++) {
+                    ConfigurationDatabase dataSourceSignalDatabase = dataSourceSignalsDatabaseBeforeMove;
+                    if (dataSourceSignalDatabase.MoveToChild(s)) {
+                        StreamString dataSourceSignalName;
+                        if (dataSourceSignalDatabase.Read("QualifiedName", dataSourceSignalName)) {
+                            found = (dataSourceSignalName == alias);
+                        }
+                        if (found) {
+                            found = dataSourceSignalDatabase.Read("ByteSize", byteSize);
+                        }
+                    }
+                }
+                zeroCopy = found;
+            }
+            //The GAM signal must map the full DataSourceI signal
+            if (zeroCopy) {
+                AnyType existentByteOffset = signalDatabase.GetType("ByteOffset");
+                zeroCopy = (existentByteOffset.GetDataPointer() != NULL_PTR(void*));
+                if (zeroCopy) {
+                    zeroCopy = (existentByteOffset.GetNumberOfElements(1u) == 1u);
+                }
+                if (zeroCopy) {
+                    uint32 offsetMatrixBackend[2u] = { 0u, 0u };
+                    Matrix<uint32> offsetMat(&offsetMatrixBackend[0], 1u, 2u);
+                    zeroCopy = signalDatabase.Read("ByteOffset", offsetMat);
+                    if (zeroCopy) {
+                        zeroCopy = ((offsetMatrixBackend[0] == 0u) && (offsetMatrixBackend[1] == byteSize));
+                    }
+                }
+            }
+            //The same Function cannot read and write the same signal from the same memory
+            if ((zeroCopy) && (hasOtherDirection)) {
+                uint32 numberOfOtherSignals = otherDirectionDatabase.GetNumberOfChildren();
+                for (uint32 s = 0u; (s < numberOfOtherSignals) && (zeroCopy); s++) {
+                    ConfigurationDatabase otherSignalDatabase = otherDirectionDatabase;
+                    if (otherSignalDatabase.MoveToChild(s)) {
+                        StreamString otherAlias;
+                        if (otherSignalDatabase.Read("Alias", otherAlias)) {
+                            zeroCopy = (otherAlias != alias);
+                        }
+                    }
+                }
+            }
+            if (zeroCopy) {
+                ret = signalDatabase.Write("ZeroCopy", 1u);
+            }
+        }
+    }
+    return ret;
+}
+
 bool RealTimeApplicationConfigurationBuilder::PostConfigureDataSources() {
     bool ret = dataSourcesDatabase.MoveToRoot();
     uint32 numberOfDataSources = 0u;
@@ -90,14 +90,16 @@ public:
                                           const char8 * const defaultDataSourceNameIn);
 
     /**
-     * @brief Constructor for RealTimeApplicationConfigurationBuilders which should work over a ConfigurationDatabase (i.e. without needing to access live objects).
-     * @param[in] globalDatabaseIn the ConfigurationDatabase where to load all the information required to construct the application information..
+     * @brief Constructor for RealTimeApplicationConfigurationBuilders which should work over a StructuredDataI (i.e. without needing to access live objects).
+     * @details Any StructuredDataI can be used (e.g. a ConfigurationDatabase or a frozen ImmutableConfigurationDatabase), given that
+     * it is only read (with StructuredDataI::Copy) from its current node.
+     * @param[in] globalDatabaseIn the StructuredDataI where to load all the information required to construct the application information..
      * @param[in] defaultDataSourceNameIn default DataSource name to be used when the DataSource in not defined in any of the signals.
      * @post
      *   realTimeApplication = realTimeApplicationIn
      *   defaultDataSourceName = defaultDataSourceNameIn
      */
-    RealTimeApplicationConfigurationBuilder(ConfigurationDatabase &globalDatabaseIn,
+    RealTimeApplicationConfigurationBuilder(StructuredDataI &globalDatabaseIn,
                                           const char8 * const defaultDataSourceNameIn);
 
     /**
@@ -624,6 +626,23 @@ public:
      */
     bool AssignBrokersToFunctions();
 
+    /**
+     * @brief Marks the signals that can be directly accessed by the GAMs in the DataSourceI memory (i.e. without broker copies).
+     * @details A signal of a Function is marked with ZeroCopy = 1 in the Data database if all the following conditions are met:
+     *   - DataSourceI::IsZeroCopySupported returns true and DataSourceI::GetNumberOfStatefulMemoryBuffers returns 1;
+     *   - the Broker is MemoryMapInputBroker (InputSignals) or MemoryMapOutputBroker (OutputSignals);
+     *   - Samples = 1, Frequency < 0 and Trigger = 0;
+     *   - there are no Ranges (i.e. the GAM signal has the same layout of the DataSourceI signal);
+     *   - the same Function does not use the signal in the other direction.
+     *
+     * The signals marked with ZeroCopy = 1 are not handled by any broker (see DataSourceI::IsSupportedBroker) and
+     * the GAM memory of these signals is aliased to the DataSourceI memory (see GAM::AliasSignalMemory).
+     * @return true if the Data database could be successfully updated.
+     * @pre
+     *   AssignBrokersToFunctions()
+     */
+    bool ResolveZeroCopySignals();
+
     /**
      * @brief For each DataSource calls DataSourceI::SetConfiguredDatabase followed by DataSourceI::AllocateMemory.
      * @details Calls DataSourceI::SetConfiguredDatabase on each DataSource under Data, passing the Signals{} and Functions{} branches.
@@ -889,6 +908,15 @@ private:
     bool AssignBrokersToSignals(const SignalDirection direction,
                                 ReferenceT<DataSourceI> dataSource);
 
+    /**
+     * @brief @see ResolveZeroCopySignals()
+     * @param[in] direction can be either InputSignals or OutputSignals
+     * @param[in] dataSourceSignalsDatabase the Signals node of the DataSourceI being queried.
+     * @return @see ResolveZeroCopySignals()
+     */
+    bool ResolveZeroCopyFunctionSignals(const SignalDirection direction,
+                                        const ConfigurationDatabase &dataSourceSignalsDatabase);
+
     /**
      * @brief Find the unique number associated to the DataSource with name = \a dataSourceName.
      * @param[in] dataSourceName the fully qualified name of the DataSource to search.
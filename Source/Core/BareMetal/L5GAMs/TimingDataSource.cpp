@@ -34,6 +34,7 @@
 #include "TimingDataSource.h"
 
 #include "AdvancedErrorManagement.h"
+#include "MemoryMapSynchronisedInputBroker.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -46,9 +47,12 @@ namespace MARTe {
 
 TimingDataSource::TimingDataSource() :
         GAMDataSource() {
+    currentState = NULL_PTR(uint32 *);
+    rawTicksTiming = false;
 }
 
 TimingDataSource::~TimingDataSource() {
+    currentState = NULL_PTR(uint32 *);
 }
 
 bool TimingDataSource::SetConfiguredDatabase(StructuredDataI & data) {
@@ -80,6 +84,93 @@ bool TimingDataSource::SetConfiguredDatabase(StructuredDataI & data) {
     return ret;
 }
 
+const char8* TimingDataSource::GetBrokerName(StructuredDataI &data,
+                                             const SignalDirection direction) {
+    const char8 *brokerName = GAMDataSource::GetBrokerName(data, direction);
+    if ((rawTicksTiming) && (brokerName != NULL_PTR(const char8 *)) && (direction == InputSignals)) {
+        brokerName = "MemoryMapSynchronisedInputBroker";
+    }
+    return brokerName;
+}
+
+bool TimingDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
+                                       const char8 * const functionName,
+                                       void * const gamMemPtr) {
+    bool ret;
+    if (rawTicksTiming) {
+        ReferenceT<MemoryMapSynchronisedInputBroker> broker("MemoryMapSynchronisedInputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(InputSignals, *this, functionName, gamMemPtr, true);
+        }
+        if (ret) {
+            if (broker->GetNumberOfCopies() > 0u) {
+                ret = inputBrokers.Insert(broker);
+            }
+        }
+    }
+    else {
+        ret = GAMDataSource::GetInputBrokers(inputBrokers, functionName, gamMemPtr);
+    }
+    return ret;
+}
+
+bool TimingDataSource::IsZeroCopySupported() {
+    return false;
+}
+
+bool TimingDataSource::Synchronise() {
+    uint32 numberOfTables = rawTicksTables.GetSize();
+    if ((numberOfTables > 0u) && (currentState != NULL_PTR(uint32 *))) {
+        uint32 stateIdentifier = *currentState;
+        const TimingDataSourceRawTicksTable *tables = rawTicksTables.GetAllocatedMemoryConst();
+        for (uint32 t = 0u; t < numberOfTables; t++) {
+            if (tables[t].stateIdentifier == stateIdentifier) {
+                for (uint32 i = 0u; i < tables[t].numberOfElements; i++) {
+                    float64 ticksToTime = static_cast<float64>(tables[t].ticks[i]) * tables[t].ticksToTime;
+                    *(tables[t].signals[i]) = static_cast<uint32>(ticksToTime);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool TimingDataSource::AddRawTicksTable(const TimingDataSourceRawTicksTable &table) {
+    bool ret = true;
+    if (currentState == NULL_PTR(uint32 *)) {
+        uint32 signalIdx;
+        ret = GetSignalIndex(signalIdx, "CurrentState");
+        void *signalAddress = NULL_PTR(void *);
+        if (ret) {
+            ret = GetSignalMemoryBuffer(signalIdx, 0u, signalAddress);
+        }
+        if (ret) {
+            currentState = reinterpret_cast<uint32 *>(signalAddress);
+            ret = (currentState != NULL_PTR(uint32 *));
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In TimingDataSource %s, the CurrentState signal is not available", GetName());
+        }
+    }
+    if (ret) {
+        ret = rawTicksTables.Add(table);
+    }
+    return ret;
+}
+
+void TimingDataSource::RemoveRawTicksTables() {
+    rawTicksTables.Clean();
+}
+
+void TimingDataSource::SetRawTicksTiming(const bool rawTicksTimingIn) {
+    rawTicksTiming = rawTicksTimingIn;
+}
+
+uint32 TimingDataSource::GetNumberOfRawTicksTables() const {
+    return rawTicksTables.GetSize();
+}
+
 CLASS_REGISTER(TimingDataSource, "1.0")
 
 }
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "GAMDataSource.h"
+#include "StaticList.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -40,6 +41,36 @@
 
 namespace MARTe {
 
+/**
+ * @brief POD with the raw HighResolutionTimer tick counters of a thread and the timing signals where they are to be converted to.
+ */
+struct TimingDataSourceRawTicksTable {
+    /**
+     * The identifier of the state (as written in the CurrentState signal) where this table is valid.
+     */
+    uint32 stateIdentifier;
+
+    /**
+     * The raw tick counters (written by the GAMSchedulerI).
+     */
+    const uint64 *ticks;
+
+    /**
+     * The address of the timing signal where each tick counter is to be converted to.
+     */
+    uint32 * const *signals;
+
+    /**
+     * The number of elements in ticks and in signals.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * The factor to convert ticks to the signal time unit.
+     */
+    float64 ticksToTime;
+};
+
 /**
  * @brief GAMDataSource implementation that is used to store the executions timing of the MARTe components.
  * @details For every Thread in the application it will generate a signal named STATE_NAME.THREAD_NAME_CycleTime,
@@ -51,6 +82,14 @@ namespace MARTe {
  *  for this GAM_NAME have been executed. The GAM_NAME_WriteTime holds the time elapsed from the beginning of the cycle
  *  until all the output brokers for this GAM_NAME have been executed. The GAM_NAME_ExecTime holds the time elapsed
  *  from the beginning of the cycle until this GAM_NAME has finished its execution.
+ *
+ * @details The GAMSchedulerI may, instead of converting and writing the timing signals after the execution of every
+ * ExecutableI, only store the raw HighResolutionTimer ticks (see GAMSchedulerI RawTicksTiming). In this case the tables
+ * registered with AddRawTicksTable are converted into the timing signals when the signals are read, i.e. in Synchronise,
+ * which is called by the MemoryMapSynchronisedInputBroker before copying the signals to the GAM.
+ * Only the tables of the state currently being executed (as given by the CurrentState signal) are converted.
+ * The MemoryMapSynchronisedInputBroker is only used if SetRawTicksTiming(true) was called (by the GAMSchedulerI) before the
+ * brokers are created. Otherwise the signals are read with the GAMDataSource brokers.
  */
 class DLL_API TimingDataSource: public GAMDataSource {
 public:
@@ -74,6 +113,81 @@ public:
      * @return true if GAMDataSource::Initialise returns true and if there are no producers assigned to this DataSourceI.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
+
+    /**
+     * @brief See GAMDataSource::GetBrokerName()
+     * @return MemoryMapSynchronisedInputBroker if direction is InputSignals and the raw ticks timing is enabled,
+     * otherwise see GAMDataSource::GetBrokerName().
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+
+    /**
+     * @brief If the raw ticks timing is enabled, adds a MemoryMapSynchronisedInputBroker so that Synchronise is called before
+     * the signals are read. Otherwise see GAMDataSource::GetInputBrokers.
+     * @param[out] inputBrokers where to add the broker.
+     * @param[in] functionName the name of the function.
+     * @param[in] gamMemPtr the GAM memory where the signals will be read.
+     * @return true if the broker can be successfully initialised.
+     */
+    virtual bool GetInputBrokers(ReferenceContainer &inputBrokers,
+                                 const char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Converts the raw tick counters of the current state (see AddRawTicksTable) into the timing signals.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief See DataSourceI::IsZeroCopySupported.
+     * @details The timing signals are written by the GAMSchedulerI and converted in Synchronise.
+     * @return false.
+     */
+    virtual bool IsZeroCopySupported();
+
+    /**
+     * @brief Registers a table of raw tick counters to be converted, when read, into timing signals.
+     * @param[in] table the table to register. The memory pointed by the table shall be valid until RemoveRawTicksTables is called.
+     * @return true if the CurrentState signal exists and the table could be added.
+     */
+    bool AddRawTicksTable(const TimingDataSourceRawTicksTable &table);
+
+    /**
+     * @brief Removes all the tables registered with AddRawTicksTable.
+     */
+    void RemoveRawTicksTables();
+
+    /**
+     * @brief Enables the conversion of the raw tick tables when the signals are read.
+     * @param[in] rawTicksTimingIn true if the GAMSchedulerI stores the timing signals as raw ticks.
+     * @pre
+     *   The brokers were not yet created.
+     */
+    void SetRawTicksTiming(const bool rawTicksTimingIn);
+
+    /**
+     * @brief Gets the number of tables registered with AddRawTicksTable.
+     * @return the number of registered tables.
+     */
+    uint32 GetNumberOfRawTicksTables() const;
+
+private:
+
+    /**
+     * The registered raw tick tables.
+     */
+    StaticList<TimingDataSourceRawTicksTable> rawTicksTables;
+
+    /**
+     * The address of the CurrentState signal.
+     */
+    uint32 *currentState;
+
+    /**
+     * True if the GAMSchedulerI stores the timing signals as raw ticks.
+     */
+    bool rawTicksTiming;
 };
 
 }
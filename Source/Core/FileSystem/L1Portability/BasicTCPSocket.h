@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "TimeoutType.h"
+#include "BasicFile.h"
 #include "BasicSocket.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -214,6 +215,22 @@ public:
     BasicTCPSocket *WaitConnection(const TimeoutType &timeout = TTInfiniteWait,
                                    BasicTCPSocket *client = static_cast<BasicTCPSocket *>(NULL));
 
+    /**
+     * @brief Sends \a size bytes of \a file, starting from its current position, to the connected peer.
+     * @details Where the operating system allows it (e.g. sendfile on Linux) the data is moved directly from the file
+     * to the socket, without ever being copied to a user space buffer. Otherwise the file is read and written through a small
+     * intermediate buffer.
+     * @param[in] file the file to be sent. It must be open for reading.
+     * @param[in] size the number of bytes to send.
+     * @return true if all the \a size bytes were sent.
+     * @pre
+     *   IsValid() && IsBlocking() && file.IsOpen()
+     * @post
+     *   The file position is advanced by the number of bytes which were sent.
+     */
+    bool SendFile(BasicFile &file,
+                  const uint64 size);
+
 };
 
 }
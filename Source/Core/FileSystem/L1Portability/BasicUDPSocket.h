@@ -90,6 +90,75 @@ public:
     virtual bool Write(const char8 *const input,
                        uint32 &size);
 
+    /**
+     * @brief Reads up to \a numberOfDatagrams datagrams with a single system call (when supported by the operating system).
+     * @details Blocks until at least one datagram is available and then reads, without blocking, all the
+     * datagrams that are already queued in the socket (up to \a numberOfDatagrams). Each datagram is
+     * written into its own buffer; datagrams larger than the buffer are truncated as in Read.
+     * The source (see GetSource) is set to the sender of the last datagram read; use the overload with the
+     * \a sources parameter to know the sender of each datagram.
+     * On Linux this is implemented with recvmmsg; on the other operating systems a single datagram is read per call.
+     * @param[in] buffers array of \a numberOfDatagrams buffers where to write the datagrams.
+     * @param[in,out] sizes array of \a numberOfDatagrams sizes. As input the size of each buffer, as output
+     * the number of bytes read into each buffer.
+     * @param[in,out] numberOfDatagrams as input the number of buffers, as output the number of datagrams read.
+     * @return true if at least one datagram was read.
+     */
+    bool ReadBatch(char8 * const * const buffers,
+                   uint32 * const sizes,
+                   uint32 &numberOfDatagrams);
+
+    /**
+     * @brief As ReadBatch but waiting at most \a timeout for the first datagram and optionally reporting,
+     * for each datagram, its sender and whether it was truncated.
+     * @details Truncation is only detected on Linux (MSG_TRUNC). If \a truncated is not provided and a datagram
+     * was truncated a warning is reported.
+     * @param[in] buffers see ReadBatch.
+     * @param[in,out] sizes see ReadBatch.
+     * @param[in,out] numberOfDatagrams see ReadBatch.
+     * @param[in] timeout the maximum time to wait for the first datagram (TTInfiniteWait to block as ReadBatch).
+     * @param[out] sources if not NULL, array of \a numberOfDatagrams hosts where the sender of each datagram read is written.
+     * @param[out] truncated if not NULL, array of \a numberOfDatagrams flags which are set to true for each datagram read
+     * that did not fit in its buffer.
+     * @return true if at least one datagram was read.
+     */
+    bool ReadBatch(char8 * const * const buffers,
+                   uint32 * const sizes,
+                   uint32 &numberOfDatagrams,
+                   const TimeoutType &timeout,
+                   InternetHost * const sources = NULL_PTR(InternetHost *),
+                   bool * const truncated = NULL_PTR(bool *));
+
+    /**
+     * @brief Writes \a numberOfDatagrams datagrams to the destination with a single system call (when supported by the operating system).
+     * @details On Linux this is implemented with sendmmsg; on the other operating systems Write is called for each datagram.
+     * @param[in] buffers array of \a numberOfDatagrams buffers, each holding one datagram.
+     * @param[in,out] sizes array of \a numberOfDatagrams sizes. As input the size of each datagram, as output
+     * the number of bytes written from each buffer.
+     * @param[in,out] numberOfDatagrams as input the number of datagrams to write, as output the number of datagrams written.
+     * @return true if at least one datagram was written.
+     */
+    bool WriteBatch(const char8 * const * const buffers,
+                    uint32 * const sizes,
+                    uint32 &numberOfDatagrams);
+
+    /**
+     * @brief Sets the size of the socket receive buffer (SO_RCVBUF).
+     * @details A larger buffer allows to absorb bursts of datagrams while the reader is not scheduled.
+     * The operating system may round or limit the value (e.g. net.core.rmem_max on Linux).
+     * @param[in] size the requested size in bytes.
+     * @return true if the operating system accepted the size.
+     */
+    bool SetReceiveBufferSize(const uint32 size) const;
+
+    /**
+     * @brief Sets the time that a blocking read may busy poll the network device before sleeping (SO_BUSY_POLL).
+     * @details Reduces the receive latency at the expense of CPU usage. Only supported on Linux.
+     * @param[in] microseconds the busy polling time. Zero disables busy polling.
+     * @return true if the operating system accepted the value.
+     */
+    bool SetBusyPoll(const uint32 microseconds) const;
+
     /**
      * @brief Opens an UDP socket.
      * @return true if the socket is successfully initialised.
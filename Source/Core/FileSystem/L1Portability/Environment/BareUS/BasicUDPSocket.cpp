@@ -178,6 +178,82 @@ bool BasicUDPSocket::Join(const char8 *const group) const {
     return ok;
 }
 
+bool BasicUDPSocket::ReadBatch(char8 * const * const buffers,
+                               uint32 * const sizes,
+                               uint32 &numberOfDatagrams) {
+    /* No batched reception available: read a single datagram per call. */
+    uint32 datagramsToRead = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    for (uint32 i = 1u; i < datagramsToRead; i++) {
+        sizes[i] = 0u;
+    }
+    if (datagramsToRead > 0u) {
+        if (BasicUDPSocket::Read(buffers[0], sizes[0])) {
+            numberOfDatagrams = 1u;
+        }
+    }
+    return (numberOfDatagrams > 0u);
+}
+
+bool BasicUDPSocket::ReadBatch(char8 * const * const buffers,
+                               uint32 * const sizes,
+                               uint32 &numberOfDatagrams,
+                               const TimeoutType &timeout,
+                               InternetHost * const sources,
+                               bool * const truncated) {
+    uint32 datagramsToRead = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    for (uint32 i = 1u; i < datagramsToRead; i++) {
+        sizes[i] = 0u;
+    }
+    if (datagramsToRead > 0u) {
+        if (BasicUDPSocket::Read(buffers[0], sizes[0], timeout)) {
+            numberOfDatagrams = 1u;
+            if (sources != NULL_PTR(InternetHost *)) {
+                sources[0] = GetSource();
+            }
+            /* The truncation of the datagram is not detected on this operating system. */
+            if (truncated != NULL_PTR(bool *)) {
+                truncated[0] = false;
+            }
+        }
+    }
+    return (numberOfDatagrams > 0u);
+}
+
+bool BasicUDPSocket::WriteBatch(const char8 * const * const buffers,
+                                uint32 * const sizes,
+                                uint32 &numberOfDatagrams) {
+    /* No batched transmission available: one Write per datagram. */
+    uint32 datagramsToWrite = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    bool ok = true;
+    for (uint32 i = 0u; i < datagramsToWrite; i++) {
+        if (ok) {
+            ok = BasicUDPSocket::Write(buffers[i], sizes[i]);
+            if (ok) {
+                numberOfDatagrams++;
+            }
+        }
+        if (!ok) {
+            sizes[i] = 0u;
+        }
+    }
+    return (numberOfDatagrams > 0u);
+}
+
+/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: not supported by the lwIP port. */
+bool BasicUDPSocket::SetReceiveBufferSize(const uint32 size) const {
+    REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "BasicUDPSocket::SetReceiveBufferSize() Not implemented");
+    return false;
+}
+
+/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: not supported by the lwIP port. */
+bool BasicUDPSocket::SetBusyPoll(const uint32 microseconds) const {
+    REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "BasicUDPSocket::SetBusyPoll() Not implemented");
+    return false;
+}
+
 bool BasicUDPSocket::Open() {
 #ifdef LWIP_ENABLED
     connectionSocket.UDPHandle = udp_new();
@@ -0,0 +1,78 @@
+/**
+ * @file BasicTCPSocketSendFile_Generic.cpp
+ * @brief Source file for the method BasicTCPSocket::SendFile
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the method BasicTCPSocket::SendFile for the
+ * environments which cannot transfer data directly from a file to a socket.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "BasicTCPSocket.h"
+#include "ErrorManagement.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+bool BasicTCPSocket::SendFile(BasicFile &file,
+                              const uint64 size) {
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    const uint32 bufferSize = 4096u;
+    char8 buffer[bufferSize];
+    uint64 sizeToSend = size;
+    while ((ok) && (sizeToSend > 0u)) {
+        uint32 readSize = bufferSize;
+        if (sizeToSend < static_cast<uint64>(bufferSize)) {
+            readSize = static_cast<uint32>(sizeToSend);
+        }
+        ok = file.Read(&buffer[0], readSize);
+        if (ok) {
+            ok = (readSize > 0u);
+        }
+        uint32 writtenSize = 0u;
+        while ((ok) && (writtenSize < readSize)) {
+            uint32 writeSize = (readSize - writtenSize);
+            ok = Write(&buffer[writtenSize], writeSize);
+            writtenSize += writeSize;
+        }
+        if (ok) {
+            sizeToSend -= static_cast<uint64>(readSize);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed to send the file");
+        }
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,91 @@
+/**
+ * @file EventPoller_Generic.cpp
+ * @brief Source file for class EventPoller
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the class EventPoller for the
+ * environments which do not provide a scalable event notification mechanism.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "EventPoller.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+EventPoller::EventPoller() {
+    pollHandle = -1;
+}
+
+EventPoller::~EventPoller() {
+}
+
+bool EventPoller::IsSupported() {
+    return false;
+}
+
+bool EventPoller::Open() {
+    REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "EventPoller is not supported.");
+    return false;
+}
+
+//Nothing can have been opened in this environment.
+bool EventPoller::Close() {
+    return false;
+}
+
+bool EventPoller::IsValid() const {
+    return false;
+}
+
+/*lint -e{715} the poller is not supported in this environment*/
+bool EventPoller::Add(const HandleI &handle,
+                      void * const context) {
+    return false;
+}
+
+/*lint -e{715} the poller is not supported in this environment*/
+bool EventPoller::Rearm(const HandleI &handle,
+                        void * const context) {
+    return false;
+}
+
+/*lint -e{715} the poller is not supported in this environment*/
+bool EventPoller::Remove(const HandleI &handle) {
+    return false;
+}
+
+/*lint -e{715} the poller is not supported in this environment*/
+void *EventPoller::Wait(const TimeoutType &timeout) {
+    return NULL_PTR(void *);
+}
+
+}
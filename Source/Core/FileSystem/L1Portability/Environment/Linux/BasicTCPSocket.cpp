@@ -31,6 +31,7 @@
 #include <netinet/in.h>
 #include <netdb.h>
 #include <sys/ioctl.h>
+#include <sys/sendfile.h>
 #include <unistd.h>
 #include <errno.h>
 /*---------------------------------------------------------------------------*/
@@ -527,5 +528,37 @@ bool BasicTCPSocket::CanSeek() const {
     return false;
 }
 
+bool BasicTCPSocket::SendFile(BasicFile &file,
+                              const uint64 size) {
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    uint64 sizeToSend = size;
+    while ((ok) && (sizeToSend > 0u)) {
+        //Linux transfers at most 0x7ffff000 bytes per call.
+        size_t chunkSize = 0x7ffff000u;
+        if (sizeToSend < static_cast<uint64>(chunkSize)) {
+            chunkSize = static_cast<size_t>(sizeToSend);
+        }
+        //NULL offset => the file position is used and updated by the kernel.
+        ssize_t sentBytes = sendfile(connectionSocket, file.GetReadHandle(), NULL_PTR(off_t *), chunkSize);
+        if (sentBytes > 0) {
+            sizeToSend -= static_cast<uint64>(sentBytes);
+        }
+        else if (sentBytes == 0) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: sendfile() reached the end of the file");
+            ok = false;
+        }
+        else {
+            ok = (sock_errno() == EINTR);
+            if (!ok) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed sendfile()");
+            }
+        }
+    }
+    return ok;
+}
+
 }
 
@@ -42,6 +42,14 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+/**
+ * Maximum number of datagrams transferred by each recvmmsg/sendmmsg call.
+ * Larger batches are split in chunks of this size (the message headers live in the stack).
+ */
+const MARTe::uint32 BATCH_CHUNK_SIZE = 64u;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -133,6 +141,197 @@ bool BasicUDPSocket::Write(const char8 * const input,
     return (ret > 0);
 }
 
+bool BasicUDPSocket::ReadBatch(char8 * const * const buffers,
+                               uint32 * const sizes,
+                               uint32 &numberOfDatagrams) {
+    return ReadBatch(buffers, sizes, numberOfDatagrams, TTInfiniteWait);
+}
+
+bool BasicUDPSocket::ReadBatch(char8 * const * const buffers,
+                               uint32 * const sizes,
+                               uint32 &numberOfDatagrams,
+                               const TimeoutType &timeout,
+                               InternetHost * const sources,
+                               bool * const truncated) {
+    uint32 datagramsToRead = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    else if (timeout.IsFinite()) {
+        struct timeval timeoutVal;
+        /*lint -e{9117} -e{9114} -e{9125}  [MISRA C++ Rule 5-0-3] [MISRA C++ Rule 5-0-4]. Justification: the time structure requires a signed integer. */
+        timeoutVal.tv_sec = static_cast<int32>(timeout.GetTimeoutUSec() / 1000000u);
+        /*lint -e{9117} -e{9114} -e{9125} [MISRA C++ Rule 5-0-3] [MISRA C++ Rule 5-0-4]. Justification: the time structure requires a signed integer. */
+        timeoutVal.tv_usec = static_cast<int32>((timeout.GetTimeoutUSec() % 1000000u));
+        int32 ret = setsockopt(connectionSocket, SOL_SOCKET, SO_RCVTIMEO, &timeoutVal, static_cast<socklen_t>(sizeof(timeoutVal)));
+
+        if (ret < 0) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting the read timeout");
+            ok = false;
+        }
+        else {
+            numberOfDatagrams = datagramsToRead;
+            ok = ReadBatch(buffers, sizes, numberOfDatagrams, TTInfiniteWait, sources, truncated);
+            datagramsToRead = 0u;
+        }
+        timeoutVal.tv_sec = 0;
+        timeoutVal.tv_usec = 0;
+        if (setsockopt(connectionSocket, SOL_SOCKET, SO_RCVTIMEO, &timeoutVal, static_cast<socklen_t>(sizeof(timeoutVal))) < 0) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() removing the read timeout");
+        }
+    }
+    else {
+        /*lint -e{9141} [MISRA C++ Rule 7-3-1]. Justification: the POSIX structures are used as declared by the operating system.*/
+        struct mmsghdr messages[BATCH_CHUNK_SIZE];
+        struct iovec vectors[BATCH_CHUNK_SIZE];
+        /* Each datagram needs its own address slot, otherwise recvmmsg overwrites the sender of the previous ones. */
+        InternetHostCore addresses[BATCH_CHUNK_SIZE];
+        uint32 numberOfTruncated = 0u;
+        /* Only the first chunk blocks; the remaining ones only collect what is already queued. */
+        int32 flags = MSG_WAITFORONE;
+        bool more = true;
+        while ((more) && (numberOfDatagrams < datagramsToRead)) {
+            uint32 chunkSize = (datagramsToRead - numberOfDatagrams);
+            if (chunkSize > BATCH_CHUNK_SIZE) {
+                chunkSize = BATCH_CHUNK_SIZE;
+            }
+            for (uint32 i = 0u; i < chunkSize; i++) {
+                uint32 n = numberOfDatagrams + i;
+                vectors[i].iov_base = buffers[n];
+                vectors[i].iov_len = static_cast<size_t>(sizes[n]);
+                messages[i].msg_hdr.msg_name = &addresses[i];
+                messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(sizeof(InternetHostCore));
+                messages[i].msg_hdr.msg_iov = &vectors[i];
+                messages[i].msg_hdr.msg_iovlen = 1u;
+                messages[i].msg_hdr.msg_control = NULL_PTR(void *);
+                messages[i].msg_hdr.msg_controllen = 0u;
+                messages[i].msg_hdr.msg_flags = 0;
+                messages[i].msg_len = 0u;
+            }
+            int32 ret = static_cast<int32>(recvmmsg(connectionSocket, &messages[0], chunkSize, flags, NULL_PTR(struct timespec *)));
+            if (ret > 0) {
+                /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+                uint32 received = static_cast<uint32>(ret);
+                for (uint32 i = 0u; i < received; i++) {
+                    uint32 n = numberOfDatagrams + i;
+                    sizes[n] = messages[i].msg_len;
+                    bool isTruncated = ((messages[i].msg_hdr.msg_flags & MSG_TRUNC) != 0);
+                    if (isTruncated) {
+                        numberOfTruncated++;
+                    }
+                    if (truncated != NULL_PTR(bool *)) {
+                        truncated[n] = isTruncated;
+                    }
+                    if (sources != NULL_PTR(InternetHost *)) {
+                        *(sources[n].GetInternetHost()) = addresses[i];
+                    }
+                }
+                *(source.GetInternetHost()) = addresses[received - 1u];
+                numberOfDatagrams += received;
+                more = (received == chunkSize);
+                flags = MSG_DONTWAIT;
+            }
+            else {
+                /* EAGAIN after the first chunk only means that the socket queue was drained. */
+                if (numberOfDatagrams == 0u) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed recvmmsg()");
+                }
+                more = false;
+            }
+        }
+        if ((numberOfTruncated > 0u) && (truncated == NULL_PTR(bool *))) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "BasicUDPSocket: Datagrams larger than the buffers were truncated");
+        }
+    }
+    for (uint32 i = numberOfDatagrams; i < datagramsToRead; i++) {
+        sizes[i] = 0u;
+    }
+    return ((ok) && (numberOfDatagrams > 0u));
+}
+
+bool BasicUDPSocket::WriteBatch(const char8 * const * const buffers,
+                                uint32 * const sizes,
+                                uint32 &numberOfDatagrams) {
+    uint32 datagramsToWrite = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    /*lint -e{9141} [MISRA C++ Rule 7-3-1]. Justification: the POSIX structures are used as declared by the operating system.*/
+    struct mmsghdr messages[BATCH_CHUNK_SIZE];
+    struct iovec vectors[BATCH_CHUNK_SIZE];
+    while ((ok) && (numberOfDatagrams < datagramsToWrite)) {
+        uint32 chunkSize = (datagramsToWrite - numberOfDatagrams);
+        if (chunkSize > BATCH_CHUNK_SIZE) {
+            chunkSize = BATCH_CHUNK_SIZE;
+        }
+        for (uint32 i = 0u; i < chunkSize; i++) {
+            uint32 n = numberOfDatagrams + i;
+            /*lint -e{1773} [MISRA C++ Rule 5-2-5]. Justification: the operating system API does not modify the buffer.*/
+            vectors[i].iov_base = const_cast<char8 *>(buffers[n]);
+            vectors[i].iov_len = static_cast<size_t>(sizes[n]);
+            messages[i].msg_hdr.msg_name = destination.GetInternetHost();
+            messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(destination.Size());
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1u;
+            messages[i].msg_hdr.msg_control = NULL_PTR(void *);
+            messages[i].msg_hdr.msg_controllen = 0u;
+            messages[i].msg_hdr.msg_flags = 0;
+            messages[i].msg_len = 0u;
+        }
+        int32 ret = static_cast<int32>(sendmmsg(connectionSocket, &messages[0], chunkSize, 0));
+        if (ret > 0) {
+            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+            uint32 sent = static_cast<uint32>(ret);
+            for (uint32 i = 0u; i < sent; i++) {
+                sizes[numberOfDatagrams + i] = messages[i].msg_len;
+            }
+            numberOfDatagrams += sent;
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed sendmmsg()");
+            ok = false;
+        }
+    }
+    for (uint32 i = numberOfDatagrams; i < datagramsToWrite; i++) {
+        sizes[i] = 0u;
+    }
+    return (numberOfDatagrams > 0u);
+}
+
+bool BasicUDPSocket::SetReceiveBufferSize(const uint32 size) const {
+    bool ok = IsValid();
+    if (ok) {
+        int32 value = static_cast<int32>(size);
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_RCVBUF, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting SO_RCVBUF");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicUDPSocket::SetBusyPoll(const uint32 microseconds) const {
+    bool ok = IsValid();
+    if (ok) {
+        int32 value = static_cast<int32>(microseconds);
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_BUSY_POLL, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting SO_BUSY_POLL");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    return ok;
+}
+
 bool BasicUDPSocket::Open() {
     /*lint -e{641} .Justification the socket type descriptor is an integer */
     connectionSocket = (socket(PF_INET, SOCK_DGRAM, 0));
@@ -0,0 +1,169 @@
+/**
+ * @file EventPoller.cpp
+ * @brief Source file for class EventPoller
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EventPoller (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <errno.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "EventPoller.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+/**
+ * @brief Registers or re-enables (\a operation = EPOLL_CTL_MOD) \a descriptor for one-shot read events.
+ */
+static bool EventPollerControl(const int32 pollHandle,
+                               const int32 operation,
+                               const int32 descriptor,
+                               void * const context) {
+    struct epoll_event event;
+    //EPOLLRDHUP so that a peer closing the connection is also served (the read will then fail).
+    event.events = static_cast<uint32>(EPOLLIN | EPOLLRDHUP | EPOLLONESHOT);
+    event.data.ptr = context;
+    return (epoll_ctl(pollHandle, operation, descriptor, &event) == 0);
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+EventPoller::EventPoller() {
+    pollHandle = -1;
+}
+
+/*lint -e{1551} the poller must be closed at destruction time.*/
+EventPoller::~EventPoller() {
+    if (IsValid()) {
+        (void) Close();
+    }
+}
+
+bool EventPoller::IsSupported() {
+    return true;
+}
+
+bool EventPoller::Open() {
+    bool ok = !IsValid();
+    if (ok) {
+        pollHandle = epoll_create1(EPOLL_CLOEXEC);
+        ok = IsValid();
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoller: Failed epoll_create1()");
+        }
+    }
+    return ok;
+}
+
+bool EventPoller::Close() {
+    bool ok = IsValid();
+    if (ok) {
+        ok = (close(pollHandle) == 0);
+        pollHandle = -1;
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoller: Failed close()");
+        }
+    }
+    return ok;
+}
+
+bool EventPoller::IsValid() const {
+    return (pollHandle >= 0);
+}
+
+bool EventPoller::Add(const HandleI &handle,
+                      void * const context) {
+    bool ok = IsValid();
+    if (ok) {
+        ok = EventPollerControl(pollHandle, EPOLL_CTL_ADD, handle.GetReadHandle(), context);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoller: Failed to add the handle");
+        }
+    }
+    return ok;
+}
+
+bool EventPoller::Rearm(const HandleI &handle,
+                        void * const context) {
+    bool ok = IsValid();
+    if (ok) {
+        ok = EventPollerControl(pollHandle, EPOLL_CTL_MOD, handle.GetReadHandle(), context);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoller: Failed to re-enable the handle");
+        }
+    }
+    return ok;
+}
+
+bool EventPoller::Remove(const HandleI &handle) {
+    bool ok = IsValid();
+    if (ok) {
+        //Kernels before 2.6.9 require a non-null event also for EPOLL_CTL_DEL.
+        struct epoll_event event;
+        event.events = 0u;
+        event.data.ptr = NULL_PTR(void *);
+        ok = (epoll_ctl(pollHandle, EPOLL_CTL_DEL, handle.GetReadHandle(), &event) == 0);
+    }
+    return ok;
+}
+
+void *EventPoller::Wait(const TimeoutType &timeout) {
+    void *context = NULL_PTR(void *);
+    if (IsValid()) {
+        int32 timeoutMSec = -1;
+        if (timeout.IsFinite()) {
+            timeoutMSec = static_cast<int32>(timeout.GetTimeoutMSec());
+        }
+        struct epoll_event event;
+        int32 ret = epoll_wait(pollHandle, &event, 1, timeoutMSec);
+        if (ret > 0) {
+            context = event.data.ptr;
+        }
+        else if (ret < 0) {
+            //Interrupted waits are reported as a timeout.
+            if (errno != EINTR) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoller: Failed epoll_wait()");
+            }
+        }
+        else {
+            //Timeout.
+        }
+    }
+    return context;
+}
+
+}
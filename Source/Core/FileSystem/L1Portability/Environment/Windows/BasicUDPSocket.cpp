@@ -131,6 +131,91 @@ bool BasicUDPSocket::Write(const char8* const input,
     return (ret > 0);
 }
 
+bool BasicUDPSocket::ReadBatch(char8 * const * const buffers,
+                               uint32 * const sizes,
+                               uint32 &numberOfDatagrams) {
+    /* No batched reception available: read a single datagram per call. */
+    uint32 datagramsToRead = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    for (uint32 i = 1u; i < datagramsToRead; i++) {
+        sizes[i] = 0u;
+    }
+    if (datagramsToRead > 0u) {
+        if (BasicUDPSocket::Read(buffers[0], sizes[0])) {
+            numberOfDatagrams = 1u;
+        }
+    }
+    return (numberOfDatagrams > 0u);
+}
+
+bool BasicUDPSocket::ReadBatch(char8 * const * const buffers,
+                               uint32 * const sizes,
+                               uint32 &numberOfDatagrams,
+                               const TimeoutType &timeout,
+                               InternetHost * const sources,
+                               bool * const truncated) {
+    uint32 datagramsToRead = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    for (uint32 i = 1u; i < datagramsToRead; i++) {
+        sizes[i] = 0u;
+    }
+    if (datagramsToRead > 0u) {
+        if (BasicUDPSocket::Read(buffers[0], sizes[0], timeout)) {
+            numberOfDatagrams = 1u;
+            if (sources != NULL_PTR(InternetHost *)) {
+                sources[0] = GetSource();
+            }
+            /* The truncation of the datagram is not detected on this operating system. */
+            if (truncated != NULL_PTR(bool *)) {
+                truncated[0] = false;
+            }
+        }
+    }
+    return (numberOfDatagrams > 0u);
+}
+
+bool BasicUDPSocket::WriteBatch(const char8 * const * const buffers,
+                                uint32 * const sizes,
+                                uint32 &numberOfDatagrams) {
+    /* No batched transmission available: one Write per datagram. */
+    uint32 datagramsToWrite = numberOfDatagrams;
+    numberOfDatagrams = 0u;
+    bool ok = true;
+    for (uint32 i = 0u; i < datagramsToWrite; i++) {
+        if (ok) {
+            ok = BasicUDPSocket::Write(buffers[i], sizes[i]);
+            if (ok) {
+                numberOfDatagrams++;
+            }
+        }
+        if (!ok) {
+            sizes[i] = 0u;
+        }
+    }
+    return (numberOfDatagrams > 0u);
+}
+
+bool BasicUDPSocket::SetReceiveBufferSize(const uint32 size) const {
+    bool ok = IsValid();
+    if (ok) {
+        int32 value = static_cast<int32>(size);
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char8 *>(&value), static_cast<int32>(sizeof(value))) == 0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting SO_RCVBUF");
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    return ok;
+}
+
+/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: busy polling is not supported by Winsock. */
+bool BasicUDPSocket::SetBusyPoll(const uint32 microseconds) const {
+    REPORT_ERROR(ErrorManagement::UnsupportedFeature, "BasicUDPSocket: SO_BUSY_POLL is not supported");
+    return false;
+}
+
 bool BasicUDPSocket::Open() {
     connectionSocket = (socket(PF_INET, SOCK_DGRAM, 0));
     if (connectionSocket != INVALID_SOCKET) {
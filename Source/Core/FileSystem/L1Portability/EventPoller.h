@@ -0,0 +1,155 @@
+/**
+ * @file EventPoller.h
+ * @brief Header file for class EventPoller
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class EventPoller
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EVENTPOLLER_H_
+#define EVENTPOLLER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "HandleI.h"
+#include "TimeoutType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Scalable wait for read events on a (possibly large) set of handles, shared by many threads.
+ * @details Contrary to Select, the set of monitored handles is kept by the operating system, so that the cost of a Wait
+ * does not depend on the number of handles being monitored, and the same EventPoller can be waited on by several threads at once.
+ *
+ * Each handle is registered together with a user context, which is what Wait returns when the handle becomes readable
+ * (including when the peer closes the connection). The events are delivered in one-shot mode: once Wait has returned the context
+ * of a handle, that handle is disabled (and thus not returned to any other thread) until it is explicitly re-enabled with Rearm.
+ * This allows a pool of threads to share the handles without any two threads ever serving the same handle concurrently.
+ *
+ * The poller requires operating system support (e.g. epoll on Linux). In environments where it is not supported Open fails
+ * and IsSupported returns false.
+ */
+class DLL_API EventPoller {
+
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   !IsValid()
+     */
+    EventPoller();
+
+    /**
+     * @brief Destructor. Closes the poller if it is still open.
+     */
+    virtual ~EventPoller();
+
+    /**
+     * @brief Checks if the poller is supported in this environment.
+     * @return true if Open can succeed in this environment.
+     */
+    static bool IsSupported();
+
+    /**
+     * @brief Creates the operating system resources.
+     * @return true if the poller could be created.
+     * @pre
+     *   !IsValid()
+     * @post
+     *   IsValid()
+     */
+    bool Open();
+
+    /**
+     * @brief Releases the operating system resources. All the handles are removed.
+     * @return true if the poller was open and could be closed.
+     */
+    bool Close();
+
+    /**
+     * @brief Checks if the poller is open.
+     * @return true if the poller is open.
+     */
+    bool IsValid() const;
+
+    /**
+     * @brief Starts monitoring \a handle for read events.
+     * @param[in] handle the handle to monitor.
+     * @param[in] context the value to be returned by Wait when \a handle is readable.
+     * @return true if the handle was added.
+     * @pre
+     *   IsValid() && handle was not already added.
+     */
+    bool Add(const HandleI &handle,
+             void * const context);
+
+    /**
+     * @brief Re-enables a handle which was disabled after having been returned by Wait.
+     * @param[in] handle the handle to re-enable.
+     * @param[in] context the value to be returned by Wait when \a handle is readable.
+     * @return true if the handle was re-enabled.
+     * @pre
+     *   IsValid() && handle was previously added.
+     */
+    bool Rearm(const HandleI &handle,
+               void * const context);
+
+    /**
+     * @brief Stops monitoring \a handle.
+     * @details Closing a handle also stops it from being monitored.
+     * @param[in] handle the handle to remove.
+     * @return true if the handle was removed.
+     */
+    bool Remove(const HandleI &handle);
+
+    /**
+     * @brief Waits for one of the monitored handles to become readable.
+     * @param[in] timeout the maximum time to wait.
+     * @return the context of the readable handle or NULL if the timeout expired (or in case of error).
+     * @post
+     *   The handle whose context is returned will not be returned again until it is re-enabled with Rearm.
+     */
+    void *Wait(const TimeoutType &timeout);
+
+private:
+
+    /**
+     * The operating system poller handle.
+     */
+    int32 pollHandle;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EVENTPOLLER_H_ */
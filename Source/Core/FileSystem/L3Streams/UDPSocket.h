@@ -44,6 +44,9 @@ namespace MARTe {
 
 /**
  * @brief Buffered implementation of the BasicUDPSocket.
+ * @details The batched datagram methods (BasicUDPSocket::ReadBatch and BasicUDPSocket::WriteBatch)
+ * are inherited unchanged and transfer the datagrams directly between the socket and the caller
+ * buffers, bypassing the stream buffers.
  */
 class UDPSocket: public BufferedStreamGenerator<DoubleBufferedStream, BasicUDPSocket>{
 
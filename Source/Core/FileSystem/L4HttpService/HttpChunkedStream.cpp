@@ -116,5 +116,15 @@ bool HttpChunkedStream::IsChunkMode() const {
     return chunkMode;
 }
 
+void HttpChunkedStream::Reset() {
+    chunkMode = false;
+    readBuffer.Empty();
+    writeBuffer.Empty();
+}
+
+bool HttpChunkedStream::HasPendingInput() const {
+    return (readBuffer.UsedAmountLeft() > 0u);
+}
+
 }
 
@@ -97,6 +97,19 @@ public:
      */
     bool IsChunkMode() const;
 
+    /**
+     * @brief Discards any data left in the read and in the write buffers and disables the chunk mode.
+     * @details Allows to reuse the stream (and its already allocated buffers) for a new connection.
+     */
+    void Reset();
+
+    /**
+     * @brief Checks if there is data that was already read from the socket but not yet consumed.
+     * @details Such data will not trigger any further read event on the socket.
+     * @return true if the read buffer holds data which was not consumed yet.
+     */
+    bool HasPendingInput() const;
+
 private:
 
     /**
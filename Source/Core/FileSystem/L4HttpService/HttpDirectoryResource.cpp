@@ -31,6 +31,7 @@
 #include "AdvancedErrorManagement.h"
 #include "Directory.h"
 #include "DirectoryScanner.h"
+#include "HttpChunkedStream.h"
 #include "HttpDirectoryResource.h"
 #include "HttpDefinition.h"
 #include "JsonPrinter.h"
@@ -39,6 +40,76 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Associates a file name extension to a MIME type.
+ */
+struct HttpDirectoryResourceMimeType {
+    /**
+     * The file name extension (including the dot).
+     */
+    const char8 *extension;
+    /**
+     * The MIME type.
+     */
+    const char8 *mimeType;
+};
+
+/**
+ * The MIME types of the known file name extensions.
+ */
+static const HttpDirectoryResourceMimeType httpDirectoryResourceMimeTypes[] = {
+        { ".html", "text/html" },
+        { ".htm", "text/html" },
+        { ".txt", "text/plain" },
+        { ".csv", "text/csv" },
+        { ".css", "text/css" },
+        { ".gif", "image/gif" },
+        { ".jpeg", "image/jpg" },
+        { ".jpg", "image/jpg" },
+        { ".png", "image/png" },
+        { ".svg", "image/svg+xml" },
+        { ".ico", "image/x-icon" },
+        { ".jnlp", "image/jnlp" },
+        { ".js", "application/x-javascript" },
+        { ".json", "application/json" } };
+
+/**
+ * The number of elements in httpDirectoryResourceMimeTypes.
+ */
+static const uint32 httpDirectoryResourceNumberOfMimeTypes = static_cast<uint32>(sizeof(httpDirectoryResourceMimeTypes)
+        / sizeof(HttpDirectoryResourceMimeType));
+
+/**
+ * @brief Computes the entity tag of the file \a d from its size and last write time.
+ */
+static bool HttpDirectoryResourceGetETag(Directory &d,
+                                         StreamString &etag) {
+    uint64 size = d.GetSize();
+    TimeStamp t = d.GetLastWriteTime();
+    return etag.Printf("\"%u-%u-%u-%u-%u-%u-%u\"", size, t.GetYear(), t.GetMonth(), t.GetDay(), t.GetHour(), t.GetMinutes(), t.GetSeconds());
+}
+
+/**
+ * @brief Checks if the If-None-Match header of the request (if any) matches \a etag.
+ */
+static bool HttpDirectoryResourceIsNotModified(HttpProtocol &protocol,
+                                               StreamString &etag) {
+    StreamString ifNoneMatch;
+    bool notModified = protocol.MoveAbsolute("InputOptions");
+    if (notModified) {
+        notModified = protocol.Read("If-None-Match", ifNoneMatch);
+    }
+    if (notModified) {
+        //The header may contain a list of tags
+        notModified = (ifNoneMatch == "*");
+        if (!notModified) {
+            notModified = (StringHelper::SearchString(ifNoneMatch.Buffer(), etag.Buffer()) != NULL_PTR(const char8 *));
+        }
+    }
+    return notModified;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -47,10 +118,23 @@ namespace MARTe {
 
 HttpDirectoryResource::HttpDirectoryResource() : Object(), HttpDataExportI() {
     replyNotFound = true;
+    cacheSize = 0u;
+    cacheMaxFileSize = 65536u;
+    cache = NULL_PTR(HttpDirectoryResourceCacheEntry *);
+    cacheCounter = 0u;
 }
 
+/*lint -e{1551} the cache must be freed at destruction time.*/
 HttpDirectoryResource::~HttpDirectoryResource() {
-
+    if (cache != NULL_PTR(HttpDirectoryResourceCacheEntry *)) {
+        uint32 i;
+        for (i = 0u; i < cacheSize; i++) {
+            if (cache[i].content != NULL_PTR(char8 *)) {
+                delete[] cache[i].content;
+            }
+        }
+        delete[] cache;
+    }
 }
 
 bool HttpDirectoryResource::Initialise(StructuredDataI &data) {
@@ -64,6 +148,25 @@ bool HttpDirectoryResource::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::FatalError, "The BaseDir directory shall be specified");
         }
     }
+    if (ok) {
+        if (!data.Read("CacheSize", cacheSize)) {
+            cacheSize = 0u;
+        }
+        if (!data.Read("CacheMaxFileSize", cacheMaxFileSize)) {
+            cacheMaxFileSize = 65536u;
+        }
+        if (cacheSize > 0u) {
+            cache = new HttpDirectoryResourceCacheEntry[cacheSize];
+            uint32 i;
+            for (i = 0u; i < cacheSize; i++) {
+                cache[i].content = NULL_PTR(char8 *);
+                cache[i].size = 0u;
+                cache[i].useCount = 0u;
+                cache[i].lastUsed = 0u;
+            }
+            REPORT_ERROR(ErrorManagement::Information, "Caching up to %u files with at most %u bytes", cacheSize, cacheMaxFileSize);
+        }
+    }
     return ok;
 }
 
@@ -148,7 +251,6 @@ bool HttpDirectoryResource::GetAsStructuredData(StreamStructuredDataI &data, Htt
     return ok;
 }
 
-/*lint -e{715} stream not required by this implementation*/
 bool HttpDirectoryResource::GetAsText(StreamI &stream, HttpProtocol &protocol) {
     StreamString path;
     if (!protocol.GetInputCommand("path", path)) {
@@ -158,7 +260,7 @@ bool HttpDirectoryResource::GetAsText(StreamI &stream, HttpProtocol &protocol) {
     fullPath += DIRECTORY_SEPARATOR;
     fullPath += path.Buffer();
     REPORT_ERROR(ErrorManagement::Debug, "Serving %s", fullPath.Buffer());
-    bool ok = ServeFile(fullPath, protocol);
+    bool ok = ServeFile(stream, fullPath, protocol);
     return ok;
 }
 
@@ -174,40 +276,35 @@ bool HttpDirectoryResource::CheckExtension(StreamString &fname, const char8 * co
     return ok;
 }
 
-bool HttpDirectoryResource::ServeFile(StreamString &fname, HttpProtocol &protocol) const {
-    File f;
-    bool ok = f.Open(fname.Buffer(), MARTe::BasicFile::ACCESS_MODE_R);
-    StreamString mime = "binary";
+const char8 *HttpDirectoryResource::GetMimeType(StreamString &fname) const {
+    const char8 *mime = "binary";
+    uint32 i;
+    bool found = false;
+    for (i = 0u; (i < httpDirectoryResourceNumberOfMimeTypes) && (!found); i++) {
+        found = CheckExtension(fname, httpDirectoryResourceMimeTypes[i].extension);
+        if (found) {
+            mime = httpDirectoryResourceMimeTypes[i].mimeType;
+        }
+    }
+    return mime;
+}
 
-    /*lint -e{9007} no side effects on CheckExtension function call*/
+bool HttpDirectoryResource::ServeFile(StreamI &stream, StreamString &fname, HttpProtocol &protocol) {
+    Directory d(fname.Buffer());
+    File f;
+    bool ok = d.IsFile();
     if (ok) {
-        if (CheckExtension(fname, ".html") || CheckExtension(fname, ".htm")) {
-            mime = "text/html";
-        }
-        else if (CheckExtension(fname, ".txt")) {
-            mime = "text/plain";
-        }
-        else if (CheckExtension(fname, ".csv")) {
-            mime = "text/csv";
-        }
-        else if (CheckExtension(fname, ".css")) {
-            mime = "text/css";
-        }
-        else if (CheckExtension(fname, ".gif")) {
-            mime = "image/gif";
-        }
-        else if (CheckExtension(fname, ".jpeg") || CheckExtension(fname, ".jpg")) {
-            mime = "image/jpg";
-        }
-        else if (CheckExtension(fname, ".jnlp")) {
-            mime = "image/jnlp";
-        }
-        else if (CheckExtension(fname, ".js")) {
-            mime = "application/x-javascript";
-        }
-        else {
-            mime = "binary";
-        }
+        ok = f.Open(fname.Buffer(), MARTe::BasicFile::ACCESS_MODE_R);
+    }
+    uint64 size = 0u;
+    StreamString etag;
+    if (ok) {
+        size = d.GetSize();
+        ok = HttpDirectoryResourceGetETag(d, etag);
+    }
+    bool notModified = false;
+    if (ok) {
+        notModified = HttpDirectoryResourceIsNotModified(protocol, etag);
         ok = protocol.MoveAbsolute("OutputOptions");
     }
     else {
@@ -216,11 +313,17 @@ bool HttpDirectoryResource::ServeFile(StreamString &fname, HttpProtocol &protoco
         }
     }
     if (ok) {
-        ok = protocol.Write("Content-Type", mime.Buffer());
+        ok = protocol.Write("Content-Type", GetMimeType(fname));
+    }
+    if (ok) {
+        ok = protocol.Write("ETag", etag.Buffer());
     }
     if (ok) {
+        if (notModified) {
+            ok = protocol.WriteHeader(true, HttpDefinition::HSHCReplyNotModified, NULL_PTR(BufferedStreamI *), NULL_PTR(const char8*));
+        }
         //With the HEAD just inform that the file exists
-        if (protocol.GetHttpCommand() == HttpDefinition::HSHCHead) {
+        else if (protocol.GetHttpCommand() == HttpDefinition::HSHCHead) {
             StreamString s;
             ok = s.SetSize(0LLU);
             if (ok) {
@@ -228,36 +331,162 @@ bool HttpDirectoryResource::ServeFile(StreamString &fname, HttpProtocol &protoco
             }
         }
         else {
-            ok = protocol.WriteHeader(true, HttpDefinition::HSHCReplyOK, &f, NULL_PTR(const char8*));
+            bool served = false;
+            if ((cacheSize > 0u) && (size <= static_cast<uint64>(cacheMaxFileSize))) {
+                ok = ServeCachedFile(stream, fname, etag, static_cast<uint32>(size), protocol, served);
+            }
+            if ((ok) && (!served)) {
+                ok = SendFile(stream, f, size, protocol);
+            }
         }
     }
-    /*if (ok) {
-     ok = f.Size()Seek(0LLU);
-     }
-     const uint32 bufReadSize = 128000u;
-     char8 *buf = NULL_PTR(char8 *);
-     if (ok) {
-     buf = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(bufReadSize));
-     uint32 bufSize = 128000u;
-     while ((f.Read(buf, bufSize)) && (ok)) {
-     ok = stream.Write(buf, bufSize);
-     bufSize = bufReadSize;
-     }
-     }
-     if (ok) {
-     if (buf != NULL_PTR(char8 *)) {
-     GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(buf));
-     }
-     }
-     if (ok) {
-     ok = f.Close();
-     }*/
-    if (ok) {
-        ok = f.Close();
+    if (f.IsOpen()) {
+        if (!f.Close()) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+bool HttpDirectoryResource::ServeCachedFile(StreamI &stream, StreamString &fname, StreamString &etag, const uint32 size, HttpProtocol &protocol,
+                                            bool &served) {
+    bool ok = true;
+    uint32 idx = AcquireCacheEntry(fname, etag, size);
+    served = (idx < cacheSize);
+    if (served) {
+        ok = protocol.MoveAbsolute("OutputOptions");
+        if (ok) {
+            ok = protocol.Write("Content-Length", size);
+        }
+        if (ok) {
+            ok = protocol.WriteHeader(false, HttpDefinition::HSHCReplyOK, NULL_PTR(BufferedStreamI *), NULL_PTR(const char8*));
+        }
+        uint32 writtenSize = 0u;
+        while ((ok) && (writtenSize < size)) {
+            uint32 writeSize = (size - writtenSize);
+            ok = stream.Write(&cache[idx].content[writtenSize], writeSize);
+            writtenSize += writeSize;
+        }
+        ReleaseCacheEntry(idx);
+    }
+    return ok;
+}
+
+bool HttpDirectoryResource::SendFile(StreamI &stream, File &f, const uint64 size, HttpProtocol &protocol) const {
+    bool ok = true;
+    //The file can only be written directly to the socket if the reply is not being encoded in chunks.
+    HttpChunkedStream *sstream = dynamic_cast<HttpChunkedStream *>(&stream);
+    bool useSendFile = (sstream != NULL_PTR(HttpChunkedStream *));
+    if (useSendFile) {
+        useSendFile = ((!sstream->IsChunkMode()) && (sstream->IsBlocking()));
+    }
+    if (useSendFile) {
+        ok = protocol.MoveAbsolute("OutputOptions");
+        if (ok) {
+            ok = protocol.Write("Content-Length", size);
+        }
+        if (ok) {
+            ok = protocol.WriteHeader(false, HttpDefinition::HSHCReplyOK, NULL_PTR(BufferedStreamI *), NULL_PTR(const char8*));
+        }
+        //The header must reach the socket before the file contents.
+        if (ok) {
+            ok = sstream->Flush();
+        }
+        if (ok) {
+            ok = sstream->SendFile(f, size);
+        }
+    }
+    else {
+        ok = protocol.WriteHeader(true, HttpDefinition::HSHCReplyOK, &f, NULL_PTR(const char8*));
     }
     return ok;
 }
 
+uint32 HttpDirectoryResource::AcquireCacheEntry(StreamString &fname, StreamString &etag, const uint32 size) {
+    uint32 idx = cacheSize;
+    uint32 victim = cacheSize;
+    uint32 i;
+    (void) cacheMux.FastLock();
+    cacheCounter++;
+    for (i = 0u; (i < cacheSize) && (idx == cacheSize); i++) {
+        bool found = (cache[i].path == fname.Buffer());
+        if (found) {
+            found = (cache[i].etag == etag.Buffer());
+        }
+        if (found) {
+            idx = i;
+        }
+        else if (cache[i].useCount == 0u) {
+            if (victim == cacheSize) {
+                victim = i;
+            }
+            else if (cache[i].lastUsed < cache[victim].lastUsed) {
+                victim = i;
+            }
+            else {
+                //The current victim was used less recently.
+            }
+        }
+        else {
+            //Being used (or loaded) by another thread.
+        }
+    }
+    bool load = ((idx == cacheSize) && (victim < cacheSize));
+    if (load) {
+        idx = victim;
+        //No other thread will match nor replace this entry while it is being loaded.
+        cache[idx].path = "";
+        cache[idx].etag = "";
+    }
+    if (idx < cacheSize) {
+        cache[idx].useCount++;
+        cache[idx].lastUsed = cacheCounter;
+    }
+    cacheMux.FastUnLock();
+    if (load) {
+        if (cache[idx].content != NULL_PTR(char8 *)) {
+            delete[] cache[idx].content;
+        }
+        cache[idx].content = new char8[size];
+        cache[idx].size = 0u;
+        File f;
+        bool ok = f.Open(fname.Buffer(), MARTe::BasicFile::ACCESS_MODE_R);
+        uint32 readSize = size;
+        if ((ok) && (size > 0u)) {
+            ok = f.Read(cache[idx].content, readSize);
+        }
+        if (ok) {
+            ok = (readSize == size);
+        }
+        if (f.IsOpen()) {
+            (void) f.Close();
+        }
+        (void) cacheMux.FastLock();
+        if (ok) {
+            cache[idx].path = fname.Buffer();
+            cache[idx].etag = etag.Buffer();
+            cache[idx].size = size;
+        }
+        else {
+            cache[idx].useCount = 0u;
+        }
+        cacheMux.FastUnLock();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not cache %s", fname.Buffer());
+            idx = cacheSize;
+        }
+    }
+    return idx;
+}
+
+void HttpDirectoryResource::ReleaseCacheEntry(const uint32 idx) {
+    (void) cacheMux.FastLock();
+    if (cache[idx].useCount > 0u) {
+        cache[idx].useCount--;
+    }
+    cacheMux.FastUnLock();
+}
+
 void HttpDirectoryResource::SetReplyNotFound(const bool replyNotFoundIn) {
     replyNotFound = replyNotFoundIn;
 }
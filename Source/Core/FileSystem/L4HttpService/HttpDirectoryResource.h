@@ -31,6 +31,8 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "Directory.h"
+#include "NonRealTimeMutexSem.h"
 #include "HttpDataExportI.h"
 #include "File.h"
 #include "Object.h"
@@ -39,6 +41,41 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief An entry of the HttpDirectoryResource cache of frequently requested files.
+ */
+struct HttpDirectoryResourceCacheEntry {
+    /**
+     * The full path of the cached file. Empty if the entry is not in use.
+     */
+    StreamString path;
+
+    /**
+     * The entity tag of the file when it was cached.
+     */
+    StreamString etag;
+
+    /**
+     * The file contents.
+     */
+    char8 *content;
+
+    /**
+     * The number of bytes in content.
+     */
+    uint32 size;
+
+    /**
+     * Number of replies currently being written from this entry. Entries in use are never replaced.
+     */
+    uint32 useCount;
+
+    /**
+     * Value of the cache access counter when the entry was last used (used to replace the least recently used entry).
+     */
+    uint64 lastUsed;
+};
+
 /**
  * @brief HTTP browsing of files and directories.
  *
@@ -47,8 +84,19 @@ namespace MARTe {
  * +HttpDirectoryResource1 = {
  *     Class = HttpDirectoryResource
  *     BaseDir = "/" //Compulsory. The base directory w.r.t. to which all the paths are evaluated.
+ *     CacheSize = 16 //Optional (default = 0, i.e. no cache). Number of (small) files to be kept in memory.
+ *     CacheMaxFileSize = 65536 //Optional (default = 65536). Only files with at most this number of bytes are kept in memory.
  * }
  * </pre>
+ *
+ * Every file is replied with an ETag (computed from the file size and last write time). If the client request
+ * has an If-None-Match header which matches this tag, the file is not sent and the reply is 304 (Not Modified).
+ *
+ * When the reply is not chunked and the client is connected through a blocking socket, the file contents are
+ * sent with BasicTCPSocket::SendFile (i.e. without being copied through user space where supported).
+ *
+ * If CacheSize > 0, the contents of the most recently requested files, which are not larger than CacheMaxFileSize,
+ * are kept in memory and written directly from there. Cached contents are only used while the file ETag does not change.
  */
 class HttpDirectoryResource: public Object, public HttpDataExportI {
 public:
@@ -60,12 +108,12 @@ public:
 HttpDirectoryResource    ();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Frees the cache.
      */
     virtual ~HttpDirectoryResource();
 
     /**
-     * @brief Calls Object::Initialise and reads the BaseDir parameters (see class description) .
+     * @brief Calls Object::Initialise and reads the BaseDir, CacheSize and CacheMaxFileSize parameters (see class description) .
      * @return true if the parameters are correctly specified.
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -101,13 +149,60 @@ private:
      */
     bool CheckExtension(StreamString &fname, const char8 * const ext) const;
 
+    /**
+     * @brief Helper function which returns the MIME type associated to the extension of a file.
+     * @param[in] fname the name of the file.
+     * @return the MIME type of the file.
+     */
+    const char8 *GetMimeType(StreamString &fname) const;
+
     /**
      * @brief Helper function which streams the filename over the provided stream.
+     * @param[out] stream where the file is written to.
      * @param[in] fname the name of the file to stream.
      * @param[out] protocol to write the Content-type.
      * @return true if the file can be successfully streamed.
      */
-    bool ServeFile(StreamString &fname, HttpProtocol &protocol) const;
+    bool ServeFile(StreamI &stream, StreamString &fname, HttpProtocol &protocol);
+
+    /**
+     * @brief Helper function which writes a file kept in the cache.
+     * @param[out] stream where the file is written to.
+     * @param[in] fname the name of the file to stream.
+     * @param[in] etag the current entity tag of the file.
+     * @param[in] size the current size of the file.
+     * @param[out] protocol to write the header.
+     * @param[out] served true if the file was written from the cache. If false the file was not in the cache
+     * and could not be added to it (e.g. because all the entries are being used).
+     * @return true if no error occurred.
+     */
+    bool ServeCachedFile(StreamI &stream, StreamString &fname, StreamString &etag, const uint32 size, HttpProtocol &protocol, bool &served);
+
+    /**
+     * @brief Helper function which writes the file with Content-Length \a size, using BasicTCPSocket::SendFile if the stream allows it.
+     * @param[out] stream where the file is written to.
+     * @param[in] f the file to stream.
+     * @param[in] size the current size of the file.
+     * @param[out] protocol to write the header.
+     * @return true if the file can be successfully streamed.
+     */
+    bool SendFile(StreamI &stream, File &f, const uint64 size, HttpProtocol &protocol) const;
+
+    /**
+     * @brief Returns the index of the cache entry of \a fname and marks it as being used.
+     * @details If the file is not cached, its contents are loaded in the least recently used entry.
+     * @param[in] fname the name of the file.
+     * @param[in] etag the current entity tag of the file.
+     * @param[in] size the current size of the file.
+     * @return the index of the cache entry or cacheSize if the file could not be cached.
+     */
+    uint32 AcquireCacheEntry(StreamString &fname, StreamString &etag, const uint32 size);
+
+    /**
+     * @brief Marks the cache entry with index \a idx as no longer being used.
+     * @param[in] idx the index returned by AcquireCacheEntry.
+     */
+    void ReleaseCacheEntry(const uint32 idx);
 
     /**
      * The base directory w.r.t. which all the paths are evaluated.
@@ -118,6 +213,31 @@ private:
      * True if ReplyNotFound should be set when a file is not found.
      */
     bool replyNotFound;
+
+    /**
+     * The number of cache entries.
+     */
+    uint32 cacheSize;
+
+    /**
+     * The maximum size of a file that can be cached.
+     */
+    uint32 cacheMaxFileSize;
+
+    /**
+     * The cache entries.
+     */
+    HttpDirectoryResourceCacheEntry *cache;
+
+    /**
+     * Incremented at every cache access.
+     */
+    uint64 cacheCounter;
+
+    /**
+     * Protects the cache entries.
+     */
+    NonRealTimeMutexSem cacheMux;
 };
 }
 
@@ -55,6 +55,12 @@ HttpService::HttpService() :
     listenMaxConnections = 0;
     textMode = 1u;
     chunkSize = 0u;
+    eventLoop = false;
+    numberOfWorkers = 0u;
+    maxNumberOfConnections = 0u;
+    connections = NULL_PTR(HttpChunkedStream *);
+    freeConnections = NULL_PTR(uint32 *);
+    numberOfFreeConnections = 0u;
     filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -70,11 +76,57 @@ HttpService::~HttpService() {
         REPORT_ERROR(ErrorManagement::Warning, "Could not Stop. Going to kill the service");
         (void) Stop();
     }
+    if (connections != NULL_PTR(HttpChunkedStream *)) {
+        //The threads are stopped. Close the connections that were still open.
+        for (uint32 i = 0u; i < maxNumberOfConnections; i++) {
+            if (connections[i].IsValid()) {
+                (void) connections[i].Close();
+            }
+        }
+        delete[] connections;
+    }
+    if (freeConnections != NULL_PTR(uint32 *)) {
+        delete[] freeConnections;
+    }
+    if (poller.IsValid()) {
+        (void) poller.Close();
+    }
 }
 
 bool HttpService::Initialise(StructuredDataI &data) {
-    //Cannot have more than one thread listening for the request.
-    bool ret = data.Write("MinNumberOfThreads", 1);
+    uint8 eventLoopTemp;
+    if (!data.Read("EventLoop", eventLoopTemp)) {
+        eventLoopTemp = 0u;
+    }
+    eventLoop = (eventLoopTemp > 0u);
+    if (eventLoop) {
+        if (!EventPoller::IsSupported()) {
+            eventLoop = false;
+            REPORT_ERROR(ErrorManagement::Warning, "EventLoop is not supported in this environment: using one thread per connection");
+        }
+    }
+    bool ret = true;
+    if (eventLoop) {
+        if (!data.Read("NumberOfWorkers", numberOfWorkers)) {
+            numberOfWorkers = 2u;
+            REPORT_ERROR(ErrorManagement::Information, "NumberOfWorkers not specified: using default %d", numberOfWorkers);
+        }
+        ret = (numberOfWorkers > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfWorkers must be > 0");
+        }
+        //All the workers wait on the poller. The thread pool never grows (see AddThread).
+        if (ret) {
+            ret = data.Write("MinNumberOfThreads", numberOfWorkers);
+        }
+        if (ret) {
+            ret = data.Write("MaxNumberOfThreads", static_cast<uint16>(numberOfWorkers + 1u));
+        }
+    }
+    else {
+        //Cannot have more than one thread listening for the request.
+        ret = data.Write("MinNumberOfThreads", 1);
+    }
     if (ret) {
         ret = MultiClientService::Initialise(data);
     }
@@ -102,6 +154,18 @@ bool HttpService::Initialise(StructuredDataI &data) {
             chunkSize = 32u;
             REPORT_ERROR(ErrorManagement::Information, "ChunkSize not specified: using default %d", chunkSize);
         }
+        if (eventLoop) {
+            if (!data.Read("MaxNumberOfConnections", maxNumberOfConnections)) {
+                maxNumberOfConnections = 64u;
+                REPORT_ERROR(ErrorManagement::Information, "MaxNumberOfConnections not specified: using default %d", maxNumberOfConnections);
+            }
+            ret = (maxNumberOfConnections > 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MaxNumberOfConnections must be > 0");
+            }
+        }
+    }
+    if (ret) {
         Reference ref = this->Find("WebRoot");
         if (ref.IsValid()) {
             webRoot = ref;
@@ -135,12 +199,71 @@ ErrorManagement::ErrorType HttpService::Start() {
 
         if (err.ErrorsCleared()) {
             err = !(server.Listen(port, listenMaxConnections));
-
+        }
+    }
+    if (err.ErrorsCleared()) {
+        if (eventLoop) {
+            if (connections == NULL_PTR(HttpChunkedStream *)) {
+                connections = new HttpChunkedStream[maxNumberOfConnections];
+                freeConnections = new uint32[maxNumberOfConnections];
+                numberOfFreeConnections = maxNumberOfConnections;
+                for (uint32 i = 0u; i < maxNumberOfConnections; i++) {
+                    connections[i].SetCalibWriteParam(0u);
+                    if (!connections[i].SetBufferSize(32u, chunkSize)) {
+                        err = ErrorManagement::FatalError;
+                    }
+                    //Take the connections from the beginning of the pool first.
+                    freeConnections[i] = (maxNumberOfConnections - 1u) - i;
+                }
+                if (!err.ErrorsCleared()) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Failed to allocate the connection buffers");
+                }
+            }
+            if (err.ErrorsCleared()) {
+                if (!poller.IsValid()) {
+                    err = !(poller.Open());
+                }
+            }
             if (err.ErrorsCleared()) {
-                err = MultiClientService::Start();
+                //The listening socket is identified by its own address.
+                err = !(poller.Add(server, &server));
             }
         }
     }
+    if (err.ErrorsCleared()) {
+        err = MultiClientService::Start();
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType HttpService::Stop() {
+    ErrorManagement::ErrorType err = MultiClientService::Stop();
+    if (err.ErrorsCleared()) {
+        if (eventLoop) {
+            if (server.IsValid()) {
+                (void) poller.Remove(server);
+            }
+            if (connections != NULL_PTR(HttpChunkedStream *)) {
+                //The threads are stopped. Give back to the pool the connections that were still open.
+                for (uint32 i = 0u; i < maxNumberOfConnections; i++) {
+                    if (connections[i].IsValid()) {
+                        ReleaseConnection(&connections[i]);
+                    }
+                }
+            }
+        }
+        if (server.IsValid()) {
+            err = !(server.Close());
+        }
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType HttpService::AddThread() {
+    ErrorManagement::ErrorType err;
+    if (!eventLoop) {
+        err = MultiClientService::AddThread();
+    }
     return err;
 }
 
@@ -157,47 +280,9 @@ ErrorManagement::ErrorType HttpService::ClientService(HttpChunkedStream * const
     }
     //give the possibility to stop the thread
     if (err.ErrorsCleared()) {
-        uint8 requestedTextMode = textMode;
         HttpProtocol hprotocol(*commClient);
         if (sel.WaitUntil(1000u) > 0) {
-            //you want plain text or data
-            if (!hprotocol.ReadHeader()) {
-                err = ErrorManagement::CommunicationError;
-                REPORT_ERROR(ErrorManagement::CommunicationError, "Error while reading HTTP header");
-            }
-            bool pagePrepared = false;
-
-            if (err.ErrorsCleared()) {
-                if (hprotocol.TextMode() >= 0) {
-                    requestedTextMode = static_cast<uint8>(hprotocol.TextMode());
-                }
-            }
-            if (err.ErrorsCleared()) {
-                if (!hprotocol.MoveAbsolute("OutputOptions")) {
-                    err = !(hprotocol.CreateAbsolute("OutputOptions"));
-                }
-                if (requestedTextMode > 0u) {
-                    pagePrepared = webRoot->GetAsText(*commClient, hprotocol);
-                }
-                else {
-                    StreamStructuredData<JsonPrinter> sdata;
-                    sdata.SetStream(*commClient);
-                    pagePrepared = webRoot->GetAsStructuredData(sdata, hprotocol);
-                }
-                if (err.ErrorsCleared()) {
-                    err = !(commClient->Flush());
-                }
-                if (err.ErrorsCleared()) {
-                    if (commClient->IsChunkMode()) {
-                        err = !(commClient->FinalChunk());
-                    }
-                }
-            }
-            if (err.ErrorsCleared()) {
-                if (!pagePrepared) {
-                    //TODO??
-                }
-            }
+            err = ServeRequest(*commClient, hprotocol);
         }
         if (err.ErrorsCleared()) {
             if (!hprotocol.KeepAlive()) {
@@ -222,6 +307,155 @@ ErrorManagement::ErrorType HttpService::ClientService(HttpChunkedStream * const
 
 }
 
+ErrorManagement::ErrorType HttpService::ServeRequest(HttpChunkedStream &commClient,
+                                                     HttpProtocol &hprotocol) const {
+    ErrorManagement::ErrorType err;
+    uint8 requestedTextMode = textMode;
+    //you want plain text or data
+    if (!hprotocol.ReadHeader()) {
+        err = ErrorManagement::CommunicationError;
+        REPORT_ERROR(ErrorManagement::CommunicationError, "Error while reading HTTP header");
+    }
+    bool pagePrepared = false;
+
+    if (err.ErrorsCleared()) {
+        if (hprotocol.TextMode() >= 0) {
+            requestedTextMode = static_cast<uint8>(hprotocol.TextMode());
+        }
+    }
+    if (err.ErrorsCleared()) {
+        if (!hprotocol.MoveAbsolute("OutputOptions")) {
+            err = !(hprotocol.CreateAbsolute("OutputOptions"));
+        }
+        if (requestedTextMode > 0u) {
+            pagePrepared = webRoot->GetAsText(commClient, hprotocol);
+        }
+        else {
+            StreamStructuredData<JsonPrinter> sdata;
+            sdata.SetStream(commClient);
+            pagePrepared = webRoot->GetAsStructuredData(sdata, hprotocol);
+        }
+        if (err.ErrorsCleared()) {
+            err = !(commClient.Flush());
+        }
+        if (err.ErrorsCleared()) {
+            if (commClient.IsChunkMode()) {
+                err = !(commClient.FinalChunk());
+            }
+        }
+    }
+    if (err.ErrorsCleared()) {
+        if (!pagePrepared) {
+            //TODO??
+        }
+    }
+    return err;
+}
+
+void HttpService::RejectClient(HttpChunkedStream &commClient) const {
+    HttpProtocol hprotocol(commClient);
+    StreamString s;
+    (void) s.SetSize(0LLU);
+    if (!hprotocol.WriteHeader(false, HttpDefinition::HSHCReplyTooManyRequests, &s, NULL_PTR(const char8*))) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Too many connections");
+    }
+    REPORT_ERROR(ErrorManagement::Warning, "Too many connections");
+    (void) commClient.Close();
+}
+
+HttpChunkedStream *HttpService::GetFreeConnection() {
+    HttpChunkedStream *commClient = NULL_PTR(HttpChunkedStream *);
+    if (connectionsMux.FastLock() == ErrorManagement::NoError) {
+        if (numberOfFreeConnections > 0u) {
+            numberOfFreeConnections--;
+            commClient = &connections[freeConnections[numberOfFreeConnections]];
+        }
+    }
+    connectionsMux.FastUnLock();
+    if (commClient != NULL_PTR(HttpChunkedStream *)) {
+        commClient->Reset();
+    }
+    return commClient;
+}
+
+void HttpService::ReleaseConnection(HttpChunkedStream * const commClient) {
+    //Must be removed before closing, as afterwards the handle is no longer known.
+    (void) poller.Remove(*commClient);
+    (void) commClient->Close();
+    /*lint -e{946} -e{947} the connection belongs to the connections array.*/
+    uint32 idx = static_cast<uint32>(commClient - connections);
+    if (connectionsMux.FastLock() == ErrorManagement::NoError) {
+        freeConnections[numberOfFreeConnections] = idx;
+        numberOfFreeConnections++;
+    }
+    connectionsMux.FastUnLock();
+}
+
+ErrorManagement::ErrorType HttpService::WaitEvent(ExecutionInfo &information) {
+    ErrorManagement::ErrorType err = ErrorManagement::Timeout;
+    void *context = poller.Wait(acceptTimeout);
+    if (context == &server) {
+        //The poller does not return the server again until it is re-armed: only this thread is accepting.
+        HttpChunkedStream *newClient = GetFreeConnection();
+        if (newClient != NULL_PTR(HttpChunkedStream *)) {
+            if (server.WaitConnection(acceptTimeout, newClient) == NULL) {
+                ReleaseConnection(newClient);
+            }
+            else {
+                bool ok = newClient->SetBlocking(true);
+                if (ok) {
+                    ok = poller.Add(*newClient, newClient);
+                }
+                if (!ok) {
+                    ReleaseConnection(newClient);
+                }
+            }
+        }
+        else {
+            HttpChunkedStream rejectedClient;
+            if (server.WaitConnection(acceptTimeout, &rejectedClient) != NULL) {
+                RejectClient(rejectedClient);
+            }
+        }
+        if (!poller.Rearm(server, &server)) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to wait for new connections");
+        }
+    }
+    else if (context != NULL) {
+        information.SetThreadSpecificContext(context);
+        err = ErrorManagement::NoError;
+    }
+    else {
+        //Timeout. Allows the thread to be stopped.
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType HttpService::ServiceEvent(ExecutionInfo &information) {
+    HttpChunkedStream *commClient = reinterpret_cast<HttpChunkedStream *>(information.GetThreadSpecificContext());
+    bool keepAlive = false;
+    ErrorManagement::ErrorType err;
+    {
+        HttpProtocol hprotocol(*commClient);
+        commClient->SetChunkMode(false);
+        err = ServeRequest(*commClient, hprotocol);
+        keepAlive = hprotocol.KeepAlive();
+    }
+    bool release = ((!err.ErrorsCleared()) || (!keepAlive));
+    if (!release) {
+        //Requests which were already read into the buffer would not wake the poller: keep serving them.
+        if (!commClient->HasPendingInput()) {
+            release = !(poller.Rearm(*commClient, commClient));
+            err = ErrorManagement::Completed;
+        }
+    }
+    if (release) {
+        ReleaseConnection(commClient);
+        err = ErrorManagement::Completed;
+    }
+    return err;
+}
+
 ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &information) {
     ErrorManagement::ErrorType err;
     if (information.GetStage() == MARTe::ExecutionInfo::StartupStage) {
@@ -229,7 +463,15 @@ ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &inform
     if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
 
         /*lint -e{593} -e{429} the newClient pointer will be freed within the thread*/
-        if (information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) {
+        if (eventLoop) {
+            if (information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) {
+                err = WaitEvent(information);
+            }
+            if (information.GetStageSpecific() == MARTe::ExecutionInfo::ServiceRequestStageSpecific) {
+                err = ServiceEvent(information);
+            }
+        }
+        else if (information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) {
             /*lint -e{429} the newClient pointer will be freed within the thread*/
             HttpChunkedStream *newClient = new HttpChunkedStream();
             newClient->SetChunkMode(false);
@@ -243,14 +485,7 @@ ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &inform
                 else {
                     if (GetNumberOfActiveThreads() == GetMaximumNumberOfPoolThreads()) {
                         err = MARTe::ErrorManagement::Timeout;
-                        HttpProtocol hprotocol(*newClient);
-                        StreamString s;
-                        (void) s.SetSize(0LLU);
-                        if (!hprotocol.WriteHeader(false, HttpDefinition::HSHCReplyTooManyRequests, &s, NULL_PTR(const char8*))) {
-                            REPORT_ERROR(ErrorManagement::FatalError, "Too many connections");
-                        }
-                        REPORT_ERROR(ErrorManagement::Warning, "Too many connections");
-                        (void) newClient->Close();
+                        RejectClient(*newClient);
                         delete newClient;
                     }
                     else {
@@ -260,7 +495,7 @@ ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &inform
                 }
             }
         }
-        if (information.GetStageSpecific() == MARTe::ExecutionInfo::ServiceRequestStageSpecific) {
+        else if (information.GetStageSpecific() == MARTe::ExecutionInfo::ServiceRequestStageSpecific) {
             HttpChunkedStream *newClient = reinterpret_cast<HttpChunkedStream *>(information.GetThreadSpecificContext());
             err = ClientService(newClient);
         }
@@ -281,6 +516,14 @@ ReferenceT<HttpDataExportI> HttpService::GetWebRoot() const {
     return webRoot;
 }
 
+bool HttpService::IsEventLoop() const {
+    return eventLoop;
+}
+
+uint32 HttpService::GetMaxNumberOfConnections() const {
+    return maxNumberOfConnections;
+}
+
 CLASS_REGISTER(HttpService, "1.0")
 CLASS_METHOD_REGISTER(HttpService, Start)
 }
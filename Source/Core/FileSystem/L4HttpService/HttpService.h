@@ -32,9 +32,11 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "EmbeddedServiceMethodBinderT.h"
-#include "FastPollingMutexSem.h"
+#include "EventPoller.h"
+#include "NonRealTimeMutexSem.h"
 #include "HttpChunkedStream.h"
 #include "HttpDataExportI.h"
+#include "HttpProtocol.h"
 #include "MessageI.h"
 #include "MultiClientService.h"
 #include "ReferenceT.h"
@@ -58,6 +60,16 @@ namespace MARTe{
  *   -The current thread with the new created socket calls the ClientService function to
  *    manage the client HTTP requests.\n
  *   - Once the client closes the connection (or in case of error) the thread terminates.\n
+ *
+ * @details If EventLoop = 1 the HttpService does not dedicate a thread to each connection. Instead, a fixed set
+ * of NumberOfWorkers threads waits (see EventPoller) on the principal socket and on all the keep-alive connections at once:\n
+ *   - When a new client connects, one of the threads accepts the connection on a stream taken from a pool of
+ *     MaxNumberOfConnections preallocated streams (so that no memory is allocated per connection) and adds it to the poller.\n
+ *   - When a request arrives on any of the connections, one of the threads serves that single request and gives the
+ *     connection back to the poller, so that an idle keep-alive connection does not hold any thread.\n
+ *   - When the client closes the connection (or in case of error) the stream is returned to the pool.\n
+ * If the pool is exhausted, new clients are replied with HttpDefinition::HSHCReplyTooManyRequests.
+ * In environments where the EventPoller is not supported, the HttpService falls back to one thread per connection.
  * @details The client can send a specific HTTP command called TextMode to express that it wants to receive data
  * in text mode (TextMode=1) or in database mode (TextMode=0). If TextMode=1, the HttpService will call the
  * DataExportI::GetAsText of the object found at the path received from the client, or DatExportI::GetAsStructuredData if
@@ -80,6 +92,9 @@ namespace MARTe{
  *     WebRoot = ARoot //Compulsory. Path in the ObjectConfigurationDatabase of the object that acts as the root for the service. This object shall inherit from HttpDataExportI.
  *     IsTextMode = 1 //Optional (default = 1). If the GET option TextMode is not set, the reply is either sent as text/html (IsTextMode = 1) or as text/json (IsTextMode = 0). With the former GetAsText is called on the web root object, while with the latter GetAsStructuredData is called instead.
  *     ChunkSize = 32 //Optional (default = 32). The maximum size of the chunks in which the reply bode is divided to perform the chunked transfer encoding mode.
+ *     EventLoop = 0 //Optional (default = 0). If 1, the connections are served by a fixed set of threads (see above). MaxNumberOfThreads and MinNumberOfThreads are then ignored.
+ *     NumberOfWorkers = 2 //Optional (default = 2). Only used if EventLoop = 1. The number of threads serving all the connections.
+ *     MaxNumberOfConnections = 64 //Optional (default = 64). Only used if EventLoop = 1. The maximum number of simultaneous client connections.
  * }
  * </pre>
  */
@@ -110,6 +125,9 @@ public:
      *   IsTextMode: The default data sending mode. A client can change this mode by sending the HTTP command called TextMode=[0(false), 1(true)].
      *     Default=1 (text mode).
      *   ChunkSize: the maximum size of the chunks in which the reply bode is divided to perform the chunked transfer encoding mode. Default = 32
+     *   EventLoop: if 1 all the connections are multiplexed on a fixed set of threads. Default = 0.
+     *   NumberOfWorkers: the number of threads of the event loop (must be > 0). Default = 2.
+     *   MaxNumberOfConnections: the number of preallocated connections of the event loop (must be > 0). Default = 64.
      * @return true if all the parameters are set and valid.
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -118,9 +136,24 @@ public:
      * @see MultiClientService::Start
      * @details Before starting the thread, it finds the root object specified in the \a WebRoot configuration parameter.
      * If the path is wrong, ErrorManagement::FatalError is returned.
+     * In event loop mode it also allocates the pool of connections and registers the principal socket in the EventPoller.
      */
     virtual ErrorManagement::ErrorType Start();
 
+    /**
+     * @see MultiClientService::Stop
+     * @details After the threads are stopped the principal socket is closed, so that the service can be started again.
+     * In event loop mode the connections that are still open are closed and given back to the pool.
+     */
+    virtual ErrorManagement::ErrorType Stop();
+
+    /**
+     * @see MultiClientService::AddThread
+     * @details In event loop mode the number of threads is fixed (NumberOfWorkers) and no thread is added.
+     * @return ErrorManagement::NoError in event loop mode, MultiClientService::AddThread() otherwise.
+     */
+    virtual ErrorManagement::ErrorType AddThread();
+
 
     /**
      * @brief The server task that has to be performed by one thread at once.
@@ -157,7 +190,64 @@ public:
      */
     ReferenceT<HttpDataExportI> GetWebRoot() const;
 
+    /**
+     * @brief Checks if the connections are multiplexed on a fixed set of threads.
+     * @return true if EventLoop = 1 and the EventPoller is supported.
+     */
+    bool IsEventLoop() const;
+
+    /**
+     * @brief Gets the maximum number of simultaneous connections in event loop mode.
+     * @return the maximum number of simultaneous connections in event loop mode.
+     */
+    uint32 GetMaxNumberOfConnections() const;
+
 private:
+    /**
+     * @brief Reads one HTTP request from \a commClient and writes the reply.
+     * @param[in] commClient is the socket to communicate with the client.
+     * @param[in] hprotocol the protocol associated to \a commClient.
+     * @return ErrorManagement::NoError if the request was successfully replied.
+     */
+    ErrorManagement::ErrorType ServeRequest(HttpChunkedStream &commClient,
+                                            HttpProtocol &hprotocol) const;
+
+    /**
+     * @brief Replies HttpDefinition::HSHCReplyTooManyRequests to \a commClient and closes it.
+     * @param[in] commClient is the socket to communicate with the client.
+     */
+    void RejectClient(HttpChunkedStream &commClient) const;
+
+    /**
+     * @brief WaitRequestStageSpecific of the event loop mode.
+     * @details Waits for an event on any of the connections. New connections are accepted and added to the poller.
+     * @param[in] information specifies the thread status managed in MultiClientEmbeddedThread::ThreadLoop.
+     * @return ErrorManagement::NoError if a request is ready to be served on the connection set in the \a information
+     * thread specific context, ErrorManagement::Timeout otherwise.
+     */
+    ErrorManagement::ErrorType WaitEvent(ExecutionInfo &information);
+
+    /**
+     * @brief ServiceRequestStageSpecific of the event loop mode.
+     * @details Serves the request and gives the connection back to the poller (keep-alive) or to the pool.
+     * @param[in] information specifies the thread status managed in MultiClientEmbeddedThread::ThreadLoop.
+     * @return ErrorManagement::Completed once the connection has been given back, ErrorManagement::NoError if more requests
+     * were already received on the same connection.
+     */
+    ErrorManagement::ErrorType ServiceEvent(ExecutionInfo &information);
+
+    /**
+     * @brief Takes a connection from the pool.
+     * @return a reset connection or NULL if the pool is exhausted.
+     */
+    HttpChunkedStream *GetFreeConnection();
+
+    /**
+     * @brief Closes \a commClient and gives it back to the pool.
+     * @param[in] commClient the connection to give back.
+     */
+    void ReleaseConnection(HttpChunkedStream * const commClient);
+
     /**
      * The server socket
      */
@@ -209,6 +299,46 @@ private:
      * Filter to receive the RPC
      */
     ReferenceT<RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * True if the connections are multiplexed on a fixed set of threads.
+     */
+    bool eventLoop;
+
+    /**
+     * The number of threads of the event loop.
+     */
+    uint16 numberOfWorkers;
+
+    /**
+     * The number of preallocated connections of the event loop.
+     */
+    uint32 maxNumberOfConnections;
+
+    /**
+     * Waits on the principal socket and on all the connections of the event loop.
+     */
+    EventPoller poller;
+
+    /**
+     * The pool of preallocated connections of the event loop.
+     */
+    HttpChunkedStream *connections;
+
+    /**
+     * The indexes of the connections which are not in use.
+     */
+    uint32 *freeConnections;
+
+    /**
+     * The number of elements in freeConnections.
+     */
+    uint32 numberOfFreeConnections;
+
+    /**
+     * Protects the freeConnections.
+     */
+    NonRealTimeMutexSem connectionsMux;
 };
 
 }
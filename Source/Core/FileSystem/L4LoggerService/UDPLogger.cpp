@@ -57,6 +57,29 @@ void UDPLogger::ConsumeLogMessage(LoggerPage * const logPage) {
     (void) udpSocket.Write(logMsg.Buffer(), msgSize);
 }
 
+void UDPLogger::ConsumeLogMessages(LoggerPage * const * const logPages,
+                                   const uint32 numberOfPages) {
+    uint32 n = 0u;
+    while (n < numberOfPages) {
+        StreamString logMsgs[MAX_LOG_PAGES_PER_BATCH];
+        const char8 *buffers[MAX_LOG_PAGES_PER_BATCH];
+        uint32 sizes[MAX_LOG_PAGES_PER_BATCH];
+        uint32 numberOfDatagrams = 0u;
+        while ((n < numberOfPages) && (numberOfDatagrams < MAX_LOG_PAGES_PER_BATCH)) {
+            if (logPages[n] != NULL_PTR(LoggerPage *)) {
+                PrintToStream(logPages[n], logMsgs[numberOfDatagrams]);
+                buffers[numberOfDatagrams] = logMsgs[numberOfDatagrams].Buffer();
+                sizes[numberOfDatagrams] = static_cast<uint32>(logMsgs[numberOfDatagrams].Size());
+                numberOfDatagrams++;
+            }
+            n++;
+        }
+        if (numberOfDatagrams > 0u) {
+            (void) udpSocket.WriteBatch(&buffers[0], &sizes[0], numberOfDatagrams);
+        }
+    }
+}
+
 bool UDPLogger::Initialise(StructuredDataI &data) {
     bool ok = LoggerConsumerI::LoadPrintPreferences(data);
     StreamString address;
@@ -72,6 +72,14 @@ public:
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage);
 
+    /**
+     * @brief Sends each logPage in its own datagram, with a single batched write (see BasicUDPSocket::WriteBatch).
+     * @param[in] logPages the log messages to be sent.
+     * @param[in] numberOfPages the number of elements in \a logPages.
+     */
+    virtual void ConsumeLogMessages(LoggerPage * const * const logPages,
+                                    const uint32 numberOfPages);
+
     /**
      * @brief Calls Object::Initialise and reads the Format parameter (see class description) .
      * @param[in] data see Object::Initialise.
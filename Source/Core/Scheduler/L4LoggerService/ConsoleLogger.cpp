@@ -68,6 +68,22 @@ void ConsoleLogger::ConsumeLogMessage(LoggerPage * const logPage) {
     }
 }
 
+void ConsoleLogger::ConsumeLogMessages(LoggerPage * const * const logPages,
+                                       const uint32 numberOfPages) {
+    StreamString err;
+    uint32 i;
+    for (i = 0u; i < numberOfPages; i++) {
+        if (logPages[i] != NULL_PTR(LoggerPage *)) {
+            PrintToStream(logPages[i], err);
+            err += "\n";
+        }
+    }
+    uint32 size32 = static_cast<uint32>(err.Size());
+    if (size32 > 0u) {
+        (void) console.Write(err.Buffer(), size32);
+    }
+}
+
 CLASS_REGISTER(ConsoleLogger, "1.0")
 }
 
@@ -68,6 +68,14 @@ ConsoleLogger    ();
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage);
 
+    /**
+     * @brief Prints all the logPages in the console output with a single write.
+     * @param[in] logPages the log messages to be printed.
+     * @param[in] numberOfPages the number of elements in \a logPages.
+     */
+    virtual void ConsumeLogMessages(LoggerPage * const * const logPages,
+                                    const uint32 numberOfPages);
+
     /**
      * @brief Calls Object::Initialise and reads the Format parameter (see class description) .
      * @param[in] data see Object::Initialise.
@@ -51,6 +51,14 @@ LoggerConsumerI::~LoggerConsumerI() {
 
 }
 
+void LoggerConsumerI::ConsumeLogMessages(LoggerPage * const * const logPages,
+                                         const uint32 numberOfPages) {
+    uint32 i;
+    for (i = 0u; i < numberOfPages; i++) {
+        ConsumeLogMessage(logPages[i]);
+    }
+}
+
 void LoggerConsumerI::PrintToStream(LoggerPage * const logPage, BufferedStreamI &err) const {
     StreamString errorCodeStr;
     ErrorManagement::ErrorInformation errorInfo = logPage->errorInfo;
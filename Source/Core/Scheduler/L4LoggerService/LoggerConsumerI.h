@@ -40,6 +40,11 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief The maximum number of log pages that are handed in one call to LoggerConsumerI::ConsumeLogMessages.
+ */
+static const uint32 MAX_LOG_PAGES_PER_BATCH = 32u;
+
 /**
  * @brief Classes that inherit from this interface (and are inserted into a LoggerService instance)
  *  will have the function ConsumeLogMessage called every time a log message is received.
@@ -62,6 +67,16 @@ public:
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage) = 0;
 
+    /**
+     * @brief This function is called with all the log messages that are pending, in batches of at most MAX_LOG_PAGES_PER_BATCH.
+     * @details The default implementation calls ConsumeLogMessage for each page. Consumers that can coalesce the output
+     * (e.g. into a single write or system call) should override it.
+     * @param[in] logPages the logging messages to be consumed, in the order they were received.
+     * @param[in] numberOfPages the number of elements in \a logPages.
+     */
+    virtual void ConsumeLogMessages(LoggerPage * const * const logPages,
+                                    const uint32 numberOfPages);
+
 protected:
     /**
      * @brief Helper function which prints the log message into a stream.
@@ -35,6 +35,21 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * The maximum time that the thread waits for new messages when WakeOnLog = 1. Allows to react to the Stop requests.
+ */
+static const uint32 LOGGER_SERVICE_WAKE_ON_LOG_TIMEOUT_MSEC = 100u;
+
+/**
+ * @brief The Logger wake up function. Posts the EventSem of the LoggerService.
+ * @param[in] parameter the EventSem to post.
+ */
+static void LoggerServiceWakeUp(void * const parameter) {
+    EventSem *eventSem = static_cast<EventSem *>(parameter);
+    (void) eventSem->Post();
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -46,6 +61,7 @@ LoggerService::LoggerService() :
     consumers = NULL_PTR(LoggerConsumerI **);
     logger = NULL_PTR(Logger *);
     nOfConsumers = 0u;
+    wakeOnLog = false;
 }
 
 /*lint -e{1551} -e{1740} the destructor must guarantee that the SingleThreadService. The logger is a singleton and is freed by the Logger class at the end of program execution*/
@@ -55,6 +71,11 @@ LoggerService::~LoggerService() {
             REPORT_ERROR(ErrorManagement::Warning, "Could not Stop the logThreadService");
         }
     }
+    if ((wakeOnLog) && (logger != NULL_PTR(Logger *))) {
+        //Returns only when no thread is posting the logEventSem
+        logger->SetWakeUpFunction(NULL_PTR(LoggerWakeUpFunctionType), NULL_PTR(void *));
+        (void) logEventSem.Close();
+    }
     if (consumers != NULL_PTR(LoggerConsumerI **)) {
         delete[] consumers;
     }
@@ -65,6 +86,8 @@ bool LoggerService::Initialise(StructuredDataI &data) {
     uint32 cpuMask = 0x1u;
     uint32 stackSize = THREADS_DEFAULT_STACKSIZE;
     uint32 numberOfLogPages = DEFAULT_NUMBER_OF_LOG_PAGES;
+    uint32 deferredFormatting = 0u;
+    uint32 wakeOnLogParameter = 0u;
     if (ok) {
         ok = data.Read("CPUs", cpuMask);
         if (!ok) {
@@ -85,6 +108,20 @@ bool LoggerService::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::Warning, "NumberOfLogPages must be > 0");
         }
     }
+    if (ok) {
+        (void) data.Read("DeferredFormatting", deferredFormatting);
+        (void) data.Read("WakeOnLog", wakeOnLogParameter);
+        wakeOnLog = (wakeOnLogParameter == 1u);
+    }
+    if ((ok) && (wakeOnLog)) {
+        ok = logEventSem.Create();
+        if (ok) {
+            ok = logEventSem.Reset();
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not create the EventSem");
+        }
+    }
     if (ok) {
         nOfConsumers = Size();
         ok = (nOfConsumers > 0u);
@@ -109,6 +146,10 @@ bool LoggerService::Initialise(StructuredDataI &data) {
     }
     if (ok) {
         logger = Logger::Instance(numberOfLogPages);
+        logger->SetDeferredFormatting(deferredFormatting == 1u);
+        if (wakeOnLog) {
+            logger->SetWakeUpFunction(&LoggerServiceWakeUp, &logEventSem);
+        }
         logThreadService.SetStackSize(stackSize);
         logThreadService.SetCPUMask(cpuMask);
         logThreadService.SetName(GetName());
@@ -132,26 +173,53 @@ ErrorManagement::ErrorType LoggerService::Execute(ExecutionInfo & info) {
             //If terminating wait a couple of seconds for the log to flush before...
             Sleep::Sec(1.0F);
         }
-        uint32 i;
         if (consumers != NULL_PTR(LoggerConsumerI **)) {
+            LoggerPage *batch[MAX_LOG_PAGES_PER_BATCH];
+            uint32 n = 0u;
             LoggerPage *page = logger->GetLogEntry();
             while (page != NULL_PTR(LoggerPage *)) {
-                for (i = 0u; (i < nOfConsumers); i++) {
-                    consumers[i]->ConsumeLogMessage(page);
+                batch[n] = page;
+                n++;
+                if (n == MAX_LOG_PAGES_PER_BATCH) {
+                    ConsumeBatch(&batch[0], n);
+                    n = 0u;
                 }
-                logger->ReturnPage(page);
                 page = logger->GetLogEntry();
             }
+            if (n > 0u) {
+                ConsumeBatch(&batch[0], n);
+            }
         }
         if (terminate) {
             //.. and after
             Sleep::Sec(1.0F);
         }
     }
-    Sleep::Sec(1e-3F);
+    if ((wakeOnLog) && (logger != NULL_PTR(Logger *))) {
+        //Reset before announcing the wait so that a Post from AddLogEntry cannot be lost
+        (void) logEventSem.Reset();
+        if (logger->PrepareWait()) {
+            (void) logEventSem.Wait(LOGGER_SERVICE_WAKE_ON_LOG_TIMEOUT_MSEC);
+            logger->CancelWait();
+        }
+    }
+    else {
+        Sleep::Sec(1e-3F);
+    }
     return ErrorManagement::NoError;
 }
 
+void LoggerService::ConsumeBatch(LoggerPage * const * const logPages,
+                                 const uint32 numberOfPages) {
+    uint32 i;
+    for (i = 0u; (i < nOfConsumers); i++) {
+        consumers[i]->ConsumeLogMessages(logPages, numberOfPages);
+    }
+    for (i = 0u; (i < numberOfPages); i++) {
+        logger->ReturnPage(logPages[i]);
+    }
+}
+
 uint32 LoggerService::GetNumberOfLogPages() const {
     uint32 n = 0u;
     if (logger != NULL_PTR(Logger *)) {
@@ -168,6 +236,18 @@ uint32 LoggerService::GetStackSize() const {
     return logThreadService.GetStackSize();
 }
 
+bool LoggerService::IsDeferredFormatting() const {
+    bool deferred = false;
+    if (logger != NULL_PTR(Logger *)) {
+        deferred = logger->IsDeferredFormatting();
+    }
+    return deferred;
+}
+
+bool LoggerService::IsWakeOnLog() const {
+    return wakeOnLog;
+}
+
 CLASS_REGISTER(LoggerService, "1.0")
 
 }
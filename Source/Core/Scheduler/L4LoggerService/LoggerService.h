@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
 #include "Logger.h"
 #include "LoggerConsumerI.h"
 #include "ReferenceContainer.h"
@@ -53,6 +54,8 @@ namespace MARTe {
  *     CPUs = 0x1 //Compulsory. The CPU mask where the asynchronous thread will run.
  *     StackSize = 32768 //Optional. The stack size of the asynchronous thread.
  *     NumberOfLogPages = 128 //Optional. The number of log pages.
+ *     DeferredFormatting = 0 //Optional. If 1 the messages with parameters are formatted by this service thread and not by the thread that reports them (see Logger::SetDeferredFormatting).
+ *     WakeOnLog = 0 //Optional. If 1 the service thread sleeps until a new message is logged (see Logger::PrepareWait). Otherwise the Logger is polled every millisecond.
  *     +LoggerConsumer1 = {
  *         Class = ALoggerConsumer
  *         ...
@@ -63,6 +66,9 @@ namespace MARTe {
  *     }
  * }
  * </pre>
+ *
+ * The pending messages are handed to the consumers in batches (see LoggerConsumerI::ConsumeLogMessages).
+ * Only one LoggerService instance shall set WakeOnLog = 1.
  */
 class LoggerService: public ReferenceContainer, public EmbeddedServiceMethodBinderI {
 public:
@@ -78,7 +84,7 @@ LoggerService    ();
     virtual ~LoggerService();
 
     /**
-     * @brief Calls ReferenceContainer::Initialise and reads the CPUs and StackSize parameters info.
+     * @brief Calls ReferenceContainer::Initialise and reads the CPUs, StackSize, NumberOfLogPages, DeferredFormatting and WakeOnLog parameters info.
      * @param[in] data see ReferenceContainer::Initialise.
      * @return true if CPUs is specified and at least one valid ConsumerI is registered. If one of the child elements does not implement
      *  the LoggerConsumerI interface it will return false.
@@ -87,8 +93,9 @@ LoggerService    ();
 
     /**
      * @brief Callback function for the EmbeddedThread that polls data from the Logger.
-     * @details Polls data from the Logger and if a new log message is available calls ConsumeLogMessage on all
-     *  the registered consumers.
+     * @details Takes all the pending log messages from the Logger and calls ConsumeLogMessages on all
+     *  the registered consumers, in batches of at most MAX_LOG_PAGES_PER_BATCH messages. Then waits for new
+     *  messages (WakeOnLog = 1) or sleeps for one millisecond.
      * @param[in] info see EmbeddedServiceMethodBinderI
      * @return ErrorManagement::NoError.
      */
@@ -117,8 +124,32 @@ LoggerService    ();
      *   Initialise()
      */
     uint32 GetStackSize() const;
+
+    /**
+     * @brief Checks if the messages with parameters are being formatted by this service thread.
+     * @return true if the deferred formatting is enabled.
+     * @pre
+     *   Initialise()
+     */
+    bool IsDeferredFormatting() const;
+
+    /**
+     * @brief Checks if the service thread is woken up by the new messages (as opposed to polling the Logger).
+     * @return true if WakeOnLog = 1.
+     * @pre
+     *   Initialise()
+     */
+    bool IsWakeOnLog() const;
 private:
 
+    /**
+     * @brief Hands a batch of pages to all the consumers and returns the pages to the Logger.
+     * @param[in] logPages the pages to consume.
+     * @param[in] numberOfPages the number of elements in \a logPages.
+     */
+    void ConsumeBatch(LoggerPage * const * const logPages,
+                      const uint32 numberOfPages);
+
     /**
      * The thread that will Poll for new messages.
      */
@@ -138,6 +169,16 @@ private:
      * Number of consumers.
      */
     uint32 nOfConsumers;
+
+    /**
+     * True if the thread waits for new messages instead of polling.
+     */
+    bool wakeOnLog;
+
+    /**
+     * Posted by the Logger when a message is added while the thread is waiting.
+     */
+    EventSem logEventSem;
 };
 }
 
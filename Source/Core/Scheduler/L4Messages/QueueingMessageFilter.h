@@ -32,8 +32,9 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
-#include "MessageFilter.h"
 #include "EventSem.h"
+#include "NonRealTimeMutexSem.h"
+#include "MessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -83,7 +84,7 @@ private:
     /**
      * Locks the adding/removing of messages to the queue
      */
-    FastPollingMutexSem mutexSemQ;
+    NonRealTimeMutexSem mutexSemQ;
 
     /**
      * Wakes threads waiting on the queue
@@ -37,6 +37,12 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Maximum time that Synchronise blocks in the EventSem before checking the stop flag again.
+ */
+static const uint32 CIRCULAR_BUFFER_EVENT_WAKE_UP_TIMEOUT_MSEC = 100u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -77,6 +83,10 @@ CircularBufferThreadInputDataSource::CircularBufferThreadInputDataSource() :
     getFirst = false;
     stop = 0;
     sleepTime = 0.F;
+    lockFree = false;
+    eventWakeUp = false;
+    waitingForData = 0;
+    (void) dataArrivedSem.Create();
 
 }
 
@@ -236,6 +246,18 @@ bool CircularBufferThreadInputDataSource::Initialise(StructuredDataI &data) {
         }
         getFirst = (getFirstTemp > 0u);
     }
+    if (ret) {
+        uint8 lockFreeTemp = 0u;
+        if (!data.Read("LockFree", lockFreeTemp)) {
+            lockFreeTemp = 0u;
+        }
+        lockFree = (lockFreeTemp > 0u);
+        uint8 eventWakeUpTemp = 0u;
+        if (!data.Read("EventWakeUp", eventWakeUpTemp)) {
+            eventWakeUpTemp = 0u;
+        }
+        eventWakeUp = (eventWakeUpTemp > 0u);
+    }
 
     REPORT_ERROR(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "CircularBufferThreadInputDataSource::Initialise returning %s",
                  ret ? "true" : "false");
@@ -257,13 +279,10 @@ void CircularBufferThreadInputDataSource::PrepareInputOffsets() {
                 if (lastReadBufTemp >= numberOfBuffers) {
                     lastReadBufTemp = 0u;
                 }
-                (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
                 uint32 index = (lastReadBufTemp * numberOfSignals) + i;
-                if (isRefreshed[index] == 0u) {
-                    mutex.FastUnLock();
+                if (!IsRefreshed(index)) {
                     break;
                 }
-                mutex.FastUnLock();
                 lastReadBuffer[i] = lastReadBufTemp;
                 nStepsForward++;
             }
@@ -287,13 +306,10 @@ bool CircularBufferThreadInputDataSource::Synchronise() {
             if (lastReadBufTemp >= numberOfBuffers) {
                 lastReadBufTemp = 0u;
             }
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
             uint32 index = (lastReadBufTemp * numberOfSignals) + syncSignal;
-            if (isRefreshed[index] == 0u) {
-                mutex.FastUnLock();
+            if (!IsRefreshed(index)) {
                 break;
             }
-            mutex.FastUnLock();
             lastReadBuffer[syncSignal] = lastReadBufTemp;
             nStepsForward++;
         }
@@ -318,16 +334,24 @@ bool CircularBufferThreadInputDataSource::Synchronise() {
                 lastReadBuffer[syncSignal] = 0u;
             }
             uint32 index = (lastReadBuffer[syncSignal] * numberOfSignals) + syncSignal;
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            bool isArrived = (isRefreshed[index] == 1u);
-            mutex.FastUnLock();
+            bool isArrived = IsRefreshed(index);
             /*lint -e{9131} -e{9007} known dependences and side effects.*/
             while ((!isArrived) && (stop == 0)) {
-                (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                isArrived = (isRefreshed[index] == 1u);
-                mutex.FastUnLock();
-                if (!isArrived) {
-                    Sleep::Sec(sleepTime);
+                if (eventWakeUp) {
+                    //Announce the wait before checking again, so that a cycle published after the check is guaranteed to post the semaphore
+                    (void) dataArrivedSem.Reset();
+                    (void) Atomic::Exchange(&waitingForData, 1);
+                    isArrived = IsRefreshed(index);
+                    if (!isArrived) {
+                        (void) dataArrivedSem.Wait(TimeoutType(CIRCULAR_BUFFER_EVENT_WAKE_UP_TIMEOUT_MSEC));
+                        isArrived = IsRefreshed(index);
+                    }
+                }
+                else {
+                    isArrived = IsRefreshed(index);
+                    if (!isArrived) {
+                        Sleep::Sec(sleepTime);
+                    }
                 }
             }
             numberOfSamplesSinceLastTrigger--;
@@ -826,6 +850,10 @@ bool CircularBufferThreadInputDataSource::GetInputOffset(const uint32 signalIdx,
     return true;
 }
 
+bool CircularBufferThreadInputDataSource::IsOffsetCachingSupported() {
+    return true;
+}
+
 /*lint -e{715} Default implementation is not implemented.*/
 bool CircularBufferThreadInputDataSource::GetOutputOffset(const uint32 signalIdx,
                                                           const uint32 numberOfSamples,
@@ -910,16 +938,12 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
                         errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index1 + cnt) * static_cast<uint32>(sizeof(uint32))));
 
                         //overlap error
-                        (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                        if (isRefreshed[index] == 1u) {
+                        if (IsRefreshed(index)) {
                             void *errorPtr = &memory[errorMemIndex];
                             *reinterpret_cast<uint32*>(errorPtr) |= 2u;
                         }
-                        mutex.FastUnLock();
                     }
-                    (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                    isRefreshed[index] = 1u;
-                    mutex.FastUnLock();
+                    SetRefreshed(index, 1u);
                     currentBuffer[i]++;
                     if (currentBuffer[i] >= numberOfBuffers) {
                         currentBuffer[i] = 0u;
@@ -930,9 +954,7 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
         }
         if (timeStampSignalIndex != 0xFFFFFFFFu) {
             uint32 index = (currentBuffer[timeStampSignalIndex] * (numberOfSignals)) + timeStampSignalIndex;
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            isRefreshed[index] = 1u;
-            mutex.FastUnLock();
+            SetRefreshed(index, 1u);
             currentBuffer[timeStampSignalIndex]++;
             if (currentBuffer[timeStampSignalIndex] >= numberOfBuffers) {
                 currentBuffer[timeStampSignalIndex] = 0u;
@@ -940,9 +962,7 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
         }
         if (errorCheckSignalIndex != 0xFFFFFFFFu) {
             uint32 index = (currentBuffer[errorCheckSignalIndex] * (numberOfSignals)) + errorCheckSignalIndex;
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            isRefreshed[index] = 1u;
-            mutex.FastUnLock();
+            SetRefreshed(index, 1u);
 
             currentBuffer[errorCheckSignalIndex]++;
             if (currentBuffer[errorCheckSignalIndex] >= numberOfBuffers) {
@@ -955,6 +975,7 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
                 *reinterpret_cast<uint32*>(errorPtr) = 0u;
             }
         }
+        WakeUpConsumer();
     }
     else if (info.GetStage() == ExecutionInfo::StartupStage) {
         for (uint32 i = 0u; i < numberOfSignals; i++) {
@@ -963,6 +984,9 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
         (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
         (void) MemoryOperationsHelper::Set(&isRefreshed[0], '\0', numberOfBuffers * numberOfSignals);
         mutex.FastUnLock();
+        if (lockFree) {
+            Atomic::ReleaseBarrier();
+        }
     }
     else {
     }
@@ -991,10 +1015,8 @@ bool CircularBufferThreadInputDataSource::TerminateInputCopy(const uint32 signal
             if (index >= numberOfBuffers) {
                 index = 0u;
             }
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
             uint32 index1 = (index * numberOfSignals) + signalIdx;
-            isRefreshed[index1] = 0u;
-            mutex.FastUnLock();
+            SetRefreshed(index1, 0u);
         }
         nBrokerOpPerSignalCounter[signalIdx] = nBrokerOpPerSignal[signalIdx];
     }
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "FastPollingMutexSem.h"
 #include "EventSem.h"
@@ -65,6 +66,14 @@ namespace MARTe {
  * If the parameter SignalDefinitionInterleaved is = 1, it is assumed that the defined signals form part of a packet that is interleaved (and replicated for N samples).
  * Again, the protected accelerators (see numberOfInterleavedSamples, numberOfInterleavedSignalMembers and memberByteSize) allow specialised classes to use this information.
  *
+ * The internal thread is the only producer and the real-time thread (through Synchronise, PrepareInputOffsets and TerminateInputCopy) the only consumer of each
+ * buffer slot. By default the isRefreshed flags are shared under a FastPollingMutexSem. If LockFree = 1 the mutex is bypassed: the internal thread publishes a slot
+ * with a store-release on its isRefreshed flag after the data has been written, and the consumer reads the flag with a load-acquire before touching the data
+ * (and releases it back with a store-release once the brokers have copied it).
+ * If EventWakeUp = 1, Synchronise does not poll (with SleepTime) for the next sample of the synchronising signal. Instead it blocks in an EventSem which is posted
+ * by the internal thread at the end of each acquisition cycle, but only when the consumer has announced that it is waiting (so that no system call is
+ * performed by the internal thread while the consumer is busy).
+ *
  * @details The configuration syntax is (names and signal quantity are only given as an example):
  * <pre>
  * +CircularBuffer_0 = {
@@ -78,6 +87,9 @@ namespace MARTe {
  *     *SignalDefinitionInterleaved = 0/1 (if 0, default, it is assumed that the signal is not defined as interleaved)
  *     *sleepInMutexSec = 1e-6F (the sleep time in mutex in seconds, default is 1e-6F)
  *     *GetFirst = 0/1 (if 0, default, do not wait for the first valid buffer to arrive)
+ *     *LockFree = 0/1 (if 1, the isRefreshed flags are shared with acquire/release semantics instead of the mutex, default is 0)
+ *     *EventWakeUp = 0/1 (if 1, Synchronise waits for the internal thread in an EventSem instead of polling with SleepTime, default is 0)
+ *     *MirroredBuffers = 0/1 (if 1, the buffers of the signals are allocated in mirrored memory, see MemoryDataSourceI, default is 0)
  *     Signals = {
  *         *InternalTimeStamp = {
  *             Type = uint64
@@ -124,6 +136,8 @@ public:
      * @details Initialises the following parameters:
      *   CpuMask: a mask to select the cpus where the internal thread is allowed to be executed (default 0xFFFFu)\n
      *   ReceiverThreadPriority: the priority of the internal thread between 0 (min) and 31 (max) (default 31)\n
+     *   LockFree: if 1, the isRefreshed flags are accessed with acquire/release semantics instead of the mutex (default 0)\n
+     *   EventWakeUp: if 1, Synchronise blocks in an EventSem posted by the internal thread instead of polling (default 0)\n
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -191,6 +205,13 @@ public:
      */
     virtual bool GetInputOffset(const uint32 signalIdx, const uint32 numberOfSamples, uint32 &offset);
 
+    /**
+     * @brief The lastReadBuffer indexes are only updated in PrepareInputOffsets and Synchronise.
+     * @see DataSourceI::IsOffsetCachingSupported
+     * @return true.
+     */
+    virtual bool IsOffsetCachingSupported();
+
     /**
      * @brief Returns the offset to the last \a numberOfSamples written for the signal \a signalIdx.
      * @see DataSourceI::GetOutputOffset
@@ -349,9 +370,46 @@ protected:
      */
     float32 sleepTime;
 
+    /**
+     * If true the isRefreshed flags are shared without the mutex (see LockFree).
+     */
+    bool lockFree;
+
+    /**
+     * If true Synchronise waits in dataArrivedSem instead of polling (see EventWakeUp).
+     */
+    bool eventWakeUp;
+
+    /**
+     * Posted by the internal thread when a cycle has been acquired and the consumer is waiting.
+     */
+    EventSem dataArrivedSem;
+
+    /**
+     * Set to 1 by the consumer before blocking in dataArrivedSem and cleared by the internal thread when it posts.
+     */
+    volatile int32 waitingForData;
+
 
 private:
 
+    /**
+     * @brief Reads the isRefreshed flag at \a index.
+     * @details Uses the mutex or, if lockFree, a load-acquire.
+     */
+    inline bool IsRefreshed(const uint32 index);
+
+    /**
+     * @brief Writes the isRefreshed flag at \a index.
+     * @details Uses the mutex or, if lockFree, a store-release.
+     */
+    inline void SetRefreshed(const uint32 index, const uint8 value);
+
+    /**
+     * @brief Called by the internal thread at the end of each cycle to wake the consumer, if it is waiting.
+     */
+    inline void WakeUpConsumer();
+
     /**
      * @brief Helper function to create the interleaved accelerators
      */
@@ -369,5 +427,48 @@ private:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/*lint -e{613} null pointer checked before.*/
+bool CircularBufferThreadInputDataSource::IsRefreshed(const uint32 index) {
+    bool refreshed;
+    if (lockFree) {
+        volatile const uint8 *flag = &isRefreshed[index];
+        refreshed = (*flag == 1u);
+        Atomic::AcquireBarrier();
+    }
+    else {
+        (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
+        refreshed = (isRefreshed[index] == 1u);
+        mutex.FastUnLock();
+    }
+    return refreshed;
+}
+
+/*lint -e{613} null pointer checked before.*/
+void CircularBufferThreadInputDataSource::SetRefreshed(const uint32 index,
+                                                       const uint8 value) {
+    if (lockFree) {
+        Atomic::ReleaseBarrier();
+        volatile uint8 *flag = &isRefreshed[index];
+        *flag = value;
+    }
+    else {
+        (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
+        isRefreshed[index] = value;
+        mutex.FastUnLock();
+    }
+}
+
+void CircularBufferThreadInputDataSource::WakeUpConsumer() {
+    if (eventWakeUp) {
+        //The exchange is also the full barrier that orders the isRefreshed stores before the read of waitingForData
+        if (Atomic::Exchange(&waitingForData, 0) != 0) {
+            (void) dataArrivedSem.Post();
+        }
+    }
+}
+
+}
 
 #endif /* CIRCULARBUFFERTHREADINPUTDATASOURCE_H_ */
@@ -362,6 +362,8 @@ void FastScheduler::CustomPrepareNextState() {
                 rtThreadInfo[nextBuffer][j].numberOfExecutables = 0u;
                 rtThreadInfo[nextBuffer][j].cycleTime = NULL_PTR(uint32 *);
                 rtThreadInfo[nextBuffer][j].lastCycleTimeStamp = 0u;
+                rtThreadInfo[nextBuffer][j].statistics = NULL_PTR(ExecutableStatistics *);
+                rtThreadInfo[nextBuffer][j].timingTicks = NULL_PTR(uint64 *);
             }
 
             //Launches the threads for the next state
@@ -372,6 +374,8 @@ void FastScheduler::CustomPrepareNextState() {
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].numberOfExecutables = nextState->threads[i].numberOfExecutables;
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].cycleTime = nextState->threads[i].cycleTime;
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].lastCycleTimeStamp = 0u;
+                rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].statistics = nextState->threads[i].statistics;
+                rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].timingTicks = nextState->threads[i].timingTicks;
                 REPORT_ERROR(ErrorManagement::FatalError, "Configuring rtThreadInfo[%d][%d]=%!", nextBuffer, cpuThreadMap[nextStateIdentifier][i],
                         rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].numberOfExecutables);
             }
@@ -398,7 +402,8 @@ ErrorManagement::ErrorType FastScheduler::Execute(ExecutionInfo & information) {
 
         if (rtThreadInfo[idx] != NULL_PTR(RTThreadParam *)) {
             if (rtThreadInfo[idx][threadNumber].numberOfExecutables > 0u) {
-                bool ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables);
+                bool ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables,
+                                             rtThreadInfo[idx][threadNumber].statistics, rtThreadInfo[idx][threadNumber].timingTicks);
                 if (!ok) {
                     REPORT_ERROR(ErrorManagement::FatalError, "Failed to ExecuteSingleCycle().");
                     //Do not set ret.fatalError = true because when ExecuteSingleCycle returns false it will trigger the MultiThreadService to restart the execution of ThreadLoop.
@@ -410,14 +415,15 @@ ErrorManagement::ErrorType FastScheduler::Execute(ExecutionInfo & information) {
                         }
                     }
                 }
-                uint32 absTime = 0u;
+                uint64 elapsedTicks = 0u;
                 if (rtThreadInfo[idx][threadNumber].lastCycleTimeStamp != 0u) {
-                    uint64 tmp = (HighResolutionTimer::Counter() - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
-                    float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-                    absTime = static_cast<uint32>(ticksToTime); //us
+                    elapsedTicks = (HighResolutionTimer::Counter() - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
                 }
-                uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-                (void)MemoryOperationsHelper::Copy(rtThreadInfo[idx][threadNumber].cycleTime, &absTime, sizeToCopy);
+                uint64 *cycleTicks = NULL_PTR(uint64 *);
+                if (rtThreadInfo[idx][threadNumber].timingTicks != NULL_PTR(uint64 *)) {
+                    cycleTicks = &rtThreadInfo[idx][threadNumber].timingTicks[rtThreadInfo[idx][threadNumber].numberOfExecutables];
+                }
+                StoreCycleTime(rtThreadInfo[idx][threadNumber].cycleTime, cycleTicks, elapsedTicks);
                 rtThreadInfo[idx][threadNumber].lastCycleTimeStamp = HighResolutionTimer::Counter();
             }
             else {
@@ -53,6 +53,9 @@ namespace MARTe {
  *    NoWait = 0 //Wait for all the cycles to terminate before executing the executables of the next cycle. Default is 0
  *     ...\n
  *    TimingDataSource = "Name of the TimingDataSource"
+ *    CollectStatistics = 0 //Optional. If 1 the execution time statistics of every GAM and BrokerI are collected (see GAMSchedulerI). Default is 0.
+ *    RawTicksTiming = 0 //Optional. If 1 the timing signals are stored as raw ticks and converted when read (see GAMSchedulerI). Default is 0.
+ *    TimingResolution = Microseconds //Optional. Microseconds or Nanoseconds (see GAMSchedulerI). Default is Microseconds.
  *    +ErrorMessage = { //Optional. Fired every time there is an execution error. Name is only an example.
  *        Class = Message
  *        ...
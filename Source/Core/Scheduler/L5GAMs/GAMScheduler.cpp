@@ -30,16 +30,26 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "ExecutionInfo.h"
 #include "GAMScheduler.h"
 #include "MultiThreadService.h"
 #include "RealTimeApplication.h"
+#include "Sleep.h"
 #include "Threads.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * Value of activeState when no state is being executed.
+ */
+static const int32 GAM_SCHEDULER_NO_ACTIVE_STATE = -1;
+/**
+ * Value of activeState while the persistent threads are being destroyed.
+ */
+static const int32 GAM_SCHEDULER_TERMINATING = -2;
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -51,9 +61,19 @@ GAMScheduler::GAMScheduler() :
     multiThreadService[1] = NULL_PTR(MultiThreadService *);
     rtThreadInfo[0] = NULL_PTR(RTThreadParam *);
     rtThreadInfo[1] = NULL_PTR(RTThreadParam *);
+    persistentThreads = false;
+    persistentThreadService = NULL_PTR(MultiThreadService *);
+    persistentThreadInfo = NULL_PTR(RTPersistentThreadParam *);
+    numberOfPersistentThreads = 0u;
+    parkingSem = NULL_PTR(EventSem *);
+    numberOfParkingSems = 0u;
+    activeState = GAM_SCHEDULER_NO_ACTIVE_STATE;
     if (!eventSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed Create(*) of the event semaphore");
     }
+    if (!parkedSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed Create(*) of the parked semaphore");
+    }
 }
 
 /*lint -e{1551} the destructor must guarantee that the resources are stopped and freed. No exception should be thrown given that
@@ -81,11 +101,16 @@ GAMScheduler::~GAMScheduler() {
     if (rtThreadInfo[1] != NULL) {
         delete[] rtThreadInfo[1];
     }
+    DestroyPersistentThreads();
 }
 
 bool GAMScheduler::Initialise(StructuredDataI & data) {
     bool ret = GAMSchedulerI::Initialise(data);
     if (ret) {
+        uint32 persistentThreadsU = 0u;
+        if (data.Read("PersistentThreads", persistentThreadsU)) {
+            persistentThreads = (persistentThreadsU == 1u);
+        }
         if (Size() > 0u) {
             ret = (Size() == 1u);
             if (ret) {
@@ -104,6 +129,205 @@ bool GAMScheduler::Initialise(StructuredDataI & data) {
     return ret;
 }
 
+bool GAMScheduler::ConfigureScheduler(Reference realTimeAppIn) {
+    //The persistent threads reference the states, which are freed by GAMSchedulerI::ConfigureScheduler
+    DestroyPersistentThreads();
+    bool ret = GAMSchedulerI::ConfigureScheduler(realTimeAppIn);
+    if ((ret) && (persistentThreads)) {
+        ErrorManagement::ErrorType err = CreatePersistentThreads();
+        ret = err.ErrorsCleared();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to create the persistent threads.");
+        }
+    }
+    return ret;
+}
+
+ErrorManagement::ErrorType GAMScheduler::CreatePersistentThreads() {
+    ErrorManagement::ErrorType err(states != NULL_PTR(ScheduledState *));
+    if (err.ErrorsCleared()) {
+        numberOfPersistentThreads = 0u;
+        for (uint32 s = 0u; s < numberOfStates; s++) {
+            numberOfPersistentThreads += states[s].numberOfThreads;
+        }
+        activeState = GAM_SCHEDULER_NO_ACTIVE_STATE;
+        numberOfParkingSems = numberOfStates;
+        parkingSem = new EventSem[numberOfParkingSems];
+        for (uint32 s = 0u; (s < numberOfParkingSems) && (err.ErrorsCleared()); s++) {
+            err = !parkingSem[s].Create();
+            if (err.ErrorsCleared()) {
+                err = !parkingSem[s].Reset();
+            }
+        }
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to Create(*) the parking semaphores");
+        }
+    }
+    if (err.ErrorsCleared()) {
+        persistentThreadInfo = new RTPersistentThreadParam[numberOfPersistentThreads];
+        persistentThreadService = new (NULL) MultiThreadService(binder);
+        persistentThreadService->SetNumberOfPoolThreads(numberOfPersistentThreads);
+        err = persistentThreadService->CreateThreads();
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to CreateThreads().");
+        }
+    }
+    if (err.ErrorsCleared()) {
+        uint32 n = 0u;
+        for (uint32 s = 0u; s < numberOfStates; s++) {
+            //lint -e{613} states != NULL checked before entering here.
+            for (uint32 t = 0u; t < states[s].numberOfThreads; t++) {
+                persistentThreadInfo[n].threadParam.executables = states[s].threads[t].executables;
+                persistentThreadInfo[n].threadParam.numberOfExecutables = states[s].threads[t].numberOfExecutables;
+                persistentThreadInfo[n].threadParam.cycleTime = states[s].threads[t].cycleTime;
+                persistentThreadInfo[n].threadParam.lastCycleTimeStamp = 0u;
+                persistentThreadInfo[n].threadParam.statistics = states[s].threads[t].statistics;
+                persistentThreadInfo[n].threadParam.timingTicks = states[s].threads[t].timingTicks;
+                persistentThreadInfo[n].stateIdentifier = s;
+                persistentThreadInfo[n].parked = 0;
+                persistentThreadService->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, n);
+                persistentThreadService->SetCPUMaskThreadPool(states[s].threads[t].cpu, n);
+                persistentThreadService->SetStackSizeThreadPool(states[s].threads[t].stackSize, n);
+                persistentThreadService->SetThreadNameThreadPool(states[s].threads[t].name, n);
+                n++;
+            }
+        }
+        err = persistentThreadService->Start();
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to Start() MultiThreadService.");
+        }
+    }
+    return err;
+}
+
+void GAMScheduler::DestroyPersistentThreads() {
+    (void) Atomic::Exchange(&activeState, GAM_SCHEDULER_TERMINATING);
+    if (parkingSem != NULL_PTR(EventSem *)) {
+        //Release all the parked threads so that they can be stopped
+        for (uint32 s = 0u; s < numberOfParkingSems; s++) {
+            if (!parkingSem[s].Post()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the parking semaphore");
+            }
+        }
+    }
+    if (persistentThreadService != NULL_PTR(MultiThreadService *)) {
+        ErrorManagement::ErrorType err;
+        err = persistentThreadService->Stop();
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not Stop the persistentThreadService");
+        }
+        delete persistentThreadService;
+        persistentThreadService = NULL_PTR(MultiThreadService *);
+    }
+    activeState = GAM_SCHEDULER_NO_ACTIVE_STATE;
+    if (persistentThreadInfo != NULL_PTR(RTPersistentThreadParam *)) {
+        delete[] persistentThreadInfo;
+        persistentThreadInfo = NULL_PTR(RTPersistentThreadParam *);
+    }
+    if (parkingSem != NULL_PTR(EventSem *)) {
+        delete[] parkingSem;
+        parkingSem = NULL_PTR(EventSem *);
+    }
+    numberOfParkingSems = 0u;
+    numberOfPersistentThreads = 0u;
+}
+
+ErrorManagement::ErrorType GAMScheduler::ParkActiveState() {
+    ErrorManagement::ErrorType err;
+    int32 stateToPark = activeState;
+    if ((stateToPark >= 0) && (parkingSem != NULL_PTR(EventSem *))) {
+        uint32 stateIdx = static_cast<uint32>(stateToPark);
+        //Close the barrier before deactivating the state, so that the threads that see the state as inactive block on it (and do not spin).
+        err = !parkingSem[stateIdx].Reset();
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed Reset(*) of the parking semaphore");
+        }
+        if (err.ErrorsCleared()) {
+            err = !parkedSem.Reset();
+        }
+        (void) Atomic::Exchange(&activeState, GAM_SCHEDULER_NO_ACTIVE_STATE);
+        TimeoutType timeout = persistentThreadService->GetTimeout();
+        uint64 startTicks = HighResolutionTimer::Counter();
+        //Wait for the threads to complete the current cycle. As activeState was atomically exchanged before, any thread that is not parked yet will park before executing a new cycle.
+        bool allParked = false;
+        while ((!allParked) && (err.ErrorsCleared())) {
+            allParked = true;
+            for (uint32 n = 0u; (n < numberOfPersistentThreads) && (allParked); n++) {
+                if (persistentThreadInfo[n].stateIdentifier == stateIdx) {
+                    allParked = (persistentThreadInfo[n].parked == 1);
+                }
+            }
+            if (!allParked) {
+                //Every thread posts the parkedSem after announcing that it is parked.
+                if (timeout == TTInfiniteWait) {
+                    err = parkedSem.Wait(TTInfiniteWait);
+                }
+                else {
+                    uint64 elapsedTicks = (HighResolutionTimer::Counter() - startTicks);
+                    err.timeout = (elapsedTicks >= timeout.HighResolutionTimerTicks());
+                    if (err.ErrorsCleared()) {
+                        TimeoutType remaining;
+                        remaining.SetTimeoutHighResolutionTimerTicks(timeout.HighResolutionTimerTicks() - elapsedTicks);
+                        err = parkedSem.Wait(remaining);
+                    }
+                }
+                if (err.ErrorsCleared()) {
+                    err = !parkedSem.Reset();
+                }
+            }
+        }
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to park the threads of state %s", states[stateIdx].name);
+        }
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType GAMScheduler::ExecutePersistentThread(const uint32 threadNumber) {
+    ErrorManagement::ErrorType ret(threadNumber < numberOfPersistentThreads);
+    if (ret.ErrorsCleared()) {
+        RTPersistentThreadParam &info = persistentThreadInfo[threadNumber];
+        //Announce that the thread is not parked before checking if its state is active (see ParkActiveState)
+        (void) Atomic::Exchange(&info.parked, 0);
+        if (activeState == static_cast<int32>(info.stateIdentifier)) {
+            bool ok = ExecuteSingleCycle(info.threadParam.executables, info.threadParam.numberOfExecutables, info.threadParam.statistics,
+                                         info.threadParam.timingTicks);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to ExecuteSingleCycle().");
+                if (errorMessage.IsValid()) {
+                    if (MessageI::SendMessage(errorMessage, this) != ErrorManagement::NoError) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Failed to SendMessage.");
+                    }
+                }
+            }
+            uint64 elapsedTicks = 0u;
+            if (info.threadParam.lastCycleTimeStamp != 0u) {
+                elapsedTicks = (HighResolutionTimer::Counter() - info.threadParam.lastCycleTimeStamp);
+            }
+            uint64 *cycleTicks = NULL_PTR(uint64 *);
+            if (info.threadParam.timingTicks != NULL_PTR(uint64 *)) {
+                cycleTicks = &info.threadParam.timingTicks[info.threadParam.numberOfExecutables];
+            }
+            StoreCycleTime(info.threadParam.cycleTime, cycleTicks, elapsedTicks);
+            info.threadParam.lastCycleTimeStamp = HighResolutionTimer::Counter();
+        }
+        else if (activeState == GAM_SCHEDULER_TERMINATING) {
+            //Do not spin (at real-time priority) while the MultiThreadService stops all the threads
+            Sleep::MSec(1u);
+        }
+        else {
+            //The time spent parked shall not be accounted as cycle time
+            info.threadParam.lastCycleTimeStamp = 0u;
+            (void) Atomic::Exchange(&info.parked, 1);
+            if (!parkedSem.Post()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the parked semaphore");
+            }
+            ret = parkingSem[info.stateIdentifier].Wait(TTInfiniteWait);
+        }
+    }
+    return ret;
+}
+
 void GAMScheduler::Purge(ReferenceContainer &purgeList) {
     //Post the semaphore to make sure that no Threads are awaiting to start!
     if (!eventSem.Post()) {
@@ -123,6 +347,7 @@ void GAMScheduler::Purge(ReferenceContainer &purgeList) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not StopCurrentStateExecution multiThreadService[1]");
         }
     }
+    DestroyPersistentThreads();
     ReferenceContainer::Purge(purgeList);
 }
 
@@ -135,8 +360,17 @@ ErrorManagement::ErrorType GAMScheduler::StartNextStateExecution() {
             ScheduledState *newState = GetSchedulableStates()[newBuffer];
             if (newState != NULL_PTR(ScheduledState *)) {
                 *currentStateIdentifier = nextStateIdentifier;
-                if (!eventSem.Post()) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the event semaphore");
+                if (persistentThreadService != NULL_PTR(MultiThreadService *)) {
+                    //Release the threads of the next state
+                    (void) Atomic::Exchange(&activeState, static_cast<int32>(nextStateIdentifier));
+                    if (!parkingSem[nextStateIdentifier].Post()) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the parking semaphore");
+                    }
+                }
+                else {
+                    if (!eventSem.Post()) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the event semaphore");
+                    }
                 }
             }
             else {
@@ -156,9 +390,14 @@ ErrorManagement::ErrorType GAMScheduler::StartNextStateExecution() {
 ErrorManagement::ErrorType GAMScheduler::StopCurrentStateExecution() {
     ErrorManagement::ErrorType err(realTimeApplicationT.IsValid());
     if (err.ErrorsCleared()) {
-        uint32 currentIndex = realTimeApplicationT->GetIndex();
-        if (multiThreadService[currentIndex] != NULL) {
-            err = multiThreadService[currentIndex]->Stop();
+        if (persistentThreadService != NULL_PTR(MultiThreadService *)) {
+            err = ParkActiveState();
+        }
+        else {
+            uint32 currentIndex = realTimeApplicationT->GetIndex();
+            if (multiThreadService[currentIndex] != NULL) {
+                err = multiThreadService[currentIndex]->Stop();
+            }
         }
     }
     return err;
@@ -166,7 +405,11 @@ ErrorManagement::ErrorType GAMScheduler::StopCurrentStateExecution() {
 
 void GAMScheduler::CustomPrepareNextState() {
     ErrorManagement::ErrorType err;
-    if (eventSem.Reset()) {
+    if (persistentThreadService != NULL_PTR(MultiThreadService *)) {
+        //The threads of the next state are already created and parked.
+        realTimeApplicationT = realTimeApp;
+    }
+    else if (eventSem.Reset()) {
         realTimeApplicationT = realTimeApp;
         err = !realTimeApplicationT.IsValid();
         if (err.ErrorsCleared()) {
@@ -196,6 +439,8 @@ void GAMScheduler::CustomPrepareNextState() {
                     rtThreadInfo[nextBuffer][i].numberOfExecutables = nextState->threads[i].numberOfExecutables;
                     rtThreadInfo[nextBuffer][i].cycleTime = nextState->threads[i].cycleTime;
                     rtThreadInfo[nextBuffer][i].lastCycleTimeStamp = 0u;
+                    rtThreadInfo[nextBuffer][i].statistics = nextState->threads[i].statistics;
+                    rtThreadInfo[nextBuffer][i].timingTicks = nextState->threads[i].timingTicks;
                     multiThreadService[nextBuffer]->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, i);
                     multiThreadService[nextBuffer]->SetCPUMaskThreadPool(nextState->threads[i].cpu, i);
                     multiThreadService[nextBuffer]->SetStackSizeThreadPool(nextState->threads[i].stackSize, i);
@@ -221,14 +466,20 @@ void GAMScheduler::CustomPrepareNextState() {
 ErrorManagement::ErrorType GAMScheduler::Execute(ExecutionInfo & information) {
     ErrorManagement::ErrorType ret;
     uint32 threadNumber = information.GetThreadNumber();
-    uint32 idx = realTimeApplicationT->GetIndex();
 
-    if (information.GetStage() == MARTe::ExecutionInfo::StartupStage) {
+    if (persistentThreadService != NULL_PTR(MultiThreadService *)) {
+        if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
+            ret = ExecutePersistentThread(threadNumber);
+        }
+    }
+    else if (information.GetStage() == MARTe::ExecutionInfo::StartupStage) {
         ret = eventSem.Wait(TTInfiniteWait);
     }
     else if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
+        uint32 idx = realTimeApplicationT->GetIndex();
         if (rtThreadInfo[idx] != NULL_PTR(RTThreadParam *)) {
-            bool ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables);
+            bool ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables,
+                                         rtThreadInfo[idx][threadNumber].statistics, rtThreadInfo[idx][threadNumber].timingTicks);
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::FatalError, "Failed to ExecuteSingleCycle().");
                 //Do not set ret.fatalError = true because when ExecuteSingleCycle returns false it will trigger the MultiThreadService to restart the execution of ThreadLoop.
@@ -240,16 +491,15 @@ ErrorManagement::ErrorType GAMScheduler::Execute(ExecutionInfo & information) {
                     }
                 }
             }
-            uint32 absTime = 0u;
+            uint64 elapsedTicks = 0u;
             if (rtThreadInfo[idx][threadNumber].lastCycleTimeStamp != 0u) {
-                uint64 tmp = (HighResolutionTimer::Counter() - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
-                float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-                absTime = static_cast<uint32>(ticksToTime);  //us
+                elapsedTicks = (HighResolutionTimer::Counter() - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
             }
-            uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-            if (!MemoryOperationsHelper::Copy(rtThreadInfo[idx][threadNumber].cycleTime, &absTime, sizeToCopy)) {
-                REPORT_ERROR(ErrorManagement::FatalError, "Could not copy cycle time information.");
+            uint64 *cycleTicks = NULL_PTR(uint64 *);
+            if (rtThreadInfo[idx][threadNumber].timingTicks != NULL_PTR(uint64 *)) {
+                cycleTicks = &rtThreadInfo[idx][threadNumber].timingTicks[rtThreadInfo[idx][threadNumber].numberOfExecutables];
             }
+            StoreCycleTime(rtThreadInfo[idx][threadNumber].cycleTime, cycleTicks, elapsedTicks);
             rtThreadInfo[idx][threadNumber].lastCycleTimeStamp = HighResolutionTimer::Counter();
         }
         else {
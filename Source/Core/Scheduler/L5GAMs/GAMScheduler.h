@@ -63,6 +63,33 @@ struct RTThreadParam {
      * HRT value last cycle time
      */
     uint64 lastCycleTimeStamp;
+    /**
+     * The execution time statistics of each executable (NULL if not collected)
+     */
+    ExecutableStatistics *statistics;
+    /**
+     * The raw execution times of each executable followed by the cycle time (NULL if RawTicksTiming = 0)
+     */
+    uint64 *timingTicks;
+};
+
+/**
+ * @brief Parameters of a thread which is created once, when the scheduler is configured, and parked while its state is not being executed.
+ */
+struct RTPersistentThreadParam {
+
+    /**
+     * The executables, cycle time and statistics of the thread
+     */
+    RTThreadParam threadParam;
+    /**
+     * The identifier of the state where the thread is executed
+     */
+    uint32 stateIdentifier;
+    /**
+     * 1 while the thread is parked, i.e. not executing the ExecutableI of its state
+     */
+    volatile int32 parked;
 };
 
 /**
@@ -73,11 +100,23 @@ struct RTThreadParam {
  *    Class = Scheduler_name
  *     ...\n
  *    TimingDataSource = "Name of the TimingDataSource"
+ *    CollectStatistics = 0 //Optional. If 1 the execution time statistics of every GAM and BrokerI are collected (see GAMSchedulerI). Default is 0.
+ *    RawTicksTiming = 0 //Optional. If 1 the timing signals are stored as raw ticks and converted when read (see GAMSchedulerI). Default is 0.
+ *    TimingResolution = Microseconds //Optional. Microseconds or Nanoseconds (see GAMSchedulerI). Default is Microseconds.
+ *    PersistentThreads = 0 //Optional. If 1 the threads of all the states are created when the scheduler is configured (see below). Default is 0.
  *    +ErrorMessage = { //Optional. Fired every time there is an execution error. Name is only an example.
  *        Class = Message
  *        ...
  *    }
  * }\n
+ *
+ * By default the threads of the next state are created (and the threads of the state before the current one are destroyed) every time
+ * that PrepareNextState is called. With PersistentThreads = 1 the threads of every state (with the CPU affinity, stack size and
+ * name of the respective RealTimeThread) are created once in ConfigureScheduler. The threads of the states that are not being executed
+ * are parked on a semaphore, so that StopCurrentStateExecution only waits for the threads of the current state to finish their cycle and
+ * StartNextStateExecution only releases the (already running) threads of the next state. The threads are only destroyed on Purge.
+ * @warning With PersistentThreads = 1, StopCurrentStateExecution waits until all the threads of the current state have completed their
+ * cycle. If an ExecutableI blocks indefinitely the state transition will also block.
  */
 class GAMScheduler: public GAMSchedulerI {
 
@@ -102,6 +141,13 @@ public:
      */
     virtual bool Initialise(StructuredDataI & data);
 
+    /**
+     * @brief Calls GAMSchedulerI::ConfigureScheduler and, if PersistentThreads = 1, creates and parks the threads of all the states.
+     * @param[in] realTimeAppIn the RealTimeApplication to be scheduled.
+     * @return true if GAMSchedulerI::ConfigureScheduler returns true and the threads (if PersistentThreads = 1) could be created.
+     */
+    virtual bool ConfigureScheduler(Reference realTimeAppIn);
+
     /**
      * @brief Starts the multi-thread execution for the current state.
      * @return ErrorManagement::NoError if the next state was configured (see PrepareNextState) and the MultiThreadService could be successfully started.
@@ -139,6 +185,30 @@ protected:
      */
     virtual void CustomPrepareNextState();
 
+    /**
+     * @brief Creates and starts the MultiThreadService with the threads of all the states (PersistentThreads = 1).
+     * @return ErrorManagement::NoError if the threads could be created and started.
+     */
+    ErrorManagement::ErrorType CreatePersistentThreads();
+
+    /**
+     * @brief Stops and destroys the MultiThreadService with the threads of all the states (PersistentThreads = 1).
+     */
+    void DestroyPersistentThreads();
+
+    /**
+     * @brief Parks the threads of the active state and waits for all of them to complete their current cycle (PersistentThreads = 1).
+     * @return ErrorManagement::NoError if all the threads were parked.
+     */
+    ErrorManagement::ErrorType ParkActiveState();
+
+    /**
+     * @brief Executes one cycle of a persistent thread or parks it if its state is not the active state (PersistentThreads = 1).
+     * @param[in] threadNumber the index of the thread in the persistentThreadInfo array.
+     * @return ErrorManagement::NoError if the thread was not parked or if it was successfully released.
+     */
+    ErrorManagement::ErrorType ExecutePersistentThread(const uint32 threadNumber);
+
     /**
      * The array of identifiers of the thread in execution.
      */
@@ -168,6 +238,46 @@ protected:
      * Specialised real-time application reference.
      */
     ReferenceT<RealTimeApplication> realTimeApplicationT;
+
+    /**
+     * True if the threads of all the states are to be created once in ConfigureScheduler.
+     */
+    bool persistentThreads;
+
+    /**
+     * The threads of all the states (PersistentThreads = 1).
+     */
+    MultiThreadService *persistentThreadService;
+
+    /**
+     * The parameters of each thread in the persistentThreadService.
+     */
+    RTPersistentThreadParam *persistentThreadInfo;
+
+    /**
+     * The number of threads in the persistentThreadService.
+     */
+    uint32 numberOfPersistentThreads;
+
+    /**
+     * One semaphore for each state. The threads of a state are parked on its semaphore while the state is not active.
+     */
+    EventSem *parkingSem;
+
+    /**
+     * The number of elements in parkingSem.
+     */
+    uint32 numberOfParkingSems;
+
+    /**
+     * The identifier of the state whose threads are being executed (-1 if none).
+     */
+    volatile int32 activeState;
+
+    /**
+     * Posted by each persistent thread when it parks, so that ParkActiveState does not have to poll the parked flags.
+     */
+    EventSem parkedSem;
 };
 
 }
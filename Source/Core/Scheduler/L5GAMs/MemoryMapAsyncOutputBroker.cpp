@@ -46,6 +46,10 @@ MemoryMapAsyncOutputBroker::MemoryMapAsyncOutputBroker() :
     bufferMemoryMap = NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*);
     numberOfBuffers = 0u;
     writeIdx = 0u;
+    publishedWriteIdx = 0u;
+    publishedBuffers = 0u;
+    consumedBuffers = 0u;
+    consumerWaiting = 0;
     readSynchIdx = 0u;
     cpuMask = ProcessorType(0xffu); // WARNING USING UINT32 TO INITIALIZE `ProcessorType`
     stackSize = THREADS_DATABASE_GRANULARITY;
@@ -55,8 +59,6 @@ MemoryMapAsyncOutputBroker::MemoryMapAsyncOutputBroker() :
     if (!sem.Reset()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not Reset the EventSem.");
     }
-    fastSem.Create();
-    posted = false;
     flushed = true;
     destroying = false;
     ignoreBufferOverrun = false;
@@ -68,10 +70,6 @@ MemoryMapAsyncOutputBroker::~MemoryMapAsyncOutputBroker() {
     if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*)) {
         uint32 i;
         for (i = 0u; i < numberOfBuffers; i++) {
-            uint32 c;
-            for (c = 0u; c < numberOfCopies; c++) {
-                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(bufferMemoryMap[i].mem[c]);
-            }
             delete[] bufferMemoryMap[i].mem;
             bufferMemoryMap[i].mem = NULL_PTR(void**);
         }
@@ -83,13 +81,10 @@ MemoryMapAsyncOutputBroker::~MemoryMapAsyncOutputBroker() {
 
 void MemoryMapAsyncOutputBroker::UnlinkDataSource() {
     if (!sem.IsClosed()) {
-        if (fastSem.FastLock() == ErrorManagement::NoError) {
-            destroying = true;
-            fastSem.FastUnLock();
-            if (!sem.Post()) {
-                REPORT_ERROR(ErrorManagement::FatalError, "Could not Post the EventSem.");
-            }
-            posted = true;
+        destroying = true;
+        Atomic::ReleaseBarrier();
+        if (!sem.Post()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not Post the EventSem.");
         }
         if (!sem.Close()) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not Close the EventSem.");
@@ -121,7 +116,9 @@ bool MemoryMapAsyncOutputBroker::InitWithBufferParameters(const SignalDirection
                                                           void *const gamMemoryAddress,
                                                           const uint32 numberOfBuffersIn,
                                                           const ProcessorType &cpuMaskIn,
-                                                          const uint32 stackSizeIn) {
+                                                          const uint32 stackSizeIn,
+                                                          const bool hugePageBuffersIn,
+                                                          const bool lockedBuffersIn) {
     bool ok = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
     numberOfBuffers = numberOfBuffersIn;
     cpuMask = cpuMaskIn;
@@ -165,6 +162,17 @@ bool MemoryMapAsyncOutputBroker::InitWithBufferParameters(const SignalDirection
     if (ok) {
         dataSourceRef = Reference(&dataSourceIn);
     }
+    if ((ok) && (numberOfCopies > 0u)) {
+        //All the buffers in a single slab, so that the BufferLoop reads the memory sequentially
+        uint32 *entrySizes = new uint32[numberOfCopies];
+        uint32 c;
+        for (c = 0u; c < numberOfCopies; c++) {
+            /*lint -e{613} copyTable cannot be NULL as otherwise MemoryMapBroker::Init would have failed*/
+            entrySizes[c] = copyTable[c].copySize;
+        }
+        ok = bufferPool.Allocate(numberOfBuffers, entrySizes, numberOfCopies, hugePageBuffersIn, lockedBuffersIn);
+        delete[] entrySizes;
+    }
     if (ok) {
         bufferMemoryMap = new MemoryMapAsyncOutputBrokerBufferEntry[numberOfBuffers];
         uint32 i;
@@ -173,9 +181,8 @@ bool MemoryMapAsyncOutputBroker::InitWithBufferParameters(const SignalDirection
             bufferMemoryMap[i].toConsume = false;
             uint32 c;
             bufferMemoryMap[i].mem = new void*[numberOfCopies];
-            for (c = 0u; (c < numberOfCopies) && (ok); c++) {
-                bufferMemoryMap[i].mem[c] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[c].copySize);
-                ok = MemoryOperationsHelper::Set(bufferMemoryMap[i].mem[c], '\0', copyTable[c].copySize);
+            for (c = 0u; c < numberOfCopies; c++) {
+                bufferMemoryMap[i].mem[c] = bufferPool.GetEntry(i, c);
             }
         }
     }
@@ -218,6 +225,8 @@ bool MemoryMapAsyncOutputBroker::Execute() {
                 ret = false;
             }
         }
+        //The BufferLoop must have finished reading this buffer before it is overwritten
+        Atomic::AcquireBarrier();
         uint32 n;
         for (n = 0u; (n < numberOfCopies) && (ret); n++) {
             if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
@@ -225,20 +234,21 @@ bool MemoryMapAsyncOutputBroker::Execute() {
                 ret = MemoryOperationsHelper::Copy(bufferMemoryMap[writeIdx].mem[n], copyTable[n].gamPointer, copyTable[n].copySize);
             }
         }
+        Atomic::ReleaseBarrier();
         bufferMemoryMap[writeIdx].toConsume = true;
-        if (ret) {
-            //Fast semaphore to increment writeIdx and to atomically Post the semaphore which warns the BufferLoop that there might be new data to be consumed.
-            ret = (fastSem.FastLock() == ErrorManagement::NoError);
-        }
         writeIdx++;
         if (writeIdx == numberOfBuffers) {
             writeIdx = 0u;
         }
-        if (ret) {
-            ret = sem.Post();
-            posted = true;
+        //The index is published before the counter, so that the BufferLoop never sees a counter newer than the index.
+        Atomic::StoreRelease(&publishedWriteIdx, writeIdx);
+        Atomic::StoreRelease(&publishedBuffers, publishedBuffers + 1u);
+        //Only enter the kernel if the BufferLoop is (about to be) blocked. The exchange is also the full barrier that orders the publishing before the read of consumerWaiting.
+        if (Atomic::Exchange(&consumerWaiting, 0) != 0) {
+            if (!sem.Post()) {
+                ret = false;
+            }
         }
-        fastSem.FastUnLock();
     }
     return ret;
 }
@@ -246,13 +256,9 @@ bool MemoryMapAsyncOutputBroker::Execute() {
 bool MemoryMapAsyncOutputBroker::Flush() {
     bool ret = true;
     if (service.GetStatus() != EmbeddedThreadI::OffState) {
-        ret = (fastSem.FastLock() == ErrorManagement::NoError);
-        if (ret) {
-            flushed = false;
-            ret = sem.Post();
-            posted = true;
-        }
-        fastSem.FastUnLock();
+        flushed = false;
+        Atomic::ReleaseBarrier();
+        ret = sem.Post();
         while (!flushed) {
             Sleep::Sec(0.1F);
         }
@@ -264,12 +270,10 @@ bool MemoryMapAsyncOutputBroker::Flush() {
 ErrorManagement::ErrorType MemoryMapAsyncOutputBroker::BufferLoop(ExecutionInfo &info) {
     ErrorManagement::ErrorType err;
     if (info.GetStage() == ExecutionInfo::MainStage) {
-        int32 synchStopIdx = 0;
-        if (fastSem.FastLock() == ErrorManagement::NoError) {
-            //Always stay preTriggerBuffers behind from the writeIdx so that we don't lose the pre-trigger buffers
-            synchStopIdx = static_cast<int32>(writeIdx);
-        }
-        fastSem.FastUnLock();
+        //All the buffers published up to now are consumed in this iteration. The free-running counter is only compared for equality (it may wrap),
+        //the stop index is the writeIdx published by the Execute.
+        consumedBuffers = Atomic::LoadAcquire(&publishedBuffers);
+        int32 synchStopIdx = static_cast<int32>(Atomic::LoadAcquire(&publishedWriteIdx));
 
         //Have to treat the special case when only one buffer is configured
         if (numberOfBuffers == 1u) {
@@ -281,6 +285,7 @@ ErrorManagement::ErrorType MemoryMapAsyncOutputBroker::BufferLoop(ExecutionInfo
         while ((readSynchIdx != static_cast<uint32>(synchStopIdx)) && (ret)) {
             if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*)) {
                 if (bufferMemoryMap[readSynchIdx].toConsume) {
+                    Atomic::AcquireBarrier();
                     uint32 c;
                     for (c = 0u; (c < numberOfCopies) && (ret); c++) {
                         //Copy from the buffer to the DataSource memory
@@ -294,6 +299,7 @@ ErrorManagement::ErrorType MemoryMapAsyncOutputBroker::BufferLoop(ExecutionInfo
                             ret = dataSourceRef->Synchronise();
                         }
                     }
+                    Atomic::ReleaseBarrier();
                     bufferMemoryMap[readSynchIdx].toConsume = false;
                 }
                 readSynchIdx++;
@@ -306,26 +312,21 @@ ErrorManagement::ErrorType MemoryMapAsyncOutputBroker::BufferLoop(ExecutionInfo
         }
 
         if (ret) {
-            flushed = true;
-            //Wait for new data to be available from the real-time thread.
-            if (!destroying) {
-                err = sem.Wait(TTInfiniteWait);
+            if (destroying) {
+                err = ErrorManagement::Completed;
             }
             else {
-                Sleep::Sec(0.1F);
-            }
-            if (err.ErrorsCleared()) {
-                //Only reset the semaphore if it was not posted in-between the Wait exit and now...
-                if (fastSem.FastLock() == ErrorManagement::NoError) {
-                    if (!posted) {
-                        err.fatalError = !sem.Reset();
-                    }
-                    if (destroying) {
-                        err = ErrorManagement::Completed;
-                    }
-                    posted = false;
+                //Reset before announcing the wait so that a Post issued after the announcement is not lost
+                err.fatalError = !sem.Reset();
+                (void) Atomic::Exchange(&consumerWaiting, 1);
+                //Check again after the announcement, as the Execute might have published a buffer without seeing it
+                bool sleep = (Atomic::LoadAcquire(&publishedBuffers) == consumedBuffers);
+                if ((sleep) && (err.ErrorsCleared()) && (!destroying)) {
+                    flushed = true;
+                    //Wait for new data to be available from the real-time thread.
+                    err = sem.Wait(TTInfiniteWait);
                 }
-                fastSem.FastUnLock();
+                (void) Atomic::Exchange(&consumerWaiting, 0);
             }
         }
     }
@@ -340,5 +341,13 @@ bool MemoryMapAsyncOutputBroker::IsIgnoringBufferOverrun() const {
     return ignoreBufferOverrun;
 }
 
+bool MemoryMapAsyncOutputBroker::IsHugePageBuffers() const {
+    return bufferPool.IsHugePageMemory();
+}
+
+bool MemoryMapAsyncOutputBroker::IsLockedBuffers() const {
+    return bufferPool.IsLockedMemory();
+}
+
 CLASS_REGISTER(MemoryMapAsyncOutputBroker, "1.0")
 }
@@ -31,6 +31,8 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "BrokerBufferPool.h"
 #include "EventSem.h"
 #include "MemoryMapBroker.h"
 #include "SingleThreadService.h"
@@ -66,6 +68,10 @@ struct MemoryMapAsyncOutputBrokerBufferEntry {
  *
  * Only one GAM is allowed to interact with this MemoryMapAsyncOutputBroker (an IOGAM can be used to collate all the signals).
  *
+ * The real-time thread (Execute) does not take any lock: each buffer is published with a store-release of the number of
+ * written buffers and the SingleThreadService is only woken up (EventSem::Post) if it announced that it is going to sleep.
+ * When woken up, the SingleThreadService consumes all the buffers published so far before sleeping again.
+ *
  * The DataSource shall call the UnlinkDataSource in the DataSourceI::Purge.
  */
 class MemoryMapAsyncOutputBroker: public MemoryMapBroker {
@@ -104,6 +110,8 @@ MemoryMapAsyncOutputBroker    ();
      * allow the asynchronous flushing into the DataSourceI (particularly useful if this operation is slow).
      * @param cpuMaskIn the CPU mask where the SingleThreadService will execute.
      * @param stackSizeIn the stack size assigned to the SingleThreadService.
+     * @param hugePageBuffersIn if true the buffers are allocated on huge pages, if available (see BrokerBufferPool::Allocate).
+     * @param lockedBuffersIn if true the buffers are locked in memory, if allowed (see BrokerBufferPool::Allocate).
      * @return true if MemoryMapOutputBroker::Init() returns true and if all the pre-conditions are met.
      * @pre
      *   numberOfBuffers > 0 &&
@@ -111,7 +119,8 @@ MemoryMapAsyncOutputBroker    ();
      *   dataSourceIn.GetNumberOfMemoryBuffers() &&
      */
     virtual bool InitWithBufferParameters(const SignalDirection direction, DataSourceI &dataSourceIn, const char8 * const functionName,
-            void * const gamMemoryAddress, const uint32 numberOfBuffersIn, const ProcessorType& cpuMaskIn, const uint32 stackSizeIn);
+            void * const gamMemoryAddress, const uint32 numberOfBuffersIn, const ProcessorType& cpuMaskIn, const uint32 stackSizeIn,
+            const bool hugePageBuffersIn = false, const bool lockedBuffersIn = false);
 
     /**
      * @brief Sequentially copies all the signals from the GAM memory to the next free buffer memory.
@@ -151,6 +160,18 @@ MemoryMapAsyncOutputBroker    ();
      */
     bool IsIgnoringBufferOverrun() const;
 
+    /**
+     * @brief Gets if the buffers were requested on huge pages (see InitWithBufferParameters).
+     * @return true if the buffers were requested on huge pages.
+     */
+    bool IsHugePageBuffers() const;
+
+    /**
+     * @brief Gets if the buffers were requested to be locked in memory (see InitWithBufferParameters).
+     * @return true if the buffers were requested to be locked in memory.
+     */
+    bool IsLockedBuffers() const;
+
     /**
      * @brief Flush all the data left in the shared buffer between the threads.
      * @return true if the data is properly flushed.
@@ -192,6 +213,11 @@ private:
      */
     MemoryMapAsyncOutputBrokerBufferEntry *bufferMemoryMap;
 
+    /**
+     * The memory of all the buffers.
+     */
+    BrokerBufferPool bufferPool;
+
     /**
      * The DataSource associated to this broker
      */
@@ -208,29 +234,39 @@ private:
     uint32 writeIdx;
 
     /**
-     * The read index where the BufferLoop is reading from.
+     * Value of writeIdx after the last buffer written by the Execute method (published with a store-release).
      */
-    uint32 readSynchIdx;
+    volatile uint32 publishedWriteIdx;
 
     /**
-     * Semaphore that synchronises the Execute and the BufferLoop methods.
+     * Number of buffers written by the Execute method (published with a store-release). Free-running, i.e. it wraps at 2^32.
      */
-    EventSem sem;
+    volatile uint32 publishedBuffers;
+
+    /**
+     * Value of publishedBuffers up to which the BufferLoop has consumed the buffers.
+     */
+    uint32 consumedBuffers;
 
     /**
-     * Makes sure that the EventSem is not Reset while being posted and also protects the writeIdx variable.
+     * Set (to 1) by the BufferLoop before waiting on the semaphore. The Execute method only posts the semaphore if this is set.
      */
-    FastPollingMutexSem fastSem;
+    volatile int32 consumerWaiting;
 
     /**
-     * Makes sure that the EventSem is not Reset while being posted and also protects the writeIdx variable.
+     * The read index where the BufferLoop is reading from.
      */
-    bool posted;
+    uint32 readSynchIdx;
+
+    /**
+     * Semaphore where the BufferLoop waits for new data.
+     */
+    EventSem sem;
 
     /**
      * Allows a clean exit of the BufferLoop thread
      */
-    bool destroying;
+    volatile bool destroying;
 
     /**
      * The binder for the SingleThreadService.
@@ -243,9 +279,9 @@ private:
     bool ignoreBufferOverrun;
 
     /**
-     * True if flushed was called.
+     * Set to false by Flush and to true by the BufferLoop when all the published buffers have been consumed.
      */
-    bool flushed;
+    volatile bool flushed;
 };
 }
 
@@ -65,6 +65,9 @@ MemoryMapAsyncTriggerOutputBroker::MemoryMapAsyncTriggerOutputBroker() :
     fastSem.Create();
     posted = false;
     destroying = false;
+    signalBufferHandover = false;
+    signalBufferAddresses = NULL_PTR(void**);
+    numberOfDataSourceSignals = 0u;
     triggerIndexInGAMMemory = 0u;
 }
 
@@ -74,10 +77,6 @@ MemoryMapAsyncTriggerOutputBroker::~MemoryMapAsyncTriggerOutputBroker() {
     if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncTriggerOutputBrokerBufferEntry*)) {
         uint32 i;
         for (i = 0u; i < numberOfBuffers; i++) {
-            uint32 c;
-            for (c = 0u; c < numberOfCopies; c++) {
-                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(bufferMemoryMap[i].mem[c]);
-            }
             delete[] bufferMemoryMap[i].mem;
             bufferMemoryMap[i].mem = NULL_PTR(void**);
         }
@@ -85,6 +84,10 @@ MemoryMapAsyncTriggerOutputBroker::~MemoryMapAsyncTriggerOutputBroker() {
         delete[] bufferMemoryMap;
         bufferMemoryMap = NULL_PTR(MemoryMapAsyncTriggerOutputBrokerBufferEntry*);
     }
+    if (signalBufferAddresses != NULL_PTR(void**)) {
+        delete[] signalBufferAddresses;
+        signalBufferAddresses = NULL_PTR(void**);
+    }
 }
 
 void MemoryMapAsyncTriggerOutputBroker::UnlinkDataSource() {
@@ -128,7 +131,9 @@ bool MemoryMapAsyncTriggerOutputBroker::InitWithTriggerParameters(const SignalDi
                                                                   const uint32 preTriggerBuffersIn,
                                                                   const uint32 postTriggerBuffersIn,
                                                                   const ProcessorType &cpuMaskIn,
-                                                                  const uint32 stackSizeIn) {
+                                                                  const uint32 stackSizeIn,
+                                                                  const bool hugePageBuffersIn,
+                                                                  const bool lockedBuffersIn) {
     bool ok = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
     numberOfBuffers = numberOfBuffersIn;
     preTriggerBuffers = preTriggerBuffersIn;
@@ -199,6 +204,17 @@ bool MemoryMapAsyncTriggerOutputBroker::InitWithTriggerParameters(const SignalDi
     if (ok) {
         dataSourceRef = Reference(&dataSourceIn);
     }
+    if ((ok) && (numberOfCopies > 0u)) {
+        //All the buffers in a single slab, so that the BufferLoop reads the memory sequentially
+        uint32 *entrySizes = new uint32[numberOfCopies];
+        uint32 c;
+        for (c = 0u; c < numberOfCopies; c++) {
+            /*lint -e{613} copyTable cannot be NULL as otherwise MemoryMapBroker::Init would have failed*/
+            entrySizes[c] = copyTable[c].copySize;
+        }
+        ok = bufferPool.Allocate(numberOfBuffers, entrySizes, numberOfCopies, hugePageBuffersIn, lockedBuffersIn);
+        delete[] entrySizes;
+    }
     if (ok) {
         bufferMemoryMap = new MemoryMapAsyncTriggerOutputBrokerBufferEntry[numberOfBuffers];
         uint32 i;
@@ -207,9 +223,16 @@ bool MemoryMapAsyncTriggerOutputBroker::InitWithTriggerParameters(const SignalDi
             bufferMemoryMap[i].triggered = false;
             uint32 c;
             bufferMemoryMap[i].mem = new void*[numberOfCopies];
-            for (c = 0u; (c < numberOfCopies) && (ok); c++) {
-                bufferMemoryMap[i].mem[c] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[c].copySize);
-                ok = MemoryOperationsHelper::Set(bufferMemoryMap[i].mem[c], '\0', copyTable[c].copySize);
+            for (c = 0u; c < numberOfCopies; c++) {
+                bufferMemoryMap[i].mem[c] = bufferPool.GetEntry(i, c);
+            }
+        }
+    }
+    if (ok) {
+        if (dataSourceIn.IsSignalBufferHandoverSupported()) {
+            signalBufferHandover = PrepareSignalBufferHandover();
+            if (!signalBufferHandover) {
+                REPORT_ERROR(ErrorManagement::Warning, "The DataSource supports the handover of buffers but not all the signals are written as a whole by the GAM. Copying into the DataSource memory.");
             }
         }
     }
@@ -383,19 +406,7 @@ ErrorManagement::ErrorType MemoryMapAsyncTriggerOutputBroker::BufferLoop(Executi
         while ((readSynchIdx != static_cast<uint32>(synchStopIdx)) && (ret)) {
             if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncTriggerOutputBrokerBufferEntry*)) {
                 if (bufferMemoryMap[readSynchIdx].triggered) {
-                    uint32 c;
-                    for (c = 0u; (c < numberOfCopies) && (ret); c++) {
-                        //Copy from the buffer to the DataSource memory
-                        if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
-                            ret = MemoryOperationsHelper::Copy(copyTable[c].dataSourcePointer, bufferMemoryMap[readSynchIdx].mem[c], copyTable[c].copySize);
-                        }
-                    }
-                    if (ret) {
-                        if (dataSourceRef.IsValid()) {
-                            //Make sure that the dataSourceRef consumes this data.
-                            ret = dataSourceRef->Synchronise();
-                        }
-                    }
+                    ret = FlushBuffer(readSynchIdx);
                     bufferMemoryMap[readSynchIdx].triggered = false;
                 }
                 readSynchIdx++;
@@ -434,6 +445,91 @@ ErrorManagement::ErrorType MemoryMapAsyncTriggerOutputBroker::BufferLoop(Executi
     return err;
 }
 
+bool MemoryMapAsyncTriggerOutputBroker::FlushBuffer(const uint32 idx) {
+    bool ret = true;
+    if (signalBufferHandover) {
+        if (dataSourceRef.IsValid()) {
+            //The page is only marked as free (triggered = false) after the DataSource returns, so that the real-time thread cannot overwrite it.
+            ret = dataSourceRef->SynchroniseSignalBuffers(&signalBufferAddresses[idx * numberOfDataSourceSignals]);
+        }
+    }
+    else {
+        uint32 c;
+        for (c = 0u; (c < numberOfCopies) && (ret); c++) {
+            //Copy from the buffer to the DataSource memory
+            if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
+                ret = MemoryOperationsHelper::Copy(copyTable[c].dataSourcePointer, bufferMemoryMap[idx].mem[c], copyTable[c].copySize);
+            }
+        }
+        if (ret) {
+            if (dataSourceRef.IsValid()) {
+                //Make sure that the dataSourceRef consumes this data.
+                ret = dataSourceRef->Synchronise();
+            }
+        }
+    }
+    return ret;
+}
+
+bool MemoryMapAsyncTriggerOutputBroker::PrepareSignalBufferHandover() {
+    numberOfDataSourceSignals = dataSource->GetNumberOfSignals();
+    bool ok = (numberOfDataSourceSignals > 0u);
+    if (ok) {
+        uint32 totalNumberOfAddresses = (numberOfBuffers * numberOfDataSourceSignals);
+        signalBufferAddresses = new void*[totalNumberOfAddresses];
+        uint32 a;
+        for (a = 0u; a < totalNumberOfAddresses; a++) {
+            signalBufferAddresses[a] = NULL_PTR(void*);
+        }
+    }
+    uint32 c;
+    for (c = 0u; (c < numberOfCopies) && (ok); c++) {
+        uint32 signalIdx = GetDSCopySignalIndex(c);
+        uint32 byteSize = 0u;
+        ok = (signalIdx < numberOfDataSourceSignals);
+        if (ok) {
+            ok = dataSource->GetSignalByteSize(signalIdx, byteSize);
+        }
+        //Each signal must be written, as a whole, by one and only one copy
+        if (ok) {
+            /*lint -e{613} copyTable cannot be NULL as otherwise MemoryMapBroker::Init would have failed*/
+            ok = ((GetCopyOffset(c) == 0u) && (copyTable[c].copySize == byteSize));
+        }
+        if (ok) {
+            /*lint -e{613} signalBufferAddresses cannot be NULL if ok*/
+            ok = (signalBufferAddresses[signalIdx] == NULL_PTR(void*));
+        }
+        if (ok) {
+            uint32 i;
+            for (i = 0u; i < numberOfBuffers; i++) {
+                signalBufferAddresses[(i * numberOfDataSourceSignals) + signalIdx] = bufferMemoryMap[i].mem[c];
+            }
+        }
+    }
+    uint32 s;
+    for (s = 0u; (s < numberOfDataSourceSignals) && (ok); s++) {
+        /*lint -e{613} signalBufferAddresses cannot be NULL if ok*/
+        ok = (signalBufferAddresses[s] != NULL_PTR(void*));
+    }
+    if ((!ok) && (signalBufferAddresses != NULL_PTR(void**))) {
+        delete[] signalBufferAddresses;
+        signalBufferAddresses = NULL_PTR(void**);
+    }
+    return ok;
+}
+
+bool MemoryMapAsyncTriggerOutputBroker::IsSignalBufferHandoverEnabled() const {
+    return signalBufferHandover;
+}
+
+bool MemoryMapAsyncTriggerOutputBroker::IsHugePageBuffers() const {
+    return bufferPool.IsHugePageMemory();
+}
+
+bool MemoryMapAsyncTriggerOutputBroker::IsLockedBuffers() const {
+    return bufferPool.IsLockedMemory();
+}
+
 bool MemoryMapAsyncTriggerOutputBroker::FlushAllTriggers() {
     uint32 i = 0u;
     uint32 idx = writeIdx;
@@ -454,19 +550,7 @@ bool MemoryMapAsyncTriggerOutputBroker::FlushAllTriggers() {
         while ((i < numberOfBuffers) && (ret)) {
             if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncTriggerOutputBrokerBufferEntry*)) {
                 if (bufferMemoryMap[idx].triggered) {
-                    uint32 c;
-                    for (c = 0u; (c < numberOfCopies) && (ret); c++) {
-                        //Copy from the buffer to the DataSource memory
-                        if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
-                            ret = MemoryOperationsHelper::Copy(copyTable[c].dataSourcePointer, bufferMemoryMap[idx].mem[c], copyTable[c].copySize);
-                        }
-                    }
-                    if (ret) {
-                        if (dataSourceRef.IsValid()) {
-                            //Make sure that the dataSourceRef consumes this data.
-                            ret = dataSourceRef->Synchronise();
-                        }
-                    }
+                    ret = FlushBuffer(idx);
                     bufferMemoryMap[idx].triggered = false;
                 }
             }
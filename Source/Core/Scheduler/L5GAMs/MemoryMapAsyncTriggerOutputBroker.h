@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "BrokerBufferPool.h"
 #include "EventSem.h"
 #include "MemoryMapBroker.h"
 #include "SingleThreadService.h"
@@ -73,6 +74,10 @@ struct MemoryMapAsyncTriggerOutputBrokerBufferEntry {
  * type uint8. All the signals shall have one and only one sample. The DataSourceI shall return GetNumberOfMemoryBuffers() == 1.
  *
  * Only one GAM is allowed to interact with this MemoryMapAsyncTriggerOutputBroker (an IOGAM can be used to collate all the signals).
+ *
+ * If the DataSourceI supports it (see DataSourceI::IsSignalBufferHandoverSupported) and all of its signals are written, without ranges,
+ * by the GAM, the pages are handed over by reference with DataSourceI::SynchroniseSignalBuffers, instead of being copied into the
+ * DataSourceI memory before calling Synchronise. This removes the second copy of the data.
  * 
  * The DataSource shall call the UnlinkDataSource in the DataSourceI::Purge.
  */
@@ -114,6 +119,8 @@ MemoryMapAsyncTriggerOutputBroker    ();
      * @param postTriggerBuffersIn number of post-trigger pages to flush into the DataSourceI.
      * @param cpuMaskIn the CPU mask where the SingleThreadService will execute.
      * @param stackSizeIn the stack size assigned to the SingleThreadService.
+     * @param hugePageBuffersIn if true the buffers are allocated on huge pages, if available (see BrokerBufferPool::Allocate).
+     * @param lockedBuffersIn if true the buffers are locked in memory, if allowed (see BrokerBufferPool::Allocate).
      *
      * @return true if MemoryMapOutputBroker::Init() returns true and if all the pre-conditions are met.
      * @pre
@@ -127,7 +134,8 @@ MemoryMapAsyncTriggerOutputBroker    ();
      */
     virtual bool InitWithTriggerParameters(const SignalDirection direction, DataSourceI &dataSourceIn, const char8 * const functionName,
             void * const gamMemoryAddress, const uint32 numberOfBuffersIn, const uint32 preTriggerBuffersIn,
-            const uint32 postTriggerBuffersIn, const ProcessorType& cpuMaskIn, const uint32 stackSizeIn);
+            const uint32 postTriggerBuffersIn, const ProcessorType& cpuMaskIn, const uint32 stackSizeIn, const bool hugePageBuffersIn = false,
+            const bool lockedBuffersIn = false);
 
     /**
      * @brief Sequentially copies all the signals from the GAM memory to the next free buffer memory.
@@ -181,6 +189,24 @@ MemoryMapAsyncTriggerOutputBroker    ();
      */
     bool FlushAllTriggers();
 
+    /**
+     * @brief Returns true if the pages are handed over by reference to the DataSourceI (see DataSourceI::SynchroniseSignalBuffers).
+     * @return true if the pages are handed over by reference to the DataSourceI.
+     */
+    bool IsSignalBufferHandoverEnabled() const;
+
+    /**
+     * @brief Gets if the buffers were requested on huge pages (see InitWithTriggerParameters).
+     * @return true if the buffers were requested on huge pages.
+     */
+    bool IsHugePageBuffers() const;
+
+    /**
+     * @brief Gets if the buffers were requested to be locked in memory (see InitWithTriggerParameters).
+     * @return true if the buffers were requested to be locked in memory.
+     */
+    bool IsLockedBuffers() const;
+
     /**
      * @brief Breaks the link with the owner DataSource (set with InitWithBufferParameters)
      */
@@ -196,6 +222,19 @@ private:
      */
     ErrorManagement::ErrorType BufferLoop(ExecutionInfo & info);
 
+    /**
+     * @brief Flushes the page with index \a idx into the DataSourceI.
+     * @param[in] idx the index of the page to flush.
+     * @return true if the page was copied (or handed over) and the DataSourceI successfully synchronised.
+     */
+    bool FlushBuffer(const uint32 idx);
+
+    /**
+     * @brief Builds the signalBufferAddresses table if every DataSourceI signal is written, as a whole, by exactly one copy.
+     * @return true if the pages can be handed over by reference to the DataSourceI.
+     */
+    bool PrepareSignalBufferHandover();
+
     /**
      * The SingleThreadService responsible for flushing the Buffer into the DataSourceI.
      */
@@ -216,6 +255,26 @@ private:
      */
     MemoryMapAsyncTriggerOutputBrokerBufferEntry *bufferMemoryMap;
 
+    /**
+     * The memory of all the buffers.
+     */
+    BrokerBufferPool bufferPool;
+
+    /**
+     * True if the pages are handed over by reference to the DataSourceI.
+     */
+    bool signalBufferHandover;
+
+    /**
+     * For each page, the address of each DataSourceI signal in the page (numberOfBuffers x numberOfDataSourceSignals).
+     */
+    void **signalBufferAddresses;
+
+    /**
+     * Number of signals of the DataSourceI.
+     */
+    uint32 numberOfDataSourceSignals;
+
     /**
      * The DataSource associated to this broker
      */
@@ -0,0 +1,77 @@
+/**
+ * @file BenchmarkGAM.h
+ * @brief Header file for class BenchmarkGAM
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BenchmarkGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BENCHMARKGAM_H_
+#define BENCHMARKGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief GAM with an empty Execute, so that only the cost of the framework (brokers and scheduler) is measured.
+ */
+class BenchmarkGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor.
+     */
+    BenchmarkGAM();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~BenchmarkGAM();
+
+    /**
+     * @brief Accepts any signal configuration.
+     * @return true.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool Execute();
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKGAM_H_ */
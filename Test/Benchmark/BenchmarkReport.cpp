@@ -0,0 +1,134 @@
+/**
+ * @file BenchmarkReport.cpp
+ * @brief Source file for class BenchmarkReport
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BenchmarkReport (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BenchmarkReport.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+BenchmarkStatistics::BenchmarkStatistics() {
+    startTicks = 0ull;
+    totalTicks = 0ull;
+    numberOfOperations = 0ull;
+    minTicks = 0.0;
+    maxTicks = 0.0;
+}
+
+uint64 BenchmarkStatistics::GetNumberOfOperations() const {
+    return numberOfOperations;
+}
+
+float64 BenchmarkStatistics::GetMeanNs() const {
+    float64 mean = 0.0;
+    if (numberOfOperations > 0ull) {
+        mean = (static_cast<float64>(totalTicks) * HighResolutionTimer::Period() * 1e9) / static_cast<float64>(numberOfOperations);
+    }
+    return mean;
+}
+
+float64 BenchmarkStatistics::GetMinNs() const {
+    return minTicks * HighResolutionTimer::Period() * 1e9;
+}
+
+float64 BenchmarkStatistics::GetMaxNs() const {
+    return maxTicks * HighResolutionTimer::Period() * 1e9;
+}
+
+BenchmarkReport::BenchmarkReport() {
+    numberOfResults = 0u;
+    numberOfFailures = 0u;
+}
+
+bool BenchmarkReport::BeginEntry(const char8 * const name,
+                                 const char8 * const variant) {
+    bool ok = true;
+    if (numberOfResults > 0u) {
+        ok = results.Printf("%s", ",\n");
+    }
+    if (ok) {
+        ok = results.Printf("    {\"Name\": \"%s\", \"Variant\": \"%s\"", name, variant);
+    }
+    numberOfResults++;
+    return ok;
+}
+
+bool BenchmarkReport::AddResult(const char8 * const name,
+                                const char8 * const variant,
+                                const BenchmarkStatistics &statistics,
+                                const uint64 bytesPerOperation) {
+    bool ok = BeginEntry(name, variant);
+    float64 meanNs = statistics.GetMeanNs();
+    float64 operationsPerSecond = 0.0;
+    if (meanNs > 0.0) {
+        operationsPerSecond = 1e9 / meanNs;
+    }
+    if (ok) {
+        ok = results.Printf(", \"Operations\": %u, \"MeanNs\": %.3f, \"MinNs\": %.3f, \"MaxNs\": %.3f, \"OperationsPerSecond\": %.3f",
+                            statistics.GetNumberOfOperations(), meanNs, statistics.GetMinNs(), statistics.GetMaxNs(), operationsPerSecond);
+    }
+    if ((ok) && (bytesPerOperation > 0ull)) {
+        float64 bytesPerSecond = operationsPerSecond * static_cast<float64>(bytesPerOperation);
+        ok = results.Printf(", \"BytesPerSecond\": %.3f", bytesPerSecond);
+    }
+    if (ok) {
+        ok = results.Printf("%s", "}");
+    }
+    return ok;
+}
+
+bool BenchmarkReport::AddFailure(const char8 * const name,
+                                 const char8 * const variant) {
+    bool ok = BeginEntry(name, variant);
+    if (ok) {
+        ok = results.Printf("%s", ", \"Failed\": 1}");
+    }
+    numberOfFailures++;
+    return ok;
+}
+
+bool BenchmarkReport::ToJson(StreamString &json) {
+    bool ok = json.Printf("{\n  \"Suite\": \"MARTe2Benchmark\",\n  \"TimerFrequency\": %u,\n  \"Results\": [\n", HighResolutionTimer::Frequency());
+    if (ok) {
+        ok = json.Printf("%s\n  ]\n}\n", results.Buffer());
+    }
+    return ok;
+}
+
+uint32 BenchmarkReport::GetNumberOfFailures() const {
+    return numberOfFailures;
+}
+
+}
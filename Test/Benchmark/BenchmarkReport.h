@@ -0,0 +1,235 @@
+/**
+ * @file BenchmarkReport.h
+ * @brief Header file for class BenchmarkReport
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BenchmarkReport
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BENCHMARKREPORT_H_
+#define BENCHMARKREPORT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "HighResolutionTimer.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Accumulates the timing of a benchmarked operation.
+ * @details The operation is timed in batches (Start/Stop) so that the cost of
+ * reading the HighResolutionTimer can be amortised over many operations.
+ * The minimum and maximum are the per-operation values of the fastest and
+ * slowest batch.
+ */
+class BenchmarkStatistics {
+public:
+
+    /**
+     * @brief Constructor. Resets all the counters.
+     */
+    BenchmarkStatistics();
+
+    /**
+     * @brief Starts timing a batch.
+     */
+    inline void Start();
+
+    /**
+     * @brief Stops timing a batch of \a operations operations.
+     * @param[in] operations the number of operations executed since Start.
+     */
+    inline void Stop(const uint32 operations = 1u);
+
+    /**
+     * @brief Gets the total number of operations timed.
+     * @return the total number of operations timed.
+     */
+    uint64 GetNumberOfOperations() const;
+
+    /**
+     * @brief Gets the mean time per operation.
+     * @return the mean time per operation in nanoseconds.
+     */
+    float64 GetMeanNs() const;
+
+    /**
+     * @brief Gets the time per operation of the fastest batch.
+     * @return the time per operation of the fastest batch in nanoseconds.
+     */
+    float64 GetMinNs() const;
+
+    /**
+     * @brief Gets the time per operation of the slowest batch.
+     * @return the time per operation of the slowest batch in nanoseconds.
+     */
+    float64 GetMaxNs() const;
+
+private:
+
+    /**
+     * HighResolutionTimer counter at the last Start.
+     */
+    uint64 startTicks;
+
+    /**
+     * Sum of the ticks of all the batches.
+     */
+    uint64 totalTicks;
+
+    /**
+     * Total number of operations.
+     */
+    uint64 numberOfOperations;
+
+    /**
+     * Ticks per operation of the fastest batch.
+     */
+    float64 minTicks;
+
+    /**
+     * Ticks per operation of the slowest batch.
+     */
+    float64 maxTicks;
+};
+
+/**
+ * @brief Collects the results of the benchmarks and serialises them to JSON.
+ * @details Each result is identified by the benchmark name and by a variant
+ * string with the parameters of the run (e.g. "Signals=8,Elements=64"), so that
+ * the same pair can be compared between MARTe2 releases. The output is:
+ * <pre>
+ * {
+ *   "Suite": "MARTe2Benchmark",
+ *   "TimerFrequency": 1000000000,
+ *   "Results": [
+ *     {"Name": "...", "Variant": "...", "Operations": N, "MeanNs": x, "MinNs": x, "MaxNs": x, "OperationsPerSecond": x, "BytesPerSecond": x},
+ *     ...
+ *   ]
+ * }
+ * </pre>
+ * BytesPerSecond is only written for the benchmarks that move data.
+ */
+class BenchmarkReport {
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    BenchmarkReport();
+
+    /**
+     * @brief Adds a result.
+     * @param[in] name the benchmark name.
+     * @param[in] variant the parameters of this run.
+     * @param[in] statistics the timing of the operations.
+     * @param[in] bytesPerOperation the number of bytes processed by each operation (0 if not applicable).
+     * @return true if the result could be written.
+     */
+    bool AddResult(const char8 * const name,
+                   const char8 * const variant,
+                   const BenchmarkStatistics &statistics,
+                   const uint64 bytesPerOperation = 0ull);
+
+    /**
+     * @brief Reports that a benchmark could not be executed.
+     * @details The failure is recorded in the JSON output (as an entry with "Failed": 1) so that a
+     * missing result is not mistaken for a regression in the tracking tools.
+     * @param[in] name the benchmark name.
+     * @param[in] variant the parameters of this run.
+     * @return true if the entry could be written.
+     */
+    bool AddFailure(const char8 * const name,
+                    const char8 * const variant);
+
+    /**
+     * @brief Writes the JSON document with all the results added so far.
+     * @param[out] json where to write the document.
+     * @return true if the document could be written.
+     */
+    bool ToJson(StreamString &json);
+
+    /**
+     * @brief Gets the number of failed benchmarks.
+     * @return the number of failed benchmarks.
+     */
+    uint32 GetNumberOfFailures() const;
+
+private:
+
+    /**
+     * Starts a new entry in the results array.
+     */
+    bool BeginEntry(const char8 * const name,
+                    const char8 * const variant);
+
+    /**
+     * The results array (without the enclosing brackets).
+     */
+    StreamString results;
+
+    /**
+     * Number of entries written.
+     */
+    uint32 numberOfResults;
+
+    /**
+     * Number of failures.
+     */
+    uint32 numberOfFailures;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+void BenchmarkStatistics::Start() {
+    startTicks = HighResolutionTimer::Counter();
+}
+
+void BenchmarkStatistics::Stop(const uint32 operations) {
+    uint64 ticks = HighResolutionTimer::Counter() - startTicks;
+    if (operations > 0u) {
+        float64 ticksPerOperation = static_cast<float64>(ticks) / static_cast<float64>(operations);
+        if ((numberOfOperations == 0ull) || (ticksPerOperation < minTicks)) {
+            minTicks = ticksPerOperation;
+        }
+        if (ticksPerOperation > maxTicks) {
+            maxTicks = ticksPerOperation;
+        }
+        totalTicks += ticks;
+        numberOfOperations += operations;
+    }
+}
+
+}
+
+#endif /* BENCHMARKREPORT_H_ */
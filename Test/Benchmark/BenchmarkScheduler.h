@@ -0,0 +1,86 @@
+/**
+ * @file BenchmarkScheduler.h
+ * @brief Header file for class BenchmarkScheduler
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BenchmarkScheduler
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BENCHMARKSCHEDULER_H_
+#define BENCHMARKSCHEDULER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAMSchedulerI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief GAMSchedulerI which does not launch any thread.
+ * @details Used by the benchmarks to configure a RealTimeApplication and to call
+ * GAMSchedulerI::ExecuteSingleCycle synchronously from the benchmark thread.
+ */
+class BenchmarkScheduler: public GAMSchedulerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor.
+     */
+    BenchmarkScheduler();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~BenchmarkScheduler();
+
+    /**
+     * @brief NOOP.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType StartNextStateExecution();
+
+    /**
+     * @brief NOOP.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType StopCurrentStateExecution();
+
+protected:
+
+    /**
+     * @brief NOOP.
+     */
+    virtual void CustomPrepareNextState();
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKSCHEDULER_H_ */
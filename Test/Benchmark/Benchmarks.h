@@ -0,0 +1,114 @@
+/**
+ * @file Benchmarks.h
+ * @brief Declaration of the MARTe2 benchmarks
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the benchmark functions
+ * of the MARTe2 benchmark suite.
+ */
+
+#ifndef BENCHMARKS_H_
+#define BENCHMARKS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BenchmarkReport.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Measures the MemoryMapInputBroker copy throughput (GAMDataSource to GAM) and the cost of a
+ * full real-time cycle (writer GAM, output brokers, input brokers, reader GAM) against the number of
+ * signals and the number of elements per signal.
+ * @param[in, out] report where the results are added.
+ * @return true if all the variants could be executed.
+ */
+bool BrokerBenchmark(BenchmarkReport &report);
+
+/**
+ * @brief Measures the overhead per executable of GAMSchedulerI::ExecuteSingleCycle.
+ * @param[in, out] report where the results are added.
+ * @return true if all the variants could be executed.
+ */
+bool SchedulerBenchmark(BenchmarkReport &report);
+
+/**
+ * @brief Measures the uncontended lock/unlock cost of FastPollingMutexSem and FastAdaptiveMutexSem
+ * and the thread to thread handoff latency of FastPollingMutexSem, FastAdaptiveMutexSem and EventSem.
+ * @param[in, out] report where the results are added.
+ * @return true if all the variants could be executed.
+ */
+bool SemaphoreBenchmark(BenchmarkReport &report);
+
+/**
+ * @brief Measures ReferenceContainer::Find and ObjectRegistryDatabase::Find against the number of children.
+ * @param[in, out] report where the results are added.
+ * @return true if all the variants could be executed.
+ */
+bool RegistryBenchmark(BenchmarkReport &report);
+
+/**
+ * @brief Measures the time to parse (StandardParser) a configuration into a ConfigurationDatabase
+ * against the number of nodes.
+ * @param[in, out] report where the results are added.
+ * @return true if all the variants could be executed.
+ */
+bool ConfigurationBenchmark(BenchmarkReport &report);
+
+/**
+ * @brief Measures the TypeConvert rate for scalar, vector and string conversions.
+ * @param[in, out] report where the results are added.
+ * @return true if all the variants could be executed.
+ */
+bool TypeConvertBenchmark(BenchmarkReport &report);
+
+/**
+ * @brief Measures RuntimeEvaluator::Execute for expressions of increasing size.
+ * @param[in, out] report where the results are added.
+ * @return true if all the variants could be executed.
+ */
+bool RuntimeEvaluatorBenchmark(BenchmarkReport &report);
+
+/**
+ * @brief Measures the loopback UDP datagram rate with one Write/Read per datagram and with WriteBatch/ReadBatch.
+ * @param[in, out] report where the results are added.
+ * @return true if all the variants could be executed.
+ */
+bool UDPSocketBenchmark(BenchmarkReport &report);
+
+/**
+ * @brief Measures the cost of a REPORT_ERROR with parameters, for the calling thread and for the Logger consumer,
+ * with the Logger formatting the messages immediately and with deferred formatting.
+ * @param[in, out] report where the results are added.
+ * @return true if all the variants could be executed.
+ */
+bool LoggerBenchmark(BenchmarkReport &report);
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKS_H_ */
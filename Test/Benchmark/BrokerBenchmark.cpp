@@ -0,0 +1,227 @@
+/**
+ * @file BrokerBenchmark.cpp
+ * @brief Broker copy throughput benchmark
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the broker copy throughput benchmark.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BenchmarkGAM.h"
+#include "BenchmarkScheduler.h"
+#include "Benchmarks.h"
+#include "BrokerI.h"
+#include "ConfigurationDatabase.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of signals of each variant.
+ */
+static const uint32 BROKER_BENCHMARK_SIGNALS[] = { 1u, 8u, 64u };
+
+/**
+ * Number of elements (uint32) of each signal of each variant.
+ */
+static const uint32 BROKER_BENCHMARK_ELEMENTS[] = { 1u, 64u, 1024u };
+
+/**
+ * Number of batches and operations per batch.
+ */
+static const uint32 BROKER_BENCHMARK_BATCHES = 100u;
+static const uint32 BROKER_BENCHMARK_OPERATIONS_PER_BATCH = 100u;
+
+/**
+ * @brief Writes a RealTimeApplication where a writer GAM produces \a numberOfSignals signals with
+ * \a numberOfElements elements into a GAMDataSource and a reader GAM consumes them.
+ */
+static bool BrokerBenchmarkConfiguration(const uint32 numberOfSignals,
+                                         const uint32 numberOfElements,
+                                         StreamString &config) {
+    StreamString signals;
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+        ok = signals.Printf("S%u = { Type = uint32 NumberOfDimensions = 1 NumberOfElements = %u } ", i, numberOfElements);
+    }
+    if (ok) {
+        ok = config.Printf("%s", "$BenchmarkApp = { Class = RealTimeApplication "
+                           "+Functions = { Class = ReferenceContainer ");
+    }
+    if (ok) {
+        ok = config.Printf("+Writer = { Class = BenchmarkGAM OutputSignals = { %s } } ", signals.Buffer());
+    }
+    if (ok) {
+        ok = config.Printf("+Reader = { Class = BenchmarkGAM InputSignals = { %s } } } ", signals.Buffer());
+    }
+    if (ok) {
+        ok = config.Printf("%s", "+Data = { Class = ReferenceContainer DefaultDataSource = DDB1 "
+                           "+DDB1 = { Class = GAMDataSource } +Timings = { Class = TimingDataSource } } "
+                           "+States = { Class = ReferenceContainer +State1 = { Class = RealTimeState "
+                           "+Threads = { Class = ReferenceContainer +Thread1 = { Class = RealTimeThread Functions = { Writer Reader } } } } } "
+                           "+Scheduler = { Class = BenchmarkScheduler TimingDataSource = Timings } }");
+    }
+    return ok;
+}
+
+/**
+ * @brief Runs one variant of the broker benchmark.
+ */
+static bool BrokerBenchmarkVariant(BenchmarkReport &report,
+                                   const uint32 numberOfSignals,
+                                   const uint32 numberOfElements) {
+    StreamString variant;
+    (void) variant.Printf("Signals=%u,Elements=%u", numberOfSignals, numberOfElements);
+    StreamString config;
+    bool ok = BrokerBenchmarkConfiguration(numberOfSignals, numberOfElements, config);
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = config.Seek(0LLU);
+    }
+    if (ok) {
+        StandardParser parser(config, cdb);
+        ok = parser.Parse();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("BenchmarkApp");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        //Dominated by the negotiation of the signal properties between the GAMs, the DataSources and the brokers
+        BenchmarkStatistics statistics;
+        statistics.Start();
+        ok = application->ConfigureApplication();
+        statistics.Stop();
+        if (ok) {
+            ok = report.AddResult("ConfigureApplication", variant.Buffer(), statistics);
+        }
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1").ErrorsCleared();
+    }
+    ReferenceT<GAM> writer;
+    ReferenceT<GAM> reader;
+    ReferenceT<GAMSchedulerI> scheduler;
+    if (ok) {
+        writer = god->Find("BenchmarkApp.Functions.Writer");
+        reader = god->Find("BenchmarkApp.Functions.Reader");
+        scheduler = god->Find("BenchmarkApp.Scheduler");
+        ok = ((writer.IsValid()) && (reader.IsValid()) && (scheduler.IsValid()));
+    }
+    ReferenceContainer inputBrokers;
+    ReferenceContainer outputBrokers;
+    if (ok) {
+        ok = reader->GetInputBrokers(inputBrokers);
+    }
+    if (ok) {
+        ok = writer->GetOutputBrokers(outputBrokers);
+    }
+    uint64 bytesPerOperation = static_cast<uint64>(numberOfSignals) * static_cast<uint64>(numberOfElements) * sizeof(uint32);
+    if (ok) {
+        BenchmarkStatistics statistics;
+        uint32 numberOfBrokers = inputBrokers.Size();
+        for (uint32 b = 0u; (b < BROKER_BENCHMARK_BATCHES) && (ok); b++) {
+            statistics.Start();
+            for (uint32 n = 0u; (n < BROKER_BENCHMARK_OPERATIONS_PER_BATCH) && (ok); n++) {
+                for (uint32 i = 0u; (i < numberOfBrokers) && (ok); i++) {
+                    ReferenceT<BrokerI> broker = inputBrokers.Get(i);
+                    ok = broker->Execute();
+                }
+            }
+            statistics.Stop(BROKER_BENCHMARK_OPERATIONS_PER_BATCH);
+        }
+        if (ok) {
+            ok = report.AddResult("InputBrokerCopy", variant.Buffer(), statistics, bytesPerOperation);
+        }
+    }
+    if (ok) {
+        //Writer, output brokers, input brokers, reader: the same sequence that the scheduler builds for the thread
+        uint32 numberOfExecutables = outputBrokers.Size() + inputBrokers.Size() + 2u;
+        ExecutableI **executables = new ExecutableI*[numberOfExecutables];
+        uint64 *timingTicks = new uint64[numberOfExecutables];
+        uint32 e = 0u;
+        executables[e] = writer.operator->();
+        e++;
+        for (uint32 i = 0u; i < outputBrokers.Size(); i++) {
+            ReferenceT<BrokerI> broker = outputBrokers.Get(i);
+            executables[e] = broker.operator->();
+            e++;
+        }
+        for (uint32 i = 0u; i < inputBrokers.Size(); i++) {
+            ReferenceT<BrokerI> broker = inputBrokers.Get(i);
+            executables[e] = broker.operator->();
+            e++;
+        }
+        executables[e] = reader.operator->();
+        BenchmarkStatistics statistics;
+        for (uint32 b = 0u; (b < BROKER_BENCHMARK_BATCHES) && (ok); b++) {
+            statistics.Start();
+            for (uint32 n = 0u; (n < BROKER_BENCHMARK_OPERATIONS_PER_BATCH) && (ok); n++) {
+                ok = scheduler->ExecuteSingleCycle(executables, numberOfExecutables, NULL_PTR(ExecutableStatistics *), timingTicks);
+            }
+            statistics.Stop(BROKER_BENCHMARK_OPERATIONS_PER_BATCH);
+        }
+        if (ok) {
+            ok = report.AddResult("RealTimeCycle", variant.Buffer(), statistics, 2ull * bytesPerOperation);
+        }
+        delete[] executables;
+        delete[] timingTicks;
+    }
+    if (!ok) {
+        (void) report.AddFailure("InputBrokerCopy", variant.Buffer());
+    }
+    god->Purge();
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+bool BrokerBenchmark(BenchmarkReport &report) {
+    bool ok = true;
+    uint32 numberOfSignalVariants = static_cast<uint32>(sizeof(BROKER_BENCHMARK_SIGNALS) / sizeof(uint32));
+    uint32 numberOfElementVariants = static_cast<uint32>(sizeof(BROKER_BENCHMARK_ELEMENTS) / sizeof(uint32));
+    for (uint32 s = 0u; s < numberOfSignalVariants; s++) {
+        for (uint32 e = 0u; e < numberOfElementVariants; e++) {
+            if (!BrokerBenchmarkVariant(report, BROKER_BENCHMARK_SIGNALS[s], BROKER_BENCHMARK_ELEMENTS[e])) {
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,177 @@
+/**
+ * @file ConfigurationBenchmark.cpp
+ * @brief Configuration load benchmark
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the configuration load benchmark.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Benchmarks.h"
+#include "ConfigurationDatabase.h"
+#include "ImmutableConfigurationDatabase.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of nodes of each variant.
+ */
+static const uint32 CONFIGURATION_BENCHMARK_NODES[] = { 10u, 100u, 1000u };
+
+/**
+ * Number of parses (one per batch).
+ */
+static const uint32 CONFIGURATION_BENCHMARK_PARSES = 5u;
+
+/**
+ * Number of batches and reads per batch.
+ */
+static const uint32 CONFIGURATION_BENCHMARK_READ_BATCHES = 20u;
+static const uint32 CONFIGURATION_BENCHMARK_READS_PER_BATCH = 100u;
+
+/**
+ * @brief Times MoveAbsolute + Read of the last node of \a database.
+ */
+static bool ConfigurationBenchmarkRead(StructuredDataI &database,
+                                       const uint32 numberOfNodes,
+                                       BenchmarkStatistics &readStatistics) {
+    StreamString lastNode;
+    bool ok = lastNode.Printf("+Node%u", (numberOfNodes - 1u));
+    for (uint32 b = 0u; (b < CONFIGURATION_BENCHMARK_READ_BATCHES) && (ok); b++) {
+        readStatistics.Start();
+        for (uint32 n = 0u; (n < CONFIGURATION_BENCHMARK_READS_PER_BATCH) && (ok); n++) {
+            uint32 value = 0u;
+            ok = database.MoveAbsolute(lastNode.Buffer());
+            if (ok) {
+                ok = database.Read("Value", value);
+            }
+            if (ok) {
+                ok = (value == (numberOfNodes - 1u));
+            }
+        }
+        readStatistics.Stop(CONFIGURATION_BENCHMARK_READS_PER_BATCH);
+    }
+    return ok;
+}
+
+/**
+ * @brief Runs one variant of the configuration benchmark.
+ */
+static bool ConfigurationBenchmarkVariant(BenchmarkReport &report,
+                                          const uint32 numberOfNodes) {
+    StreamString config;
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfNodes) && (ok); i++) {
+        ok = config.Printf("+Node%u = {\n    Class = ReferenceContainer\n    Value = %u\n    Gain = 1.5\n"
+                           "    Vector = { 1 2 3 4 5 6 7 8 }\n    Description = \"A benchmark node\"\n}\n", i, i);
+    }
+    StreamString variant;
+    (void) variant.Printf("Nodes=%u", numberOfNodes);
+    BenchmarkStatistics parseStatistics;
+    for (uint32 b = 0u; (b < CONFIGURATION_BENCHMARK_PARSES) && (ok); b++) {
+        ConfigurationDatabase cdb;
+        ok = config.Seek(0LLU);
+        if (ok) {
+            StandardParser parser(config, cdb);
+            parseStatistics.Start();
+            ok = parser.Parse();
+            parseStatistics.Stop();
+        }
+    }
+    if (ok) {
+        ok = report.AddResult("StandardParserLoad", variant.Buffer(), parseStatistics, config.Size());
+    }
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = config.Seek(0LLU);
+    }
+    if (ok) {
+        StandardParser parser(config, cdb);
+        ok = parser.Parse();
+    }
+    BenchmarkStatistics readStatistics;
+    if (ok) {
+        ok = ConfigurationBenchmarkRead(cdb, numberOfNodes, readStatistics);
+    }
+    if (ok) {
+        ok = report.AddResult("ConfigurationDatabaseMoveAndRead", variant.Buffer(), readStatistics);
+    }
+    BenchmarkStatistics immutableParseStatistics;
+    for (uint32 b = 0u; (b < CONFIGURATION_BENCHMARK_PARSES) && (ok); b++) {
+        ImmutableConfigurationDatabase icdb;
+        ok = config.Seek(0LLU);
+        if (ok) {
+            StandardParser parser(config, icdb);
+            immutableParseStatistics.Start();
+            ok = parser.Parse();
+            icdb.Freeze();
+            immutableParseStatistics.Stop();
+        }
+    }
+    if (ok) {
+        ok = report.AddResult("ImmutableStandardParserLoad", variant.Buffer(), immutableParseStatistics, config.Size());
+    }
+    ImmutableConfigurationDatabase icdb;
+    if (ok) {
+        ok = config.Seek(0LLU);
+    }
+    if (ok) {
+        StandardParser parser(config, icdb);
+        ok = parser.Parse();
+        icdb.Freeze();
+    }
+    BenchmarkStatistics immutableReadStatistics;
+    if (ok) {
+        ok = ConfigurationBenchmarkRead(icdb, numberOfNodes, immutableReadStatistics);
+    }
+    if (ok) {
+        ok = report.AddResult("ImmutableConfigurationDatabaseMoveAndRead", variant.Buffer(), immutableReadStatistics);
+    }
+    if (!ok) {
+        (void) report.AddFailure("StandardParserLoad", variant.Buffer());
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+bool ConfigurationBenchmark(BenchmarkReport &report) {
+    bool ok = true;
+    uint32 numberOfVariants = static_cast<uint32>(sizeof(CONFIGURATION_BENCHMARK_NODES) / sizeof(uint32));
+    for (uint32 v = 0u; v < numberOfVariants; v++) {
+        if (!ConfigurationBenchmarkVariant(report, CONFIGURATION_BENCHMARK_NODES[v])) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,122 @@
+/**
+ * @file LoggerBenchmark.cpp
+ * @brief REPORT_ERROR cost benchmark with immediate and deferred formatting
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details Measures the time spent by the thread calling REPORT_ERROR (i.e. the
+ * real-time thread) with the Logger formatting the message immediately and with
+ * the formatting deferred to the consumer of the Logger pages.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Benchmarks.h"
+#include "Logger.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of batches and messages per batch. The messages per batch must fit in the Logger pages.
+ */
+static const uint32 LOGGER_BENCHMARK_BATCHES = 200u;
+static const uint32 LOGGER_BENCHMARK_MESSAGES_PER_BATCH = 64u;
+
+/**
+ * @brief Returns all the pending pages to the Logger.
+ * @return the number of pages returned.
+ */
+static uint32 LoggerBenchmarkDrain(Logger * const logger) {
+    uint32 n = 0u;
+    LoggerPage *page = logger->GetLogEntry();
+    while (page != NULL_PTR(LoggerPage *)) {
+        logger->ReturnPage(page);
+        n++;
+        page = logger->GetLogEntry();
+    }
+    return n;
+}
+
+static bool LoggerBenchmarkRun(BenchmarkReport &report,
+                               const bool deferred,
+                               const char8 * const variant) {
+    Logger *logger = Logger::Instance();
+    bool ok = (logger != NULL_PTR(Logger *));
+    if (ok) {
+        logger->SetDeferredFormatting(deferred);
+        (void) LoggerBenchmarkDrain(logger);
+    }
+    BenchmarkStatistics producer;
+    BenchmarkStatistics consumer;
+    const char8 * const name = "LoggerBenchmark";
+    float64 value = 3.14159;
+    for (uint32 b = 0u; (b < LOGGER_BENCHMARK_BATCHES) && (ok); b++) {
+        producer.Start();
+        for (uint32 n = 0u; n < LOGGER_BENCHMARK_MESSAGES_PER_BATCH; n++) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Cycle %u of %s: value = %f, counter = %d", b, name, value, n);
+        }
+        producer.Stop(LOGGER_BENCHMARK_MESSAGES_PER_BATCH);
+        consumer.Start();
+        uint32 drained = LoggerBenchmarkDrain(logger);
+        consumer.Stop(LOGGER_BENCHMARK_MESSAGES_PER_BATCH);
+        ok = (drained == LOGGER_BENCHMARK_MESSAGES_PER_BATCH);
+    }
+    if (logger != NULL_PTR(Logger *)) {
+        logger->SetDeferredFormatting(false);
+    }
+    StreamString producerVariant;
+    StreamString consumerVariant;
+    (void) producerVariant.Printf("%s,Side=Producer", variant);
+    (void) consumerVariant.Printf("%s,Side=Consumer", variant);
+    if (ok) {
+        ok = report.AddResult("LoggerReportError", producerVariant.Buffer(), producer);
+    }
+    if (ok) {
+        ok = report.AddResult("LoggerReportError", consumerVariant.Buffer(), consumer);
+    }
+    else {
+        (void) report.AddFailure("LoggerReportError", variant);
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+bool LoggerBenchmark(BenchmarkReport &report) {
+    //The Logger registers itself as the error process function: restore the benchmark one at the end
+    ErrorManagement::ErrorProcessFunctionType errorProcessFunction = ErrorManagement::errorMessageProcessFunction;
+    bool ok = LoggerBenchmarkRun(report, false, "Formatting=Immediate");
+    if (!LoggerBenchmarkRun(report, true, "Formatting=Deferred")) {
+        ok = false;
+    }
+    ErrorManagement::SetErrorProcessFunction(errorProcessFunction);
+    return ok;
+}
+
+}
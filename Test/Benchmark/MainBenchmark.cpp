@@ -0,0 +1,83 @@
+/**
+ * @file MainBenchmark.cpp
+ * @brief Entry point of the MARTe2 benchmark suite
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the entry point of the MARTe2 benchmark suite.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Benchmarks.h"
+#include "ErrorManagement.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Prints the errors to the standard error so that the standard output only contains the JSON document.
+ */
+static void MainBenchmarkErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
+                                              const char * const errorDescription) {
+    MARTe::StreamString errorCodeStr;
+    MARTe::ErrorManagement::ErrorCodeToStream(errorInfo.header.errorType, errorCodeStr);
+    fprintf(stderr, "[%s - %s:%d]: %s\n", errorCodeStr.Buffer(), errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
+}
+
+/**
+ * The benchmarks to be executed, in order.
+ */
+typedef bool (*BenchmarkFunctionType)(MARTe::BenchmarkReport &report);
+static const BenchmarkFunctionType MAIN_BENCHMARK_FUNCTIONS[] = {
+        &MARTe::BrokerBenchmark,
+        &MARTe::SchedulerBenchmark,
+        &MARTe::SemaphoreBenchmark,
+        &MARTe::RegistryBenchmark,
+        &MARTe::ConfigurationBenchmark,
+        &MARTe::TypeConvertBenchmark,
+        &MARTe::RuntimeEvaluatorBenchmark,
+        &MARTe::UDPSocketBenchmark,
+        &MARTe::LoggerBenchmark };
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+int main(int argc, char **argv) {
+    using namespace MARTe;
+    SetErrorProcessFunction(&MainBenchmarkErrorProcessFunction);
+
+    BenchmarkReport report;
+    uint32 numberOfBenchmarks = static_cast<uint32>(sizeof(MAIN_BENCHMARK_FUNCTIONS) / sizeof(BenchmarkFunctionType));
+    for (uint32 i = 0u; i < numberOfBenchmarks; i++) {
+        //Failures are recorded in the report
+        (void) MAIN_BENCHMARK_FUNCTIONS[i](report);
+    }
+    StreamString json;
+    bool ok = report.ToJson(json);
+    if (ok) {
+        printf("%s", json.Buffer());
+        ok = (report.GetNumberOfFailures() == 0u);
+    }
+    return (ok ? 0 : -1);
+}
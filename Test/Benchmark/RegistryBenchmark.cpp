@@ -0,0 +1,152 @@
+/**
+ * @file RegistryBenchmark.cpp
+ * @brief Object registry lookup benchmark
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the object registry lookup benchmark.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Benchmarks.h"
+#include "GlobalObjectsDatabase.h"
+#include "ObjectRegistryDatabase.h"
+#include "ReferenceContainer.h"
+#include "ReferenceT.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of children of each variant.
+ */
+static const uint32 REGISTRY_BENCHMARK_CHILDREN[] = { 16u, 256u, 4096u };
+
+/**
+ * Number of batches and lookups per batch.
+ */
+static const uint32 REGISTRY_BENCHMARK_BATCHES = 10u;
+static const uint32 REGISTRY_BENCHMARK_FINDS_PER_BATCH = 2u;
+
+/**
+ * @brief Times \a container.Find(\a path) and adds the result to the report.
+ * @details Templated so that ObjectRegistryDatabase::Find (which hides ReferenceContainer::Find) is the one timed.
+ */
+template<typename ContainerType>
+static bool RegistryBenchmarkFind(BenchmarkReport &report,
+                                  const char8 * const name,
+                                  const char8 * const variant,
+                                  ContainerType &container,
+                                  const char8 * const path,
+                                  const bool expectFound) {
+    bool ok = true;
+    BenchmarkStatistics statistics;
+    for (uint32 b = 0u; (b < REGISTRY_BENCHMARK_BATCHES) && (ok); b++) {
+        statistics.Start();
+        for (uint32 n = 0u; (n < REGISTRY_BENCHMARK_FINDS_PER_BATCH) && (ok); n++) {
+            Reference found = container.Find(path);
+            ok = (found.IsValid() == expectFound);
+        }
+        statistics.Stop(REGISTRY_BENCHMARK_FINDS_PER_BATCH);
+    }
+    if (ok) {
+        ok = report.AddResult(name, variant, statistics);
+    }
+    else {
+        (void) report.AddFailure(name, variant);
+    }
+    return ok;
+}
+
+/**
+ * @brief Runs all the lookups for a container with \a numberOfChildren children.
+ * @details The children are inserted in BenchmarkRoot.Level1.Level2 of the ObjectRegistryDatabase, so that the
+ * same objects are looked up both directly in their container and with an absolute path from the root.
+ */
+static bool RegistryBenchmarkVariant(BenchmarkReport &report,
+                                     const uint32 numberOfChildren) {
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    HeapI *heap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+    ReferenceT<ReferenceContainer> root(heap);
+    ReferenceT<ReferenceContainer> level1(heap);
+    ReferenceT<ReferenceContainer> level2(heap);
+    bool ok = ((root.IsValid()) && (level1.IsValid()) && (level2.IsValid()));
+    if (ok) {
+        root->SetName("BenchmarkRoot");
+        level1->SetName("Level1");
+        level2->SetName("Level2");
+        ok = root->Insert(level1);
+    }
+    if (ok) {
+        ok = level1->Insert(level2);
+    }
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        ReferenceT<ReferenceContainer> child(heap);
+        StreamString childName;
+        ok = childName.Printf("Child%u", i);
+        if (ok) {
+            child->SetName(childName.Buffer());
+            ok = level2->Insert(child);
+        }
+    }
+    if (ok) {
+        ok = god->Insert(root);
+    }
+    StreamString variant;
+    (void) variant.Printf("Children=%u", numberOfChildren);
+    StreamString lastChild;
+    (void) lastChild.Printf("Child%u", (numberOfChildren - 1u));
+    StreamString lastChildPath;
+    (void) lastChildPath.Printf("BenchmarkRoot.Level1.Level2.Child%u", (numberOfChildren - 1u));
+    if (ok) {
+        ok = RegistryBenchmarkFind(report, "ReferenceContainerFind", variant.Buffer(), *(level2.operator->()), lastChild.Buffer(), true);
+    }
+    if (ok) {
+        ok = RegistryBenchmarkFind(report, "ReferenceContainerFindMiss", variant.Buffer(), *(level2.operator->()), "NotAChild", false);
+    }
+    if (ok) {
+        ok = RegistryBenchmarkFind(report, "ObjectRegistryDatabaseFind", variant.Buffer(), *god, lastChildPath.Buffer(), true);
+    }
+    (void) god->Delete(root);
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+bool RegistryBenchmark(BenchmarkReport &report) {
+    bool ok = true;
+    uint32 numberOfVariants = static_cast<uint32>(sizeof(REGISTRY_BENCHMARK_CHILDREN) / sizeof(uint32));
+    for (uint32 v = 0u; v < numberOfVariants; v++) {
+        if (!RegistryBenchmarkVariant(report, REGISTRY_BENCHMARK_CHILDREN[v])) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,135 @@
+/**
+ * @file RuntimeEvaluatorBenchmark.cpp
+ * @brief RuntimeEvaluator execution benchmark
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the runtimeevaluator execution benchmark.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Benchmarks.h"
+#include "MathExpressionParser.h"
+#include "RuntimeEvaluator.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Expressions of increasing size. All the variables are float64.
+ */
+static const char8 * const RUNTIME_EVALUATOR_BENCHMARK_EXPRESSIONS[] = {
+        "y = a * x + b;",
+        "y = a * x * x + b * x + c; z = sin(x) + cos(x) * y;",
+        "e = r - x; p = kp * e; i = ki * (e + ie) * dt; d = kd * (e - ep) / dt; u = p + i + d; w = g * u + o;" };
+
+/**
+ * Number of batches and executions per batch.
+ */
+static const uint32 RUNTIME_EVALUATOR_BENCHMARK_BATCHES = 50u;
+static const uint32 RUNTIME_EVALUATOR_BENCHMARK_EXECUTIONS_PER_BATCH = 200u;
+
+/**
+ * @brief Compiles \a expression (all variables as float64) and times its execution.
+ */
+static bool RuntimeEvaluatorBenchmarkVariant(BenchmarkReport &report,
+                                             const char8 * const expression,
+                                             const uint32 variantIdx) {
+    StreamString variant;
+    (void) variant.Printf("Expression=%u", variantIdx);
+    StreamString expressionStr = expression;
+    bool ok = expressionStr.Seek(0LLU);
+    StreamString rpnCode;
+    if (ok) {
+        MathExpressionParser parser(expressionStr);
+        ok = parser.Parse();
+        if (ok) {
+            rpnCode = parser.GetStackMachineExpression();
+        }
+    }
+    RuntimeEvaluator *evaluator = NULL_PTR(RuntimeEvaluator *);
+    if (ok) {
+        evaluator = new RuntimeEvaluator(rpnCode);
+        ok = evaluator->ExtractVariables().ErrorsCleared();
+    }
+    if (ok) {
+        VariableInformation *variable = NULL_PTR(VariableInformation *);
+        for (uint32 i = 0u; (ok) && (evaluator->BrowseInputVariable(i, variable).ErrorsCleared()); i++) {
+            ok = evaluator->SetInputVariableType(i, Float64Bit);
+        }
+        for (uint32 i = 0u; (ok) && (evaluator->BrowseOutputVariable(i, variable).ErrorsCleared()); i++) {
+            ok = evaluator->SetOutputVariableType(i, Float64Bit);
+        }
+    }
+    if (ok) {
+        ok = evaluator->Compile().ErrorsCleared();
+    }
+    if (ok) {
+        //Non-zero inputs so that no division by zero is timed
+        VariableInformation *variable = NULL_PTR(VariableInformation *);
+        for (uint32 i = 0u; evaluator->BrowseInputVariable(i, variable).ErrorsCleared(); i++) {
+            float64 *value = static_cast<float64 *>(evaluator->GetInputVariableMemory(i));
+            if (value != NULL_PTR(float64 *)) {
+                *value = 1.0 + static_cast<float64>(i);
+            }
+        }
+    }
+    BenchmarkStatistics statistics;
+    for (uint32 b = 0u; (b < RUNTIME_EVALUATOR_BENCHMARK_BATCHES) && (ok); b++) {
+        statistics.Start();
+        for (uint32 n = 0u; (n < RUNTIME_EVALUATOR_BENCHMARK_EXECUTIONS_PER_BATCH) && (ok); n++) {
+            ok = evaluator->Execute().ErrorsCleared();
+        }
+        statistics.Stop(RUNTIME_EVALUATOR_BENCHMARK_EXECUTIONS_PER_BATCH);
+    }
+    if (ok) {
+        ok = report.AddResult("RuntimeEvaluatorExecute", variant.Buffer(), statistics);
+    }
+    else {
+        (void) report.AddFailure("RuntimeEvaluatorExecute", variant.Buffer());
+    }
+    if (evaluator != NULL_PTR(RuntimeEvaluator *)) {
+        delete evaluator;
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+bool RuntimeEvaluatorBenchmark(BenchmarkReport &report) {
+    bool ok = true;
+    uint32 numberOfVariants = static_cast<uint32>(sizeof(RUNTIME_EVALUATOR_BENCHMARK_EXPRESSIONS) / sizeof(const char8 *));
+    for (uint32 v = 0u; v < numberOfVariants; v++) {
+        if (!RuntimeEvaluatorBenchmarkVariant(report, RUNTIME_EVALUATOR_BENCHMARK_EXPRESSIONS[v], v)) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,128 @@
+/**
+ * @file SchedulerBenchmark.cpp
+ * @brief Scheduler cycle overhead benchmark
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the scheduler cycle overhead benchmark.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BenchmarkScheduler.h"
+#include "Benchmarks.h"
+#include "ExecutableI.h"
+#include "ExecutableStatistics.h"
+#include "GlobalObjectsDatabase.h"
+#include "ReferenceT.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of executables of each variant.
+ */
+static const uint32 SCHEDULER_BENCHMARK_EXECUTABLES[] = { 1u, 16u, 256u };
+
+/**
+ * Number of batches and cycles per batch.
+ */
+static const uint32 SCHEDULER_BENCHMARK_BATCHES = 100u;
+static const uint32 SCHEDULER_BENCHMARK_CYCLES_PER_BATCH = 100u;
+
+/**
+ * @brief ExecutableI which does nothing, so that only the scheduler bookkeeping is measured.
+ */
+class SchedulerBenchmarkExecutable: public ExecutableI {
+public:
+    SchedulerBenchmarkExecutable() :
+            ExecutableI() {
+    }
+
+    virtual ~SchedulerBenchmarkExecutable() {
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+bool SchedulerBenchmark(BenchmarkReport &report) {
+    bool ok = true;
+    ReferenceT<BenchmarkScheduler> scheduler(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    uint32 numberOfVariants = static_cast<uint32>(sizeof(SCHEDULER_BENCHMARK_EXECUTABLES) / sizeof(uint32));
+    for (uint32 v = 0u; v < numberOfVariants; v++) {
+        uint32 numberOfExecutables = SCHEDULER_BENCHMARK_EXECUTABLES[v];
+        SchedulerBenchmarkExecutable *executableObjects = new SchedulerBenchmarkExecutable[numberOfExecutables];
+        ExecutableI **executables = new ExecutableI*[numberOfExecutables];
+        uint64 *timingTicks = new uint64[numberOfExecutables];
+        void *statisticsMemory = NULL_PTR(void *);
+        ExecutableStatistics *statistics = ExecutableStatistics::Allocate(numberOfExecutables, statisticsMemory);
+        for (uint32 i = 0u; i < numberOfExecutables; i++) {
+            executables[i] = &executableObjects[i];
+        }
+        StreamString variant;
+        (void) variant.Printf("Executables=%u", numberOfExecutables);
+        bool variantOk = true;
+        BenchmarkStatistics plain;
+        for (uint32 b = 0u; (b < SCHEDULER_BENCHMARK_BATCHES) && (variantOk); b++) {
+            plain.Start();
+            for (uint32 n = 0u; (n < SCHEDULER_BENCHMARK_CYCLES_PER_BATCH) && (variantOk); n++) {
+                variantOk = scheduler->ExecuteSingleCycle(executables, numberOfExecutables, NULL_PTR(ExecutableStatistics *), timingTicks);
+            }
+            plain.Stop(SCHEDULER_BENCHMARK_CYCLES_PER_BATCH * numberOfExecutables);
+        }
+        if (variantOk) {
+            variantOk = report.AddResult("ExecuteSingleCyclePerExecutable", variant.Buffer(), plain);
+        }
+        //Same, also collecting the per-executable statistics (CollectStatistics = 1)
+        BenchmarkStatistics collecting;
+        for (uint32 b = 0u; (b < SCHEDULER_BENCHMARK_BATCHES) && (variantOk); b++) {
+            collecting.Start();
+            for (uint32 n = 0u; (n < SCHEDULER_BENCHMARK_CYCLES_PER_BATCH) && (variantOk); n++) {
+                variantOk = scheduler->ExecuteSingleCycle(executables, numberOfExecutables, statistics, timingTicks);
+            }
+            collecting.Stop(SCHEDULER_BENCHMARK_CYCLES_PER_BATCH * numberOfExecutables);
+        }
+        if (variantOk) {
+            variantOk = report.AddResult("ExecuteSingleCyclePerExecutableWithStatistics", variant.Buffer(), collecting);
+        }
+        if (!variantOk) {
+            (void) report.AddFailure("ExecuteSingleCyclePerExecutable", variant.Buffer());
+            ok = false;
+        }
+        ExecutableStatistics::Free(statisticsMemory);
+        delete[] timingTicks;
+        delete[] executables;
+        delete[] executableObjects;
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,232 @@
+/**
+ * @file SemaphoreBenchmark.cpp
+ * @brief Semaphore lock and handoff latency benchmark
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the semaphore lock and handoff latency benchmark.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Benchmarks.h"
+#include "EventSem.h"
+#include "FastAdaptiveMutexSem.h"
+#include "FastPollingMutexSem.h"
+#include "Sleep.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of batches and operations per batch for the uncontended lock/unlock.
+ */
+static const uint32 SEMAPHORE_BENCHMARK_LOCK_BATCHES = 100u;
+static const uint32 SEMAPHORE_BENCHMARK_LOCKS_PER_BATCH = 1000u;
+
+/**
+ * Number of batches and round trips per batch for the handoff.
+ */
+static const uint32 SEMAPHORE_BENCHMARK_HANDOFF_BATCHES = 10u;
+static const uint32 SEMAPHORE_BENCHMARK_ROUND_TRIPS_PER_BATCH = 100u;
+
+/**
+ * Maximum time to wait for the ponger thread to terminate.
+ */
+static const uint32 SEMAPHORE_BENCHMARK_JOIN_TIMEOUT_MSEC = 5000u;
+
+/**
+ * @brief State shared between the benchmark thread (ping) and the ponger thread.
+ * @details The fast mutexes are used as binary semaphores (both start locked): FastUnLock signals and FastLock waits.
+ */
+template<typename MutexType>
+struct SemaphoreBenchmarkHandoff {
+    MutexType ping;
+    MutexType pong;
+    uint32 numberOfRoundTrips;
+    volatile int32 done;
+};
+
+template<typename MutexType>
+static void SemaphoreBenchmarkMutexPonger(const void * const parameters) {
+    SemaphoreBenchmarkHandoff<MutexType> *handoff = static_cast<SemaphoreBenchmarkHandoff<MutexType> *>(const_cast<void *>(parameters));
+    for (uint32 i = 0u; i < handoff->numberOfRoundTrips; i++) {
+        (void) handoff->ping.FastLock();
+        handoff->pong.FastUnLock();
+    }
+    handoff->done = 1;
+}
+
+/**
+ * @brief State shared between the benchmark thread (ping) and the EventSem ponger thread.
+ */
+struct SemaphoreBenchmarkEventHandoff {
+    EventSem ping;
+    EventSem pong;
+    uint32 numberOfRoundTrips;
+    volatile int32 done;
+};
+
+static void SemaphoreBenchmarkEventPonger(const void * const parameters) {
+    SemaphoreBenchmarkEventHandoff *handoff = static_cast<SemaphoreBenchmarkEventHandoff *>(const_cast<void *>(parameters));
+    for (uint32 i = 0u; i < handoff->numberOfRoundTrips; i++) {
+        (void) handoff->ping.Wait();
+        (void) handoff->ping.Reset();
+        (void) handoff->pong.Post();
+    }
+    handoff->done = 1;
+}
+
+/**
+ * @brief Waits for the ponger to set \a done.
+ */
+static bool SemaphoreBenchmarkJoin(volatile int32 &done) {
+    uint32 waited = 0u;
+    while ((done == 0) && (waited < SEMAPHORE_BENCHMARK_JOIN_TIMEOUT_MSEC)) {
+        Sleep::MSec(1);
+        waited++;
+    }
+    return (done != 0);
+}
+
+template<typename MutexType>
+static bool SemaphoreBenchmarkUncontended(BenchmarkReport &report,
+                                          const char8 * const name) {
+    MutexType mutex;
+    mutex.Create();
+    BenchmarkStatistics statistics;
+    bool ok = true;
+    for (uint32 b = 0u; (b < SEMAPHORE_BENCHMARK_LOCK_BATCHES) && (ok); b++) {
+        statistics.Start();
+        for (uint32 n = 0u; (n < SEMAPHORE_BENCHMARK_LOCKS_PER_BATCH) && (ok); n++) {
+            ok = (mutex.FastLock() == ErrorManagement::NoError);
+            mutex.FastUnLock();
+        }
+        statistics.Stop(SEMAPHORE_BENCHMARK_LOCKS_PER_BATCH);
+    }
+    if (ok) {
+        ok = report.AddResult(name, "Uncontended", statistics);
+    }
+    else {
+        (void) report.AddFailure(name, "Uncontended");
+    }
+    return ok;
+}
+
+template<typename MutexType>
+static bool SemaphoreBenchmarkMutexHandoff(BenchmarkReport &report,
+                                           const char8 * const name) {
+    SemaphoreBenchmarkHandoff<MutexType> handoff;
+    handoff.ping.Create(true);
+    handoff.pong.Create(true);
+    handoff.numberOfRoundTrips = SEMAPHORE_BENCHMARK_HANDOFF_BATCHES * SEMAPHORE_BENCHMARK_ROUND_TRIPS_PER_BATCH;
+    handoff.done = 0;
+    bool ok = (Threads::BeginThread(&SemaphoreBenchmarkMutexPonger<MutexType>, &handoff) != InvalidThreadIdentifier);
+    BenchmarkStatistics statistics;
+    for (uint32 b = 0u; (b < SEMAPHORE_BENCHMARK_HANDOFF_BATCHES) && (ok); b++) {
+        statistics.Start();
+        for (uint32 n = 0u; n < SEMAPHORE_BENCHMARK_ROUND_TRIPS_PER_BATCH; n++) {
+            handoff.ping.FastUnLock();
+            (void) handoff.pong.FastLock();
+        }
+        //Two handoffs per round trip
+        statistics.Stop(2u * SEMAPHORE_BENCHMARK_ROUND_TRIPS_PER_BATCH);
+    }
+    if (ok) {
+        ok = SemaphoreBenchmarkJoin(handoff.done);
+    }
+    if (ok) {
+        ok = report.AddResult(name, "Handoff", statistics);
+    }
+    else {
+        (void) report.AddFailure(name, "Handoff");
+    }
+    return ok;
+}
+
+static bool SemaphoreBenchmarkEventHandoffRun(BenchmarkReport &report) {
+    SemaphoreBenchmarkEventHandoff handoff;
+    bool ok = handoff.ping.Create();
+    if (ok) {
+        ok = handoff.pong.Create();
+    }
+    if (ok) {
+        ok = handoff.ping.Reset();
+    }
+    if (ok) {
+        ok = handoff.pong.Reset();
+    }
+    handoff.numberOfRoundTrips = SEMAPHORE_BENCHMARK_HANDOFF_BATCHES * SEMAPHORE_BENCHMARK_ROUND_TRIPS_PER_BATCH;
+    handoff.done = 0;
+    if (ok) {
+        ok = (Threads::BeginThread(&SemaphoreBenchmarkEventPonger, &handoff) != InvalidThreadIdentifier);
+    }
+    BenchmarkStatistics statistics;
+    for (uint32 b = 0u; (b < SEMAPHORE_BENCHMARK_HANDOFF_BATCHES) && (ok); b++) {
+        statistics.Start();
+        for (uint32 n = 0u; n < SEMAPHORE_BENCHMARK_ROUND_TRIPS_PER_BATCH; n++) {
+            (void) handoff.ping.Post();
+            (void) handoff.pong.Wait();
+            (void) handoff.pong.Reset();
+        }
+        statistics.Stop(2u * SEMAPHORE_BENCHMARK_ROUND_TRIPS_PER_BATCH);
+    }
+    if (ok) {
+        ok = SemaphoreBenchmarkJoin(handoff.done);
+    }
+    if (ok) {
+        ok = report.AddResult("EventSem", "Handoff", statistics);
+    }
+    else {
+        (void) report.AddFailure("EventSem", "Handoff");
+    }
+    (void) handoff.ping.Close();
+    (void) handoff.pong.Close();
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+bool SemaphoreBenchmark(BenchmarkReport &report) {
+    bool ok = SemaphoreBenchmarkUncontended<FastPollingMutexSem>(report, "FastPollingMutexSem");
+    if (!SemaphoreBenchmarkUncontended<FastAdaptiveMutexSem>(report, "FastAdaptiveMutexSem")) {
+        ok = false;
+    }
+    if (!SemaphoreBenchmarkMutexHandoff<FastPollingMutexSem>(report, "FastPollingMutexSem")) {
+        ok = false;
+    }
+    if (!SemaphoreBenchmarkMutexHandoff<FastAdaptiveMutexSem>(report, "FastAdaptiveMutexSem")) {
+        ok = false;
+    }
+    if (!SemaphoreBenchmarkEventHandoffRun(report)) {
+        ok = false;
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,119 @@
+/**
+ * @file TypeConvertBenchmark.cpp
+ * @brief Type conversion benchmark
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the type conversion benchmark.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Benchmarks.h"
+#include "StreamString.h"
+#include "TypeConversion.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of batches and conversions per batch.
+ */
+static const uint32 TYPE_CONVERT_BENCHMARK_BATCHES = 50u;
+static const uint32 TYPE_CONVERT_BENCHMARK_CONVERSIONS_PER_BATCH = 200u;
+
+/**
+ * Number of elements of the vector conversion.
+ */
+static const uint32 TYPE_CONVERT_BENCHMARK_VECTOR_ELEMENTS = 1024u;
+
+/**
+ * @brief Times TypeConvert(\a destination, \a source) and adds the result to the report.
+ */
+static bool TypeConvertBenchmarkRun(BenchmarkReport &report,
+                                    const char8 * const variant,
+                                    const AnyType &destination,
+                                    const AnyType &source,
+                                    const uint64 bytesPerOperation) {
+    bool ok = true;
+    BenchmarkStatistics statistics;
+    for (uint32 b = 0u; (b < TYPE_CONVERT_BENCHMARK_BATCHES) && (ok); b++) {
+        statistics.Start();
+        for (uint32 n = 0u; (n < TYPE_CONVERT_BENCHMARK_CONVERSIONS_PER_BATCH) && (ok); n++) {
+            ok = TypeConvert(destination, source);
+        }
+        statistics.Stop(TYPE_CONVERT_BENCHMARK_CONVERSIONS_PER_BATCH);
+    }
+    if (ok) {
+        ok = report.AddResult("TypeConvert", variant, statistics, bytesPerOperation);
+    }
+    else {
+        (void) report.AddFailure("TypeConvert", variant);
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+bool TypeConvertBenchmark(BenchmarkReport &report) {
+    uint32 sourceUInt32 = 123456u;
+    float64 destinationFloat64 = 0.0;
+    bool ok = TypeConvertBenchmarkRun(report, "uint32->float64", destinationFloat64, sourceUInt32, sizeof(uint32));
+
+    float32 sourceFloat32 = 3.1415926F;
+    int32 destinationInt32 = 0;
+    if (!TypeConvertBenchmarkRun(report, "float32->int32", destinationInt32, sourceFloat32, sizeof(float32))) {
+        ok = false;
+    }
+
+    uint16 sourceVector[TYPE_CONVERT_BENCHMARK_VECTOR_ELEMENTS];
+    float32 destinationVector[TYPE_CONVERT_BENCHMARK_VECTOR_ELEMENTS];
+    for (uint32 i = 0u; i < TYPE_CONVERT_BENCHMARK_VECTOR_ELEMENTS; i++) {
+        sourceVector[i] = static_cast<uint16>(i);
+        destinationVector[i] = 0.F;
+    }
+    Vector<uint16> sourceVectorT(&sourceVector[0], TYPE_CONVERT_BENCHMARK_VECTOR_ELEMENTS);
+    Vector<float32> destinationVectorT(&destinationVector[0], TYPE_CONVERT_BENCHMARK_VECTOR_ELEMENTS);
+    if (!TypeConvertBenchmarkRun(report, "uint16[1024]->float32[1024]", destinationVectorT, sourceVectorT, sizeof(sourceVector))) {
+        ok = false;
+    }
+
+    float64 sourceFloat64 = 2.718281828459045;
+    StreamString destinationString;
+    if (!TypeConvertBenchmarkRun(report, "float64->string", destinationString, sourceFloat64, sizeof(float64))) {
+        ok = false;
+    }
+
+    const char8 * const sourceString = "-1234567";
+    if (!TypeConvertBenchmarkRun(report, "string->int32", destinationInt32, sourceString, 8u)) {
+        ok = false;
+    }
+    return ok;
+}
+
+}
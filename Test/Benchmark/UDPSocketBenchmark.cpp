@@ -0,0 +1,168 @@
+/**
+ * @file UDPSocketBenchmark.cpp
+ * @brief UDP datagram throughput benchmark
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the UDP datagram throughput benchmark.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BasicUDPSocket.h"
+#include "Benchmarks.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of batches. Each batch sends and then receives UDP_SOCKET_BENCHMARK_DATAGRAMS datagrams.
+ */
+static const uint32 UDP_SOCKET_BENCHMARK_BATCHES = 200u;
+
+/**
+ * Datagrams per batch (small enough to always fit in the default socket receive buffer).
+ */
+static const uint32 UDP_SOCKET_BENCHMARK_DATAGRAMS = 32u;
+
+/**
+ * Size of each datagram.
+ */
+static const uint32 UDP_SOCKET_BENCHMARK_DATAGRAM_SIZE = 256u;
+
+/**
+ * Loopback port used by the benchmark.
+ */
+static const uint16 UDP_SOCKET_BENCHMARK_PORT = 44490u;
+
+/**
+ * @brief Sends and receives one batch with one Write/Read per datagram.
+ */
+static bool UDPSocketBenchmarkSingle(BasicUDPSocket &client,
+                                     BasicUDPSocket &server,
+                                     char8 * const * const buffers) {
+    bool ok = true;
+    for (uint32 i = 0u; (i < UDP_SOCKET_BENCHMARK_DATAGRAMS) && (ok); i++) {
+        uint32 size = UDP_SOCKET_BENCHMARK_DATAGRAM_SIZE;
+        ok = client.Write(buffers[i], size);
+    }
+    for (uint32 i = 0u; (i < UDP_SOCKET_BENCHMARK_DATAGRAMS) && (ok); i++) {
+        uint32 size = UDP_SOCKET_BENCHMARK_DATAGRAM_SIZE;
+        ok = server.Read(buffers[i], size);
+    }
+    return ok;
+}
+
+/**
+ * @brief Sends and receives one batch with WriteBatch/ReadBatch.
+ */
+static bool UDPSocketBenchmarkBatch(BasicUDPSocket &client,
+                                    BasicUDPSocket &server,
+                                    char8 * const * const buffers,
+                                    uint32 * const sizes) {
+    for (uint32 i = 0u; i < UDP_SOCKET_BENCHMARK_DATAGRAMS; i++) {
+        sizes[i] = UDP_SOCKET_BENCHMARK_DATAGRAM_SIZE;
+    }
+    uint32 numberOfDatagrams = UDP_SOCKET_BENCHMARK_DATAGRAMS;
+    bool ok = client.WriteBatch(const_cast<const char8 * const *>(buffers), sizes, numberOfDatagrams);
+    if (ok) {
+        ok = (numberOfDatagrams == UDP_SOCKET_BENCHMARK_DATAGRAMS);
+    }
+    uint32 received = 0u;
+    while ((ok) && (received < UDP_SOCKET_BENCHMARK_DATAGRAMS)) {
+        numberOfDatagrams = UDP_SOCKET_BENCHMARK_DATAGRAMS - received;
+        for (uint32 i = received; i < UDP_SOCKET_BENCHMARK_DATAGRAMS; i++) {
+            sizes[i] = UDP_SOCKET_BENCHMARK_DATAGRAM_SIZE;
+        }
+        ok = server.ReadBatch(&buffers[received], &sizes[received], numberOfDatagrams);
+        received += numberOfDatagrams;
+    }
+    return ok;
+}
+
+static bool UDPSocketBenchmarkRun(BenchmarkReport &report,
+                                  const bool batched) {
+    const char8 * const name = batched ? "UDPSocketBatch" : "UDPSocket";
+    StreamString variant;
+    bool ok = variant.Printf("Datagrams=%u,Size=%u", UDP_SOCKET_BENCHMARK_DATAGRAMS, UDP_SOCKET_BENCHMARK_DATAGRAM_SIZE);
+    BasicUDPSocket server;
+    BasicUDPSocket client;
+    if (ok) {
+        ok = server.Open();
+    }
+    if (ok) {
+        ok = server.Listen(UDP_SOCKET_BENCHMARK_PORT);
+    }
+    if (ok) {
+        ok = client.Open();
+    }
+    if (ok) {
+        ok = client.Connect("127.0.0.1", UDP_SOCKET_BENCHMARK_PORT);
+    }
+    char8 memory[UDP_SOCKET_BENCHMARK_DATAGRAMS * UDP_SOCKET_BENCHMARK_DATAGRAM_SIZE];
+    char8 *buffers[UDP_SOCKET_BENCHMARK_DATAGRAMS];
+    uint32 sizes[UDP_SOCKET_BENCHMARK_DATAGRAMS];
+    for (uint32 i = 0u; i < UDP_SOCKET_BENCHMARK_DATAGRAMS; i++) {
+        buffers[i] = &memory[i * UDP_SOCKET_BENCHMARK_DATAGRAM_SIZE];
+        for (uint32 j = 0u; j < UDP_SOCKET_BENCHMARK_DATAGRAM_SIZE; j++) {
+            buffers[i][j] = static_cast<char8>(i + j);
+        }
+    }
+    BenchmarkStatistics statistics;
+    for (uint32 b = 0u; (b < UDP_SOCKET_BENCHMARK_BATCHES) && (ok); b++) {
+        statistics.Start();
+        if (batched) {
+            ok = UDPSocketBenchmarkBatch(client, server, &buffers[0], &sizes[0]);
+        }
+        else {
+            ok = UDPSocketBenchmarkSingle(client, server, &buffers[0]);
+        }
+        statistics.Stop(UDP_SOCKET_BENCHMARK_DATAGRAMS);
+    }
+    if (ok) {
+        ok = report.AddResult(name, variant.Buffer(), statistics, UDP_SOCKET_BENCHMARK_DATAGRAM_SIZE);
+    }
+    else {
+        (void) report.AddFailure(name, variant.Buffer());
+    }
+    (void) client.Close();
+    (void) server.Close();
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+bool UDPSocketBenchmark(BenchmarkReport &report) {
+    bool ok = UDPSocketBenchmarkRun(report, false);
+    if (!UDPSocketBenchmarkRun(report, true)) {
+        ok = false;
+    }
+    return ok;
+}
+
+}
@@ -78,6 +78,12 @@ public:
      */
     bool TestExchange();
 
+    /**
+     * @brief Tests the compare and swap function.
+     * @return true if the testValue is only replaced (by a dummy value 1234) when it is equal to the expected value.
+     */
+    bool TestCompareAndSwap();
+
     /**
      * @brief Tests the addition function.
      * @return true if the testValue can be successfully added to a dummy value (10).
@@ -169,6 +175,18 @@ bool AtomicTest<T>::TestExchange() {
     return testResult;
 }
 
+template<class T>
+bool AtomicTest<T>::TestCompareAndSwap() {
+    volatile T auxValue = testValue;
+
+    bool testResult = !Atomic::CompareAndSwap(&auxValue, testValue + 1, 1234);
+    testResult = testResult && (auxValue == testValue);
+    testResult = testResult && Atomic::CompareAndSwap(&auxValue, testValue, 1234);
+    testResult = testResult && (auxValue == 1234);
+
+    return testResult;
+}
+
 template<class T>
 bool AtomicTest<T>::TestAdd() {
     bool testResult = false;
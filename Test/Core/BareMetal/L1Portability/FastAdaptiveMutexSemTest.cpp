@@ -0,0 +1,218 @@
+/**
+ * @file FastAdaptiveMutexSemTest.cpp
+ * @brief Source file for class FastAdaptiveMutexSemTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FastAdaptiveMutexSemTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "Atomic.h"
+#include "FastAdaptiveMutexSemTest.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+FastAdaptiveMutexSemTest::FastAdaptiveMutexSemTest() :
+        extFlag(0),
+        testMutex(extFlag) {
+    testMutex.Create();
+    synchSem.Create();
+    sharedVariable = 0;
+    nOfExecutingThreads = 0;
+    testMutexTimeout = TTInfiniteWait;
+    testMutexSpins = FAST_ADAPTIVE_MUTEX_SEM_DEFAULT_SPINS;
+    failed = true;
+    stop = false;
+}
+
+FastAdaptiveMutexSemTest::~FastAdaptiveMutexSemTest() {
+}
+
+bool FastAdaptiveMutexSemTest::TestConstructor() {
+    FastAdaptiveMutexSem mutexSem;
+    return !mutexSem.Locked();
+}
+
+bool FastAdaptiveMutexSemTest::TestConstructorFromExternal() {
+    volatile int32 x = 0;
+    FastAdaptiveMutexSem mutexSem(x);
+    bool ok = !mutexSem.Locked();
+    x = 1;
+    ok = ok && mutexSem.Locked();
+    return ok;
+}
+
+bool FastAdaptiveMutexSemTest::TestCreate(bool locked) {
+    FastAdaptiveMutexSem testSem;
+    testSem.Create(locked);
+    return (testSem.Locked() == locked);
+}
+
+bool FastAdaptiveMutexSemTest::GenericMutexTestCaller(int32 nOfThreads,
+                                                      ThreadFunctionType functionToTest) {
+    failed = false;
+    stop = false;
+    nOfExecutingThreads = 0;
+
+    synchSem.Reset();
+    for (int32 i = 0; i < nOfThreads; i++) {
+        Atomic::Increment(&nOfExecutingThreads);
+        Threads::BeginThread(functionToTest, this);
+    }
+    synchSem.Post();
+
+    Sleep::Sec(1.0f);
+    stop = true;
+    while (nOfExecutingThreads > 0) {
+        Sleep::MSec(10);
+    }
+    return !failed;
+}
+
+void FastAdaptiveMutexSemTestFastLockCallback(FastAdaptiveMutexSemTest &mt) {
+    mt.synchSem.Wait();
+    while ((!mt.stop) && (!mt.failed)) {
+        if (mt.testMutex.FastLock(mt.testMutexTimeout, mt.testMutexSpins) != ErrorManagement::NoError) {
+            mt.failed = true;
+        }
+        int32 state = mt.sharedVariable;
+        mt.sharedVariable++;
+        Sleep::MSec(1);
+        if (mt.sharedVariable != (state + 1)) {
+            mt.failed = true;
+        }
+        mt.testMutex.FastUnLock();
+    }
+    Atomic::Decrement(&mt.nOfExecutingThreads);
+}
+
+bool FastAdaptiveMutexSemTest::TestFastLock(int32 nOfThreads,
+                                            TimeoutType timeout,
+                                            uint32 maxSpins) {
+    testMutexTimeout = timeout;
+    testMutexSpins = maxSpins;
+    bool ok = GenericMutexTestCaller(nOfThreads, (ThreadFunctionType) FastAdaptiveMutexSemTestFastLockCallback);
+    if (ok) {
+        ok = !testMutex.Locked();
+    }
+    return ok;
+}
+
+bool FastAdaptiveMutexSemTest::TestFastTryLock() {
+    FastAdaptiveMutexSem sem;
+    bool ok = sem.FastTryLock();
+    ok = ok && !sem.FastTryLock();
+    sem.FastUnLock();
+    ok = ok && sem.FastTryLock();
+    sem.FastUnLock();
+    return ok;
+}
+
+void FastAdaptiveMutexSemTestFastLockErrorCodeCallback(FastAdaptiveMutexSemTest &mt) {
+    //This should fail because it was already locked in the TestFastLockErrorCode
+    if (mt.testMutex.FastLock(mt.testMutexTimeout) != ErrorManagement::Timeout) {
+        mt.failed = true;
+    }
+    Atomic::Decrement(&mt.nOfExecutingThreads);
+}
+
+bool FastAdaptiveMutexSemTest::TestFastLockErrorCode() {
+    bool ok = (testMutex.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        testMutexTimeout = 100u;
+        ok = GenericMutexTestCaller(1, (ThreadFunctionType) FastAdaptiveMutexSemTestFastLockErrorCodeCallback);
+    }
+    testMutex.FastUnLock();
+    if (ok) {
+        //The semaphore shall be usable after the timeout
+        ok = (testMutex.FastLock(TTInfiniteWait) == ErrorManagement::NoError);
+        testMutex.FastUnLock();
+    }
+    return ok;
+}
+
+void FastAdaptiveMutexSemTestWakeCallback(FastAdaptiveMutexSemTest &mt) {
+    if (mt.testMutex.FastLock(TTInfiniteWait, 0u) == ErrorManagement::NoError) {
+        mt.sharedVariable = 1;
+        mt.testMutex.FastUnLock();
+    }
+    else {
+        mt.failed = true;
+    }
+    Atomic::Decrement(&mt.nOfExecutingThreads);
+}
+
+bool FastAdaptiveMutexSemTest::TestFastUnLockWakesWaiter() {
+    failed = false;
+    sharedVariable = 0;
+    nOfExecutingThreads = 1;
+    bool ok = (testMutex.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        Threads::BeginThread((ThreadFunctionType) FastAdaptiveMutexSemTestWakeCallback, this);
+        //Wait for the thread to mark the semaphore as having waiters
+        uint32 counter = 0u;
+        while ((extFlag != 2) && (counter < 1000u)) {
+            Sleep::MSec(1);
+            counter++;
+        }
+        ok = (extFlag == 2);
+        ok = ok && (sharedVariable == 0);
+        testMutex.FastUnLock();
+    }
+    uint32 counter = 0u;
+    while ((nOfExecutingThreads > 0) && (counter < 1000u)) {
+        Sleep::MSec(1);
+        counter++;
+    }
+    if (ok) {
+        ok = (nOfExecutingThreads == 0);
+    }
+    if (ok) {
+        ok = (sharedVariable == 1) && (!failed) && (!testMutex.Locked());
+    }
+    return ok;
+}
+
+bool FastAdaptiveMutexSemTest::TestLocked() {
+    bool test = true;
+
+    testMutex.Create(false);
+    test &= !testMutex.Locked();
+
+    testMutex.Create(true);
+    test &= testMutex.Locked();
+
+    testMutex.FastUnLock();
+    test &= !testMutex.Locked();
+
+    return test;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file FastAdaptiveMutexSemTest.h
+ * @brief Header file for class FastAdaptiveMutexSemTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FastAdaptiveMutexSemTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FASTADAPTIVEMUTEXSEMTEST_H_
+#define FASTADAPTIVEMUTEXSEMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "FastAdaptiveMutexSem.h"
+#include "EventSem.h"
+#include "Threads.h"
+
+using namespace MARTe;
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief A class to test the FastAdaptiveMutexSem functions.
+ */
+class FastAdaptiveMutexSemTest {
+
+public:
+
+    /**
+     * @brief Default constructor.
+     */
+    FastAdaptiveMutexSemTest();
+
+    /**
+     * @brief Destructor.
+     */
+    ~FastAdaptiveMutexSemTest();
+
+    /**
+     * @brief Tests the FastAdaptiveMutexSem constructor
+     * @return true if the semaphore is initialised unlocked as expected.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the FastAdaptiveMutexSem from external flag
+     * @return true if the semaphore is initialised as expected.
+     */
+    bool TestConstructorFromExternal();
+
+    /**
+     * @brief Tests the FastAdaptiveMutexSem::Create function.
+     * @param[in] locked is the desired initial state: true = locked, false = unlocked.
+     * @return true if the semaphore is created in the requested state.
+     */
+    bool TestCreate(bool locked);
+
+    /**
+     * @brief Tests the FastAdaptiveMutexSem::FastLock function.
+     * @details This test spawns nOfThreads threads which compete for a shared resource variable during one second.
+     * @param[in] nOfThreads is the number of threads to launch.
+     * @param[in] timeout the timeout value that will be used to call the lock function.
+     * @param[in] maxSpins the number of spins to be used to call the lock function.
+     * @return true if the calls to FastAdaptiveMutexSem::FastLock returned true and if the shared resource was protected.
+     */
+    bool TestFastLock(int32 nOfThreads,
+                      TimeoutType timeout,
+                      uint32 maxSpins);
+
+    /**
+     * @brief Tests the FastAdaptiveMutexSem::FastTryLock function.
+     * @return true if a second consecutive call to FastAdaptiveMutexSem::FastTryLock returns false
+     * and if the semaphore can be locked again after being unlocked.
+     */
+    bool TestFastTryLock();
+
+    /**
+     * @brief Tests that the FastAdaptiveMutexSem::FastLock function returns ErrorManagement::Timeout if the semaphore is not unlocked in time.
+     * @return true if the error code is set to ErrorManagement::Timeout.
+     */
+    bool TestFastLockErrorCode();
+
+    /**
+     * @brief Tests that FastAdaptiveMutexSem::FastUnLock wakes a thread that is sleeping in FastAdaptiveMutexSem::FastLock.
+     * @return true if the waiting thread marks the semaphore as having waiters and acquires it after it is unlocked.
+     */
+    bool TestFastUnLockWakesWaiter();
+
+    /**
+     * @brief Tests the FastAdaptiveMutexSem::Locked function.
+     * @return true if FastAdaptiveMutexSem::Locked returns the semaphore state.
+     */
+    bool TestLocked();
+
+private:
+
+    /**
+     * External flag
+     */
+    volatile int32 extFlag;
+
+    /**
+     * Semaphore which is tested by the unit testing functions (initialised with the external flag).
+     */
+    FastAdaptiveMutexSem testMutex;
+
+    /**
+     * timeout to be used for the locking test
+     */
+    TimeoutType testMutexTimeout;
+
+    /**
+     * Number of spins to be used for the locking test
+     */
+    uint32 testMutexSpins;
+
+    /**
+     * Shared variable that is protected by the unit testing functions
+     */
+    int32 sharedVariable;
+
+    /**
+     * Number of running threads for a given test
+     */
+    int32 nOfExecutingThreads;
+
+    /**
+     * This variable is set to true when the callback functions are expected to return
+     */
+    bool stop;
+
+    /**
+     * To be used by the threading callback functions to report an error
+     */
+    bool failed;
+
+    /**
+     * Helper semaphore to synchronise the launching of concurrent threads
+     */
+    EventSem synchSem;
+
+    /**
+     * @brief Launches nOfThreads threads calling functionToTest, waits one second, stops them and returns !failed.
+     */
+    bool GenericMutexTestCaller(int32 nOfThreads,
+                                ThreadFunctionType functionToTest);
+
+    /**
+     * @see TestFastLock
+     */
+    friend void FastAdaptiveMutexSemTestFastLockCallback(FastAdaptiveMutexSemTest &mt);
+    /**
+     * @see TestFastLockErrorCode
+     */
+    friend void FastAdaptiveMutexSemTestFastLockErrorCodeCallback(FastAdaptiveMutexSemTest &mt);
+    /**
+     * @see TestFastUnLockWakesWaiter
+     */
+    friend void FastAdaptiveMutexSemTestWakeCallback(FastAdaptiveMutexSemTest &mt);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FASTADAPTIVEMUTEXSEMTEST_H_ */
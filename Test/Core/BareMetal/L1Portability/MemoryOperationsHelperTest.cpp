@@ -293,6 +293,125 @@ bool MemoryOperationsHelperTest::TestSearchZeroSize() {
 
 }
 
+bool MemoryOperationsHelperTest::TestCopyLargeUnaligned() {
+    //Sizes around the vector lengths and above the streaming threshold
+    const uint32 sizes[] = { 1u, 15u, 16u, 17u, 31u, 32u, 33u, 63u, 64u, 65u, 127u, 128u, 129u, 255u, 1000u, 4099u, 1048576u + 77u };
+    const uint32 numberOfSizes = sizeof(sizes) / sizeof(uint32);
+    const uint32 maxSize = sizes[numberOfSizes - 1u] + 128u;
+    uint8 *source = static_cast<uint8 *>(HeapManager::Malloc(maxSize));
+    uint8 *destination = static_cast<uint8 *>(HeapManager::Malloc(maxSize));
+    bool ok = ((source != NULL) && (destination != NULL));
+    for (uint32 i = 0u; (i < maxSize) && (ok); i++) {
+        source[i] = static_cast<uint8>((i * 7u) + (i >> 8u));
+    }
+    for (uint32 s = 0u; (s < numberOfSizes) && (ok); s++) {
+        for (uint32 sourceOffset = 0u; (sourceOffset < 34u) && (ok); sourceOffset += 11u) {
+            for (uint32 destinationOffset = 0u; (destinationOffset < 34u) && (ok); destinationOffset += 3u) {
+                ok = MemoryOperationsHelper::Set(destination, 0x5A, maxSize);
+                if (ok) {
+                    ok = MemoryOperationsHelper::Copy(&destination[destinationOffset], &source[sourceOffset], sizes[s]);
+                }
+                for (uint32 i = 0u; (i < sizes[s]) && (ok); i++) {
+                    ok = (destination[destinationOffset + i] == source[sourceOffset + i]);
+                }
+                for (uint32 i = 0u; (i < destinationOffset) && (ok); i++) {
+                    ok = (destination[i] == 0x5Au);
+                }
+                if (ok) {
+                    uint32 end = (destinationOffset + sizes[s]);
+                    ok = (destination[end] == 0x5Au);
+                }
+            }
+        }
+    }
+    void *mem = source;
+    (void) HeapManager::Free(mem);
+    mem = destination;
+    (void) HeapManager::Free(mem);
+    return ok;
+}
+
+bool MemoryOperationsHelperTest::TestSetLargeUnaligned() {
+    const uint32 sizes[] = { 1u, 15u, 16u, 17u, 31u, 32u, 33u, 63u, 64u, 65u, 127u, 128u, 129u, 255u, 1000u, 4099u, 1048576u + 77u };
+    const uint32 numberOfSizes = sizeof(sizes) / sizeof(uint32);
+    const uint32 maxSize = sizes[numberOfSizes - 1u] + 128u;
+    uint8 *mem = static_cast<uint8 *>(HeapManager::Malloc(maxSize));
+    bool ok = (mem != NULL);
+    for (uint32 s = 0u; (s < numberOfSizes) && (ok); s++) {
+        for (uint32 offset = 0u; (offset < 34u) && (ok); offset += 3u) {
+            ok = MemoryOperationsHelper::Set(mem, 0x11, maxSize);
+            if (ok) {
+                ok = MemoryOperationsHelper::Set(&mem[offset], static_cast<char8>(0xE7), sizes[s]);
+            }
+            for (uint32 i = 0u; (i < sizes[s]) && (ok); i++) {
+                ok = (mem[offset + i] == 0xE7u);
+            }
+            for (uint32 i = 0u; (i < offset) && (ok); i++) {
+                ok = (mem[i] == 0x11u);
+            }
+            if (ok) {
+                ok = (mem[offset + sizes[s]] == 0x11u);
+            }
+        }
+    }
+    void *memToFree = mem;
+    (void) HeapManager::Free(memToFree);
+    return ok;
+}
+
+bool MemoryOperationsHelperTest::TestCompareLargeUnaligned() {
+    const uint32 size = 300u;
+    uint8 mem1[size + 1u];
+    uint8 mem2[size + 1u];
+    bool ok = true;
+    for (uint32 i = 0u; i < (size + 1u); i++) {
+        mem1[i] = static_cast<uint8>(i);
+        mem2[i] = static_cast<uint8>(i);
+    }
+    //Use the second byte to start on an unaligned address
+    ok = (MemoryOperationsHelper::Compare(&mem1[1], &mem2[1], size) == 0);
+    for (uint32 i = 1u; (i < (size + 1u)) && (ok); i++) {
+        //The bytes are compared as unsigned
+        mem2[i] = static_cast<uint8>(mem1[i] + 0x80u);
+        int32 expected = (mem1[i] < mem2[i]) ? 1 : 2;
+        ok = (MemoryOperationsHelper::Compare(&mem1[1], &mem2[1], size) == expected);
+        if (ok) {
+            ok = (MemoryOperationsHelper::Compare(&mem2[1], &mem1[1], size) == ((expected == 1) ? 2 : 1));
+        }
+        if (ok) {
+            //The difference is outside of the compared area
+            ok = (MemoryOperationsHelper::Compare(&mem1[1], &mem2[1], (i - 1u)) == 0);
+        }
+        mem2[i] = mem1[i];
+    }
+    return ok;
+}
+
+bool MemoryOperationsHelperTest::TestSearchLargeUnaligned() {
+    const uint32 size = 300u;
+    char8 mem[size + 1u];
+    bool ok = MemoryOperationsHelper::Set(&mem[0], 'a', size + 1u);
+    if (ok) {
+        ok = (MemoryOperationsHelper::Search(&mem[1], 'b', size) == NULL);
+    }
+    for (uint32 i = 1u; (i < (size + 1u)) && (ok); i++) {
+        mem[i] = 'b';
+        if ((i + 7u) < (size + 1u)) {
+            mem[i + 7u] = 'b';
+        }
+        ok = (MemoryOperationsHelper::Search(&mem[1], 'b', size) == &mem[i]);
+        if (ok) {
+            //The character is outside of the searched area
+            ok = (MemoryOperationsHelper::Search(&mem[1], 'b', (i - 1u)) == NULL);
+        }
+        mem[i] = 'a';
+        if ((i + 7u) < (size + 1u)) {
+            mem[i + 7u] = 'a';
+        }
+    }
+    return ok;
+}
+
 bool MemoryOperationsHelperTest::TestInterleavedToFlat() {
 
     const uint32 memSize = 150;
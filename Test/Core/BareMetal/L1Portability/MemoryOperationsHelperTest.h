@@ -131,6 +131,30 @@ public:
      */
     bool TestSearchZeroSize();
 
+    /**
+     * @brief Tests the Copy function for sizes and misalignments that exercise the vector and the streaming implementations.
+     * @return true if all the copies are correct and the bytes around the destination are not modified.
+     */
+    bool TestCopyLargeUnaligned();
+
+    /**
+     * @brief Tests the Set function for sizes and misalignments that exercise the vector and the streaming implementations.
+     * @return true if all the bytes are set and the bytes around the memory area are not modified.
+     */
+    bool TestSetLargeUnaligned();
+
+    /**
+     * @brief Tests the Compare function with a difference at every position of memory areas larger than a vector.
+     * @return true if the result is correct for every position of the difference.
+     */
+    bool TestCompareLargeUnaligned();
+
+    /**
+     * @brief Tests the Search function with the character at every position of memory areas larger than a vector.
+     * @return true if the first occurrence is always returned and NULL if the character is not in the memory area.
+     */
+    bool TestSearchLargeUnaligned();
+
     /**
      * @brief Tests the InterleavedToFlat function
      */
@@ -0,0 +1,132 @@
+/**
+ * @file MirroredMemoryTest.cpp
+ * @brief Source file for class MirroredMemoryTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MirroredMemoryTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MirroredMemoryTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool MirroredMemoryTest::TestGetGranularity() {
+    uint32 granularity = MirroredMemory::GetGranularity();
+    bool ok = (granularity > 0u);
+    if (ok) {
+        ok = ((granularity % 4096u) == 0u);
+    }
+    return ok;
+}
+
+bool MirroredMemoryTest::TestAllocate() {
+    const uint32 size = MirroredMemory::GetGranularity();
+    const bool mirrored = true;
+    uint8 *region = static_cast<uint8 *>(MirroredMemory::Allocate(1u, &size, &mirrored));
+    bool ok = (region != NULL_PTR(uint8 *));
+    for (uint32 i = 0u; (i < (2u * size)) && (ok); i++) {
+        ok = (region[i] == 0u);
+    }
+    for (uint32 i = 0u; (i < size) && (ok); i++) {
+        region[i] = static_cast<uint8>(i);
+    }
+    for (uint32 i = 0u; (i < size) && (ok); i++) {
+        ok = (region[size + i] == static_cast<uint8>(i));
+    }
+    if (ok) {
+        region[(2u * size) - 1u] = 0xAAu;
+        ok = (region[size - 1u] == 0xAAu);
+    }
+    void *address = region;
+    if (ok) {
+        ok = MirroredMemory::Free(address);
+    }
+    return ok;
+}
+
+bool MirroredMemoryTest::TestAllocate_Regions() {
+    const uint32 granularity = MirroredMemory::GetGranularity();
+    const uint32 sizes[] = { granularity, 2u * granularity, granularity };
+    const bool mirrored[] = { false, true, true };
+    uint8 *regions = static_cast<uint8 *>(MirroredMemory::Allocate(3u, &sizes[0], &mirrored[0]));
+    bool ok = (regions != NULL_PTR(uint8 *));
+    uint8 *region0 = regions;
+    uint8 *region1 = &regions[sizes[0]];
+    uint8 *region2 = &regions[sizes[0] + (2u * sizes[1])];
+    if (ok) {
+        region0[0] = 1u;
+        region1[0] = 2u;
+        region2[0] = 3u;
+        ok = (region0[0] == 1u);
+    }
+    if (ok) {
+        ok = (region1[sizes[1]] == 2u);
+    }
+    if (ok) {
+        ok = (region2[sizes[2]] == 3u);
+    }
+    if (ok) {
+        //A write at the end of the mirror of the region 1 must not change the region 2
+        region1[(2u * sizes[1]) - 1u] = 4u;
+        ok = ((region1[sizes[1] - 1u] == 4u) && (region2[0] == 3u));
+    }
+    void *address = regions;
+    if (ok) {
+        ok = MirroredMemory::Free(address);
+    }
+    return ok;
+}
+
+bool MirroredMemoryTest::TestAllocate_InvalidSize() {
+    const uint32 size = MirroredMemory::GetGranularity() + 1u;
+    const bool mirrored = true;
+    void *address = MirroredMemory::Allocate(1u, &size, &mirrored);
+    return (address == NULL_PTR(void *));
+}
+
+bool MirroredMemoryTest::TestFree() {
+    const uint32 size = MirroredMemory::GetGranularity();
+    const bool mirrored = true;
+    void *address = MirroredMemory::Allocate(1u, &size, &mirrored);
+    bool ok = (address != NULL_PTR(void *));
+    if (ok) {
+        ok = MirroredMemory::Free(address);
+    }
+    if (ok) {
+        ok = (address == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool MirroredMemoryTest::TestFree_False() {
+    void *address = NULL_PTR(void *);
+    return !MirroredMemory::Free(address);
+}
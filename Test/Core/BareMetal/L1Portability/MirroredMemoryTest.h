@@ -0,0 +1,83 @@
+/**
+ * @file MirroredMemoryTest.h
+ * @brief Header file for class MirroredMemoryTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MirroredMemoryTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MIRROREDMEMORYTEST_H_
+#define MIRROREDMEMORYTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MirroredMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the MirroredMemory functions
+ */
+class MirroredMemoryTest {
+public:
+
+    /**
+     * @brief Tests that the granularity is the page size.
+     */
+    bool TestGetGranularity();
+
+    /**
+     * @brief Tests that a mirrored region is zeroed and that the writes in the region are seen in the mirror and vice-versa.
+     */
+    bool TestAllocate();
+
+    /**
+     * @brief Tests the layout of a list of mirrored and not mirrored regions.
+     */
+    bool TestAllocate_Regions();
+
+    /**
+     * @brief Tests that Allocate fails if a region size is not a multiple of the granularity.
+     */
+    bool TestAllocate_InvalidSize();
+
+    /**
+     * @brief Tests that Free releases the memory and sets the address to NULL.
+     */
+    bool TestFree();
+
+    /**
+     * @brief Tests that Free fails with a NULL address.
+     */
+    bool TestFree_False();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MIRROREDMEMORYTEST_H_ */
@@ -0,0 +1,109 @@
+/**
+ * @file SlabMemoryTest.cpp
+ * @brief Source file for class SlabMemoryTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SlabMemoryTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SlabMemoryTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool SlabMemoryTest::TestAllocate() {
+    const uint32 size = 10000u;
+    uint8 *slab = static_cast<uint8 *>(SlabMemory::Allocate(size));
+    bool ok = (slab != NULL_PTR(uint8 *));
+    if (ok) {
+        ok = ((reinterpret_cast<uintp>(slab) % SlabMemory::ALIGNMENT) == 0u);
+    }
+    for (uint32 i = 0u; (i < size) && (ok); i++) {
+        ok = (slab[i] == 0u);
+        slab[i] = static_cast<uint8>(i);
+    }
+    for (uint32 i = 0u; (i < size) && (ok); i++) {
+        ok = (slab[i] == static_cast<uint8>(i));
+    }
+    void *address = slab;
+    if (ok) {
+        ok = SlabMemory::Free(address);
+    }
+    return ok;
+}
+
+bool SlabMemoryTest::TestAllocate_HugePages() {
+    const uint32 size = 3000000u;
+    uint8 *slab = static_cast<uint8 *>(SlabMemory::Allocate(size, true, false));
+    bool ok = (slab != NULL_PTR(uint8 *));
+    if (ok) {
+        ok = ((reinterpret_cast<uintp>(slab) % SlabMemory::ALIGNMENT) == 0u);
+    }
+    if (ok) {
+        ok = ((slab[0] == 0u) && (slab[size - 1u] == 0u));
+        slab[size - 1u] = 1u;
+    }
+    void *address = slab;
+    if (ok) {
+        ok = SlabMemory::Free(address);
+    }
+    return ok;
+}
+
+bool SlabMemoryTest::TestAllocate_Locked() {
+    const uint32 size = 4096u;
+    uint8 *slab = static_cast<uint8 *>(SlabMemory::Allocate(size, false, true));
+    bool ok = (slab != NULL_PTR(uint8 *));
+    if (ok) {
+        ok = ((slab[0] == 0u) && (slab[size - 1u] == 0u));
+    }
+    void *address = slab;
+    if (ok) {
+        ok = SlabMemory::Free(address);
+    }
+    return ok;
+}
+
+bool SlabMemoryTest::TestFree() {
+    void *address = SlabMemory::Allocate(100u);
+    bool ok = (address != NULL_PTR(void *));
+    if (ok) {
+        ok = SlabMemory::Free(address);
+    }
+    if (ok) {
+        ok = (address == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool SlabMemoryTest::TestFree_False() {
+    void *address = NULL_PTR(void *);
+    return !SlabMemory::Free(address);
+}
@@ -0,0 +1,78 @@
+/**
+ * @file SlabMemoryTest.h
+ * @brief Header file for class SlabMemoryTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SlabMemoryTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SLABMEMORYTEST_H_
+#define SLABMEMORYTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SlabMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the SlabMemory functions
+ */
+class SlabMemoryTest {
+public:
+
+    /**
+     * @brief Tests that the slab is aligned, zeroed and writable.
+     */
+    bool TestAllocate();
+
+    /**
+     * @brief Tests that Allocate with huge pages succeeds (falling back to the standard pages if needed).
+     */
+    bool TestAllocate_HugePages();
+
+    /**
+     * @brief Tests that Allocate with memory locking succeeds (even if the lock is not allowed).
+     */
+    bool TestAllocate_Locked();
+
+    /**
+     * @brief Tests that Free releases the slab and sets the address to NULL.
+     */
+    bool TestFree();
+
+    /**
+     * @brief Tests that Free fails with a NULL address.
+     */
+    bool TestFree_False();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SLABMEMORYTEST_H_ */
@@ -281,3 +281,93 @@ bool ClassRegistryDatabaseTest::TestCleanUp() {
     testDB.CleanUp();
     return testDB.GetSize() == 0;
 }
+
+bool ClassRegistryDatabaseTest::TestFindManyClasses() {
+    DummyClassRegistryDatabase testDB;
+    const uint32 numberOfClasses = 300u;
+    char8 names[numberOfClasses][16];
+    char8 typeIdNames[numberOfClasses][16];
+    ClassProperties *cps[numberOfClasses];
+    ClassRegistryItem *items[numberOfClasses];
+    uint32 i;
+    for (i = 0u; i < numberOfClasses; i++) {
+        char8 number[4] = { static_cast<char8>('0' + (i / 100u)), static_cast<char8>('0' + ((i / 10u) % 10u)), static_cast<char8>('0' + (i % 10u)), '\0' };
+        StringHelper::Copy(&names[i][0], "Class");
+        StringHelper::Concatenate(&names[i][0], &number[0]);
+        StringHelper::Copy(&typeIdNames[i][0], "TypeId");
+        StringHelper::Concatenate(&typeIdNames[i][0], &number[0]);
+        cps[i] = new ClassProperties(&names[i][0], &typeIdNames[i][0], "V");
+        items[i] = new DummyClassRegistryItem(*cps[i]);
+        testDB.Add(items[i]);
+    }
+    bool ok = (testDB.GetSize() == numberOfClasses);
+    for (i = 0u; (i < numberOfClasses) && (ok); i++) {
+        ok = (testDB.Find(&names[i][0]) == items[i]);
+        if (ok) {
+            ok = (testDB.FindTypeIdName(&typeIdNames[i][0]) == items[i]);
+        }
+    }
+    if (ok) {
+        ok = (testDB.FindTypeIdName("TypeIdNotRegistered") == NULL);
+    }
+    testDB.CleanUp();
+    for (i = 0u; i < numberOfClasses; i++) {
+        delete cps[i];
+    }
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestFindSameNameReturnsFirst() {
+    DummyClassRegistryDatabase testDB;
+    ClassProperties cp1("SameName", "SameTypeId", "V1");
+    ClassProperties cp2("SameName", "SameTypeId", "V2");
+    ClassRegistryItem *first = new DummyClassRegistryItem(cp1);
+    ClassRegistryItem *second = new DummyClassRegistryItem(cp2);
+    testDB.Add(first);
+    testDB.Add(second);
+    bool ok = (testDB.Find("SameName") == first);
+    if (ok) {
+        ok = (testDB.FindTypeIdName("SameTypeId") == first);
+    }
+    testDB.CleanUp();
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestPeek() {
+    ClassRegistryDatabase *db = ClassRegistryDatabase::Instance();
+    const ClassRegistryItem *integerItem = db->Find("IntegerObject");
+    bool ok = (integerItem != NULL);
+    if (ok) {
+        ok = (db->Peek(integerItem->GetClassProperties()->GetUniqueIdentifier()) == integerItem);
+    }
+    if (ok) {
+        ok = (db->Peek(db->GetSize()) == NULL);
+    }
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestCleanUpResetsIdentifiers() {
+    DummyClassRegistryDatabase testDB;
+    ClassProperties cp1("CleanUpA", "CleanUpTypeIdA", "V");
+    ClassProperties cp2("CleanUpB", "CleanUpTypeIdB", "V");
+    ClassProperties cp3("CleanUpC", "CleanUpTypeIdC", "V");
+    testDB.Add(new DummyClassRegistryItem(cp1));
+    testDB.Add(new DummyClassRegistryItem(cp2));
+    testDB.CleanUp();
+    ClassRegistryItem *item = new DummyClassRegistryItem(cp3);
+    testDB.Add(item);
+    bool ok = (cp3.GetUniqueIdentifier() == 0u);
+    if (ok) {
+        ok = (testDB.Peek(0u) == item);
+    }
+    if (ok) {
+        ok = (testDB.Find("CleanUpA") == NULL);
+    }
+    if (ok) {
+        ok = (testDB.FindTypeIdName("CleanUpTypeIdB") == NULL);
+    }
+    if (ok) {
+        ok = (testDB.Find("CleanUpC") == item);
+    }
+    return ok;
+}
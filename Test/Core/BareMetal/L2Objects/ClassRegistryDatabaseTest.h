@@ -159,6 +159,27 @@ public:
 
     bool TestCleanUp();
 
+    /**
+     * @brief Tests that the Find and FindTypeIdName functions retrieve every class of a database with more classes
+     * than the initial capacity of its indexes.
+     */
+    bool TestFindManyClasses();
+
+    /**
+     * @brief Tests that Find and FindTypeIdName return the first class registered when two classes have the same name.
+     */
+    bool TestFindSameNameReturnsFirst();
+
+    /**
+     * @brief Tests that the Peek function returns the class with the given unique identifier.
+     */
+    bool TestPeek();
+
+    /**
+     * @brief Tests that after CleanUp the unique identifiers restart from zero and the old classes are no longer found.
+     */
+    bool TestCleanUpResetsIdentifiers();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -31,6 +31,7 @@
 
 #include "ClassRegistryItemT.h"
 #include "ObjectRegistryDatabaseTest.h"
+#include "StreamString.h"
 #include "stdio.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -194,3 +195,91 @@ bool ObjectRegistryDatabaseTest::TestGetClassName() {
     return StringHelper::Compare(ObjectRegistryDatabase::Instance()->GetClassName(), "ObjectRegistryDatabase") == 0;
 }
 
+
+bool ObjectRegistryDatabaseTest::TestFind_Cached() {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<PID> test = ord->Find("A.B.C.PID");
+    bool ok = test.IsValid();
+    if (ok) {
+        ok = (ord->Find("A.B.C.PID") == test);
+    }
+    ReferenceT<ReferenceContainer> containerC = ord->Find("A.B.C");
+    if (ok) {
+        ok = containerC.IsValid();
+    }
+    if (ok) {
+        ok = containerC->Delete(test);
+    }
+    if (ok) {
+        ok = !ord->Find("A.B.C.PID").IsValid();
+    }
+    ReferenceT<PID> replacement(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    replacement->SetName("PID");
+    if (ok) {
+        ok = containerC->Insert(replacement);
+    }
+    if (ok) {
+        ok = (ord->Find("A.B.C.PID") == replacement);
+    }
+    if (ok) {
+        ok = (ord->Find("A.B.C.PID") == replacement);
+    }
+    return ok;
+}
+
+bool ObjectRegistryDatabaseTest::TestFind_CachedContainerDeleted() {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<PID> test = ord->Find("A.B.C.PID");
+    bool ok = test.IsValid();
+    ReferenceT<ReferenceContainer> containerB = ord->Find("A.B");
+    ReferenceT<ReferenceContainer> containerC = ord->Find("A.B.C");
+    if (ok) {
+        ok = containerB.IsValid() && containerC.IsValid();
+    }
+    if (ok) {
+        ok = containerB->Delete(containerC);
+    }
+    //Release the container so that the cached address is no longer valid
+    containerC = Reference();
+    if (ok) {
+        ok = !ord->Find("A.B.C.PID").IsValid();
+    }
+    if (ok) {
+        ok = !ord->Find("A.B.C").IsValid();
+    }
+    if (ok) {
+        ReferenceT<PID> pidB = ord->Find("A.B.PID");
+        ok = pidB.IsValid();
+        if (ok) {
+            ok = (pidB->Kp == 4);
+        }
+    }
+    return ok;
+}
+
+bool ObjectRegistryDatabaseTest::TestFind_NotCacheable() {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    StreamString deepPath = "D0";
+    for (uint32 i = 1u; i <= OBJECT_REGISTRY_DATABASE_CACHE_MAX_DEPTH; i++) {
+        deepPath.Printf(".D%u", i);
+    }
+    deepPath += ".Obj";
+    StreamString longPath = "L";
+    for (uint32 i = 0u; i < OBJECT_REGISTRY_DATABASE_CACHE_MAX_PATH_SIZE; i++) {
+        longPath += "a";
+    }
+    longPath += ".Obj";
+    ReferenceT<Object> deep(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<Object> longObj(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = ord->Insert(deepPath.Buffer(), deep);
+    if (ok) {
+        ok = ord->Insert(longPath.Buffer(), longObj);
+    }
+    for (uint32 n = 0u; (n < 2u) && (ok); n++) {
+        ok = (ord->Find(deepPath.Buffer()) == deep);
+        if (ok) {
+            ok = (ord->Find(longPath.Buffer()) == longObj);
+        }
+    }
+    return ok;
+}
@@ -108,6 +108,22 @@ public:
      */
     bool TestFindTooManyBackSteps();
 
+    /**
+     * @brief Tests that a path found from the cache is invalidated when the object is deleted or replaced.
+     */
+    bool TestFind_Cached();
+
+    /**
+     * @brief Tests that a cached path is invalidated when one of the containers in the path is deleted.
+     */
+    bool TestFind_CachedContainerDeleted();
+
+    /**
+     * @brief Tests that paths deeper than OBJECT_REGISTRY_DATABASE_CACHE_MAX_DEPTH or longer than
+     * OBJECT_REGISTRY_DATABASE_CACHE_MAX_PATH_SIZE are found.
+     */
+    bool TestFind_NotCacheable();
+
     /**
      * @brief Tests if the function returns "ObjectRegistryDatabase"
      */
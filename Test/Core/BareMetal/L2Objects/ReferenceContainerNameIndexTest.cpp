@@ -0,0 +1,375 @@
+/**
+ * @file ReferenceContainerNameIndexTest.cpp
+ * @brief Source file for class ReferenceContainerNameIndexTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReferenceContainerNameIndexTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ReferenceContainerNameIndexTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Creates a node holding an Object named as requested (if name is not NULL).
+ */
+static ReferenceContainerNode *CreateNamedNode(const char8 * const name) {
+    ReferenceT<Object> obj(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (name != NULL) {
+        obj->SetName(name);
+    }
+    ReferenceContainerNode *node = new ReferenceContainerNode();
+    node->SetReference(obj);
+    return node;
+}
+
+/**
+ * Adds n nodes named N0, N1, ... to the list.
+ */
+static void CreateNamedNodes(LinkedListHolderT<ReferenceContainerNode> &list,
+                             const uint32 n) {
+    for (uint32 i = 0u; i < n; i++) {
+        StreamString name;
+        name.Printf("N%u", i);
+        list.ListAdd(CreateNamedNode(name.Buffer()));
+    }
+}
+
+bool ReferenceContainerNameIndexTest::TestConstructor() {
+    ReferenceContainerNameIndex index;
+    bool ok = !index.IsBuilt();
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 0u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestBuild() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    CreateNamedNodes(list, 10u);
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(list.List());
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 10u);
+    }
+    for (uint32 i = 0u; (i < 10u) && (ok); i++) {
+        StreamString name;
+        name.Printf("N%u", i);
+        ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+        ok = (index.Find(name.Buffer(), static_cast<uint32>(name.Size()), node) == 1u);
+        if (ok) {
+            ok = (node == list.ListPeek(i));
+        }
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestBuild_Empty() {
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(NULL_PTR(ReferenceContainerNode *));
+    if (ok) {
+        ok = index.IsBuilt();
+    }
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 0u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestReset() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    CreateNamedNodes(list, 3u);
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(list.List());
+    index.Reset();
+    if (ok) {
+        ok = !index.IsBuilt();
+    }
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 0u);
+    }
+    if (ok) {
+        ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+        ok = (index.Find("N0", 2u, node) == 0u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestIsBuilt() {
+    ReferenceContainerNameIndex index;
+    bool ok = !index.IsBuilt();
+    if (ok) {
+        ok = index.Build(NULL_PTR(ReferenceContainerNode *));
+    }
+    if (ok) {
+        ok = index.IsBuilt();
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestAdd() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    CreateNamedNodes(list, 100u);
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(NULL_PTR(ReferenceContainerNode *));
+    for (uint32 i = 0u; (i < 100u) && (ok); i++) {
+        ok = index.Add(list.ListPeek(i));
+    }
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 100u);
+    }
+    for (uint32 i = 0u; (i < 100u) && (ok); i++) {
+        StreamString name;
+        name.Printf("N%u", i);
+        ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+        ok = (index.Find(name.Buffer(), static_cast<uint32>(name.Size()), node) == 1u);
+        if (ok) {
+            ok = (node == list.ListPeek(i));
+        }
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestAdd_NotBuilt() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    CreateNamedNodes(list, 1u);
+    ReferenceContainerNameIndex index;
+    bool ok = index.Add(list.List());
+    if (ok) {
+        ok = !index.IsBuilt();
+    }
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 0u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestAdd_NoName() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    list.ListAdd(CreateNamedNode(NULL_PTR(const char8 *)));
+    list.ListAdd(new ReferenceContainerNode());
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(list.List());
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 0u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestRemove() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    CreateNamedNodes(list, 20u);
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(list.List());
+    index.Remove(list.ListPeek(5u));
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 19u);
+    }
+    ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+    if (ok) {
+        ok = (index.Find("N5", 2u, node) == 0u);
+    }
+    if (ok) {
+        ok = (node == NULL);
+    }
+    //The entries probed after the removed one shall still be found
+    for (uint32 i = 0u; (i < 20u) && (ok); i++) {
+        if (i != 5u) {
+            StreamString name;
+            name.Printf("N%u", i);
+            ok = (index.Find(name.Buffer(), static_cast<uint32>(name.Size()), node) == 1u);
+        }
+    }
+    //Removing twice shall do nothing
+    index.Remove(list.ListPeek(5u));
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 19u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestRemove_Renamed() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    CreateNamedNodes(list, 4u);
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(list.List());
+    ReferenceContainerNode *renamed = list.ListPeek(2u);
+    Reference ref = renamed->GetReference();
+    ref->SetName("Renamed");
+    index.Remove(renamed);
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 3u);
+    }
+    ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+    if (ok) {
+        ok = (index.Find("Renamed", 7u, node) == 0u);
+    }
+    if (ok) {
+        ok = (index.Find("N2", 2u, node) == 0u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestRemove_Reuse() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    CreateNamedNodes(list, 8u);
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(NULL_PTR(ReferenceContainerNode *));
+    //Repeatedly adding and removing shall not grow the table indefinitely nor lose entries
+    for (uint32 n = 0u; (n < 1000u) && (ok); n++) {
+        ok = index.Add(list.ListPeek(n % 8u));
+        if (ok) {
+            ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+            ok = (index.Find(list.ListPeek(n % 8u)->GetReference()->GetName(), 2u, node) == 1u);
+        }
+        index.Remove(list.ListPeek(n % 8u));
+    }
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 0u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestFind() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    list.ListAdd(CreateNamedNode("A"));
+    list.ListAdd(CreateNamedNode("AB"));
+    list.ListAdd(CreateNamedNode("ABC"));
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(list.List());
+    ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+    if (ok) {
+        ok = (index.Find("AB", 2u, node) == 1u);
+    }
+    if (ok) {
+        ok = (node == list.ListPeek(1u));
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestFind_Duplicated() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    list.ListAdd(CreateNamedNode("A"));
+    list.ListAdd(CreateNamedNode("B"));
+    list.ListAdd(CreateNamedNode("A"));
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(list.List());
+    ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+    if (ok) {
+        ok = (index.Find("A", 1u, node) == 2u);
+    }
+    if (ok) {
+        ok = ((node == list.ListPeek(0u)) || (node == list.ListPeek(2u)));
+    }
+    if (ok) {
+        ok = (index.Find("B", 1u, node) == 1u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestFind_NotTerminated() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    list.ListAdd(CreateNamedNode("A"));
+    list.ListAdd(CreateNamedNode("B"));
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(list.List());
+    ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+    if (ok) {
+        ok = (index.Find("B.C.D", 1u, node) == 1u);
+    }
+    if (ok) {
+        ok = (node == list.ListPeek(1u));
+    }
+    if (ok) {
+        ok = (index.Find("B.C.D", 3u, node) == 0u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestFind_NotFound() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    CreateNamedNodes(list, 10u);
+    ReferenceContainerNameIndex index;
+    bool ok = index.Build(list.List());
+    ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+    if (ok) {
+        ok = (index.Find("N10", 3u, node) == 0u);
+    }
+    if (ok) {
+        ok = (node == NULL);
+    }
+    if (ok) {
+        ok = (index.Find("N", 1u, node) == 0u);
+    }
+    if (ok) {
+        ok = (index.Find(NULL_PTR(const char8 *), 0u, node) == 0u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestGetNumberOfEntries() {
+    LinkedListHolderT<ReferenceContainerNode> list;
+    CreateNamedNodes(list, 5u);
+    ReferenceContainerNameIndex index;
+    bool ok = (index.GetNumberOfEntries() == 0u);
+    if (ok) {
+        ok = index.Build(list.List());
+    }
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 5u);
+    }
+    index.Remove(list.ListPeek(0u));
+    if (ok) {
+        ok = (index.GetNumberOfEntries() == 4u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestIsNamed() {
+    ReferenceContainerNode *node = CreateNamedNode("ABC");
+    ReferenceContainerNode *noName = CreateNamedNode(NULL_PTR(const char8 *));
+    bool ok = ReferenceContainerNameIndex::IsNamed(node, "ABC", 3u);
+    if (ok) {
+        ok = ReferenceContainerNameIndex::IsNamed(node, "ABC.D", 3u);
+    }
+    if (ok) {
+        ok = !ReferenceContainerNameIndex::IsNamed(node, "AB", 2u);
+    }
+    if (ok) {
+        ok = !ReferenceContainerNameIndex::IsNamed(node, "ABCD", 4u);
+    }
+    if (ok) {
+        ok = !ReferenceContainerNameIndex::IsNamed(noName, "ABC", 3u);
+    }
+    delete node;
+    delete noName;
+    return ok;
+}
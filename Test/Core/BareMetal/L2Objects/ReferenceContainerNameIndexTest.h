@@ -0,0 +1,142 @@
+/**
+ * @file ReferenceContainerNameIndexTest.h
+ * @brief Header file for class ReferenceContainerNameIndexTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReferenceContainerNameIndexTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REFERENCECONTAINERNAMEINDEXTEST_H_
+#define REFERENCECONTAINERNAMEINDEXTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GlobalObjectsDatabase.h"
+#include "LinkedListHolderT.h"
+#include "ReferenceContainerNameIndex.h"
+#include "ReferenceT.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the ReferenceContainerNameIndex functions
+ */
+class ReferenceContainerNameIndexTest {
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Build indexes all the nodes of the list.
+     */
+    bool TestBuild();
+
+    /**
+     * @brief Tests that Build with an empty list builds an empty index.
+     */
+    bool TestBuild_Empty();
+
+    /**
+     * @brief Tests that Reset frees the index.
+     */
+    bool TestReset();
+
+    /**
+     * @brief Tests the IsBuilt method.
+     */
+    bool TestIsBuilt();
+
+    /**
+     * @brief Tests that Add indexes nodes beyond the initial capacity.
+     */
+    bool TestAdd();
+
+    /**
+     * @brief Tests that Add does nothing if the index is not built.
+     */
+    bool TestAdd_NotBuilt();
+
+    /**
+     * @brief Tests that Add does not index Objects without name.
+     */
+    bool TestAdd_NoName();
+
+    /**
+     * @brief Tests that Remove removes only the given node.
+     */
+    bool TestRemove();
+
+    /**
+     * @brief Tests that Remove finds a node whose Object was renamed after being indexed.
+     */
+    bool TestRemove_Renamed();
+
+    /**
+     * @brief Tests that the slots of the removed nodes are reused.
+     */
+    bool TestRemove_Reuse();
+
+    /**
+     * @brief Tests that Find returns the node with the given name.
+     */
+    bool TestFind();
+
+    /**
+     * @brief Tests that Find returns the number of nodes with the same name.
+     */
+    bool TestFind_Duplicated();
+
+    /**
+     * @brief Tests that Find compares only nameLength characters.
+     */
+    bool TestFind_NotTerminated();
+
+    /**
+     * @brief Tests that Find returns zero if the name is not indexed.
+     */
+    bool TestFind_NotFound();
+
+    /**
+     * @brief Tests the GetNumberOfEntries method.
+     */
+    bool TestGetNumberOfEntries();
+
+    /**
+     * @brief Tests the IsNamed method.
+     */
+    bool TestIsNamed();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REFERENCECONTAINERNAMEINDEXTEST_H_ */
@@ -36,6 +36,7 @@
 #include "ReferenceContainerFilterObjectName.h"
 #include "ReferenceContainerFilterReferences.h"
 #include "ReferenceContainerTest.h"
+#include "StreamString.h"
 #include "StringHelper.h"
 #include "Threads.h"
 
@@ -1194,6 +1195,233 @@ bool ReferenceContainerTest::TestRemoveDomainToken() {
     return TestIsDomainToken();
 }
 
+/**
+ * Inserts n objects named prefix0, prefix1, ... in the container.
+ */
+static bool InsertNamedObjects(ReferenceT<ReferenceContainer> container,
+                               const char8 * const prefix,
+                               const uint32 n) {
+    bool ok = true;
+    for (uint32 i = 0u; (i < n) && (ok); i++) {
+        ReferenceT<Object> obj(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        StreamString name;
+        name.Printf("%s%u", prefix, i);
+        obj->SetName(name.Buffer());
+        ok = container->Insert(obj);
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestFindWithPath_NameIndex() {
+    ReferenceT<ReferenceContainer> containerRoot("ReferenceContainer", h);
+    bool ok = InsertNamedObjects(containerRoot, "X", 2u * REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD);
+    Reference ref("Object");
+    if (ok) {
+        ok = containerRoot->Insert("A.B.C.MyObject", ref);
+    }
+    ReferenceT<ReferenceContainer> containerB = containerRoot->Find("A.B");
+    if (ok) {
+        ok = containerB.IsValid();
+    }
+    if (ok) {
+        ok = InsertNamedObjects(containerB, "Y", 2u * REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD);
+    }
+    if (ok) {
+        ok = (containerRoot->Find("A.B.C.MyObject") == ref);
+    }
+    if (ok) {
+        ok = (containerRoot->Find(".A.B.C.MyObject") == ref);
+    }
+    if (ok) {
+        ok = (containerRoot->Find("A.B.C.MyObject.") == ref);
+    }
+    if (ok) {
+        ok = !containerRoot->Find("A.B..C.MyObject").IsValid();
+    }
+    if (ok) {
+        ok = !containerRoot->Find("A.B.X3.MyObject").IsValid();
+    }
+    if (ok) {
+        ok = !containerRoot->Find("A.B.Y3.MyObject").IsValid();
+    }
+    if (ok) {
+        ok = containerRoot->Find("A.B.Y3").IsValid();
+    }
+    if (ok) {
+        ok = (containerRoot->Find("MyObject", true) == ref);
+    }
+    if (ok) {
+        ok = containerRoot->Delete("A.B.C.MyObject");
+    }
+    if (ok) {
+        ok = !containerRoot->Find("A.B.C.MyObject").IsValid();
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestFindChild() {
+    bool ok = true;
+    const uint32 sizes[] = { 3u, REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD, 100u };
+    for (uint32 s = 0u; (s < 3u) && (ok); s++) {
+        ReferenceT<ReferenceContainer> container("ReferenceContainer", h);
+        ok = InsertNamedObjects(container, "N", sizes[s]);
+        for (uint32 i = 0u; (i < sizes[s]) && (ok); i++) {
+            StreamString name;
+            name.Printf("N%u", i);
+            Reference found = container->FindChild(name.Buffer(), static_cast<uint32>(name.Size()));
+            ok = (found == container->Get(i));
+        }
+        if (ok) {
+            ok = !container->FindChild("N", 1u).IsValid();
+        }
+        if (ok) {
+            ok = (container->FindChild("N1.N2", 2u) == container->Get(1u));
+        }
+        if (ok) {
+            StreamString name;
+            name.Printf("N%u", sizes[s]);
+            ok = !container->FindChild(name.Buffer(), static_cast<uint32>(name.Size())).IsValid();
+        }
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestFindChild_Duplicated() {
+    ReferenceT<ReferenceContainer> container("ReferenceContainer", h);
+    bool ok = InsertNamedObjects(container, "N", 20u);
+    ReferenceT<Object> duplicated(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    duplicated->SetName("N5");
+    if (ok) {
+        ok = container->Insert(duplicated, 0);
+    }
+    if (ok) {
+        ok = (container->FindChild("N5", 2u) == duplicated);
+    }
+    if (ok) {
+        ok = container->Delete(duplicated);
+    }
+    if (ok) {
+        ok = (container->FindChild("N5", 2u) == container->Get(5u));
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestFindChild_Renamed() {
+    ReferenceT<ReferenceContainer> container("ReferenceContainer", h);
+    bool ok = InsertNamedObjects(container, "N", 20u);
+    //Build the index
+    if (ok) {
+        ok = container->FindChild("N0", 2u).IsValid();
+    }
+    Reference renamed = container->Get(7u);
+    renamed->SetName("Renamed");
+    if (ok) {
+        ok = (container->FindChild("Renamed", 7u) == renamed);
+    }
+    if (ok) {
+        ok = !container->FindChild("N7", 2u).IsValid();
+    }
+    if (ok) {
+        ok = (container->Find("Renamed") == renamed);
+    }
+    if (ok) {
+        ok = container->Delete(renamed);
+    }
+    if (ok) {
+        ok = !container->FindChild("Renamed", 7u).IsValid();
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestFindChild_Removed() {
+    ReferenceT<ReferenceContainer> container("ReferenceContainer", h);
+    bool ok = InsertNamedObjects(container, "N", 20u);
+    if (ok) {
+        ok = container->FindChild("N0", 2u).IsValid();
+    }
+    if (ok) {
+        ok = container->Delete("N3");
+    }
+    if (ok) {
+        ok = !container->FindChild("N3", 2u).IsValid();
+    }
+    if (ok) {
+        ok = (container->FindChild("N4", 2u) == container->Get(3u));
+    }
+    container->Purge();
+    if (ok) {
+        ok = !container->FindChild("N4", 2u).IsValid();
+    }
+    if (ok) {
+        ok = InsertNamedObjects(container, "N", 2u);
+    }
+    if (ok) {
+        ok = (container->FindChild("N1", 2u) == container->Get(1u));
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestGetGeneration() {
+    ReferenceT<ReferenceContainer> container("ReferenceContainer", h);
+    uint32 generation = container->GetGeneration();
+    bool ok = container->Insert(leafB);
+    if (ok) {
+        ok = (container->GetGeneration() != generation);
+    }
+    generation = container->GetGeneration();
+    if (ok) {
+        ok = (container->Find(leafB->GetName()) == leafB);
+    }
+    if (ok) {
+        ok = (container->GetGeneration() == generation);
+    }
+    if (ok) {
+        ok = container->Delete(leafB);
+    }
+    if (ok) {
+        ok = (container->GetGeneration() != generation);
+    }
+    generation = container->GetGeneration();
+    if (ok) {
+        ok = !container->Delete(leafB);
+    }
+    if (ok) {
+        ok = (container->GetGeneration() == generation);
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestFindRemoveAll_Large() {
+    ReferenceT<ReferenceContainer> container("ReferenceContainer", h);
+    bool ok = InsertNamedObjects(container, "N", 50u);
+    for (uint32 i = 0u; (i < 50u) && (ok); i += 2u) {
+        ReferenceT<Object> obj(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        obj->SetName("Removed");
+        ok = container->Insert(obj, static_cast<int32>(i));
+    }
+    if (ok) {
+        ok = (container->FindChild("Removed", 7u) == container->Get(0u));
+    }
+    ReferenceContainerFilterObjectName filter(-1, ReferenceContainerFilterMode::REMOVE, "Removed");
+    ReferenceContainer result;
+    container->Find(result, filter);
+    if (ok) {
+        ok = (result.Size() == 25u);
+    }
+    if (ok) {
+        ok = (container->Size() == 50u);
+    }
+    for (uint32 i = 0u; (i < 50u) && (ok); i++) {
+        StreamString name;
+        name.Printf("N%u", i);
+        ok = (container->FindChild(name.Buffer(), static_cast<uint32>(name.Size())) == container->Get(i));
+    }
+    if (ok) {
+        ok = !container->FindChild("Removed", 7u).IsValid();
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
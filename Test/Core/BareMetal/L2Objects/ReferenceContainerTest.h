@@ -320,6 +320,41 @@ public:
      */
     bool TestInsertWithPath();
 
+    /**
+     * @brief Tests the ReferenceContainer::Find with a path on containers large enough to use the name index.
+     */
+    bool TestFindWithPath_NameIndex();
+
+    /**
+     * @brief Tests the ReferenceContainer::FindChild function (with and without the name index).
+     */
+    bool TestFindChild();
+
+    /**
+     * @brief Tests that ReferenceContainer::FindChild returns the first of the elements with the same name.
+     */
+    bool TestFindChild_Duplicated();
+
+    /**
+     * @brief Tests that ReferenceContainer::FindChild finds an element renamed after being inserted.
+     */
+    bool TestFindChild_Renamed();
+
+    /**
+     * @brief Tests that ReferenceContainer::FindChild does not return removed elements.
+     */
+    bool TestFindChild_Removed();
+
+    /**
+     * @brief Tests that ReferenceContainer::GetGeneration changes when an element is inserted or removed.
+     */
+    bool TestGetGeneration();
+
+    /**
+     * @brief Tests that all the matching elements of a large container are removed with a search all filter.
+     */
+    bool TestFindRemoveAll_Large();
+
     /**
      * @brief Tests the ReferenceContainer::Insert function.
      * @details Creates an empty container and Inserts the following nodes to the end of the container: leafB, containerC, containerD, leafH
@@ -188,3 +188,101 @@ bool StreamStringIOBufferTest::TestWriteAll(uint32 writeSize,
     return StringHelper::CompareN(stringBuffer.Buffer(), string, writeSize) == 0;
 
 }
+
+bool StreamStringIOBufferTest::TestSmallBuffer() {
+    StreamStringIOBuffer smallStringBuffer(64u, true);
+    StreamStringIOBuffer stringBuffer(64u);
+    const char8 *string = "HelloWorld";
+    uint32 size = StringHelper::Length(string);
+    bool ok = smallStringBuffer.Write(string, size);
+    if (ok) {
+        size = StringHelper::Length(string);
+        ok = stringBuffer.Write(string, size);
+    }
+    if (ok) {
+        smallStringBuffer.Terminate();
+        ok = (StringHelper::Compare(smallStringBuffer.Buffer(), string) == 0);
+    }
+    if (ok) {
+        ok = smallStringBuffer.IsUsingSmallBuffer();
+    }
+    if (ok) {
+        ok = (smallStringBuffer.GetBufferSize() == STREAM_STRING_IO_BUFFER_SMALL_SIZE);
+    }
+    if (ok) {
+        ok = !stringBuffer.IsUsingSmallBuffer();
+    }
+    if (ok) {
+        //The largest string which fits in the small buffer
+        ok = smallStringBuffer.SetBufferAllocationSize(STREAM_STRING_IO_BUFFER_SMALL_SIZE - 1u);
+    }
+    if (ok) {
+        ok = smallStringBuffer.IsUsingSmallBuffer();
+    }
+    return ok;
+}
+
+bool StreamStringIOBufferTest::TestSmallBufferToHeap() {
+    StreamStringIOBuffer stringBuffer(64u, true);
+    const char8 *string = "0123456789";
+    uint32 size = StringHelper::Length(string);
+    bool ok = stringBuffer.Write(string, size);
+    if (ok) {
+        ok = stringBuffer.Seek(5u);
+    }
+    if (ok) {
+        //Moves to the heap and keeps the position
+        ok = stringBuffer.SetBufferAllocationSize(100u);
+    }
+    if (ok) {
+        ok = !stringBuffer.IsUsingSmallBuffer();
+    }
+    if (ok) {
+        ok = (stringBuffer.Position() == 5u) && (stringBuffer.UsedSize() == 10u);
+    }
+    if (ok) {
+        ok = (StringHelper::CompareN(stringBuffer.Buffer(), string, 10u) == 0);
+    }
+    for (uint32 i = 0u; (i < 10u) && (ok); i++) {
+        ok = stringBuffer.Seek(stringBuffer.UsedSize());
+        if (ok) {
+            size = StringHelper::Length(string);
+            ok = stringBuffer.Write(string, size);
+        }
+    }
+    if (ok) {
+        stringBuffer.Terminate();
+        ok = (StringHelper::Length(stringBuffer.Buffer()) == 110u);
+    }
+    if (ok) {
+        //Never goes back to the small buffer
+        ok = stringBuffer.SetBufferAllocationSize(5u);
+    }
+    if (ok) {
+        ok = !stringBuffer.IsUsingSmallBuffer();
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(stringBuffer.Buffer(), "01234") == 0);
+    }
+    return ok;
+}
+
+bool StreamStringIOBufferTest::TestSmallBufferTruncate() {
+    StreamStringIOBuffer stringBuffer(64u, true);
+    const char8 *string = "HelloWorld";
+    uint32 size = StringHelper::Length(string);
+    bool ok = stringBuffer.Write(string, size);
+    if (ok) {
+        ok = stringBuffer.SetBufferAllocationSize(5u);
+    }
+    if (ok) {
+        ok = stringBuffer.IsUsingSmallBuffer();
+    }
+    if (ok) {
+        ok = (stringBuffer.UsedSize() == 5u) && (stringBuffer.Position() == 5u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(stringBuffer.Buffer(), "Hello") == 0);
+    }
+    return ok;
+}
@@ -87,6 +87,21 @@ public:
     bool TestWriteAll(uint32 writeSize,
                       const char8 *string);
 
+    /**
+     * @brief Tests that short strings are stored in the small buffer (and only if it is enabled).
+     */
+    bool TestSmallBuffer();
+
+    /**
+     * @brief Tests that the content and the position are preserved when the string grows from the small buffer to the heap.
+     */
+    bool TestSmallBufferToHeap();
+
+    /**
+     * @brief Tests that SetBufferAllocationSize truncates a string stored in the small buffer.
+     */
+    bool TestSmallBufferTruncate();
+
 };
 
 /*---------------------------------------------------------------------------*/
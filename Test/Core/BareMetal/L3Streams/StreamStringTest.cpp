@@ -43,6 +43,56 @@
 /*---------------------------------------------------------------------------*/
 
 using namespace MARTe;
+
+/**
+ * @brief HeapI which counts the allocations and forwards them to the HeapManager.
+ */
+class StreamStringTestHeap: public HeapI {
+public:
+    StreamStringTestHeap() {
+        numberOfMallocs = 0u;
+        numberOfFrees = 0u;
+    }
+
+    virtual ~StreamStringTestHeap() {
+    }
+
+    virtual void *Malloc(const uint32 size) {
+        numberOfMallocs++;
+        return HeapManager::Malloc(size);
+    }
+
+    virtual void Free(void *&data) {
+        numberOfFrees++;
+        (void) HeapManager::Free(data);
+    }
+
+    virtual void *Realloc(void *&data,
+                          const uint32 newSize) {
+        return HeapManager::Realloc(data, newSize);
+    }
+
+    virtual void *Duplicate(const void * const data,
+                            uint32 size = 0U) {
+        return HeapManager::Duplicate(data, size);
+    }
+
+    virtual uintp FirstAddress() const {
+        return 0u;
+    }
+
+    virtual uintp LastAddress() const {
+        return 0u;
+    }
+
+    virtual const char8 *Name() const {
+        return "StreamStringTestHeap";
+    }
+
+    uint32 numberOfMallocs;
+    uint32 numberOfFrees;
+};
+
 static void cleanOutputBuffer(char8* buffer,
                               int32 size) {
     for (int32 i = 0; i < size; i++) {
@@ -628,3 +678,65 @@ bool StreamStringTest::TestGetToken(const TokenTestTableRow *table) {
     }
     return result;
 }
+
+bool StreamStringTest::TestSetHeap() {
+    StreamStringTestHeap heap;
+    {
+        StreamString string;
+        bool ok = string.SetHeap(&heap);
+        if (ok) {
+            ok = string.Printf("%s", "Short");
+        }
+        if (ok) {
+            ok = (heap.numberOfMallocs == 0u);
+        }
+        if (ok) {
+            ok = string.Printf("%s", " string which does no longer fit in the small buffer");
+        }
+        if (ok) {
+            ok = (heap.numberOfMallocs == 1u);
+        }
+        if (ok) {
+            ok = (string == "Short string which does no longer fit in the small buffer");
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return (heap.numberOfFrees == 1u);
+}
+
+bool StreamStringTest::TestSetHeap_AlreadyAllocated() {
+    StreamStringTestHeap heap;
+    StreamString string = "A string which does not fit in the small buffer";
+    bool ok = !string.SetHeap(&heap);
+    if (ok) {
+        ok = string.SetHeap(NULL_PTR(HeapI *));
+    }
+    if (ok) {
+        ok = (heap.numberOfMallocs == 0u);
+    }
+    return ok;
+}
+
+bool StreamStringTest::TestCopySmallString() {
+    StreamString *string = new StreamString("Small");
+    StreamString copy(*string);
+    StreamString assigned;
+    assigned = *string;
+    bool ok = string->Seek(0ull);
+    if (ok) {
+        ok = string->Printf("%s", "Other");
+    }
+    if (ok) {
+        ok = (copy == "Small") && (assigned == "Small");
+    }
+    delete string;
+    if (ok) {
+        ok = (copy.Buffer() != assigned.Buffer());
+    }
+    if (ok) {
+        ok = (copy == "Small") && (assigned == "Small");
+    }
+    return ok;
+}
@@ -253,6 +253,21 @@ public:
      */
     bool TestGetToken(const TokenTestTableRow *table);
 
+    /**
+     * @brief Tests that short strings do not allocate memory and that longer strings are allocated from the heap set with SetHeap.
+     */
+    bool TestSetHeap();
+
+    /**
+     * @brief Tests that SetHeap fails if the string already allocated memory from the heap.
+     */
+    bool TestSetHeap_AlreadyAllocated();
+
+    /**
+     * @brief Tests the copy of short strings (stored inside the StreamString).
+     */
+    bool TestCopySmallString();
+
 
 
 };
@@ -0,0 +1,746 @@
+/**
+ * @file ImmutableConfigurationDatabaseTest.cpp
+ * @brief Source file for class ImmutableConfigurationDatabaseTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ImmutableConfigurationDatabaseTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "ConfigurationDatabaseNode.h"
+#include "ImmutableConfigurationDatabaseTest.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+
+using namespace MARTe;
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static const char8 * const configTest = ""
+        "A = {"
+        "    B = {"
+        "        Value = 1"
+        "        Vector = {1 2 3}"
+        "        Matrix = {{1 2} {3 4} {5 6}}"
+        "        Strings = {\"a\" \"bb\" \"ccc\"}"
+        "        StringMatrix = {{\"a\" \"b\"} {\"c\" \"d\"}}"
+        "    }"
+        "    C = {"
+        "        Value = 2"
+        "    }"
+        "    Name = \"Hello\""
+        "}"
+        "D = -3.5";
+
+static bool ParseConfiguration(StructuredDataI &database) {
+    StreamString config = configTest;
+    config.Seek(0LLU);
+    StandardParser parser(config, database);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = database.MoveToRoot();
+    }
+    return ok;
+}
+
+static bool CheckConfiguration(StructuredDataI &database) {
+    bool ok = database.MoveAbsolute("A.B");
+    uint32 value = 0u;
+    if (ok) {
+        ok = database.Read("Value", value);
+    }
+    if (ok) {
+        ok = (value == 1u);
+    }
+    uint32 vector[3];
+    if (ok) {
+        ok = database.Read("Vector", vector);
+    }
+    if (ok) {
+        ok = (vector[0] == 1u) && (vector[1] == 2u) && (vector[2] == 3u);
+    }
+    int32 matrix[3][2];
+    if (ok) {
+        ok = database.Read("Matrix", matrix);
+    }
+    if (ok) {
+        ok = (matrix[0][0] == 1) && (matrix[0][1] == 2) && (matrix[1][0] == 3) && (matrix[1][1] == 4) && (matrix[2][0] == 5) && (matrix[2][1] == 6);
+    }
+    StreamString strings[3];
+    if (ok) {
+        ok = database.Read("Strings", strings);
+    }
+    if (ok) {
+        ok = (strings[0] == "a") && (strings[1] == "bb") && (strings[2] == "ccc");
+    }
+    StreamString stringMatrix[2][2];
+    if (ok) {
+        ok = database.Read("StringMatrix", stringMatrix);
+    }
+    if (ok) {
+        ok = (stringMatrix[0][0] == "a") && (stringMatrix[0][1] == "b") && (stringMatrix[1][0] == "c") && (stringMatrix[1][1] == "d");
+    }
+    if (ok) {
+        ok = database.MoveAbsolute("A.C");
+    }
+    if (ok) {
+        ok = database.Read("Value", value);
+    }
+    if (ok) {
+        ok = (value == 2u);
+    }
+    if (ok) {
+        ok = database.MoveToAncestor(1u);
+    }
+    StreamString name;
+    if (ok) {
+        ok = database.Read("Name", name);
+    }
+    if (ok) {
+        ok = (name == "Hello");
+    }
+    float32 d = 0.0F;
+    if (ok) {
+        ok = database.MoveToRoot();
+    }
+    if (ok) {
+        ok = database.Read("D", d);
+    }
+    if (ok) {
+        ok = (d == -3.5F);
+    }
+    if (ok) {
+        ok = database.MoveToRoot();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+bool ImmutableConfigurationDatabaseTest::TestDefaultConstructor() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = !icdb.IsFrozen();
+    if (ok) {
+        ok = (icdb.GetNumberOfChildren() == 0u);
+    }
+    if (ok) {
+        ok = (icdb.GetName() == NULL);
+    }
+    if (ok) {
+        ok = icdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = (icdb.GetMemorySize() > 0u);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestCopyConstructor() {
+    ImmutableConfigurationDatabase *icdb = new ImmutableConfigurationDatabase();
+    bool ok = ParseConfiguration(*icdb);
+    if (ok) {
+        icdb->Freeze();
+        ok = icdb->MoveAbsolute("A.C");
+    }
+    ImmutableConfigurationDatabase copy(*icdb);
+    if (ok) {
+        ok = copy.IsFrozen();
+    }
+    if (ok) {
+        //Starts from the current node of the source
+        ok = (StringHelper::Compare(copy.GetName(), "C") == 0);
+    }
+    if (ok) {
+        ok = copy.MoveAbsolute("A.B");
+    }
+    if (ok) {
+        //The source did not move
+        ok = (StringHelper::Compare(icdb->GetName(), "C") == 0);
+    }
+    delete icdb;
+    //The storage must still be valid
+    if (ok) {
+        ok = CheckConfiguration(copy);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestWriteRead_Scalars() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = icdb.Write("UInt32", 7u);
+    if (ok) {
+        ok = icdb.Write("Float64", 1.5);
+    }
+    if (ok) {
+        ok = icdb.Write("CString", "Hello");
+    }
+    StreamString sString = "World";
+    if (ok) {
+        ok = icdb.Write("SString", sString);
+    }
+    //The source values are copied
+    sString = "";
+    uint32 uint32Value = 0u;
+    if (ok) {
+        ok = icdb.Read("UInt32", uint32Value);
+    }
+    if (ok) {
+        ok = (uint32Value == 7u);
+    }
+    float64 float64Value = 0.0;
+    if (ok) {
+        ok = icdb.Read("Float64", float64Value);
+    }
+    if (ok) {
+        ok = (float64Value == 1.5);
+    }
+    StreamString value;
+    if (ok) {
+        ok = icdb.Read("CString", value);
+    }
+    if (ok) {
+        ok = (value == "Hello");
+    }
+    if (ok) {
+        value = "";
+        ok = icdb.Read("SString", value);
+    }
+    if (ok) {
+        ok = (value == "World");
+    }
+    if (ok) {
+        //Converted on read
+        value = "";
+        ok = icdb.Read("UInt32", value);
+    }
+    if (ok) {
+        ok = (value == "7");
+    }
+    if (ok) {
+        ok = !icdb.Read("DoesNotExist", uint32Value);
+    }
+    if (ok) {
+        ok = !icdb.Write("", uint32Value);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestWriteRead_VectorsMatrices() {
+    ImmutableConfigurationDatabase icdb;
+    int32 vector[4] = { 1, -2, 3, -4 };
+    bool ok = icdb.Write("Vector", vector);
+    float32 matrix[2][3] = { { 1.0F, 2.0F, 3.0F }, { 4.0F, 5.0F, 6.0F } };
+    if (ok) {
+        ok = icdb.Write("Matrix", matrix);
+    }
+    const char8 *strings[3] = { "A", "BB", "CCC" };
+    if (ok) {
+        ok = icdb.Write("Strings", strings);
+    }
+    int32 vectorRead[4];
+    if (ok) {
+        ok = icdb.Read("Vector", vectorRead);
+    }
+    for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+        ok = (vectorRead[i] == vector[i]);
+    }
+    float32 matrixRead[2][3];
+    if (ok) {
+        ok = icdb.Read("Matrix", matrixRead);
+    }
+    for (uint32 r = 0u; (r < 2u) && (ok); r++) {
+        for (uint32 c = 0u; (c < 3u) && (ok); c++) {
+            ok = (matrixRead[r][c] == matrix[r][c]);
+        }
+    }
+    StreamString stringsRead[3];
+    if (ok) {
+        ok = icdb.Read("Strings", stringsRead);
+    }
+    for (uint32 i = 0u; (i < 3u) && (ok); i++) {
+        ok = (stringsRead[i] == strings[i]);
+    }
+    ImmutableConfigurationDatabase parsed;
+    if (ok) {
+        ok = ParseConfiguration(parsed);
+    }
+    if (ok) {
+        ok = CheckConfiguration(parsed);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestWrite_Overwrite() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = icdb.Write("A", 1u);
+    if (ok) {
+        ok = icdb.Write("B", 2u);
+    }
+    if (ok) {
+        ok = icdb.Write("A", "Replaced");
+    }
+    if (ok) {
+        ok = (icdb.GetNumberOfChildren() == 2u);
+    }
+    if (ok) {
+        //Keeps its position
+        ok = (StringHelper::Compare(icdb.GetChildName(0u), "A") == 0);
+    }
+    StreamString value;
+    if (ok) {
+        ok = icdb.Read("A", value);
+    }
+    if (ok) {
+        ok = (value == "Replaced");
+    }
+    if (ok) {
+        ok = icdb.CreateRelative("C");
+    }
+    if (ok) {
+        ok = icdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = !icdb.Write("C", 3u);
+    }
+    if (ok) {
+        //Cannot create a node over a leaf
+        ok = !icdb.CreateRelative("A");
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestRead_StructuredData() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = ParseConfiguration(icdb);
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = icdb.Read("A", cdb);
+    }
+    if (ok) {
+        //The current node was restored
+        ok = (icdb.GetName() == NULL);
+    }
+    uint32 value = 0u;
+    if (ok) {
+        ok = cdb.MoveAbsolute("B");
+    }
+    if (ok) {
+        ok = cdb.Read("Value", value);
+    }
+    if (ok) {
+        ok = (value == 1u);
+    }
+    if (ok) {
+        ok = !icdb.Read("D", cdb);
+    }
+    ImmutableConfigurationDatabase written;
+    if (ok) {
+        ok = written.Write("X", cdb);
+    }
+    if (ok) {
+        ok = written.MoveAbsolute("X");
+    }
+    if (ok) {
+        ok = written.Read("Value", value);
+    }
+    if (ok) {
+        ok = (value == 1u);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestGetType() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = ParseConfiguration(icdb);
+    AnyType at;
+    if (ok) {
+        at = icdb.GetType("D");
+        ok = (at.GetDataPointer() != NULL);
+    }
+    if (ok) {
+        ok = (at.GetNumberOfDimensions() == 0u);
+    }
+    if (ok) {
+        ok = icdb.MoveAbsolute("A.B");
+    }
+    if (ok) {
+        at = icdb.GetType("Matrix");
+        ok = (at.GetNumberOfDimensions() == 2u);
+    }
+    if (ok) {
+        ok = (at.GetNumberOfElements(0u) == 2u) && (at.GetNumberOfElements(1u) == 3u);
+    }
+    if (ok) {
+        at = icdb.GetType("Vector");
+        ok = (at.GetNumberOfDimensions() == 1u) && (at.GetNumberOfElements(0u) == 3u);
+    }
+    if (ok) {
+        //Nodes and missing leafs
+        ok = icdb.MoveToRoot();
+    }
+    if (ok) {
+        at = icdb.GetType("A");
+        ok = (at.GetDataPointer() == NULL);
+    }
+    if (ok) {
+        at = icdb.GetType("DoesNotExist");
+        ok = (at.GetDataPointer() == NULL);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestCreate() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = icdb.CreateAbsolute("A.B.C");
+    if (ok) {
+        ok = (StringHelper::Compare(icdb.GetName(), "C") == 0);
+    }
+    if (ok) {
+        ok = icdb.CreateRelative("D");
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(icdb.GetName(), "D") == 0);
+    }
+    if (ok) {
+        //Reuses the existing nodes
+        ok = icdb.CreateAbsolute(".A..B.E.");
+    }
+    if (ok) {
+        ok = icdb.MoveAbsolute("A.B");
+    }
+    if (ok) {
+        ok = (icdb.GetNumberOfChildren() == 2u);
+    }
+    if (ok) {
+        //Already exists
+        ok = !icdb.CreateAbsolute("A.B");
+    }
+    if (ok) {
+        //Restores the current node on failure
+        ok = (StringHelper::Compare(icdb.GetName(), "B") == 0);
+    }
+    if (ok) {
+        ok = !icdb.CreateRelative("");
+    }
+    if (ok) {
+        ok = !icdb.CreateRelative(".");
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestMove() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = ParseConfiguration(icdb);
+    if (ok) {
+        icdb.Freeze();
+        ok = icdb.MoveAbsolute("A.B");
+    }
+    if (ok) {
+        ok = icdb.MoveToAncestor(2u);
+    }
+    if (ok) {
+        ok = (icdb.GetName() == NULL);
+    }
+    if (ok) {
+        ok = icdb.MoveRelative("A");
+    }
+    if (ok) {
+        ok = icdb.MoveRelative("C");
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(icdb.GetName(), "C") == 0);
+    }
+    if (ok) {
+        //Past the root
+        ok = !icdb.MoveToAncestor(3u);
+    }
+    if (ok) {
+        ok = !icdb.MoveToAncestor(0u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(icdb.GetName(), "C") == 0);
+    }
+    if (ok) {
+        //Leafs
+        ok = !icdb.MoveRelative("Value");
+    }
+    if (ok) {
+        ok = !icdb.MoveAbsolute("D");
+    }
+    if (ok) {
+        ok = !icdb.MoveAbsolute("A.B.Value");
+    }
+    if (ok) {
+        ok = !icdb.MoveAbsolute("A.X");
+    }
+    if (ok) {
+        ok = !icdb.MoveAbsolute("");
+    }
+    if (ok) {
+        ok = icdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = icdb.MoveToChild(0u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(icdb.GetName(), "A") == 0);
+    }
+    if (ok) {
+        ok = icdb.MoveToChild(1u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(icdb.GetName(), "C") == 0);
+    }
+    if (ok) {
+        ok = icdb.MoveToRoot();
+    }
+    if (ok) {
+        //D is a leaf
+        ok = !icdb.MoveToChild(1u);
+    }
+    if (ok) {
+        ok = !icdb.MoveToChild(2u);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestGetChildName() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = ParseConfiguration(icdb);
+    const char8 * const expected[] = { "Value", "Vector", "Matrix", "Strings", "StringMatrix" };
+    for (uint32 frozen = 0u; (frozen < 2u) && (ok); frozen++) {
+        if (frozen > 0u) {
+            icdb.Freeze();
+        }
+        ok = icdb.MoveAbsolute("A.B");
+        if (ok) {
+            ok = (icdb.GetNumberOfChildren() == 5u);
+        }
+        for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+            ok = (StringHelper::Compare(icdb.GetChildName(i), expected[i]) == 0);
+        }
+        if (ok) {
+            ok = (icdb.GetChildName(5u) == NULL);
+        }
+        if (ok) {
+            ok = (StringHelper::Compare(icdb.GetName(), "B") == 0);
+        }
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestFreeze() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = ParseConfiguration(icdb);
+    if (ok) {
+        icdb.Freeze();
+        ok = icdb.IsFrozen();
+    }
+    if (ok) {
+        ok = !icdb.Write("E", 1u);
+    }
+    if (ok) {
+        ok = !icdb.Write("D", 1u);
+    }
+    if (ok) {
+        ok = !icdb.CreateAbsolute("E");
+    }
+    if (ok) {
+        ok = !icdb.CreateRelative("E");
+    }
+    if (ok) {
+        //Freezing twice has no effect
+        icdb.Freeze();
+        ok = CheckConfiguration(icdb);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestDeleteAddToCurrentNode() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = ParseConfiguration(icdb);
+    if (ok) {
+        ok = !icdb.Delete("D");
+    }
+    ReferenceT<ConfigurationDatabaseNode> node(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ok) {
+        ok = !icdb.AddToCurrentNode(node);
+    }
+    if (ok) {
+        ok = CheckConfiguration(icdb);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestCopy() {
+    ConfigurationDatabase cdb;
+    bool ok = ParseConfiguration(cdb);
+    ImmutableConfigurationDatabase icdb;
+    if (ok) {
+        ok = cdb.Copy(icdb);
+    }
+    if (ok) {
+        icdb.Freeze();
+        ok = CheckConfiguration(icdb);
+    }
+    ConfigurationDatabase cdbCopy;
+    if (ok) {
+        ok = icdb.Copy(cdbCopy);
+    }
+    if (ok) {
+        ok = cdbCopy.MoveToRoot();
+    }
+    if (ok) {
+        ok = CheckConfiguration(cdbCopy);
+    }
+    //From a node
+    ConfigurationDatabase cdbNode;
+    if (ok) {
+        ok = icdb.MoveAbsolute("A");
+    }
+    if (ok) {
+        ok = icdb.Copy(cdbNode);
+    }
+    if (ok) {
+        ok = cdbNode.MoveToRoot();
+    }
+    uint32 value = 0u;
+    if (ok) {
+        ok = cdbNode.MoveAbsolute("C");
+    }
+    if (ok) {
+        ok = cdbNode.Read("Value", value);
+    }
+    if (ok) {
+        ok = (value == 2u);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestInitialise() {
+    ConfigurationDatabase cdb;
+    bool ok = ParseConfiguration(cdb);
+    if (ok) {
+        ok = cdb.MoveAbsolute("A");
+    }
+    ImmutableConfigurationDatabase icdb;
+    if (ok) {
+        ok = icdb.Initialise(cdb);
+    }
+    if (ok) {
+        ok = icdb.IsFrozen();
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(icdb.GetName(), "A") == 0);
+    }
+    if (ok) {
+        ok = (icdb.GetNumberOfChildren() == 3u);
+    }
+    uint32 value = 0u;
+    if (ok) {
+        ok = icdb.MoveRelative("B");
+    }
+    if (ok) {
+        ok = icdb.Read("Value", value);
+    }
+    if (ok) {
+        ok = (value == 1u);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestStandardParser() {
+    ImmutableConfigurationDatabase icdb;
+    bool ok = ParseConfiguration(icdb);
+    if (ok) {
+        ok = CheckConfiguration(icdb);
+    }
+    if (ok) {
+        icdb.Freeze();
+        ok = CheckConfiguration(icdb);
+    }
+    return ok;
+}
+
+bool ImmutableConfigurationDatabaseTest::TestManyEntries() {
+    const uint32 numberOfNodes = 100u;
+    const uint32 numberOfLeafs = 50u;
+    ImmutableConfigurationDatabase icdb;
+    bool ok = true;
+    char8 name[32];
+    for (uint32 n = 0u; (n < numberOfNodes) && (ok); n++) {
+        StringHelper::Copy(name, "Node");
+        name[4] = static_cast<char8>('0' + (n / 10u));
+        name[5] = static_cast<char8>('0' + (n % 10u));
+        name[6] = '\0';
+        ok = icdb.CreateAbsolute(name);
+        for (uint32 l = 0u; (l < numberOfLeafs) && (ok); l++) {
+            //The leaf names are shared by all the nodes
+            StringHelper::Copy(name, "Leaf");
+            name[4] = static_cast<char8>('0' + (l / 10u));
+            name[5] = static_cast<char8>('0' + (l % 10u));
+            name[6] = '\0';
+            ok = icdb.Write(name, (n * numberOfLeafs) + l);
+        }
+    }
+    if (ok) {
+        icdb.Freeze();
+        ok = icdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = (icdb.GetNumberOfChildren() == numberOfNodes);
+    }
+    for (uint32 n = 0u; (n < numberOfNodes) && (ok); n++) {
+        ok = icdb.MoveToChild(n);
+        if (ok) {
+            ok = (icdb.GetNumberOfChildren() == numberOfLeafs);
+        }
+        for (uint32 l = 0u; (l < numberOfLeafs) && (ok); l++) {
+            uint32 value = 0u;
+            ok = icdb.Read(icdb.GetChildName(l), value);
+            if (ok) {
+                ok = (value == ((n * numberOfLeafs) + l));
+            }
+        }
+        if (ok) {
+            ok = icdb.MoveToAncestor(1u);
+        }
+    }
+    if (ok) {
+        ok = icdb.MoveAbsolute("Node42");
+    }
+    uint32 value = 0u;
+    if (ok) {
+        ok = icdb.Read("Leaf07", value);
+    }
+    if (ok) {
+        ok = (value == ((42u * numberOfLeafs) + 7u));
+    }
+    return ok;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file ImmutableConfigurationDatabaseTest.h
+ * @brief Header file for class ImmutableConfigurationDatabaseTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ImmutableConfigurationDatabaseTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef IMMUTABLECONFIGURATIONDATABASETEST_H_
+#define IMMUTABLECONFIGURATIONDATABASETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ImmutableConfigurationDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the ImmutableConfigurationDatabase functions.
+ */
+class ImmutableConfigurationDatabaseTest {
+public:
+    /**
+     * @brief Tests that the default constructor creates an empty root node which is not frozen.
+     */
+    bool TestDefaultConstructor();
+
+    /**
+     * @brief Tests that the copy constructor shares the database but moves independently.
+     */
+    bool TestCopyConstructor();
+
+    /**
+     * @brief Tests the Write and Read functions with scalar values.
+     */
+    bool TestWriteRead_Scalars();
+
+    /**
+     * @brief Tests the Write and Read functions with vectors and matrices.
+     */
+    bool TestWriteRead_VectorsMatrices();
+
+    /**
+     * @brief Tests that writing an existing leaf replaces its value and that a node cannot be overwritten.
+     */
+    bool TestWrite_Overwrite();
+
+    /**
+     * @brief Tests the Read function with a StructuredDataI (i.e. reading a node).
+     */
+    bool TestRead_StructuredData();
+
+    /**
+     * @brief Tests the GetType function.
+     */
+    bool TestGetType();
+
+    /**
+     * @brief Tests the CreateAbsolute and CreateRelative functions.
+     */
+    bool TestCreate();
+
+    /**
+     * @brief Tests the MoveToRoot, MoveAbsolute, MoveRelative, MoveToAncestor and MoveToChild functions.
+     */
+    bool TestMove();
+
+    /**
+     * @brief Tests the GetName, GetChildName and GetNumberOfChildren functions (before and after Freeze).
+     */
+    bool TestGetChildName();
+
+    /**
+     * @brief Tests that Freeze disables any modification.
+     */
+    bool TestFreeze();
+
+    /**
+     * @brief Tests that Delete and AddToCurrentNode are not supported.
+     */
+    bool TestDeleteAddToCurrentNode();
+
+    /**
+     * @brief Tests the Copy function from and to a ConfigurationDatabase.
+     */
+    bool TestCopy();
+
+    /**
+     * @brief Tests the Initialise function.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the StandardParser can write directly to the database.
+     */
+    bool TestStandardParser();
+
+    /**
+     * @brief Tests a database with enough entries and names to grow all the internal tables.
+     */
+    bool TestManyEntries();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* IMMUTABLECONFIGURATIONDATABASETEST_H_ */
@@ -629,3 +629,75 @@ bool LexicalAnalyzerTest::TestComments() {
     return tok->GetId() == EOF_TOKEN;
 
 }
+
+bool LexicalAnalyzerTest::TestGetTokenAcrossReadBlocks() {
+    StreamString configString;
+    const uint32 numberOfEntries = (3u * LEXICAL_ANALYZER_READ_BLOCK_SIZE) / 16u;
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfEntries) && (ok); i++) {
+        ok = configString.Printf("Var%d = \"%d\"\n", i, i);
+    }
+    ok &= configString.Seek(0);
+
+    LexicalAnalyzer la(configString, "{}=", " ,\n", "//", "/*", "*/");
+    for (uint32 i = 0u; (i < numberOfEntries) && (ok); i++) {
+        StreamString name;
+        StreamString value;
+        ok = name.Printf("Var%d", i);
+        ok &= value.Printf("%d", i);
+        Token *tok = la.GetToken();
+        ok &= (tok->GetId() == STRING_TOKEN);
+        ok &= (StringHelper::Compare(tok->GetData(), name.Buffer()) == 0);
+        ok &= (tok->GetLineNumber() == (i + 1u));
+        tok = la.GetToken();
+        ok &= (tok->GetId() == TERMINAL_TOKEN);
+        ok &= (StringHelper::Compare(tok->GetData(), "=") == 0);
+        tok = la.GetToken();
+        ok &= (tok->GetId() == STRING_TOKEN);
+        ok &= (StringHelper::Compare(tok->GetData(), value.Buffer()) == 0);
+        ok &= (tok->GetLineNumber() == (i + 1u));
+    }
+    if (ok) {
+        ok = (la.GetToken()->GetId() == EOF_TOKEN);
+    }
+    return ok;
+}
+
+bool LexicalAnalyzerTest::TestKeywordAcrossReadBlocks() {
+    StreamString configString;
+    bool ok = true;
+    //The < is the last character of the first block
+    while ((configString.Size() < (LEXICAL_ANALYZER_READ_BLOCK_SIZE - 2u)) && (ok)) {
+        ok = configString.Printf("%s", " ");
+    }
+    ok &= configString.Printf("%s", "A<=B");
+    ok &= configString.Seek(0);
+
+    LexicalAnalyzer la(configString, "<=", " \n", "//", "/*", "*/", "<= >=");
+    Token *tok = la.GetToken();
+    ok &= (tok->GetId() == STRING_TOKEN);
+    ok &= (StringHelper::Compare(tok->GetData(), "A") == 0);
+    tok = la.GetToken();
+    ok &= (tok->GetId() == TERMINAL_TOKEN);
+    ok &= (StringHelper::Compare(tok->GetData(), "<=") == 0);
+    tok = la.GetToken();
+    ok &= (tok->GetId() == STRING_TOKEN);
+    ok &= (StringHelper::Compare(tok->GetData(), "B") == 0);
+    tok = la.GetToken();
+    ok &= (tok->GetId() == EOF_TOKEN);
+    return ok;
+}
+
+bool LexicalAnalyzerTest::TestStreamPositionRestored() {
+    StreamString configString = "a = 1 b = 2";
+    bool ok = configString.Seek(0);
+    {
+        LexicalAnalyzer la(configString, "{}=", " ,\n", "//", "/*", "*/");
+        ok &= (StringHelper::Compare(la.GetToken()->GetData(), "a") == 0);
+        ok &= (StringHelper::Compare(la.GetToken()->GetData(), "=") == 0);
+        ok &= (StringHelper::Compare(la.GetToken()->GetData(), "1") == 0);
+    }
+    //"a = 1 " was consumed
+    ok &= (configString.Position() == 6u);
+    return ok;
+}
@@ -68,6 +68,22 @@ public:
      * @brief Tests that the lexical analyzer skips correctly comments in the stream.
      */
     bool TestComments();
+
+    /**
+     * @brief Tests that the tokens and the line numbers are correct when the stream is longer than a read block
+     * (i.e. with tokens split between two blocks).
+     */
+    bool TestGetTokenAcrossReadBlocks();
+
+    /**
+     * @brief Tests that a keyword split between two read blocks is recognised.
+     */
+    bool TestKeywordAcrossReadBlocks();
+
+    /**
+     * @brief Tests that when the lexer is destroyed the stream position is the one of the first character not consumed.
+     */
+    bool TestStreamPositionRestored();
 };
 
 /*---------------------------------------------------------------------------*/
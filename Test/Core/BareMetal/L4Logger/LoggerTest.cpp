@@ -30,13 +30,53 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
 #include "Logger.h"
 #include "LoggerTest.h"
+#include "Sleep.h"
 #include "StreamString.h"
+#include "Threads.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+/**
+ * @brief Wake up function for the tests. Counts the number of calls.
+ */
+static void LoggerTestWakeUp(void * const parameter) {
+    MARTe::uint32 *counter = static_cast<MARTe::uint32 *>(parameter);
+    (*counter)++;
+}
+
+/**
+ * @brief Slow wake up function for the tests. Sets the state to 1 while it is running and to 2 when it returns.
+ */
+static void LoggerTestSlowWakeUp(void * const parameter) {
+    volatile MARTe::int32 *state = static_cast<volatile MARTe::int32 *>(parameter);
+    (void) MARTe::Atomic::Exchange(state, 1);
+    MARTe::Sleep::MSec(200u);
+    (void) MARTe::Atomic::Exchange(state, 2);
+}
+
+/**
+ * @brief Adds a log from another thread, so that the wake up function is called by that thread.
+ */
+static void LoggerTestAddLogThread(volatile MARTe::int32 * const done) {
+    REPORT_ERROR_STATIC(MARTe::ErrorManagement::Information, "TestSetWakeUpFunction_WaitsForCallers");
+    (void) MARTe::Atomic::Exchange(done, 1);
+}
+
+/**
+ * @brief Returns all the pending pages to the Logger.
+ */
+static void LoggerTestEmpty(MARTe::Logger * const logger) {
+    using namespace MARTe;
+    LoggerPage *entry = logger->GetLogEntry();
+    while (entry != NULL) {
+        logger->ReturnPage(entry);
+        entry = logger->GetLogEntry();
+    }
+}
 
 bool LoggerTest::TestConstructor() {
     using namespace MARTe;
@@ -163,6 +203,289 @@ bool LoggerTest::TestGetNumberOfLogs() {
     return ok;
 }
 
+bool LoggerTest::TestSetDeferredFormatting() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    logger->SetDeferredFormatting(true);
+    bool ok = logger->IsDeferredFormatting();
+    if (ok) {
+        ok = (ErrorManagement::deferredErrorProcessFunction != NULL);
+    }
+    logger->SetDeferredFormatting(false);
+    if (ok) {
+        ok = !logger->IsDeferredFormatting();
+    }
+    if (ok) {
+        ok = (ErrorManagement::deferredErrorProcessFunction == NULL);
+    }
+    return ok;
+}
+
+bool LoggerTest::TestIsDeferredFormatting() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    bool ok = !logger->IsDeferredFormatting();
+    logger->SetDeferredFormatting(true);
+    if (ok) {
+        ok = logger->IsDeferredFormatting();
+    }
+    logger->SetDeferredFormatting(false);
+    return ok;
+}
+
+bool LoggerTest::TestSetDeferredFormatting_SetErrorProcessFunction() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    logger->SetDeferredFormatting(true);
+    bool ok = logger->IsDeferredFormatting();
+    //Re-registering the (same) immediate callback must reset the deferred one
+    ErrorManagement::ErrorProcessFunctionType current = ErrorManagement::errorMessageProcessFunction;
+    ErrorManagement::SetErrorProcessFunction(current);
+    if (ok) {
+        ok = !logger->IsDeferredFormatting();
+    }
+    logger->SetDeferredFormatting(false);
+    return ok;
+}
+
+bool LoggerTest::TestLoggerDeferredErrorProcessFunction() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerPage *entry = logger->GetLogEntry();
+    //Empty all the entries
+    while (entry != NULL) {
+        logger->ReturnPage(entry);
+        entry = logger->GetLogEntry();
+    }
+    logger->SetDeferredFormatting(true);
+    int32 i32 = -7;
+    uint8 u8 = 200u;
+    uint64 u64 = 0xFFFFFFFFFFull;
+    float32 f32 = 1.5F;
+    float64 f64 = -2.25;
+    bool b = true;
+    char8 c = 'M';
+    const char8 *str = "MARTe";
+    void *ptr = &i32;
+    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Deferred %d %d %d %f %f %d %c %s %p", i32, u8, u64, f32, f64, b, c, str, ptr);
+    //The parameters may be changed after the call without affecting the message
+    i32 = 0;
+    str = "Other";
+    //More than one page pending
+    uint32 n;
+    for (n = 0u; n < 10u; n++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Deferred %d", n);
+    }
+    logger->SetDeferredFormatting(false);
+
+    StreamString toCompare;
+    toCompare.Printf("Deferred %d %d %d %f %f %d %c %s %p", -7, u8, u64, f32, f64, b, c, "MARTe", ptr);
+    entry = logger->GetLogEntry();
+    bool ok = (entry != NULL);
+    if (ok) {
+        ok = (entry->errorInfo.header.errorType == ErrorManagement::Warning);
+    }
+    if (ok) {
+        ok = (toCompare == entry->errorStrBuffer);
+    }
+    if (entry != NULL) {
+        logger->ReturnPage(entry);
+    }
+    for (n = 0u; (n < 10u) && (ok); n++) {
+        entry = logger->GetLogEntry();
+        ok = (entry != NULL);
+        if (ok) {
+            ok = (entry->errorInfo.header.errorType == ErrorManagement::Information);
+        }
+        if (ok) {
+            toCompare = "";
+            toCompare.Printf("Deferred %d", n);
+            ok = (toCompare == entry->errorStrBuffer);
+        }
+        if (entry != NULL) {
+            logger->ReturnPage(entry);
+        }
+    }
+    return ok;
+}
+
+bool LoggerTest::TestLoggerDeferredErrorProcessFunction_Fallback() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerPage *entry = logger->GetLogEntry();
+    //Empty all the entries
+    while (entry != NULL) {
+        logger->ReturnPage(entry);
+        entry = logger->GetLogEntry();
+    }
+    logger->SetDeferredFormatting(true);
+    StreamString name = "Streamed";
+    uint32 value = 3u;
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "Fallback %s %d", name, value);
+    logger->SetDeferredFormatting(false);
+
+    entry = logger->GetLogEntry();
+    bool ok = (entry != NULL);
+    if (ok) {
+        StreamString toCompare;
+        toCompare.Printf("Fallback %s %d", name, value);
+        ok = (toCompare == entry->errorStrBuffer);
+    }
+    if (entry != NULL) {
+        logger->ReturnPage(entry);
+    }
+    return ok;
+}
+
+bool LoggerTest::TestLoggerDeferredErrorProcessFunction_TooLong() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerPage *entry = logger->GetLogEntry();
+    //Empty all the entries
+    while (entry != NULL) {
+        logger->ReturnPage(entry);
+        entry = logger->GetLogEntry();
+    }
+    char8 longString[MAX_ERROR_MESSAGE_SIZE];
+    (void) MemoryOperationsHelper::Set(&longString[0], 'x', MAX_ERROR_MESSAGE_SIZE - 1u);
+    longString[MAX_ERROR_MESSAGE_SIZE - 1u] = '\0';
+    const char8 *longStringPtr = &longString[0];
+    logger->SetDeferredFormatting(true);
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TooLong %s", longStringPtr);
+    logger->SetDeferredFormatting(false);
+
+    entry = logger->GetLogEntry();
+    bool ok = (entry != NULL);
+    if (ok) {
+        StreamString toCompare;
+        toCompare.Printf("TooLong %s", longStringPtr);
+        //The immediate formatting truncates the message to the page size
+        ok = (StringHelper::CompareN(entry->errorStrBuffer, toCompare.Buffer(), 100u) == 0);
+    }
+    if (entry != NULL) {
+        logger->ReturnPage(entry);
+    }
+    return ok;
+}
+
+bool LoggerTest::TestSetWakeUpFunction() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerTestEmpty(logger);
+    uint32 counter = 0u;
+    logger->SetWakeUpFunction(&LoggerTestWakeUp, &counter);
+    bool ok = logger->PrepareWait();
+    //Only the first log after PrepareWait calls the wake up function
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TestSetWakeUpFunction 1");
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TestSetWakeUpFunction 2");
+    if (ok) {
+        ok = (counter == 1u);
+    }
+    LoggerTestEmpty(logger);
+    //Disabled
+    logger->SetWakeUpFunction(NULL_PTR(LoggerWakeUpFunctionType), NULL_PTR(void *));
+    if (ok) {
+        ok = logger->PrepareWait();
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TestSetWakeUpFunction 3");
+    if (ok) {
+        ok = (counter == 1u);
+    }
+    logger->CancelWait();
+    LoggerTestEmpty(logger);
+    return ok;
+}
+
+bool LoggerTest::TestSetWakeUpFunction_WaitsForCallers() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerTestEmpty(logger);
+    volatile int32 state = 0;
+    volatile int32 done = 0;
+    logger->SetWakeUpFunction(&LoggerTestSlowWakeUp, const_cast<int32 *>(&state));
+    bool ok = logger->PrepareWait();
+    if (ok) {
+        ok = (Threads::BeginThread((ThreadFunctionType) LoggerTestAddLogThread, const_cast<int32 *>(&done)) != InvalidThreadIdentifier);
+    }
+    uint32 timeout = 200u;
+    while ((ok) && (state == 0) && (timeout > 0u)) {
+        Sleep::MSec(10u);
+        timeout--;
+    }
+    //The other thread is calling the wake up function: removing it must wait for the call to complete
+    logger->SetWakeUpFunction(NULL_PTR(LoggerWakeUpFunctionType), NULL_PTR(void *));
+    if (ok) {
+        ok = (state == 2);
+    }
+    timeout = 200u;
+    while ((done == 0) && (timeout > 0u)) {
+        Sleep::MSec(10u);
+        timeout--;
+    }
+    LoggerTestEmpty(logger);
+    return ok;
+}
+
+bool LoggerTest::TestPrepareWait() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerTestEmpty(logger);
+    uint32 counter = 0u;
+    logger->SetWakeUpFunction(&LoggerTestWakeUp, &counter);
+    bool ok = logger->PrepareWait();
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TestPrepareWait");
+    if (ok) {
+        ok = (counter == 1u);
+    }
+    LoggerTestEmpty(logger);
+    //Every PrepareWait arms a new wake up
+    if (ok) {
+        ok = logger->PrepareWait();
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TestPrepareWait");
+    if (ok) {
+        ok = (counter == 2u);
+    }
+    logger->SetWakeUpFunction(NULL_PTR(LoggerWakeUpFunctionType), NULL_PTR(void *));
+    LoggerTestEmpty(logger);
+    return ok;
+}
+
+bool LoggerTest::TestPrepareWait_PendingLogs() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerTestEmpty(logger);
+    uint32 counter = 0u;
+    logger->SetWakeUpFunction(&LoggerTestWakeUp, &counter);
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TestPrepareWait_PendingLogs");
+    //There is a pending log: the caller shall not wait and the wait is cancelled
+    bool ok = !logger->PrepareWait();
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TestPrepareWait_PendingLogs");
+    if (ok) {
+        ok = (counter == 0u);
+    }
+    logger->SetWakeUpFunction(NULL_PTR(LoggerWakeUpFunctionType), NULL_PTR(void *));
+    LoggerTestEmpty(logger);
+    return ok;
+}
+
+bool LoggerTest::TestCancelWait() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerTestEmpty(logger);
+    uint32 counter = 0u;
+    logger->SetWakeUpFunction(&LoggerTestWakeUp, &counter);
+    bool ok = logger->PrepareWait();
+    logger->CancelWait();
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TestCancelWait");
+    if (ok) {
+        ok = (counter == 0u);
+    }
+    logger->SetWakeUpFunction(NULL_PTR(LoggerWakeUpFunctionType), NULL_PTR(void *));
+    LoggerTestEmpty(logger);
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -82,6 +82,61 @@ public:
      */
     bool TestLoggerErrorProcessFunction();
 
+    /**
+     * @brief Tests the SetDeferredFormatting method
+     */
+    bool TestSetDeferredFormatting();
+
+    /**
+     * @brief Tests the IsDeferredFormatting method
+     */
+    bool TestIsDeferredFormatting();
+
+    /**
+     * @brief Tests that SetErrorProcessFunction disables the deferred formatting
+     */
+    bool TestSetDeferredFormatting_SetErrorProcessFunction();
+
+    /**
+     * @brief Tests the deferred formatting of REPORT_ERROR with numeric, boolean, character, string and pointer parameters
+     */
+    bool TestLoggerDeferredErrorProcessFunction();
+
+    /**
+     * @brief Tests that the messages with parameters that cannot be stored by value are formatted immediately
+     */
+    bool TestLoggerDeferredErrorProcessFunction_Fallback();
+
+    /**
+     * @brief Tests that the messages which do not fit in a page are formatted immediately
+     */
+    bool TestLoggerDeferredErrorProcessFunction_TooLong();
+
+    /**
+     * @brief Tests the SetWakeUpFunction method
+     */
+    bool TestSetWakeUpFunction();
+
+    /**
+     * @brief Tests that SetWakeUpFunction waits for the wake up function that is being called by another thread
+     */
+    bool TestSetWakeUpFunction_WaitsForCallers();
+
+    /**
+     * @brief Tests the PrepareWait method
+     */
+    bool TestPrepareWait();
+
+    /**
+     * @brief Tests the PrepareWait method with pending logs
+     */
+    bool TestPrepareWait_PendingLogs();
+
+    /**
+     * @brief Tests the CancelWait method
+     */
+    bool TestCancelWait();
+
 };
 
 
@@ -0,0 +1,203 @@
+/**
+ * @file BrokerBufferPoolTest.cpp
+ * @brief Source file for class BrokerBufferPoolTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BrokerBufferPoolTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BrokerBufferPoolTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool BrokerBufferPoolTest::TestConstructor() {
+    BrokerBufferPool pool;
+    bool ok = (pool.GetNumberOfBuffers() == 0u);
+    if (ok) {
+        ok = (pool.GetNumberOfEntries() == 0u);
+    }
+    if (ok) {
+        ok = (pool.GetBufferStride() == 0u);
+    }
+    if (ok) {
+        ok = (pool.GetEntry(0u, 0u) == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (!pool.IsHugePageMemory() && !pool.IsLockedMemory());
+    }
+    return ok;
+}
+
+bool BrokerBufferPoolTest::TestAllocate() {
+    BrokerBufferPool pool;
+    const uint32 numberOfBuffers = 5u;
+    const uint32 sizes[] = { 1u, 4u, 13u, 64u, 8u };
+    const uint32 numberOfEntries = sizeof(sizes) / sizeof(uint32);
+    bool ok = pool.Allocate(numberOfBuffers, &sizes[0], numberOfEntries);
+    if (ok) {
+        ok = (pool.GetNumberOfBuffers() == numberOfBuffers);
+    }
+    if (ok) {
+        ok = (pool.GetNumberOfEntries() == numberOfEntries);
+    }
+    if (ok) {
+        ok = ((pool.GetBufferStride() % SlabMemory::ALIGNMENT) == 0u);
+    }
+    for (uint32 b = 0u; (b < numberOfBuffers) && (ok); b++) {
+        char8 *bufferStart = static_cast<char8 *>(pool.GetEntry(b, 0u));
+        ok = ((reinterpret_cast<uintp>(bufferStart) % SlabMemory::ALIGNMENT) == 0u);
+        if ((ok) && (b > 0u)) {
+            ok = ((bufferStart - static_cast<char8 *>(pool.GetEntry(b - 1u, 0u))) == static_cast<int32>(pool.GetBufferStride()));
+        }
+        for (uint32 e = 0u; (e < numberOfEntries) && (ok); e++) {
+            uint8 *entry = static_cast<uint8 *>(pool.GetEntry(b, e));
+            ok = ((reinterpret_cast<uintp>(entry) % 8u) == 0u);
+            if ((ok) && (e > 0u)) {
+                //Packed one after the other
+                ok = (entry >= (static_cast<uint8 *>(pool.GetEntry(b, e - 1u)) + sizes[e - 1u]));
+            }
+            if (ok) {
+                ok = ((entry + sizes[e]) <= reinterpret_cast<uint8 *>(bufferStart + pool.GetBufferStride()));
+            }
+            for (uint32 k = 0u; (k < sizes[e]) && (ok); k++) {
+                ok = (entry[k] == 0u);
+            }
+            //Writable
+            for (uint32 k = 0u; (k < sizes[e]) && (ok); k++) {
+                entry[k] = static_cast<uint8>(b + e);
+            }
+        }
+    }
+    for (uint32 b = 0u; (b < numberOfBuffers) && (ok); b++) {
+        for (uint32 e = 0u; (e < numberOfEntries) && (ok); e++) {
+            uint8 *entry = static_cast<uint8 *>(pool.GetEntry(b, e));
+            for (uint32 k = 0u; (k < sizes[e]) && (ok); k++) {
+                ok = (entry[k] == static_cast<uint8>(b + e));
+            }
+        }
+    }
+    return ok;
+}
+
+bool BrokerBufferPoolTest::TestAllocate_Twice() {
+    BrokerBufferPool pool;
+    const uint32 sizes1[] = { 4u };
+    const uint32 sizes2[] = { 4u, 200u };
+    bool ok = pool.Allocate(2u, &sizes1[0], 1u);
+    if (ok) {
+        ok = pool.Allocate(3u, &sizes2[0], 2u);
+    }
+    if (ok) {
+        ok = (pool.GetNumberOfBuffers() == 3u);
+    }
+    if (ok) {
+        ok = (pool.GetNumberOfEntries() == 2u);
+    }
+    if (ok) {
+        ok = (pool.GetBufferStride() >= 208u);
+    }
+    if (ok) {
+        ok = (pool.GetEntry(2u, 1u) != NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool BrokerBufferPoolTest::TestAllocate_HugePagesAndLocked() {
+    BrokerBufferPool pool;
+    const uint32 sizes[] = { 1024u, 8u };
+    bool ok = pool.Allocate(4u, &sizes[0], 2u, true, true);
+    if (ok) {
+        ok = (pool.IsHugePageMemory() && pool.IsLockedMemory());
+    }
+    if (ok) {
+        uint8 *entry = static_cast<uint8 *>(pool.GetEntry(3u, 0u));
+        ok = (entry != NULL_PTR(uint8 *));
+        for (uint32 k = 0u; (k < sizes[0]) && (ok); k++) {
+            ok = (entry[k] == 0u);
+        }
+    }
+    return ok;
+}
+
+bool BrokerBufferPoolTest::TestAllocate_False_NoBuffers() {
+    BrokerBufferPool pool;
+    const uint32 sizes[] = { 4u };
+    bool ok = !pool.Allocate(0u, &sizes[0], 1u);
+    if (ok) {
+        ok = (pool.GetEntry(0u, 0u) == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool BrokerBufferPoolTest::TestAllocate_False_NoEntries() {
+    BrokerBufferPool pool;
+    const uint32 sizes[] = { 4u };
+    bool ok = !pool.Allocate(1u, &sizes[0], 0u);
+    if (ok) {
+        ok = !pool.Allocate(1u, NULL_PTR(const uint32 *), 1u);
+    }
+    return ok;
+}
+
+bool BrokerBufferPoolTest::TestFree() {
+    BrokerBufferPool pool;
+    const uint32 sizes[] = { 4u };
+    bool ok = pool.Allocate(1u, &sizes[0], 1u);
+    pool.Free();
+    if (ok) {
+        ok = (pool.GetEntry(0u, 0u) == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (pool.GetNumberOfBuffers() == 0u);
+    }
+    if (ok) {
+        ok = (!pool.IsHugePageMemory() && !pool.IsLockedMemory());
+    }
+    //Free twice is harmless
+    pool.Free();
+    return ok;
+}
+
+bool BrokerBufferPoolTest::TestGetEntry_OutOfRange() {
+    BrokerBufferPool pool;
+    const uint32 sizes[] = { 4u, 4u };
+    bool ok = pool.Allocate(2u, &sizes[0], 2u);
+    if (ok) {
+        ok = (pool.GetEntry(1u, 1u) != NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (pool.GetEntry(2u, 0u) == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (pool.GetEntry(0u, 2u) == NULL_PTR(void *));
+    }
+    return ok;
+}
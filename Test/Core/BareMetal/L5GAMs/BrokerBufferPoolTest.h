@@ -0,0 +1,94 @@
+/**
+ * @file BrokerBufferPoolTest.h
+ * @brief Header file for class BrokerBufferPoolTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BrokerBufferPoolTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BROKERBUFFERPOOLTEST_H_
+#define BROKERBUFFERPOOLTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BrokerBufferPool.h"
+#include "SlabMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the BrokerBufferPool functions
+ */
+class BrokerBufferPoolTest {
+public:
+
+    /**
+     * @brief Tests that the constructor initialises an empty pool.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that all the entries are zeroed, do not overlap and that each buffer starts on a cache line.
+     */
+    bool TestAllocate();
+
+    /**
+     * @brief Tests that a second Allocate replaces the first slab.
+     */
+    bool TestAllocate_Twice();
+
+    /**
+     * @brief Tests that Allocate succeeds (falling back to the standard pages) when huge pages and memory locking are requested.
+     */
+    bool TestAllocate_HugePagesAndLocked();
+
+    /**
+     * @brief Tests that Allocate fails with zero buffers.
+     */
+    bool TestAllocate_False_NoBuffers();
+
+    /**
+     * @brief Tests that Allocate fails with zero entries.
+     */
+    bool TestAllocate_False_NoEntries();
+
+    /**
+     * @brief Tests that Free releases the slab.
+     */
+    bool TestFree();
+
+    /**
+     * @brief Tests that GetEntry returns NULL for out of range indexes.
+     */
+    bool TestGetEntry_OutOfRange();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BROKERBUFFERPOOLTEST_H_ */
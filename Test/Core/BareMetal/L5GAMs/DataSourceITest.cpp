@@ -239,6 +239,30 @@ bool DataSourceITestHelper::Synchronise() {
 
 CLASS_REGISTER(DataSourceITestHelper, "1.0");
 
+/**
+ * Helper class which records the node where DataSourceI::SetConfiguredDatabase leaves the configuredDatabase
+ */
+class DataSourceITestHelperConfiguredNode: public DataSourceITestHelper {
+public:
+    DataSourceITestHelperConfiguredNode() :
+            DataSourceITestHelper() {
+        numberOfChildren = 0u;
+    }
+
+    virtual ~DataSourceITestHelperConfiguredNode() {
+    }
+
+    virtual bool SetConfiguredDatabase(StructuredDataI & data) {
+        bool ret = DataSourceI::SetConfiguredDatabase(data);
+        if (ret) {
+            numberOfChildren = configuredDatabase.GetNumberOfChildren();
+        }
+        return ret;
+    }
+
+    uint32 numberOfChildren;
+};
+
 static bool InitialiseDataSourceIEnviroment(const char8 * const config) {
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -688,6 +712,249 @@ bool DataSourceITest::TestSetConfiguredDatabase() {
     return ret;
 }
 
+static bool DataSourceITestWriteSignals(ConfigurationDatabase &cdb,
+                                        const uint32 numberOfSignals,
+                                        const char8 * const functionName) {
+    bool ret = cdb.CreateAbsolute("Signals");
+    uint32 n;
+    for (n = 0u; (n < numberOfSignals) && (ret); n++) {
+        StreamString nodeName;
+        StreamString signalName;
+        ret = nodeName.Printf("%d", n);
+        if (ret) {
+            ret = signalName.Printf("Signal%d", n);
+        }
+        if (ret) {
+            ret = cdb.MoveAbsolute("Signals");
+        }
+        if (ret) {
+            ret = cdb.CreateRelative(nodeName.Buffer());
+        }
+        if (ret) {
+            ret = cdb.Write("QualifiedName", signalName.Buffer());
+        }
+        if (ret) {
+            ret = cdb.Write("Type", ((n % 2u) == 0u) ? "uint32" : "float64");
+        }
+        if (ret) {
+            ret = cdb.Write("NumberOfDimensions", 1u);
+        }
+        if (ret) {
+            ret = cdb.Write("NumberOfElements", (n + 1u));
+        }
+        if (ret) {
+            ret = cdb.Write("ByteSize", (n + 1u) * 8u);
+        }
+    }
+    if (ret) {
+        ret = cdb.CreateAbsolute("Functions.0");
+    }
+    if (ret) {
+        ret = cdb.Write("QualifiedName", functionName);
+    }
+    if (ret) {
+        ret = cdb.CreateRelative("InputSignals.0");
+    }
+    if (ret) {
+        ret = cdb.Write("QualifiedName", "Signal1");
+    }
+    if (ret) {
+        ret = cdb.Write("Broker", "MemoryMapInputBroker");
+    }
+    if (ret) {
+        ret = cdb.Write("Samples", 3u);
+    }
+    if (ret) {
+        ret = cdb.Write("GAMMemoryOffset", 16u);
+    }
+    if (ret) {
+        uint32 byteOffset[2][2] = { { 0u, 4u }, { 8u, 8u } };
+        ret = cdb.Write("ByteOffset", byteOffset);
+    }
+    if (ret) {
+        ret = cdb.MoveToAncestor(1u);
+    }
+    if (ret) {
+        ret = cdb.Write("ByteSize", 16u);
+    }
+    if (ret) {
+        ret = cdb.MoveToRoot();
+    }
+    return ret;
+}
+
+bool DataSourceITest::TestSetConfiguredDatabase_ManySignals() {
+    const uint32 numberOfSignals = 1000u;
+    ReferenceT<DataSourceITestHelper> dataSource(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    bool ret = DataSourceITestWriteSignals(cdb, 10u, "GAMA");
+    if (ret) {
+        ret = dataSource->SetConfiguredDatabase(cdb);
+    }
+    uint32 idx;
+    if (ret) {
+        ret = dataSource->GetFunctionIndex(idx, "GAMA");
+    }
+    //Compile again with a different database
+    ConfigurationDatabase cdb2;
+    if (ret) {
+        ret = DataSourceITestWriteSignals(cdb2, numberOfSignals, "GAMB");
+    }
+    if (ret) {
+        ret = dataSource->SetConfiguredDatabase(cdb2);
+    }
+    if (ret) {
+        ret = (dataSource->GetNumberOfSignals() == numberOfSignals);
+    }
+    if (ret) {
+        ret = !dataSource->GetFunctionIndex(idx, "GAMA");
+    }
+    uint32 n;
+    for (n = 0u; (n < numberOfSignals) && (ret); n++) {
+        StreamString signalName;
+        ret = signalName.Printf("Signal%d", n);
+        if (ret) {
+            ret = dataSource->GetSignalIndex(idx, signalName.Buffer());
+        }
+        if (ret) {
+            ret = (idx == n);
+        }
+        if (ret) {
+            ret = (dataSource->GetSignalType(n) == (((n % 2u) == 0u) ? UnsignedInteger32Bit : Float64Bit));
+        }
+        uint32 value = 0u;
+        if (ret) {
+            ret = dataSource->GetSignalNumberOfElements(n, value);
+        }
+        if (ret) {
+            ret = (value == (n + 1u));
+        }
+        if (ret) {
+            ret = dataSource->GetSignalByteSize(n, value);
+        }
+        if (ret) {
+            ret = (value == ((n + 1u) * 8u));
+        }
+    }
+    if (ret) {
+        ret = !dataSource->GetSignalIndex(idx, "Signal1000");
+    }
+    uint32 functionIdx = 0u;
+    if (ret) {
+        ret = dataSource->GetFunctionIndex(functionIdx, "GAMB");
+    }
+    uint32 value = 0u;
+    if (ret) {
+        ret = dataSource->GetFunctionNumberOfSignals(InputSignals, functionIdx, value);
+    }
+    if (ret) {
+        ret = (value == 1u);
+    }
+    //No OutputSignals node
+    if (ret) {
+        ret = dataSource->GetFunctionNumberOfSignals(OutputSignals, functionIdx, value);
+    }
+    if (ret) {
+        ret = (value == 0u);
+    }
+    if (ret) {
+        ret = dataSource->GetFunctionSignalsByteSize(InputSignals, functionIdx, value);
+    }
+    if (ret) {
+        ret = (value == 16u);
+    }
+    if (ret) {
+        ret = dataSource->GetFunctionSignalSamples(InputSignals, functionIdx, 0u, value);
+    }
+    if (ret) {
+        ret = (value == 3u);
+    }
+    if (ret) {
+        ret = dataSource->GetFunctionSignalGAMMemoryOffset(InputSignals, functionIdx, 0u, value);
+    }
+    if (ret) {
+        ret = (value == 16u);
+    }
+    if (ret) {
+        ret = dataSource->IsSupportedBroker(InputSignals, functionIdx, 0u, "MemoryMapInputBroker");
+    }
+    if (ret) {
+        ret = !dataSource->IsSupportedBroker(InputSignals, functionIdx, 0u, "MemoryMapOutputBroker");
+    }
+    if (ret) {
+        ret = dataSource->GetFunctionSignalNumberOfByteOffsets(InputSignals, functionIdx, 0u, value);
+    }
+    if (ret) {
+        ret = (value == 2u);
+    }
+    uint32 start = 0u;
+    uint32 size = 0u;
+    if (ret) {
+        ret = dataSource->GetFunctionSignalByteOffsetInfo(InputSignals, functionIdx, 0u, 1u, start, size);
+    }
+    if (ret) {
+        ret = (start == 8u) && (size == 8u);
+    }
+    if (ret) {
+        ret = !dataSource->GetFunctionSignalByteOffsetInfo(InputSignals, functionIdx, 0u, 2u, start, size);
+    }
+    StreamString alias;
+    if (ret) {
+        ret = dataSource->GetFunctionSignalAlias(InputSignals, functionIdx, 0u, alias);
+    }
+    if (ret) {
+        ret = (alias.Size() == 0u);
+    }
+    //The ByteSize is not a signal
+    if (ret) {
+        ret = !dataSource->GetFunctionSignalSamples(InputSignals, functionIdx, 1u, value);
+    }
+    return ret;
+}
+
+bool DataSourceITest::TestSetConfiguredDatabase_SignalsNode() {
+    DataSourceITestHelperConfiguredNode dataSource;
+    ConfigurationDatabase cdb;
+    bool ret = DataSourceITestWriteSignals(cdb, 10u, "GAMA");
+    if (ret) {
+        ret = dataSource.SetConfiguredDatabase(cdb);
+    }
+    if (ret) {
+        ret = (dataSource.numberOfChildren == 10u);
+    }
+    return ret;
+}
+
+bool DataSourceITest::TestSetConfiguredDatabase_False_NoQualifiedName() {
+    ReferenceT<DataSourceITestHelper> dataSource(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    bool ret = DataSourceITestWriteSignals(cdb, 4u, "GAMA");
+    if (ret) {
+        ret = cdb.MoveAbsolute("Signals.2");
+    }
+    if (ret) {
+        ret = cdb.Delete("QualifiedName");
+    }
+    if (ret) {
+        ret = cdb.MoveToRoot();
+    }
+    if (ret) {
+        ret = !dataSource->SetConfiguredDatabase(cdb);
+    }
+    uint32 idx;
+    if (ret) {
+        ret = !dataSource->GetSignalIndex(idx, "Signal0");
+    }
+    StreamString name;
+    if (ret) {
+        ret = !dataSource->GetSignalName(0u, name);
+    }
+    if (ret) {
+        ret = !dataSource->GetFunctionIndex(idx, "GAMA");
+    }
+    return ret;
+}
+
 bool DataSourceITest::TestGetNumberOfSignals() {
     bool ret = InitialiseDataSourceIEnviroment(config1);
     ReferenceT<DataSourceITestHelper> dataSource;
@@ -2353,3 +2620,25 @@ bool DataSourceITest::TestBrokerCopyTerminated() {
     return test.BrokerCopyTerminated();
 }
 
+bool DataSourceITest::TestIsSignalBufferHandoverSupported() {
+    DataSourceITestHelper test;
+    return !test.IsSignalBufferHandoverSupported();
+}
+
+bool DataSourceITest::TestSynchroniseSignalBuffers() {
+    DataSourceITestHelper test;
+    uint32 signal = 0u;
+    void *signalAddresses[] = { &signal };
+    return !test.SynchroniseSignalBuffers(&signalAddresses[0]);
+}
+
+bool DataSourceITest::TestIsOffsetCachingSupported() {
+    DataSourceITestHelper test;
+    return !test.IsOffsetCachingSupported();
+}
+
+bool DataSourceITest::TestIsSignalMemoryMirrored() {
+    DataSourceITestHelper test;
+    return !test.IsSignalMemoryMirrored(0u);
+}
+
@@ -63,6 +63,21 @@ public:
      */
     bool TestSetConfiguredDatabase();
 
+    /**
+     * @brief Tests the SetConfiguredDatabase method with many signals and that the compiled properties are replaced if it is called again.
+     */
+    bool TestSetConfiguredDatabase_ManySignals();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method leaves the configuredDatabase on the Signals node.
+     */
+    bool TestSetConfiguredDatabase_SignalsNode();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if a signal has no QualifiedName.
+     */
+    bool TestSetConfiguredDatabase_False_NoQualifiedName();
+
     /**
      * @brief Tests the GetNumberOfSignals method.
      */
@@ -288,6 +303,26 @@ public:
      */
     bool TestBrokerCopyTerminated();
 
+    /**
+     * @brief Tests the IsSignalBufferHandoverSupported() method.
+     */
+    bool TestIsSignalBufferHandoverSupported();
+
+    /**
+     * @brief Tests the SynchroniseSignalBuffers() method.
+     */
+    bool TestSynchroniseSignalBuffers();
+
+    /**
+     * @brief Tests the IsOffsetCachingSupported() method.
+     */
+    bool TestIsOffsetCachingSupported();
+
+    /**
+     * @brief Tests the IsSignalMemoryMirrored() method.
+     */
+    bool TestIsSignalMemoryMirrored();
+
 };
 
 /*---------------------------------------------------------------------------*/
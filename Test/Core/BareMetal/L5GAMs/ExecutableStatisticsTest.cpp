@@ -0,0 +1,226 @@
+/**
+ * @file ExecutableStatisticsTest.cpp
+ * @brief Source file for class ExecutableStatisticsTest
+ * @date 16/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutableStatisticsTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ExecutableStatisticsTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool ExecutableStatisticsTest::TestAllocate() {
+    void *memory = NULL_PTR(void *);
+    ExecutableStatistics *stats = ExecutableStatistics::Allocate(10u, memory);
+    bool ok = (stats != NULL_PTR(ExecutableStatistics *));
+    if (ok) {
+        ok = (memory != NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = ((reinterpret_cast<uintp>(stats) % EXECUTABLE_STATISTICS_CACHE_LINE_SIZE) == 0u);
+    }
+    if (ok) {
+        ok = ((sizeof(ExecutableStatistics) % EXECUTABLE_STATISTICS_CACHE_LINE_SIZE) == 0u);
+    }
+    for (uint32 i = 0u; (i < 10u) && (ok); i++) {
+        ok = (stats[i].GetNumberOfSamples() == 0ull);
+    }
+    ExecutableStatistics::Free(memory);
+    if (ok) {
+        ok = (memory == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool ExecutableStatisticsTest::TestInitialise() {
+    ExecutableStatistics stats;
+    stats.Initialise();
+    stats.Update(10u);
+    stats.Initialise();
+    bool ok = (stats.GetNumberOfSamples() == 0ull);
+    if (ok) {
+        ok = (stats.GetMaximum() == 0ull);
+    }
+    if (ok) {
+        ok = (stats.GetMinimum() == 0ull);
+    }
+    if (ok) {
+        ok = (stats.GetMean() == 0.0);
+    }
+    for (uint32 i = 0u; (i < EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS) && (ok); i++) {
+        ok = (stats.GetBucketCounter(i) == 0u);
+    }
+    return ok;
+}
+
+bool ExecutableStatisticsTest::TestUpdate() {
+    ExecutableStatistics stats;
+    stats.Initialise();
+    stats.Update(100u);
+    stats.Update(20u);
+    stats.Update(300u);
+    bool ok = (stats.GetNumberOfSamples() == 3ull);
+    if (ok) {
+        ok = (stats.GetMinimum() == 20ull);
+    }
+    if (ok) {
+        ok = (stats.GetMaximum() == 300ull);
+    }
+    if (ok) {
+        ok = (stats.GetMean() == 140.0);
+    }
+    if (ok) {
+        ok = (stats.GetBucketCounter(ExecutableStatistics::GetBucketIndex(100u)) == 1u);
+    }
+    if (ok) {
+        ok = (stats.GetBucketCounter(ExecutableStatistics::GetBucketIndex(20u)) == 1u);
+    }
+    if (ok) {
+        ok = (stats.GetBucketCounter(ExecutableStatistics::GetBucketIndex(300u)) == 1u);
+    }
+    if (ok) {
+        ok = (stats.GetBucketCounter(EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS) == 0u);
+    }
+    return ok;
+}
+
+bool ExecutableStatisticsTest::TestRequestReset() {
+    ExecutableStatistics stats;
+    stats.Initialise();
+    stats.Update(100u);
+    stats.Update(200u);
+    stats.RequestReset();
+    bool ok = (stats.GetNumberOfSamples() == 2ull);
+    stats.Update(5u);
+    if (ok) {
+        ok = (stats.GetNumberOfSamples() == 1ull);
+    }
+    if (ok) {
+        ok = (stats.GetMaximum() == 5ull);
+    }
+    if (ok) {
+        ok = (stats.GetBucketCounter(ExecutableStatistics::GetBucketIndex(100u)) == 0u);
+    }
+    return ok;
+}
+
+bool ExecutableStatisticsTest::TestGetSnapshot() {
+    ExecutableStatistics stats;
+    stats.Initialise();
+    for (uint32 i = 1u; i <= 100u; i++) {
+        stats.Update(i);
+    }
+    ExecutableStatistics snapshot;
+    snapshot.Initialise();
+    bool ok = stats.GetSnapshot(snapshot);
+    if (ok) {
+        ok = (snapshot.GetNumberOfSamples() == 100ull);
+    }
+    if (ok) {
+        ok = (snapshot.GetMinimum() == 1ull);
+    }
+    if (ok) {
+        ok = (snapshot.GetMaximum() == 100ull);
+    }
+    if (ok) {
+        ok = (snapshot.GetMean() == 50.5);
+    }
+    for (uint32 i = 0u; (i < EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS) && (ok); i++) {
+        ok = (snapshot.GetBucketCounter(i) == stats.GetBucketCounter(i));
+    }
+    return ok;
+}
+
+bool ExecutableStatisticsTest::TestGetPercentile() {
+    ExecutableStatistics stats;
+    stats.Initialise();
+    bool ok = (stats.GetPercentile(50.0) == 0ull);
+    //990 fast samples and 10 slow samples
+    for (uint32 i = 0u; i < 990u; i++) {
+        stats.Update(1000u);
+    }
+    for (uint32 i = 0u; i < 10u; i++) {
+        stats.Update(100000u);
+    }
+    uint64 p50 = stats.GetPercentile(50.0);
+    uint64 p99 = stats.GetPercentile(99.0);
+    uint64 p999 = stats.GetPercentile(99.9);
+    //The relative error is at most 25%
+    if (ok) {
+        ok = ((p50 >= 1000ull) && (p50 <= 1250ull));
+    }
+    if (ok) {
+        ok = ((p99 >= 1000ull) && (p99 <= 1250ull));
+    }
+    if (ok) {
+        ok = (p999 == 100000ull);
+    }
+    if (ok) {
+        ok = (stats.GetPercentile(100.0) == 100000ull);
+    }
+    if (ok) {
+        ok = (stats.GetPercentile(0.0) >= 1000ull);
+    }
+    return ok;
+}
+
+bool ExecutableStatisticsTest::TestGetBucketIndex() {
+    bool ok = (ExecutableStatistics::GetBucketIndex(0u) == 0u);
+    if (ok) {
+        ok = (ExecutableStatistics::GetBucketIndex(3u) == 3u);
+    }
+    if (ok) {
+        ok = (ExecutableStatistics::GetBucketIndex(0xFFFFFFFFFFFFFFFFull) == (EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS - 1u));
+    }
+    uint64 value = 1u;
+    while ((value < (1ull << 40u)) && (ok)) {
+        uint32 idx = ExecutableStatistics::GetBucketIndex(value);
+        ok = (ExecutableStatistics::GetBucketUpperLimit(idx) >= value);
+        if ((ok) && (idx > 0u)) {
+            ok = (ExecutableStatistics::GetBucketUpperLimit(idx - 1u) < value);
+        }
+        value = (value * 3u) / 2u + 1u;
+    }
+    return ok;
+}
+
+bool ExecutableStatisticsTest::TestGetBucketUpperLimit() {
+    bool ok = true;
+    for (uint32 i = 1u; (i < EXECUTABLE_STATISTICS_NUMBER_OF_BUCKETS) && (ok); i++) {
+        uint64 previous = ExecutableStatistics::GetBucketUpperLimit(i - 1u);
+        ok = (ExecutableStatistics::GetBucketUpperLimit(i) > previous);
+        if (ok) {
+            ok = (ExecutableStatistics::GetBucketIndex(previous + 1u) == i);
+        }
+    }
+    return ok;
+}
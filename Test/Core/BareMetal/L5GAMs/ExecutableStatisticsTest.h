@@ -0,0 +1,93 @@
+/**
+ * @file ExecutableStatisticsTest.h
+ * @brief Header file for class ExecutableStatisticsTest
+ * @date 16/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutableStatisticsTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTABLESTATISTICSTEST_H_
+#define EXECUTABLESTATISTICSTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ExecutableStatistics.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the ExecutableStatistics functions
+ */
+class ExecutableStatisticsTest {
+public:
+
+    /**
+     * @brief Tests that the allocated array is aligned to the cache line size and initialised.
+     */
+    bool TestAllocate();
+
+    /**
+     * @brief Tests that Initialise sets all the counters to zero.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that Update computes the minimum, maximum, mean and histogram.
+     */
+    bool TestUpdate();
+
+    /**
+     * @brief Tests that the RequestReset clears the counters on the next Update.
+     */
+    bool TestRequestReset();
+
+    /**
+     * @brief Tests that GetSnapshot copies all the values.
+     */
+    bool TestGetSnapshot();
+
+    /**
+     * @brief Tests the GetPercentile method.
+     */
+    bool TestGetPercentile();
+
+    /**
+     * @brief Tests that every value is stored in a bucket whose upper limit is not smaller than the value.
+     */
+    bool TestGetBucketIndex();
+
+    /**
+     * @brief Tests that the bucket upper limits are strictly increasing and contiguous.
+     */
+    bool TestGetBucketUpperLimit();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EXECUTABLESTATISTICSTEST_H_ */
@@ -34,6 +34,7 @@
 #include "RealTimeApplication.h"
 #include "StandardParser.h"
 #include "ObjectRegistryDatabase.h"
+#include "TimingDataSource.h"
 
 
 /*---------------------------------------------------------------------------*/
@@ -199,3 +200,132 @@ bool GAMBareSchedulerTest::TestStopCurrentStateExecution() {
     
     return retVal;
 }
+
+bool GAMBareSchedulerTest::TestStartCurrentStateExecution_RawTicks() {
+    StreamString config = ""
+            "$TestRTApp = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                SignalIn1 = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    Alias = add1"
+            "                    Default = 1"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA }"
+            "                }"
+            "            }"
+            "        }"
+            "        +State2 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA }"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMBareScheduler"
+            "        TimingDataSource = Timings"
+            "        RawTicksTiming = 1"
+            "        TimingResolution = Nanoseconds"
+            "        MaxCycles = 1"
+            "    }"
+            "}";
+
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool retVal = parser.Parse();
+    if (retVal) {
+        ObjectRegistryDatabase::Instance()->Purge();
+        retVal = cdb.MoveToRoot();
+    }
+    if (retVal) {
+        retVal = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    if (retVal) {
+        realTimeApplication = ObjectRegistryDatabase::Instance()->Find("TestRTApp");
+        retVal = realTimeApplication.IsValid();
+    }
+    if (retVal) {
+        retVal = realTimeApplication->ConfigureApplication();
+    }
+    ReferenceT<TimingDataSource> timings;
+    if (retVal) {
+        timings = realTimeApplication->Find("Data.Timings");
+        retVal = timings.IsValid();
+    }
+    uint32 *currentState = NULL_PTR(uint32 *);
+    uint32 *execTime = NULL_PTR(uint32 *);
+    if (retVal) {
+        uint32 signalIdx;
+        retVal = timings->GetSignalIndex(signalIdx, "CurrentState");
+        if (retVal) {
+            retVal = timings->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void *&>(currentState));
+        }
+        if (retVal) {
+            retVal = timings->GetSignalIndex(signalIdx, "GAMA_ExecTime");
+        }
+        if (retVal) {
+            retVal = timings->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void *&>(execTime));
+        }
+    }
+    if (retVal) {
+        retVal = realTimeApplication->PrepareNextState("State2");
+    }
+    if (retVal) {
+        retVal = realTimeApplication->StartNextStateExecution();
+    }
+    if (retVal) {
+        retVal = (*currentState == 1u);
+    }
+    //Only the tables of State2 have been executed.
+    if (retVal) {
+        retVal = timings->Synchronise();
+    }
+    if (retVal) {
+        retVal = (*execTime > 0u);
+    }
+    if (realTimeApplication.IsValid()) {
+        if (!realTimeApplication->StopCurrentStateExecution()) {
+            retVal = false;
+        }
+    }
+    return retVal;
+}
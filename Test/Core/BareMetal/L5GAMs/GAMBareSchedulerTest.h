@@ -81,6 +81,11 @@ public:
      */
     bool TestStopCurrentStateExecution();
 
+    /**
+     * @brief Tests that with RawTicksTiming = 1 the timing signals of a state other than the first are converted.
+     */
+    bool TestStartCurrentStateExecution_RawTicks();
+
 private:
     /**
      * @brief Reference to the real time application used internally in tests
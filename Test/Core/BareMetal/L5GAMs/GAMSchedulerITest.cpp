@@ -123,7 +123,9 @@ bool DummyScheduler::ConfigureScheduler(Reference realTimeApp) {
 bool DummyScheduler::ExecuteThreadCycle(uint32 threadId) {
     ReferenceT<RealTimeApplication> realTimeAppT = realTimeApp;
     return ExecuteSingleCycle(scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].executables,
-                       scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].numberOfExecutables);
+                       scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].numberOfExecutables,
+                       scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].statistics,
+                       scheduledStates[realTimeAppT->GetIndex()]->threads[threadId].timingTicks);
 
 }
 MARTe::ErrorManagement::ErrorType DummyScheduler::StopCurrentStateExecution() {
@@ -753,3 +755,310 @@ bool GAMSchedulerITest::TestExecuteSingleCycle_False() {
     }
     return ok;
 }
+
+static bool GAMSchedulerITestConfigureWithOptions(ReferenceT<RealTimeApplication> &app,
+                                                 ReferenceT<DummyScheduler> &scheduler,
+                                                 const char8 * const schedulerOptions) {
+    StreamString config = ""
+            "$TestStatistics = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                SignalIn1 = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    Alias = add1"
+            "                    Default = 1"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add2"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "        +GAMB = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                SignalIn1 = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    Alias = add2"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA GAMB}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = DummyScheduler"
+            "        TimingDataSource = Timings ";
+    config += schedulerOptions;
+    config += ""
+            "    }"
+            "}";
+
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        cdb.MoveToRoot();
+        ObjectRegistryDatabase::Instance()->Purge();
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("TestStatistics");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = app->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = scheduler->PrepareNextState("", "State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    return ok;
+}
+
+bool GAMSchedulerITest::TestGetExecutableStatistics() {
+    ReferenceT<RealTimeApplication> app;
+    ReferenceT<DummyScheduler> scheduler;
+    bool ok = GAMSchedulerITestConfigureWithOptions(app, scheduler, "CollectStatistics = 1");
+    const uint32 numberOfCycles = 10u;
+    for (uint32 n = 0u; (n < numberOfCycles) && (ok); n++) {
+        ok = scheduler->ExecuteThreadCycle(0u);
+    }
+    uint32 numberOfExecutables = 0u;
+    if (ok) {
+        numberOfExecutables = scheduler->GetNumberOfExecutables("State1", "Thread1");
+        ok = (numberOfExecutables > 2u);
+    }
+    for (uint32 e = 0u; (e < numberOfExecutables) && (ok); e++) {
+        ExecutableStatistics snapshot;
+        ok = scheduler->GetExecutableStatistics("State1", "Thread1", e, snapshot);
+        if (ok) {
+            ok = (snapshot.GetNumberOfSamples() == numberOfCycles);
+        }
+        if (ok) {
+            ok = (snapshot.GetMaximum() >= snapshot.GetMinimum());
+        }
+    }
+    if (ok) {
+        ExecutableStatistics snapshot;
+        ok = !scheduler->GetExecutableStatistics("State1", "Thread1", numberOfExecutables, snapshot);
+        if (ok) {
+            ok = !scheduler->GetExecutableStatistics("State1", "Thread2", 0u, snapshot);
+        }
+        if (ok) {
+            ok = !scheduler->GetExecutableStatistics("State2", "Thread1", 0u, snapshot);
+        }
+    }
+    if (ok) {
+        scheduler->ResetStatistics();
+        ok = scheduler->ExecuteThreadCycle(0u);
+    }
+    if (ok) {
+        ExecutableStatistics snapshot;
+        ok = scheduler->GetExecutableStatistics("State1", "Thread1", 0u, snapshot);
+        if (ok) {
+            ok = (snapshot.GetNumberOfSamples() == 1u);
+        }
+    }
+    return ok;
+}
+
+bool GAMSchedulerITest::TestGetExecutableStatistics_Disabled() {
+    ReferenceT<RealTimeApplication> app;
+    ReferenceT<DummyScheduler> scheduler;
+    bool ok = GAMSchedulerITestConfigureWithOptions(app, scheduler, "CollectStatistics = 0");
+    if (ok) {
+        ok = scheduler->ExecuteThreadCycle(0u);
+    }
+    if (ok) {
+        ExecutableStatistics snapshot;
+        ok = !scheduler->GetExecutableStatistics("State1", "Thread1", 0u, snapshot);
+    }
+    if (ok) {
+        ConfigurationDatabase cdb;
+        ok = scheduler->ExportData(cdb);
+        if (ok) {
+            ok = !cdb.MoveAbsolute("Statistics");
+        }
+    }
+    return ok;
+}
+
+bool GAMSchedulerITest::TestExportData_Statistics() {
+    ReferenceT<RealTimeApplication> app;
+    ReferenceT<DummyScheduler> scheduler;
+    bool ok = GAMSchedulerITestConfigureWithOptions(app, scheduler, "CollectStatistics = 1");
+    const uint32 numberOfCycles = 5u;
+    for (uint32 n = 0u; (n < numberOfCycles) && (ok); n++) {
+        ok = scheduler->ExecuteThreadCycle(0u);
+    }
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = scheduler->ExportData(cdb);
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("Statistics.State1.Thread1.GAMA");
+    }
+    if (ok) {
+        uint64 samples = 0u;
+        ok = cdb.Read("Samples", samples);
+        if (ok) {
+            ok = (samples == numberOfCycles);
+        }
+    }
+    if (ok) {
+        float64 minimum = -1.0;
+        float64 maximum = -1.0;
+        float64 p99 = -1.0;
+        ok = cdb.Read("Min", minimum);
+        if (ok) {
+            ok = cdb.Read("Max", maximum);
+        }
+        if (ok) {
+            ok = cdb.Read("P99", p99);
+        }
+        if (ok) {
+            ok = (minimum >= 0.0) && (maximum >= minimum) && (p99 <= maximum);
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("Statistics.State1.Thread1.GAMB");
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("Statistics.State1.Thread1.GAMA_DDB1_MemoryMapInputBroker");
+    }
+    return ok;
+}
+
+bool GAMSchedulerITest::TestExecuteSingleCycle_RawTicks() {
+    ReferenceT<RealTimeApplication> app;
+    ReferenceT<DummyScheduler> scheduler;
+    bool ok = GAMSchedulerITestConfigureWithOptions(app, scheduler, "RawTicksTiming = 1 TimingResolution = Nanoseconds");
+    ReferenceT<TimingDataSource> timings;
+    if (ok) {
+        timings = app->Find("Data.Timings");
+        ok = timings.IsValid();
+    }
+    uint32 *execTime = NULL_PTR(uint32 *);
+    if (ok) {
+        uint32 signalIdx;
+        ok = timings->GetSignalIndex(signalIdx, "GAMB_ExecTime");
+        if (ok) {
+            ok = timings->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void *&>(execTime));
+        }
+    }
+    if (ok) {
+        ok = scheduler->ExecuteThreadCycle(0u);
+    }
+    //Not converted until the TimingDataSource is read
+    if (ok) {
+        ok = (*execTime == 0u);
+    }
+    if (ok) {
+        ok = timings->Synchronise();
+    }
+    if (ok) {
+        ok = (*execTime > 0u);
+    }
+    return ok;
+}
+
+bool GAMSchedulerITest::TestConfigureScheduler_RawTicks_Twice() {
+    ReferenceT<RealTimeApplication> app;
+    ReferenceT<DummyScheduler> scheduler;
+    bool ok = GAMSchedulerITestConfigureWithOptions(app, scheduler, "RawTicksTiming = 1");
+    ReferenceT<TimingDataSource> timings;
+    if (ok) {
+        timings = app->Find("Data.Timings");
+        ok = timings.IsValid();
+    }
+    uint32 numberOfTables = 0u;
+    if (ok) {
+        numberOfTables = timings->GetNumberOfRawTicksTables();
+        ok = (numberOfTables > 0u);
+    }
+    if (ok) {
+        ok = scheduler->ConfigureScheduler(app);
+    }
+    //The tables of the previous configuration must have been removed
+    if (ok) {
+        ok = (timings->GetNumberOfRawTicksTables() == numberOfTables);
+    }
+    if (ok) {
+        ok = scheduler->PrepareNextState("", "State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    if (ok) {
+        ok = scheduler->ExecuteThreadCycle(0u);
+    }
+    if (ok) {
+        ok = timings->Synchronise();
+    }
+    return ok;
+}
+
+bool GAMSchedulerITest::TestInitialise_False_TimingResolution() {
+    DummyScheduler scheduler;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("TimingDataSource", "Timings");
+    if (ok) {
+        ok = cdb.Write("TimingResolution", "Seconds");
+    }
+    if (ok) {
+        ok = !scheduler.Initialise(cdb);
+    }
+    if (ok) {
+        ok = cdb.Write("TimingResolution", "Nanoseconds");
+    }
+    if (ok) {
+        DummyScheduler scheduler2;
+        ok = scheduler2.Initialise(cdb);
+    }
+    return ok;
+}
@@ -92,6 +92,36 @@ public:
      */
     bool TestExecuteSingleCycle_False();
 
+    /**
+     * @brief Tests that the execution statistics are collected for every executable when CollectStatistics = 1.
+     */
+    bool TestGetExecutableStatistics();
+
+    /**
+     * @brief Tests that no statistics are available when CollectStatistics = 0.
+     */
+    bool TestGetExecutableStatistics_Disabled();
+
+    /**
+     * @brief Tests that the execution statistics are exported by ExportData.
+     */
+    bool TestExportData_Statistics();
+
+    /**
+     * @brief Tests that with RawTicksTiming = 1 the timing signals are only written when the TimingDataSource is synchronised.
+     */
+    bool TestExecuteSingleCycle_RawTicks();
+
+    /**
+     * @brief Tests that configuring the scheduler again replaces the raw ticks tables of the previous configuration.
+     */
+    bool TestConfigureScheduler_RawTicks_Twice();
+
+    /**
+     * @brief Tests that the Initialise fails with an invalid TimingResolution.
+     */
+    bool TestInitialise_False_TimingResolution();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -365,3 +365,113 @@ bool MemoryDataSourceITest::TestGetSignalMemoryBuffer() {
     ObjectRegistryDatabase::Instance()->Purge();
     return ok;
 }
+
+/**
+ * Configuration with a signal whose buffers (1024 x uint32) can be mirrored and a signal whose buffers (1024 x uint16) cannot.
+ */
+static const char8 * const configMirrored = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MemoryDataSourceITestGAM1"
+        "            InputSignals = {"
+        "               Signal1 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal2 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint16"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Drv1 = {"
+        "            Class = MemoryDataSourceIDataSourceTest"
+        "            NumberOfBuffers = 1024"
+        "            MirroredBuffers = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        TimingDataSource = Timings"
+        "        Class = GAMDataSourceTestScheduler1"
+        "    }"
+        "}";
+
+bool MemoryDataSourceITest::TestGetSignalMemoryBuffer_MirroredBuffers() {
+    bool ok = InitialiseDataSourceIEnviroment(configMirrored);
+    ReferenceT<MemoryDataSourceIDataSourceTest> dataSourceTest = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+    if (ok) {
+        ok = dataSourceTest.IsValid();
+    }
+    const uint32 numberOfBuffers = 1024u;
+    uint32 *signal1[3] = { NULL_PTR(uint32 *), NULL_PTR(uint32 *), NULL_PTR(uint32 *) };
+    uint16 *signal2[3] = { NULL_PTR(uint16 *), NULL_PTR(uint16 *), NULL_PTR(uint16 *) };
+    for (uint32 b = 0u; (b < 3u) && (ok); b++) {
+        ok = dataSourceTest->GetSignalMemoryBuffer(0u, b, reinterpret_cast<void *&>(signal1[b]));
+        if (ok) {
+            ok = dataSourceTest->GetSignalMemoryBuffer(1u, b, reinterpret_cast<void *&>(signal2[b]));
+        }
+    }
+    for (uint32 b = 0u; (b < 3u) && (ok); b++) {
+        for (uint32 i = 0u; i < numberOfBuffers; i++) {
+            signal1[b][i] = (b * numberOfBuffers) + i;
+            signal2[b][i] = static_cast<uint16>(i);
+        }
+    }
+    //The buffers of the Signal1 are followed by their mirror, in every state buffer
+    for (uint32 b = 0u; (b < 3u) && (ok); b++) {
+        for (uint32 i = 0u; (i < numberOfBuffers) && (ok); i++) {
+            ok = (signal1[b][numberOfBuffers + i] == ((b * numberOfBuffers) + i));
+        }
+        for (uint32 i = 0u; (i < numberOfBuffers) && (ok); i++) {
+            ok = (signal2[b][i] == static_cast<uint16>(i));
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool MemoryDataSourceITest::TestIsSignalMemoryMirrored() {
+    bool ok = InitialiseDataSourceIEnviroment(configMirrored);
+    ReferenceT<MemoryDataSourceIDataSourceTest> dataSourceTest = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+    if (ok) {
+        ok = dataSourceTest.IsValid();
+    }
+    if (ok) {
+        ok = dataSourceTest->IsSignalMemoryMirrored(0u);
+    }
+    if (ok) {
+        ok = !dataSourceTest->IsSignalMemoryMirrored(1u);
+    }
+    if (ok) {
+        ok = !dataSourceTest->IsSignalMemoryMirrored(2u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    //Without MirroredBuffers no signal is mirrored
+    MemoryDataSourceIDataSourceTest dataSourceNotMirrored;
+    if (ok) {
+        ok = !dataSourceNotMirrored.IsSignalMemoryMirrored(0u);
+    }
+    return ok;
+}
@@ -79,6 +79,16 @@ public:
      * @brief Tests the GetSignalMemoryBuffer method.
      */
     bool TestGetSignalMemoryBuffer();
+
+    /**
+     * @brief Tests the GetSignalMemoryBuffer method with MirroredBuffers = 1.
+     */
+    bool TestGetSignalMemoryBuffer_MirroredBuffers();
+
+    /**
+     * @brief Tests the IsSignalMemoryMirrored method.
+     */
+    bool TestIsSignalMemoryMirrored();
 };
 
 
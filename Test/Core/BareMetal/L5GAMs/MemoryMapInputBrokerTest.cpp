@@ -301,6 +301,41 @@ bool MemoryMapInputBrokerDataSourceTestHelper::Synchronise() {
 
 CLASS_REGISTER(MemoryMapInputBrokerDataSourceTestHelper, "1.0");
 
+/**
+ * @brief DataSourceI implementation which stores all the signals contiguously in a single buffer.
+ */
+class MemoryMapInputBrokerContiguousDataSourceTestHelper: public MemoryMapInputBrokerDataSourceTestHelper {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    MemoryMapInputBrokerContiguousDataSourceTestHelper();
+
+    virtual uint32 GetNumberOfStatefulMemoryBuffers();
+
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx,
+            const uint32 bufferIdx,
+            void *&signalAddress);
+};
+
+MemoryMapInputBrokerContiguousDataSourceTestHelper::MemoryMapInputBrokerContiguousDataSourceTestHelper() :
+        MemoryMapInputBrokerDataSourceTestHelper() {
+    samples = 1u;
+}
+
+uint32 MemoryMapInputBrokerContiguousDataSourceTestHelper::GetNumberOfStatefulMemoryBuffers() {
+    return 1u;
+}
+
+bool MemoryMapInputBrokerContiguousDataSourceTestHelper::GetSignalMemoryBuffer(const uint32 signalIdx,
+                                                                               const uint32 bufferIdx,
+                                                                               void *&signalAddress) {
+    char8 *memPtr = reinterpret_cast<char8 *>(signalMemory);
+    signalAddress = reinterpret_cast<void *>(&memPtr[offsets[signalIdx]]);
+    return true;
+}
+
+CLASS_REGISTER(MemoryMapInputBrokerContiguousDataSourceTestHelper, "1.0");
+
 /**
  * Helper function to setup a MARTe execution environment
  */
@@ -486,6 +521,102 @@ static const char8 * const config1 = ""
         "        TimingDataSource = Timings"
         "    }"
         "}";
+/**
+ * MARTe configuration structure to test the MemoryMapInputBroker copy plan
+ */
+static const char8 * const configCopyPlan = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MemoryMapInputBrokerTestGAM1"
+        "            InputSignals = {"
+        "               SignalA = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               SignalB = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               SignalC = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               SignalD = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = MemoryMapInputBrokerTestGAM1"
+        "            InputSignals = {"
+        "               SignalB = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               SignalA = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               SignalC = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMC = {"
+        "            Class = MemoryMapInputBrokerTestGAM1"
+        "            OutputSignals = {"
+        "               SignalA = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               SignalB = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               SignalC = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               SignalD = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Drv1 = {"
+        "            Class = MemoryMapInputBrokerContiguousDataSourceTestHelper"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMC GAMA GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = MemoryMapInputBrokerTestScheduler1"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -709,3 +840,79 @@ bool MemoryMapInputBrokerTest::TestExecute_MultiStateBuffer() {
     return ret;
 }
 
+
+bool MemoryMapInputBrokerTest::TestExecute_CopyPlan() {
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(configCopyPlan);
+    ReferenceT<MemoryMapInputBrokerContiguousDataSourceTestHelper> dataSource;
+    ReferenceT<MemoryMapInputBroker> brokerA;
+    ReferenceT<MemoryMapInputBroker> brokerB;
+    ReferenceT<MemoryMapInputBrokerTestGAM1> gamA;
+    ReferenceT<MemoryMapInputBrokerTestGAM1> gamB;
+    ReferenceContainer brokersA;
+    ReferenceContainer brokersB;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        gamA = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        gamB = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMB");
+        ret = (gamA.IsValid() && gamB.IsValid());
+    }
+    if (ret) {
+        ret = dataSource->GetInputBrokers(brokersA, "GAMA", (void *) gamA->GetInputSignalsMemory());
+    }
+    if (ret) {
+        ret = dataSource->GetInputBrokers(brokersB, "GAMB", (void *) gamB->GetInputSignalsMemory());
+    }
+    if (ret) {
+        brokerA = brokersA.Get(0);
+        brokerB = brokersB.Get(0);
+        ret = (brokerA.IsValid() && brokerB.IsValid());
+    }
+    //All the signals of GAMA are contiguous in both memories: a single copy operation.
+    if (ret) {
+        ret = (brokerA->GetNumberOfCopies() == 4u);
+    }
+    if (ret) {
+        ret = (brokerA->GetCopyPlanSize() == 1u);
+    }
+    //GAMB reads SignalB before SignalA: SignalB and SignalC are not contiguous in the DataSource and SignalA cannot be merged with SignalC.
+    if (ret) {
+        ret = (brokerB->GetNumberOfCopies() == 3u);
+    }
+    if (ret) {
+        ret = (brokerB->GetCopyPlanSize() == 3u);
+    }
+    uint32 signalIdx;
+    const char8 * const signalNames[] = { "SignalA", "SignalB", "SignalC", "SignalD" };
+    for (uint32 n = 0u; (n < 4u) && (ret); n++) {
+        uint32 *signalPtr = NULL_PTR(uint32 *);
+        ret = dataSource->GetSignalIndex(signalIdx, signalNames[n]);
+        if (ret) {
+            ret = dataSource->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void *&>(signalPtr));
+        }
+        if (ret) {
+            *signalPtr = (n + 1u) * 11u;
+        }
+    }
+    if (ret) {
+        ret = brokerA->Execute();
+    }
+    if (ret) {
+        ret = brokerB->Execute();
+    }
+    for (uint32 n = 0u; (n < 4u) && (ret); n++) {
+        ret = (*reinterpret_cast<uint32 *>(gamA->GetInputSignalMemory(n)) == ((n + 1u) * 11u));
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(gamB->GetInputSignalMemory(0u)) == 22u);
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(gamB->GetInputSignalMemory(1u)) == 11u);
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(gamB->GetInputSignalMemory(2u)) == 33u);
+    }
+    return ret;
+}
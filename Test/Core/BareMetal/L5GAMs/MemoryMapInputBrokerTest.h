@@ -68,6 +68,11 @@ public:
      * @brief Tests the Execute method with a multi-state buffers.
      */
     bool TestExecute_MultiStateBuffer();
+
+    /**
+     * @brief Tests that the Execute method merges the contiguous signals in the compiled copy plan.
+     */
+    bool TestExecute_CopyPlan();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -187,6 +187,7 @@ MemoryMapInterpolatedInputBrokerDataSourceTestHelper    ();
     float32 floatIncrement;
     float32 initialFloatValue;
     uint64 interpolationPeriod;
+    uint32 elementIncrements;
 };
 
 MemoryMapInterpolatedInputBrokerDataSourceTestHelper::MemoryMapInterpolatedInputBrokerDataSourceTestHelper() :
@@ -205,6 +206,7 @@ MemoryMapInterpolatedInputBrokerDataSourceTestHelper::MemoryMapInterpolatedInput
     synchCounter = 0;
     initialIntValue = 0;
     initialFloatValue = 0;
+    elementIncrements = 0;
 }
 
 MemoryMapInterpolatedInputBrokerDataSourceTestHelper::~MemoryMapInterpolatedInputBrokerDataSourceTestHelper() {
@@ -239,6 +241,12 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Initialise(Structured
     if (ok) {
         ok = data.Read("InterpolationPeriod", interpolationPeriod);
     }
+    if (ok) {
+        //If set, the element n of each signal is incremented by (n + 1) * increment
+        if (!data.Read("ElementIncrements", elementIncrements)) {
+            elementIncrements = 0u;
+        }
+    }
     return ok;
 }
 
@@ -421,7 +429,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 uint8 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(uint8));
-                val += intIncrement;
+                val += (intIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(uint8));
             }
         }
@@ -430,7 +438,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 uint16 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(uint16));
-                val += intIncrement;
+                val += (intIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(uint16));
             }
         }
@@ -439,7 +447,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 uint32 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(uint32));
-                val += intIncrement;
+                val += (intIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(uint32));
             }
         }
@@ -448,7 +456,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 uint64 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(uint64));
-                val += intIncrement;
+                val += (intIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(uint64));
             }
         }
@@ -457,7 +465,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 int8 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(int8));
-                val += intIncrement;
+                val += (intIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(int8));
             }
         }
@@ -466,7 +474,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 int16 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(int16));
-                val += intIncrement;
+                val += (intIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(int16));
             }
         }
@@ -475,7 +483,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 int32 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(int32));
-                val += intIncrement;
+                val += (intIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(int32));
             }
         }
@@ -484,7 +492,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 int64 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(int64));
-                val += intIncrement;
+                val += (intIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(int64));
             }
         }
@@ -493,7 +501,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 float32 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(float32));
-                val += floatIncrement;
+                val += (floatIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(float32));
             }
         }
@@ -502,7 +510,7 @@ bool MemoryMapInterpolatedInputBrokerDataSourceTestHelper::Synchronise() {
             for (n = 0u; (n < nElements[s]) && (ret); n++) {
                 float64 val;
                 MemoryOperationsHelper::Copy(&val, &signal[n], sizeof(float64));
-                val += floatIncrement;
+                val += (floatIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u));
                 MemoryOperationsHelper::Copy(&signal[n], &val, sizeof(float64));
             }
         }
@@ -931,19 +939,176 @@ static const char8 * const config3 = ""
         "    }"
         "}";
 
+/**
+ * MARTe configuration structure to test the MemoryMapInterpolatedInputBroker with several signals of the same type and a different slope for each element
+ */
+static const char8 * const config4 = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MemoryMapInterpolatedInputBrokerTestGAM1"
+        "            InputSignals = {"
+        "               SignalUInt32A = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "                   NumberOfElements = 3"
+        "               }"
+        "               SignalUInt64 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint64"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               SignalFloat32A = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "                   NumberOfElements = 2"
+        "               }"
+        "               SignalUInt16 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint16"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               SignalUInt8 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint8"
+        "                   NumberOfElements = 2"
+        "               }"
+        "               SignalInt8 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int8"
+        "                   NumberOfElements = 2"
+        "               }"
+        "               SignalUInt32B = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "                   NumberOfElements = 5"
+        "               }"
+        "               SignalInt16 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int16"
+        "                   NumberOfElements = 4"
+        "               }"
+        "               SignalInt32 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "                   NumberOfElements = 1"
+        "               }"
+        "               SignalInt64 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int64"
+        "                   NumberOfElements = 3"
+        "               }"
+        "               SignalFloat32B = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "                   NumberOfElements = 1"
+        "               }"
+        "               SignalFloat64 = {"
+        "                   DataSource = Drv1"
+        "                   Type = float64"
+        "                   NumberOfElements = 2"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Drv1 = {"
+        "            Class = MemoryMapInterpolatedInputBrokerDataSourceTestHelper"
+        "            IntIncrement = 10"
+        "            FloatIncrement = 0.5"
+        "            InterpolationPeriod = 2"
+        "            TimeIncrement = 5"
+        "            ElementIncrements = 1"
+        "            Signals = {"
+        "               SignalUInt32A = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               SignalUInt64 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint64"
+        "               }"
+        "               SignalFloat32A = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "               }"
+        "               SignalUInt16 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint16"
+        "               }"
+        "               SignalUInt8 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint8"
+        "               }"
+        "               SignalInt8 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int8"
+        "               }"
+        "               SignalUInt32B = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               SignalInt16 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int16"
+        "               }"
+        "               SignalInt32 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "               }"
+        "               SignalInt64 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int64"
+        "               }"
+        "               SignalFloat32B = {"
+        "                   DataSource = Drv1"
+        "                   Type = float32"
+        "               }"
+        "               SignalFloat64 = {"
+        "                   DataSource = Drv1"
+        "                   Type = float64"
+        "               }"
+        "            }"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = MemoryMapInterpolatedInputBrokerTestScheduler1"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /**
  * Check the expected value already knowing that the MemoryMapInterpolatedInputBrokerDataSourceTestHelper is generating an increasing monotonic ramp with constant derivative
  */
 template<typename T>
-static bool CheckExpectedValue(uint64 executeNumber, uint32 valueIncrement, uint32 initValue, uint64 timeIncrement, uint64 interpolationPeriod, uint32 nElements, void *gamPtr) {
+static bool CheckExpectedValue(uint64 executeNumber, uint32 valueIncrement, uint32 initValue, uint64 timeIncrement, uint64 interpolationPeriod, uint32 nElements, uint32 elementIncrements, void *gamPtr) {
     T *signal = static_cast<T *>(gamPtr);
-    float64 m = static_cast<float64>(valueIncrement) / static_cast<float64>(timeIncrement);
-
-    T expectedValue = static_cast<T>(m * interpolationPeriod * executeNumber + initValue);
 
     bool ret = true;
     uint32 n;
     for (n = 0u; (n < nElements) && (ret); n++) {
+        uint32 increment = valueIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u);
+        float64 m = static_cast<float64>(increment) / static_cast<float64>(timeIncrement);
+        T expectedValue = static_cast<T>(m * interpolationPeriod * executeNumber + initValue);
 	T sn;
 	MemoryOperationsHelper::Copy(&sn, &signal[n], sizeof(T));
         ret = (sn == expectedValue);
@@ -953,17 +1118,17 @@ static bool CheckExpectedValue(uint64 executeNumber, uint32 valueIncrement, uint
 }
 
 template<typename T>
-static bool CheckExpectedValueD(uint64 executeNumber, float32 valueIncrement, float32 initValue, uint64 timeIncrement, uint64 interpolationPeriod, uint32 nElements, void *gamPtr) {
+static bool CheckExpectedValueD(uint64 executeNumber, float32 valueIncrement, float32 initValue, uint64 timeIncrement, uint64 interpolationPeriod, uint32 nElements, uint32 elementIncrements, void *gamPtr) {
     T *signal = static_cast<T *>(gamPtr);
-    T expectedValue = valueIncrement * executeNumber;
-    float64 dt = static_cast<float64>(interpolationPeriod);
-    dt /= static_cast<float64>(timeIncrement);
-    expectedValue *= dt;
-    expectedValue += initValue;
 
     bool ret = true;
     uint32 n;
     for (n = 0u; (n < nElements) && (ret); n++) {
+        T expectedValue = valueIncrement * ((elementIncrements != 0u) ? (n + 1u) : 1u) * executeNumber;
+        float64 dt = static_cast<float64>(interpolationPeriod);
+        dt /= static_cast<float64>(timeIncrement);
+        expectedValue *= dt;
+        expectedValue += initValue;
 	T ft; 
 	MemoryOperationsHelper::Copy(&ft, &signal[n], sizeof(T));
         float64 f1 = ft;
@@ -1000,6 +1165,10 @@ bool MemoryMapInterpolatedInputBrokerTest::TestExecute_3() {
     return TestExecuteP(config3);
 }
 
+bool MemoryMapInterpolatedInputBrokerTest::TestExecute_4() {
+    return TestExecuteP(config4);
+}
+
 bool MemoryMapInterpolatedInputBrokerTest::TestExecute_False() {
     return !TestExecuteP(config2, 6);
 }
@@ -1072,34 +1241,34 @@ bool MemoryMapInterpolatedInputBrokerTest::TestExecuteP(StreamString config1, ui
                 gamA->GetSignalNumberOfElements(InputSignals, s, nElements);
                 TypeDescriptor signalType = gamA->GetSignalType(InputSignals, s);
                 if (signalType == UnsignedInteger8Bit) {
-                    ret = CheckExpectedValue<uint8>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                    ret = CheckExpectedValue<uint8>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, dataSource->elementIncrements, gamPtr);
                 }
                 else if (signalType == UnsignedInteger16Bit) {
-                    ret = CheckExpectedValue<uint16>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                    ret = CheckExpectedValue<uint16>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, dataSource->elementIncrements, gamPtr);
                 }
                 else if (signalType == UnsignedInteger32Bit) {
-                    ret = CheckExpectedValue<uint32>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                    ret = CheckExpectedValue<uint32>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, dataSource->elementIncrements, gamPtr);
                 }
                 else if (signalType == UnsignedInteger64Bit) {
-                    ret = CheckExpectedValue<uint64>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                    ret = CheckExpectedValue<uint64>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, dataSource->elementIncrements, gamPtr);
                 }
                 else if (signalType == SignedInteger8Bit) {
-                    ret = CheckExpectedValue<int8>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                    ret = CheckExpectedValue<int8>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, dataSource->elementIncrements, gamPtr);
                 }
                 else if (signalType == SignedInteger16Bit) {
-                    ret = CheckExpectedValue<int16>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                    ret = CheckExpectedValue<int16>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, dataSource->elementIncrements, gamPtr);
                 }
                 else if (signalType == SignedInteger32Bit) {
-                    ret = CheckExpectedValue<int32>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                    ret = CheckExpectedValue<int32>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, dataSource->elementIncrements, gamPtr);
                 }
                 else if (signalType == SignedInteger64Bit) {
-                    ret = CheckExpectedValue<int64>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                    ret = CheckExpectedValue<int64>(e, dataSource->intIncrement, dataSource->initialIntValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, dataSource->elementIncrements, gamPtr);
                 }
                 else if (signalType == Float32Bit) {
-                    ret = CheckExpectedValueD<float32>(e, dataSource->floatIncrement, dataSource->initialFloatValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                    ret = CheckExpectedValueD<float32>(e, dataSource->floatIncrement, dataSource->initialFloatValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, dataSource->elementIncrements, gamPtr);
                 }
                 else if (signalType == Float64Bit) {
-                    ret = CheckExpectedValueD<float64>(e, dataSource->floatIncrement, dataSource->initialFloatValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, gamPtr);
+                    ret = CheckExpectedValueD<float64>(e, dataSource->floatIncrement, dataSource->initialFloatValue, dataSource->timeIncrement, dataSource->interpolationPeriod, nElements, dataSource->elementIncrements, gamPtr);
                 }
             }
         }
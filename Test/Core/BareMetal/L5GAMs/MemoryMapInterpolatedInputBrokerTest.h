@@ -61,6 +61,11 @@ public:
      */
     bool TestExecute_3();
 
+    /**
+     * @brief Tests the Execute method with several signals of the same type and a different slope for each element.
+     */
+    bool TestExecute_4();
+
     /**
      * @brief Tests that the Execute method returns false when the DataSource time does not change.
      */
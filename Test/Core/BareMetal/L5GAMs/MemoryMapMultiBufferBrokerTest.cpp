@@ -79,10 +79,20 @@ MemoryMapMultiBufferBrokerDSTest    ();
     virtual bool GetInputBrokers(ReferenceContainer &inputBrokers, const char8* const functionName, void * const gamMemPtr);
 
     virtual bool GetOutputBrokers(ReferenceContainer &outputBrokers, const char8* const functionName, void * const gamMemPtr);
+
+    virtual bool Initialise(StructuredDataI &data);
+
+    virtual bool IsOffsetCachingSupported();
+
+    void SetOffset(const uint32 signalIdx, const uint32 offset);
+
+    uint32 GetNumberOfOffsetQueries();
 protected:
 
     uint32 currentOffsets[3];
     uint32 currentBuffer;
+    uint32 numberOfOffsetQueries;
+    bool offsetCaching;
 };
 
 MemoryMapMultiBufferBrokerDSTest::MemoryMapMultiBufferBrokerDSTest() {
@@ -90,6 +100,8 @@ MemoryMapMultiBufferBrokerDSTest::MemoryMapMultiBufferBrokerDSTest() {
     currentOffsets[1] = 0u;
     currentOffsets[2] = 0u;
     currentBuffer = 0u;
+    numberOfOffsetQueries = 0u;
+    offsetCaching = false;
 
 }
 
@@ -99,14 +111,40 @@ MemoryMapMultiBufferBrokerDSTest::~MemoryMapMultiBufferBrokerDSTest() {
 
 bool MemoryMapMultiBufferBrokerDSTest::GetInputOffset(const uint32 signalIdx, const uint32 samples, uint32 &offset) {
     offset = currentOffsets[signalIdx % 3];
+    numberOfOffsetQueries++;
     return true;
 }
 
 bool MemoryMapMultiBufferBrokerDSTest::GetOutputOffset(const uint32 signalIdx, const uint32 samples, uint32 &offset) {
     offset = currentOffsets[signalIdx % 3];
+    numberOfOffsetQueries++;
     return true;
 }
 
+bool MemoryMapMultiBufferBrokerDSTest::Initialise(StructuredDataI &data) {
+    bool ret = MemoryDataSourceI::Initialise(data);
+    if (ret) {
+        uint8 offsetCachingTemp = 0u;
+        if (!data.Read("OffsetCaching", offsetCachingTemp)) {
+            offsetCachingTemp = 0u;
+        }
+        offsetCaching = (offsetCachingTemp > 0u);
+    }
+    return ret;
+}
+
+bool MemoryMapMultiBufferBrokerDSTest::IsOffsetCachingSupported() {
+    return offsetCaching;
+}
+
+void MemoryMapMultiBufferBrokerDSTest::SetOffset(const uint32 signalIdx, const uint32 offset) {
+    currentOffsets[signalIdx % 3] = offset;
+}
+
+uint32 MemoryMapMultiBufferBrokerDSTest::GetNumberOfOffsetQueries() {
+    return numberOfOffsetQueries;
+}
+
 uint32 MemoryMapMultiBufferBrokerDSTest::GetNumberOfMemoryBuffers() {
     return numberOfBuffers;
 }
@@ -1872,3 +1910,336 @@ bool MemoryMapMultiBufferBrokerTest::TestCopyOutputs_MoreBuffersThanSamples() {
     }
     return ret;
 }
+
+bool MemoryMapMultiBufferBrokerTest::TestCopyInputs_OffsetCaching() {
+    static const char8 * const config1 = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = MemoryMapMultiBufferBrokerTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 3"
+            "               }"
+            "               Signal2 = {"
+            "                   DataSource = Drv1"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 3"
+            "                   Type = uint32"
+            "                   Ranges = {{0, 0}, {2, 2}}"
+            "                   Samples = 3"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = MemoryMapMultiBufferBrokerDSTest"
+            "            NumberOfBuffers = 2"
+            "            OffsetCaching = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = MemoryMapInputBrokerTestScheduler1"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config1);
+
+    ReferenceT<MemoryMapMultiBufferBrokerDSTest> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+
+    ReferenceT<MemoryMapMultiBufferBrokerTestGAM1> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    ReferenceContainer brokers;
+    ReferenceT<MemoryMapMultiBufferBrokerTestInputBroker> broker;
+    uint32* data = NULL;
+    if (ret) {
+        gam->GetInputBrokers(brokers);
+        broker = brokers.Get(0);
+        data = (uint32*) gam->GetInputMemoryBuffer();
+    }
+    uint32 numberOfQueries = 0u;
+    if (ret) {
+        //One copy for Signal1 and one copy for each range and sample of Signal2, but only one offset query per signal.
+        uint32 numberOfCopies = 0u;
+        (void) broker->GetSignalIdxArr(numberOfCopies);
+        ret = (numberOfCopies == 7u);
+        numberOfQueries = dataSource->GetNumberOfOffsetQueries();
+    }
+
+    if (ret) {
+        broker->CopyInputs();
+        ret = (dataSource->GetNumberOfOffsetQueries() == (numberOfQueries + 2u));
+        ret &= (data[0] == 0);
+        ret &= (data[1] == 1);
+        ret &= (data[2] == 0);
+        ret &= (data[3] == 2);
+        ret &= (data[4] == 5);
+        ret &= (data[5] == 2);
+        ret &= (data[6] == 4);
+        ret &= (data[7] == 7);
+        ret &= (data[8] == 4);
+    }
+
+    if (ret) {
+        dataSource->Synchronise();
+        broker->CopyInputs();
+        ret = (dataSource->GetNumberOfOffsetQueries() == (numberOfQueries + 4u));
+        ret &= (data[0] == 1);
+        ret &= (data[1] == 0);
+        ret &= (data[2] == 1);
+        ret &= (data[3] == 5);
+        ret &= (data[4] == 2);
+        ret &= (data[5] == 5);
+        ret &= (data[6] == 7);
+        ret &= (data[7] == 4);
+        ret &= (data[8] == 7);
+    }
+
+    return ret;
+}
+
+bool MemoryMapMultiBufferBrokerTest::TestCopyInputs_MirroredBuffers() {
+    static const char8 * const config1 = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = MemoryMapMultiBufferBrokerTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 3"
+            "               }"
+            "               Signal2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint16"
+            "                   Samples = 3"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = MemoryMapMultiBufferBrokerDSTest"
+            "            NumberOfBuffers = 1024"
+            "            MirroredBuffers = 1"
+            "            OffsetCaching = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = MemoryMapInputBrokerTestScheduler1"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config1);
+
+    ReferenceT<MemoryMapMultiBufferBrokerDSTest> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    //The buffers of Signal1 (1024 x uint32) are mirrored, the ones of Signal2 (1024 x uint16) are not.
+    if (ret) {
+        ret = dataSource->IsSignalMemoryMirrored(0u);
+    }
+    if (ret) {
+        ret = !dataSource->IsSignalMemoryMirrored(1u);
+    }
+
+    ReferenceT<MemoryMapMultiBufferBrokerTestGAM1> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    ReferenceContainer brokers;
+    ReferenceT<MemoryMapMultiBufferBrokerTestInputBroker> broker;
+    uint32 *data = NULL;
+    uint32 *signal1 = NULL;
+    uint16 *signal2 = NULL;
+    if (ret) {
+        gam->GetInputBrokers(brokers);
+        broker = brokers.Get(0);
+        data = (uint32*) gam->GetInputMemoryBuffer();
+        ret = dataSource->GetSignalMemoryBuffer(0u, 0u, (void*&) signal1);
+    }
+    if (ret) {
+        ret = dataSource->GetSignalMemoryBuffer(1u, 0u, (void*&) signal2);
+    }
+    if (ret) {
+        for (uint32 i = 0u; i < 1024u; i++) {
+            signal1[i] = 1000u + i;
+            signal2[i] = static_cast<uint16>(i);
+        }
+        //The last 3 samples wrap around the end of the buffers
+        dataSource->SetOffset(0u, 1022u * sizeof(uint32));
+        dataSource->SetOffset(1u, 1022u * sizeof(uint16));
+        ret = broker->CopyInputs();
+    }
+    if (ret) {
+        uint16 *data2 = reinterpret_cast<uint16 *>(&data[3]);
+        ret = (data[0] == 2022u);
+        ret &= (data[1] == 2023u);
+        ret &= (data[2] == 1000u);
+        ret &= (data2[0] == 1022u);
+        ret &= (data2[1] == 1023u);
+        ret &= (data2[2] == 0u);
+    }
+    if (ret) {
+        //No wrap
+        dataSource->SetOffset(0u, 10u * sizeof(uint32));
+        ret = broker->CopyInputs();
+    }
+    if (ret) {
+        ret = (data[0] == 1010u);
+        ret &= (data[1] == 1011u);
+        ret &= (data[2] == 1012u);
+    }
+
+    return ret;
+}
+
+bool MemoryMapMultiBufferBrokerTest::TestCopyOutputs_MirroredBuffers() {
+    static const char8 * const config1 = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = MemoryMapMultiBufferBrokerTestGAM1"
+            "            OutputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   Samples = 3"
+            "               }"
+            "               Signal2 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint16"
+            "                   Samples = 3"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = MemoryMapMultiBufferBrokerDSTest"
+            "            NumberOfBuffers = 1024"
+            "            MirroredBuffers = 1"
+            "            OffsetCaching = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = MemoryMapInputBrokerTestScheduler1"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config1);
+
+    ReferenceT<MemoryMapMultiBufferBrokerDSTest> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = dataSource->IsSignalMemoryMirrored(0u);
+    }
+
+    ReferenceT<MemoryMapMultiBufferBrokerTestGAM1> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    ReferenceContainer brokers;
+    ReferenceT<MemoryMapMultiBufferBrokerTestOutputBroker> broker;
+    uint32 *signal1 = NULL;
+    if (ret) {
+        gam->GetOutputBrokers(brokers);
+        broker = brokers.Get(0);
+        ret = dataSource->GetSignalMemoryBuffer(0u, 0u, (void*&) signal1);
+    }
+    if (ret) {
+        for (uint32 i = 0u; i < 1024u; i++) {
+            signal1[i] = 0xFFFFFFFFu;
+        }
+        //The GAM writes 0, 1, 2 in the 3 samples of Signal1, which wrap around the end of the buffers
+        dataSource->SetOffset(0u, 1022u * sizeof(uint32));
+        ret = broker->CopyOutputs();
+    }
+    if (ret) {
+        ret = (signal1[1022] == 0u);
+        ret &= (signal1[1023] == 1u);
+        ret &= (signal1[0] == 2u);
+        ret &= (signal1[1] == 0xFFFFFFFFu);
+        ret &= (signal1[1021] == 0xFFFFFFFFu);
+    }
+
+    return ret;
+}
@@ -125,6 +125,21 @@ public:
      * @brief Tests the CopyOutputs method with more buffers than samples.
      */
     bool TestCopyOutputs_MoreBuffersThanSamples();
+
+    /**
+     * @brief Tests that the CopyInputs method only queries the offset once per signal if the DataSourceI supports the offset caching.
+     */
+    bool TestCopyInputs_OffsetCaching();
+
+    /**
+     * @brief Tests the CopyInputs method with a window of samples that wraps around the end of mirrored signal buffers.
+     */
+    bool TestCopyInputs_MirroredBuffers();
+
+    /**
+     * @brief Tests the CopyOutputs method with a window of samples that wraps around the end of mirrored signal buffers.
+     */
+    bool TestCopyOutputs_MirroredBuffers();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -31,6 +31,7 @@
 
 #include "ConfigurationDatabase.h"
 #include "ErrorManagement.h"
+#include "ImmutableConfigurationDatabase.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "RealTimeApplicationConfigurationBuilderTest.h"
@@ -294,7 +295,8 @@ static bool TestBuilder(const char8 *const config,
                         const char8 *const expectedDataConfig,
                         RealTimeApplicationConfigurationBuilderFunctions functionToCall,
                         bool expectCallFailure = false,
-                        bool fromConfiguration = false) {
+                        bool fromConfiguration = false,
+                        bool fromImmutableConfiguration = false) {
 
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -328,7 +330,22 @@ static bool TestBuilder(const char8 *const config,
     expectedDataDatabase.MoveToRoot();
 
     bool ret = true;
-    if (fromConfiguration) {
+    if (fromImmutableConfiguration) {
+        ImmutableConfigurationDatabase icdb;
+        ret = cdb.MoveToRoot();
+        if (ret) {
+            ret = cdb.Copy(icdb);
+        }
+        icdb.Freeze();
+        if (ret) {
+            ret = icdb.MoveAbsolute(appName);
+        }
+        RealTimeApplicationConfigurationBuilder rtAppBuilder(icdb, ddbName);
+        if (ret) {
+            ret = TestLauncher(rtAppBuilder, expectedFunctionsDatabase, expectedDataDatabase, functionToCall, expectCallFailure, true);
+        }
+    }
+    else if (fromConfiguration) {
         ret = cdb.MoveAbsolute(appName);
         RealTimeApplicationConfigurationBuilder rtAppBuilder(cdb, ddbName);
         ret = TestLauncher(rtAppBuilder, expectedFunctionsDatabase, expectedDataDatabase, functionToCall, expectCallFailure, fromConfiguration);
@@ -33255,7 +33272,7 @@ bool RealTimeApplicationConfigurationBuilderTest::TestConfigureAfterInitialisati
     return !CallConfigureAfterInitialisation(config);
 }
 
-bool RealTimeApplicationConfigurationBuilderTest::TestConfigureBeforeInitialisation() {
+bool RealTimeApplicationConfigurationBuilderTest::TestConfigureBeforeInitialisation(bool fromImmutableConfig) {
     const char8 *const config = ""
             "$Application1 = {"
             "    Class = RealTimeApplication"
@@ -33961,7 +33978,7 @@ bool RealTimeApplicationConfigurationBuilderTest::TestConfigureBeforeInitialisat
             "    }"
             "}";
 
-    return TestBuilder(config, "$Application1", "DDB1", expectedFunctionsConfig, expectedDataConfig, ConfigureInitialisation, false, true);
+    return TestBuilder(config, "$Application1", "DDB1", expectedFunctionsConfig, expectedDataConfig, ConfigureInitialisation, false, true, fromImmutableConfig);
 }
 
 bool RealTimeApplicationConfigurationBuilderTest::TestConfigureBeforeInitialisation_False_NoFunctions() {
@@ -530,9 +530,9 @@ public:
     bool TestConfigureAfterInitialisation_False_NoData();
 
     /**
-     * @brief Tests the ConfigureBeforeInitialisation method.
+     * @brief Tests the ConfigureBeforeInitialisation method (optionally reading the configuration from a frozen ImmutableConfigurationDatabase).
      */
-    bool TestConfigureBeforeInitialisation();
+    bool TestConfigureBeforeInitialisation(bool fromImmutableConfig = false);
 
     /**
      * @brief Tests the ResolveStates method on the ConfigureBeforeInitialisation context.
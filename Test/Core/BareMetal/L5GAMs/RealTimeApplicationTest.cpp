@@ -336,6 +336,48 @@ public:
 };
 CLASS_REGISTER(GAMRealTimeApplicationTestHelper1, "1.0")
 
+/**
+ * @brief GAM which writes a known pattern in all of its uint32 output signals.
+ */
+class GAMRealTimeApplicationTestHelper2: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()GAMRealTimeApplicationTestHelper2 () {
+
+    }
+    virtual ~GAMRealTimeApplicationTestHelper2() {
+
+    }
+
+    virtual bool Execute() {
+        bool ret = true;
+        for (uint32 i = 0u; (i < GetNumberOfOutputSignals()) && (ret); i++) {
+            uint32 numberOfElements = 0u;
+            ret = GetSignalNumberOfElements(OutputSignals, i, numberOfElements);
+            uint32 *signal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(i));
+            for (uint32 n = 0u; (n < numberOfElements) && (ret); n++) {
+                signal[n] = (((i + 1u) * 10u) + n);
+            }
+        }
+        return ret;
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    void *GetSignalMemory(const SignalDirection direction, const uint32 signalIdx) const {
+        void *ret;
+        if (direction == InputSignals) {
+            ret = GetInputSignalMemory(signalIdx);
+        }
+        else {
+            ret = GetOutputSignalMemory(signalIdx);
+        }
+        return ret;
+    }
+};
+CLASS_REGISTER(GAMRealTimeApplicationTestHelper2, "1.0")
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -3012,3 +3054,177 @@ bool RealTimeApplicationTest::TestCheckMultipleProducersWrites(){
     }
     return ret;
 }
+
+bool RealTimeApplicationTest::TestConfigureApplication_ZeroCopySignals() {
+    bool ret = TestZeroCopySignals(true);
+    if (ret) {
+        ret = TestZeroCopySignals(false);
+    }
+    return ret;
+}
+
+bool RealTimeApplicationTest::TestZeroCopySignals(const bool zeroCopySignals) {
+    StreamString config = ""
+            "$Fibonacci = {"
+            "    Class = RealTimeApplication";
+    if (zeroCopySignals) {
+        config += "    ZeroCopySignals = 1";
+    }
+    config += ""
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = GAMRealTimeApplicationTestHelper2"
+            "            OutputSignals = {"
+            "                SignalA = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                }"
+            "                SignalB = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 8"
+            "                }"
+            "                SignalC = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 4"
+            "                }"
+            "            }"
+            "        }"
+            "        +GAMB = {"
+            "            Class = GAMRealTimeApplicationTestHelper2"
+            "            InputSignals = {"
+            "                SignalA = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                }"
+            "                SignalB = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 8"
+            "                }"
+            "                SignalC = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 4"
+            "                    Ranges = {{1 2}}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA GAMB}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = RealTimeApplicationTestScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ret = parser.Parse();
+
+    if (ret) {
+        cdb.MoveToRoot();
+        ObjectRegistryDatabase::Instance()->Purge();
+        ret = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+    if (ret) {
+        ret = app.IsValid();
+    }
+    if (ret) {
+        ret = app->ConfigureApplication();
+    }
+    ReferenceT<GAMRealTimeApplicationTestHelper2> gamA = ObjectRegistryDatabase::Instance()->Find("Fibonacci.Functions.GAMA");
+    ReferenceT<GAMRealTimeApplicationTestHelper2> gamB = ObjectRegistryDatabase::Instance()->Find("Fibonacci.Functions.GAMB");
+    ReferenceT<GAMDataSource> ddb1 = ObjectRegistryDatabase::Instance()->Find("Fibonacci.Data.DDB1");
+    if (ret) {
+        ret = (gamA.IsValid() && gamB.IsValid() && ddb1.IsValid());
+    }
+    void *dsSignalMemory[3];
+    const char8 * const signalNames[] = { "SignalA", "SignalB", "SignalC" };
+    for (uint32 i = 0u; (i < 3u) && (ret); i++) {
+        uint32 signalIdx;
+        ret = ddb1->GetSignalIndex(signalIdx, signalNames[i]);
+        if (ret) {
+            ret = ddb1->GetSignalMemoryBuffer(signalIdx, 0u, dsSignalMemory[i]);
+        }
+    }
+    //All the signals of GAMA and the SignalA and SignalB of GAMB are accessed directly. The SignalC of GAMB has ranges.
+    for (uint32 i = 0u; (i < 3u) && (ret); i++) {
+        ret = ((gamA->GetSignalMemory(OutputSignals, i) == dsSignalMemory[i]) == zeroCopySignals);
+    }
+    for (uint32 i = 0u; (i < 2u) && (ret); i++) {
+        ret = ((gamB->GetSignalMemory(InputSignals, i) == dsSignalMemory[i]) == zeroCopySignals);
+    }
+    if (ret) {
+        ret = (gamB->GetSignalMemory(InputSignals, 2u) != dsSignalMemory[2u]);
+    }
+    ReferenceContainer outputBrokersA;
+    ReferenceContainer inputBrokersB;
+    if (ret) {
+        ret = gamA->GetOutputBrokers(outputBrokersA);
+    }
+    if (ret) {
+        ret = gamB->GetInputBrokers(inputBrokersB);
+    }
+    if (ret) {
+        if (zeroCopySignals) {
+            ret = ((outputBrokersA.Size() == 0u) && (inputBrokersB.Size() == 1u));
+        }
+        else {
+            ret = ((outputBrokersA.Size() == 1u) && (inputBrokersB.Size() == 1u));
+        }
+    }
+    //Execute the cycle and check that the data arrives to GAMB
+    if (ret) {
+        ret = gamA->Execute();
+    }
+    for (uint32 i = 0u; (i < outputBrokersA.Size()) && (ret); i++) {
+        ReferenceT<BrokerI> broker = outputBrokersA.Get(i);
+        ret = broker->Execute();
+    }
+    for (uint32 i = 0u; (i < inputBrokersB.Size()) && (ret); i++) {
+        ReferenceT<BrokerI> broker = inputBrokersB.Get(i);
+        ret = broker->Execute();
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(gamB->GetSignalMemory(InputSignals, 0u)) == 10u);
+    }
+    for (uint32 n = 0u; (n < 8u) && (ret); n++) {
+        ret = (reinterpret_cast<uint32 *>(gamB->GetSignalMemory(InputSignals, 1u))[n] == (20u + n));
+    }
+    for (uint32 n = 0u; (n < 2u) && (ret); n++) {
+        ret = (reinterpret_cast<uint32 *>(gamB->GetSignalMemory(InputSignals, 2u))[n] == (31u + n));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -207,8 +207,21 @@ public:
      */
     bool TestCheckMultipleProducersWrites();
 
+    /**
+     * @brief Tests that the ConfigureApplication method with ZeroCopySignals = 1 removes the broker copies of the signals
+     * that can be directly accessed in the DataSourceI memory.
+     */
+    bool TestConfigureApplication_ZeroCopySignals();
+
 
     StreamString config;
+
+private:
+
+    /**
+     * @brief Configures an application with (or without) ZeroCopySignals and verifies the GAM signal memory and the brokers.
+     */
+    bool TestZeroCopySignals(const bool zeroCopySignals);
 };
 
 /*---------------------------------------------------------------------------*/
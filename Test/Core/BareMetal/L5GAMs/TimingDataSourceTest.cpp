@@ -34,6 +34,7 @@
 #include "GAM.h"
 #include "GAMSchedulerI.h"
 #include "MemoryMapInputBroker.h"
+#include "MemoryMapSynchronisedInputBroker.h"
 #include "MemoryMapOutputBroker.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
@@ -41,13 +42,20 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
-static bool InitialiseTimingDataSourceEnviroment(const char8 * const config) {
+static bool InitialiseTimingDataSourceEnviroment(const char8 * const config, const bool rawTicksTiming = false) {
     ConfigurationDatabase cdb;
     StreamString configStream = config;
     configStream.Seek(0);
     StandardParser parser(configStream, cdb);
 
     bool ok = parser.Parse();
+    if ((ok) && (rawTicksTiming)) {
+        ok = cdb.MoveAbsolute("$Application1.+Scheduler");
+        if (ok) {
+            ok = cdb.Write("RawTicksTiming", 1u);
+        }
+        cdb.MoveToRoot();
+    }
 
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
 
@@ -562,3 +570,129 @@ bool TimingDataSourceTest::TestSetConfiguredDatabase_False_Producers() {
     TimingDataSource timingDataSource;
     return !timingDataSource.SetConfiguredDatabase(config);
 }
+
+bool TimingDataSourceTest::TestGetInputBrokers() {
+    bool ok = InitialiseTimingDataSourceEnviroment(configTestCurrentStateSignal);
+    ReferenceT<GAM> gama;
+    if (ok) {
+        gama = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = gama.IsValid();
+    }
+    ReferenceContainer inputBrokers;
+    if (ok) {
+        ok = gama->GetInputBrokers(inputBrokers);
+    }
+    if (ok) {
+        ok = (inputBrokers.Size() == 1u);
+    }
+    if (ok) {
+        ReferenceT<MemoryMapInputBroker> broker = inputBrokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    if (ok) {
+        ReferenceT<MemoryMapSynchronisedInputBroker> broker = inputBrokers.Get(0u);
+        ok = !broker.IsValid();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool TimingDataSourceTest::TestGetInputBrokers_RawTicks() {
+    bool ok = InitialiseTimingDataSourceEnviroment(configTestCurrentStateSignal, true);
+    ReferenceT<GAM> gama;
+    if (ok) {
+        gama = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = gama.IsValid();
+    }
+    ReferenceContainer inputBrokers;
+    if (ok) {
+        ok = gama->GetInputBrokers(inputBrokers);
+    }
+    if (ok) {
+        ok = (inputBrokers.Size() == 1u);
+    }
+    if (ok) {
+        ReferenceT<MemoryMapSynchronisedInputBroker> broker = inputBrokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool TimingDataSourceTest::TestSynchronise() {
+    bool ok = InitialiseTimingDataSourceEnviroment(configTestCurrentStateSignal);
+    ReferenceT<TimingDataSource> timings;
+    if (ok) {
+        timings = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Timings");
+        ok = timings.IsValid();
+    }
+    uint32 *currentState = NULL_PTR(uint32 *);
+    if (ok) {
+        uint32 signalIdx;
+        ok = timings->GetSignalIndex(signalIdx, "CurrentState");
+        if (ok) {
+            ok = timings->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void *&>(currentState));
+        }
+    }
+    uint64 ticks1[] = { 1000u, 2000u };
+    uint64 ticks2[] = { 3000u };
+    uint32 destination1[] = { 0u, 0u };
+    uint32 destination2[] = { 0u };
+    uint32 *signals1[] = { &destination1[0], &destination1[1] };
+    uint32 *signals2[] = { &destination2[0] };
+    if (ok) {
+        TimingDataSourceRawTicksTable table;
+        table.stateIdentifier = 0u;
+        table.ticks = &ticks1[0];
+        table.signals = &signals1[0];
+        table.numberOfElements = 2u;
+        table.ticksToTime = 0.5;
+        ok = timings->AddRawTicksTable(table);
+        if (ok) {
+            table.stateIdentifier = 1u;
+            table.ticks = &ticks2[0];
+            table.signals = &signals2[0];
+            table.numberOfElements = 1u;
+            table.ticksToTime = 1.0;
+            ok = timings->AddRawTicksTable(table);
+        }
+    }
+    if (ok) {
+        *currentState = 0u;
+        ok = timings->Synchronise();
+    }
+    if (ok) {
+        ok = (destination1[0] == 500u) && (destination1[1] == 1000u) && (destination2[0] == 0u);
+    }
+    if (ok) {
+        *currentState = 1u;
+        ok = timings->Synchronise();
+    }
+    if (ok) {
+        ok = (destination1[0] == 500u) && (destination1[1] == 1000u) && (destination2[0] == 3000u);
+    }
+    if (ok) {
+        timings->RemoveRawTicksTables();
+        ticks2[0] = 4000u;
+        ok = timings->Synchronise();
+    }
+    if (ok) {
+        ok = (destination2[0] == 3000u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool TimingDataSourceTest::TestAddRawTicksTable_False_NoCurrentState() {
+    TimingDataSource timingDataSource;
+    uint64 ticks = 0u;
+    uint32 destination = 0u;
+    uint32 *signals = &destination;
+    TimingDataSourceRawTicksTable table;
+    table.stateIdentifier = 0u;
+    table.ticks = &ticks;
+    table.signals = &signals;
+    table.numberOfElements = 1u;
+    table.ticksToTime = 1.0;
+    return !timingDataSource.AddRawTicksTable(table);
+}
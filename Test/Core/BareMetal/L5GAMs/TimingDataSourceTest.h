@@ -64,6 +64,26 @@ public:
     */
     bool TestCurrentStateValue();
 
+    /**
+     * @brief Tests that the signals are read through a MemoryMapInputBroker if RawTicksTiming = 0.
+     */
+    bool TestGetInputBrokers();
+
+    /**
+     * @brief Tests that the signals are read through a MemoryMapSynchronisedInputBroker if RawTicksTiming = 1.
+     */
+    bool TestGetInputBrokers_RawTicks();
+
+    /**
+     * @brief Tests that Synchronise converts the raw ticks tables of the current state.
+     */
+    bool TestSynchronise();
+
+    /**
+     * @brief Tests that AddRawTicksTable fails if the CurrentState signal does not exist.
+     */
+    bool TestAddRawTicksTable_False_NoCurrentState();
+
 };
 
 /*---------------------------------------------------------------------------*/
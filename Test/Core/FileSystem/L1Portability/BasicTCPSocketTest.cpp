@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "BasicTCPSocketTest.h"
+#include "Directory.h"
 #include "StringHelper.h"
 #include "InternetService.h"
 #include "Sleep.h"
@@ -1064,3 +1065,92 @@ bool BasicTCPSocketTest::TestIsConnected(bool connect,
     return ((retVal == expected) && (NoError));
 }
 
+
+/**
+ * @brief Creates a file with \a size bytes, connects a client to a server socket and sends \a sendSize bytes of the file
+ * from the server side. The client then reads the bytes which are expected to be sent.
+ */
+static bool SendFileTest(const uint32 size,
+                         const uint32 sendSize) {
+    const char8 * const fileName = "BasicTCPSocketTestSendFile.bin";
+    char8 *fileContent = new char8[size];
+    uint32 i;
+    for (i = 0u; i < size; i++) {
+        fileContent[i] = static_cast<char8>(i % 251u);
+    }
+    BasicFile file;
+    bool ok = file.Open(fileName, BasicFile::FLAG_CREAT | BasicFile::FLAG_TRUNC | BasicFile::ACCESS_MODE_W);
+    if (ok) {
+        uint32 writeSize = size;
+        ok = file.Write(fileContent, writeSize);
+    }
+    (void) file.Close();
+    if (ok) {
+        ok = file.Open(fileName, BasicFile::ACCESS_MODE_R);
+    }
+
+    BasicTCPSocket server;
+    BasicTCPSocket client;
+    BasicTCPSocket *accepted = NULL_PTR(BasicTCPSocket *);
+    if (ok) {
+        ok = server.Open();
+    }
+    if (ok) {
+        ok = server.Listen(4446);
+    }
+    if (ok) {
+        ok = client.Open();
+    }
+    if (ok) {
+        ok = client.Connect("127.0.0.1", 4446);
+    }
+    if (ok) {
+        accepted = server.WaitConnection(1000u);
+        ok = (accepted != NULL_PTR(BasicTCPSocket *));
+    }
+    bool sent = false;
+    if (ok) {
+        sent = accepted->SendFile(file, sendSize);
+    }
+    if ((ok) && (sent)) {
+        char8 *received = new char8[sendSize];
+        uint32 receivedSize = 0u;
+        while ((ok) && (receivedSize < sendSize)) {
+            uint32 readSize = (sendSize - receivedSize);
+            ok = client.Read(&received[receivedSize], readSize);
+            receivedSize += readSize;
+        }
+        if (ok) {
+            ok = (StringHelper::CompareN(received, fileContent, sendSize) == 0);
+        }
+        delete[] received;
+    }
+    if (ok) {
+        ok = sent;
+    }
+    if (accepted != NULL_PTR(BasicTCPSocket *)) {
+        (void) accepted->Close();
+        delete accepted;
+    }
+    (void) client.Close();
+    (void) server.Close();
+    (void) file.Close();
+    Directory d(fileName);
+    (void) d.Delete();
+    delete[] fileContent;
+    return ok;
+}
+
+bool BasicTCPSocketTest::TestSendFile() {
+    return SendFileTest(65536u, 65000u);
+}
+
+bool BasicTCPSocketTest::TestSendFile_False_FileTooSmall() {
+    return !SendFileTest(1000u, 2000u);
+}
+
+bool BasicTCPSocketTest::TestSendFile_False_InvalidSocket() {
+    BasicTCPSocket socket;
+    BasicFile file;
+    return !socket.SendFile(file, 10u);
+}
@@ -198,6 +198,21 @@ public:
     bool TestIsConnected(bool connect,
                          bool expected);
 
+    /**
+     * @brief Tests that the function sends the requested number of bytes of a file.
+     */
+    bool TestSendFile();
+
+    /**
+     * @brief Tests that the function fails if the file has less bytes than the ones requested.
+     */
+    bool TestSendFile_False_FileTooSmall();
+
+    /**
+     * @brief Tests that the function fails if the socket is not valid.
+     */
+    bool TestSendFile_False_InvalidSocket();
+
 public:
     InternetHost server;
     uint32 maxConnections;
@@ -30,6 +30,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "BasicUDPSocketTest.h"
+#include "StringHelper.h"
 #include "stdio.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -1040,3 +1041,262 @@ bool BasicUDPSocketTest::TestWrite(const ReadWriteUDPTestTable* table) {
     }
     return true;
 }
+
+bool BasicUDPSocketTest::TestWriteBatch_ReadBatch(const uint32 numberOfDatagrams) {
+    const uint16 port = 4445u;
+    const uint32 datagramSize = 16u;
+    BasicUDPSocket serverSocket;
+    BasicUDPSocket clientSocket;
+    bool ok = serverSocket.Open();
+    if (ok) {
+        ok = serverSocket.Listen(port);
+    }
+    if (ok) {
+        ok = clientSocket.Open();
+    }
+    if (ok) {
+        ok = clientSocket.Connect("127.0.0.1", port);
+    }
+    char8 *writeMemory = new char8[numberOfDatagrams * datagramSize];
+    char8 *readMemory = new char8[numberOfDatagrams * datagramSize];
+    char8 **writeBuffers = new char8*[numberOfDatagrams];
+    char8 **readBuffers = new char8*[numberOfDatagrams];
+    uint32 *writeSizes = new uint32[numberOfDatagrams];
+    uint32 *readSizes = new uint32[numberOfDatagrams];
+    uint32 i;
+    for (i = 0u; i < numberOfDatagrams; i++) {
+        writeBuffers[i] = &writeMemory[i * datagramSize];
+        readBuffers[i] = &readMemory[i * datagramSize];
+        uint32 j;
+        for (j = 0u; j < datagramSize; j++) {
+            writeBuffers[i][j] = static_cast<char8>(i + j);
+        }
+        writeSizes[i] = datagramSize;
+    }
+    if (ok) {
+        uint32 written = numberOfDatagrams;
+        ok = clientSocket.WriteBatch(writeBuffers, writeSizes, written);
+        if (ok) {
+            ok = (written == numberOfDatagrams);
+        }
+        for (i = 0u; (i < numberOfDatagrams) && (ok); i++) {
+            ok = (writeSizes[i] == datagramSize);
+        }
+    }
+    uint32 received = 0u;
+    while ((ok) && (received < numberOfDatagrams)) {
+        uint32 read = numberOfDatagrams - received;
+        for (i = 0u; i < read; i++) {
+            readSizes[received + i] = datagramSize;
+        }
+        ok = serverSocket.ReadBatch(&readBuffers[received], &readSizes[received], read, 1000u);
+        received += read;
+    }
+    for (i = 0u; (i < numberOfDatagrams) && (ok); i++) {
+        ok = (readSizes[i] == datagramSize);
+        uint32 j;
+        for (j = 0u; (j < datagramSize) && (ok); j++) {
+            ok = (readBuffers[i][j] == static_cast<char8>(i + j));
+        }
+    }
+    if (ok) {
+        ok = (serverSocket.GetSource().GetAddress() == "127.0.0.1");
+    }
+    delete[] writeMemory;
+    delete[] readMemory;
+    delete[] writeBuffers;
+    delete[] readBuffers;
+    delete[] writeSizes;
+    delete[] readSizes;
+    (void) clientSocket.Close();
+    (void) serverSocket.Close();
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestReadBatch_Timeout() {
+    BasicUDPSocket serverSocket;
+    bool ok = serverSocket.Open();
+    if (ok) {
+        ok = serverSocket.Listen(4445u);
+    }
+    if (ok) {
+        char8 buffer0[8];
+        char8 buffer1[8];
+        char8 *buffers[] = { &buffer0[0], &buffer1[0] };
+        uint32 sizes[] = { 8u, 8u };
+        uint32 numberOfDatagrams = 2u;
+        ok = !serverSocket.ReadBatch(&buffers[0], &sizes[0], numberOfDatagrams, 100u);
+        if (ok) {
+            ok = (numberOfDatagrams == 0u);
+        }
+        if (ok) {
+            ok = (sizes[0] == 0u) && (sizes[1] == 0u);
+        }
+    }
+    (void) serverSocket.Close();
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestReadBatch_Truncate() {
+    BasicUDPSocket serverSocket;
+    BasicUDPSocket clientSocket;
+    bool ok = serverSocket.Open();
+    if (ok) {
+        ok = serverSocket.Listen(4445u);
+    }
+    if (ok) {
+        ok = clientSocket.Open();
+    }
+    if (ok) {
+        ok = clientSocket.Connect("127.0.0.1", 4445u);
+    }
+    if (ok) {
+        const char8 *input[] = { "HelloWorld", "abc" };
+        uint32 inputSizes[] = { 10u, 3u };
+        uint32 numberOfDatagrams = 2u;
+        ok = clientSocket.WriteBatch(&input[0], &inputSizes[0], numberOfDatagrams);
+    }
+    if (ok) {
+        char8 buffer0[5];
+        char8 buffer1[5];
+        char8 *buffers[] = { &buffer0[0], &buffer1[0] };
+        uint32 sizes[] = { 5u, 5u };
+        bool truncated[] = { false, true };
+        uint32 numberOfDatagrams = 2u;
+        uint32 received = 0u;
+        while ((ok) && (received < 2u)) {
+            numberOfDatagrams = 2u - received;
+            ok = serverSocket.ReadBatch(&buffers[received], &sizes[received], numberOfDatagrams, 1000u, NULL_PTR(InternetHost *), &truncated[received]);
+            received += numberOfDatagrams;
+        }
+        if (ok) {
+            ok = (sizes[0] == 5u) && (sizes[1] == 3u);
+        }
+        if (ok) {
+            ok = (truncated[0]) && (!truncated[1]);
+        }
+        if (ok) {
+            ok = (StringHelper::CompareN(&buffer0[0], "Hello", 5u) == 0) && (StringHelper::CompareN(&buffer1[0], "abc", 3u) == 0);
+        }
+    }
+    (void) clientSocket.Close();
+    (void) serverSocket.Close();
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestReadBatch_Sources() {
+    BasicUDPSocket serverSocket;
+    BasicUDPSocket clientSocket1;
+    BasicUDPSocket clientSocket2;
+    bool ok = serverSocket.Open();
+    if (ok) {
+        ok = serverSocket.Listen(4445u);
+    }
+    if (ok) {
+        ok = clientSocket1.Open();
+    }
+    if (ok) {
+        ok = clientSocket1.Connect("127.0.0.1", 4445u);
+    }
+    if (ok) {
+        ok = clientSocket2.Open();
+    }
+    if (ok) {
+        ok = clientSocket2.Connect("127.0.0.1", 4445u);
+    }
+    if (ok) {
+        uint32 size = 1u;
+        ok = clientSocket1.Write("1", size);
+    }
+    if (ok) {
+        uint32 size = 1u;
+        ok = clientSocket2.Write("2", size);
+    }
+    if (ok) {
+        char8 buffer0[4];
+        char8 buffer1[4];
+        char8 *buffers[] = { &buffer0[0], &buffer1[0] };
+        uint32 sizes[] = { 4u, 4u };
+        InternetHost sources[2];
+        uint32 numberOfDatagrams = 2u;
+        uint32 received = 0u;
+        while ((ok) && (received < 2u)) {
+            numberOfDatagrams = 2u - received;
+            ok = serverSocket.ReadBatch(&buffers[received], &sizes[received], numberOfDatagrams, 1000u, &sources[received]);
+            received += numberOfDatagrams;
+        }
+        if (ok) {
+            ok = (sizes[0] == 1u) && (sizes[1] == 1u) && (buffer0[0] == '1') && (buffer1[0] == '2');
+        }
+        if (ok) {
+            ok = (sources[0].GetAddress() == "127.0.0.1") && (sources[1].GetAddress() == "127.0.0.1");
+        }
+        //Each datagram must report its own sender
+        if (ok) {
+            ok = (sources[0].GetPort() != sources[1].GetPort());
+        }
+        if (ok) {
+            ok = (serverSocket.GetSource().GetPort() == sources[1].GetPort());
+        }
+    }
+    (void) clientSocket1.Close();
+    (void) clientSocket2.Close();
+    (void) serverSocket.Close();
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestReadBatch_WriteBatch_InvalidSocket() {
+    BasicUDPSocket socket;
+    char8 buffer[8];
+    char8 *buffers[] = { &buffer[0] };
+    const char8 *constBuffers[] = { &buffer[0] };
+    uint32 sizes[] = { 8u };
+    uint32 numberOfDatagrams = 1u;
+    bool ok = !socket.ReadBatch(&buffers[0], &sizes[0], numberOfDatagrams);
+    if (ok) {
+        ok = (numberOfDatagrams == 0u) && (sizes[0] == 0u);
+    }
+    if (ok) {
+        sizes[0] = 8u;
+        numberOfDatagrams = 1u;
+        ok = !socket.ReadBatch(&buffers[0], &sizes[0], numberOfDatagrams, 10u);
+    }
+    if (ok) {
+        ok = (numberOfDatagrams == 0u);
+    }
+    if (ok) {
+        sizes[0] = 8u;
+        numberOfDatagrams = 1u;
+        ok = !socket.WriteBatch(&constBuffers[0], &sizes[0], numberOfDatagrams);
+    }
+    if (ok) {
+        ok = (numberOfDatagrams == 0u) && (sizes[0] == 0u);
+    }
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestSetReceiveBufferSize() {
+    BasicUDPSocket socket;
+    bool ok = !socket.SetReceiveBufferSize(65536u);
+    if (ok) {
+        ok = socket.Open();
+    }
+    if (ok) {
+        ok = socket.SetReceiveBufferSize(65536u);
+    }
+    (void) socket.Close();
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestSetBusyPoll() {
+    BasicUDPSocket socket;
+    bool ok = !socket.SetBusyPoll(0u);
+    if (ok) {
+        ok = socket.Open();
+    }
+    if (ok) {
+        ok = socket.SetBusyPoll(0u);
+    }
+    (void) socket.Close();
+    return ok;
+}
@@ -183,6 +183,41 @@ public:
      */
     bool TestJoinMulticastAddress(const ConnectListenUDPTestTable* table);
 
+    /**
+     * @brief Tests that WriteBatch and ReadBatch transfer \a numberOfDatagrams datagrams in order.
+     */
+    bool TestWriteBatch_ReadBatch(const uint32 numberOfDatagrams);
+
+    /**
+     * @brief Tests that ReadBatch returns false (with no datagrams) when nothing arrives within the timeout.
+     */
+    bool TestReadBatch_Timeout();
+
+    /**
+     * @brief Tests that ReadBatch truncates the datagrams larger than the buffers and flags them as truncated.
+     */
+    bool TestReadBatch_Truncate();
+
+    /**
+     * @brief Tests that ReadBatch reports the sender of each datagram when they are sent from two sockets.
+     */
+    bool TestReadBatch_Sources();
+
+    /**
+     * @brief Tests that ReadBatch and WriteBatch fail on an invalid socket.
+     */
+    bool TestReadBatch_WriteBatch_InvalidSocket();
+
+    /**
+     * @brief Tests the SetReceiveBufferSize method.
+     */
+    bool TestSetReceiveBufferSize();
+
+    /**
+     * @brief Tests the SetBusyPoll method.
+     */
+    bool TestSetBusyPoll();
+
 
 public:
 
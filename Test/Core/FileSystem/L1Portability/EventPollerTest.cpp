@@ -0,0 +1,301 @@
+/**
+ * @file EventPollerTest.cpp
+ * @brief Source file for class EventPollerTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EventPollerTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "EventPollerTest.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static const char8 EVENT_POLLER_TEST_IP[] = "127.0.0.1";
+static const uint16 EVENT_POLLER_TEST_PORT = 49172;
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+EventPollerTest::EventPollerTest() {
+}
+
+EventPollerTest::~EventPollerTest() {
+    if (reader.IsValid()) {
+        (void) reader.Close();
+    }
+}
+
+bool EventPollerTest::OpenReader() {
+    bool ok = reader.Open();
+    if (ok) {
+        ok = reader.Listen(EVENT_POLLER_TEST_PORT);
+    }
+    return ok;
+}
+
+bool EventPollerTest::WriteToReader() {
+    BasicUDPSocket writer;
+    bool ok = writer.Open();
+    if (ok) {
+        ok = writer.Connect(EVENT_POLLER_TEST_IP, EVENT_POLLER_TEST_PORT);
+    }
+    if (ok) {
+        uint32 size = 3u;
+        ok = writer.Write("Hey", size);
+    }
+    (void) writer.Close();
+    return ok;
+}
+
+bool EventPollerTest::TestConstructor() {
+    EventPoller poller;
+    return !poller.IsValid();
+}
+
+bool EventPollerTest::TestIsSupported() {
+    EventPoller poller;
+    bool ok = (poller.Open() == EventPoller::IsSupported());
+    return ok;
+}
+
+bool EventPollerTest::TestOpen() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = poller.IsValid();
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestOpen_False_AlreadyOpen() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = !poller.Open();
+    }
+    if (ok) {
+        ok = poller.IsValid();
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestClose() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = poller.Close();
+    }
+    if (ok) {
+        ok = !poller.IsValid();
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestClose_False_NotOpen() {
+    EventPoller poller;
+    return !poller.Close();
+}
+
+bool EventPollerTest::TestAdd() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = OpenReader();
+    }
+    if (ok) {
+        ok = poller.Add(reader, &reader);
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestAdd_False_AlreadyAdded() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = OpenReader();
+    }
+    if (ok) {
+        ok = poller.Add(reader, &reader);
+    }
+    if (ok) {
+        ok = !poller.Add(reader, &reader);
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestAdd_False_NotOpen() {
+    EventPoller poller;
+    bool ok = OpenReader();
+    if (ok) {
+        ok = !poller.Add(reader, &reader);
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestWait() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = OpenReader();
+    }
+    if (ok) {
+        ok = poller.Add(reader, &reader);
+    }
+    if (ok) {
+        ok = WriteToReader();
+    }
+    if (ok) {
+        ok = (poller.Wait(1000u) == &reader);
+    }
+    if (ok) {
+        char8 buffer[4];
+        uint32 size = 3u;
+        ok = reader.Read(&buffer[0], size);
+        if (ok) {
+            ok = (StringHelper::CompareN(&buffer[0], "Hey", 3u) == 0);
+        }
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestWait_Timeout() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = OpenReader();
+    }
+    if (ok) {
+        ok = poller.Add(reader, &reader);
+    }
+    if (ok) {
+        ok = (poller.Wait(10u) == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestWait_OneShot() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = OpenReader();
+    }
+    if (ok) {
+        ok = poller.Add(reader, &reader);
+    }
+    if (ok) {
+        ok = WriteToReader();
+    }
+    if (ok) {
+        ok = (poller.Wait(1000u) == &reader);
+    }
+    //The datagram was not read, but the handle is disabled until re-armed.
+    if (ok) {
+        ok = (poller.Wait(10u) == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestRearm() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = OpenReader();
+    }
+    if (ok) {
+        ok = poller.Add(reader, &reader);
+    }
+    if (ok) {
+        ok = WriteToReader();
+    }
+    if (ok) {
+        ok = (poller.Wait(1000u) == &reader);
+    }
+    int32 context = 0;
+    if (ok) {
+        ok = poller.Rearm(reader, &context);
+    }
+    //The datagram is still to be read.
+    if (ok) {
+        ok = (poller.Wait(1000u) == &context);
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestRearm_False_NotAdded() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = OpenReader();
+    }
+    if (ok) {
+        ok = !poller.Rearm(reader, &reader);
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestRemove() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = OpenReader();
+    }
+    if (ok) {
+        ok = poller.Add(reader, &reader);
+    }
+    if (ok) {
+        ok = poller.Remove(reader);
+    }
+    if (ok) {
+        ok = WriteToReader();
+    }
+    if (ok) {
+        ok = (poller.Wait(10u) == NULL_PTR(void *));
+    }
+    //Can be added again.
+    if (ok) {
+        ok = poller.Add(reader, &reader);
+    }
+    if (ok) {
+        ok = (poller.Wait(1000u) == &reader);
+    }
+    return ok;
+}
+
+bool EventPollerTest::TestRemove_False_NotAdded() {
+    EventPoller poller;
+    bool ok = poller.Open();
+    if (ok) {
+        ok = OpenReader();
+    }
+    if (ok) {
+        ok = !poller.Remove(reader);
+    }
+    return ok;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file EventPollerTest.h
+ * @brief Header file for class EventPollerTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class EventPollerTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EVENTPOLLERTEST_H_
+#define EVENTPOLLERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BasicUDPSocket.h"
+#include "EventPoller.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the EventPoller public methods.
+ */
+class EventPollerTest {
+
+public:
+
+    /**
+     * @brief Default constructor.
+     */
+    EventPollerTest();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EventPollerTest();
+
+    /**
+     * @brief Tests that the poller is not valid after construction.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the IsSupported method.
+     */
+    bool TestIsSupported();
+
+    /**
+     * @brief Tests the Open method.
+     */
+    bool TestOpen();
+
+    /**
+     * @brief Tests that the Open method fails if the poller is already open.
+     */
+    bool TestOpen_False_AlreadyOpen();
+
+    /**
+     * @brief Tests the Close method.
+     */
+    bool TestClose();
+
+    /**
+     * @brief Tests that the Close method fails if the poller is not open.
+     */
+    bool TestClose_False_NotOpen();
+
+    /**
+     * @brief Tests the Add method.
+     */
+    bool TestAdd();
+
+    /**
+     * @brief Tests that the Add method fails if the handle was already added.
+     */
+    bool TestAdd_False_AlreadyAdded();
+
+    /**
+     * @brief Tests that the Add method fails if the poller is not open.
+     */
+    bool TestAdd_False_NotOpen();
+
+    /**
+     * @brief Tests that the Wait method returns the context of the readable handle.
+     */
+    bool TestWait();
+
+    /**
+     * @brief Tests that the Wait method returns NULL if no handle is readable.
+     */
+    bool TestWait_Timeout();
+
+    /**
+     * @brief Tests that the Wait method does not return the same handle twice without a Rearm.
+     */
+    bool TestWait_OneShot();
+
+    /**
+     * @brief Tests that the Rearm method allows to return the handle again.
+     */
+    bool TestRearm();
+
+    /**
+     * @brief Tests that the Rearm method fails if the handle was not added.
+     */
+    bool TestRearm_False_NotAdded();
+
+    /**
+     * @brief Tests the Remove method.
+     */
+    bool TestRemove();
+
+    /**
+     * @brief Tests that the Remove method fails if the handle was not added.
+     */
+    bool TestRemove_False_NotAdded();
+
+private:
+
+    /**
+     * @brief Opens and binds the reader socket.
+     */
+    bool OpenReader();
+
+    /**
+     * @brief Sends a datagram to the reader socket.
+     */
+    bool WriteToReader();
+
+    /**
+     * The socket being polled.
+     */
+    BasicUDPSocket reader;
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EVENTPOLLERTEST_H_ */
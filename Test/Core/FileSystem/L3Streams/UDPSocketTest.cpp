@@ -33,6 +33,7 @@
 #include "Threads.h"
 #include "UDPSocket.h"
 #include "UDPSocketTest.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -211,3 +212,47 @@ bool UDPSocketTest::TestCanRead() {
     UDPSocket socket;
     return socket.CanRead();
 }
+
+bool UDPSocketTest::TestWriteBatch_ReadBatch() {
+    using namespace MARTe;
+    UDPSocket server;
+    UDPSocket client;
+    bool ok = server.Open();
+    if (ok) {
+        ok = server.Listen(static_cast<uint16>(udpServerPort));
+    }
+    if (ok) {
+        ok = server.SetReceiveBufferSize(65536u);
+    }
+    if (ok) {
+        ok = client.Open();
+    }
+    if (ok) {
+        ok = client.Connect("127.0.0.1", static_cast<uint16>(udpServerPort));
+    }
+    if (ok) {
+        const char8 *input[] = { "Hello", "World" };
+        uint32 sizes[] = { 5u, 5u };
+        uint32 numberOfDatagrams = 2u;
+        ok = client.WriteBatch(&input[0], &sizes[0], numberOfDatagrams);
+    }
+    char8 buffer0[8];
+    char8 buffer1[8];
+    char8 *buffers[] = { &buffer0[0], &buffer1[0] };
+    uint32 sizes[] = { 8u, 8u };
+    uint32 received = 0u;
+    while ((ok) && (received < 2u)) {
+        uint32 numberOfDatagrams = 2u - received;
+        ok = server.ReadBatch(&buffers[received], &sizes[received], numberOfDatagrams, 1000u);
+        received += numberOfDatagrams;
+    }
+    if (ok) {
+        ok = (sizes[0] == 5u) && (sizes[1] == 5u);
+    }
+    if (ok) {
+        ok = (StringHelper::CompareN(&buffer0[0], "Hello", 5u) == 0) && (StringHelper::CompareN(&buffer1[0], "World", 5u) == 0);
+    }
+    (void) client.Close();
+    (void) server.Close();
+    return ok;
+}
@@ -117,6 +117,11 @@ public:
      * @brief Tests the CanRead method.
      */
     bool TestCanRead();
+
+    /**
+     * @brief Tests that the WriteBatch and ReadBatch methods of the BasicUDPSocket are available.
+     */
+    bool TestWriteBatch_ReadBatch();
 };
 
 /*---------------------------------------------------------------------------*/
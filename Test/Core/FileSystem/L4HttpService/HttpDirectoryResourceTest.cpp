@@ -41,6 +41,126 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace HttpDirectoryResourceTestHelper {
+using namespace MARTe;
+
+/**
+ * @brief Starts an HttpService on port 9094 which serves the current directory with an HttpDirectoryResource configured with \a options.
+ */
+static bool StartService(const char8 * const options) {
+    StreamString cfg;
+    cfg.Printf("%s", ""
+            "+HttpService1 = {\n"
+            "    Class = HttpService\n"
+            "    Port = 9094\n"
+            "    Timeout = 0\n"
+            "    AcceptTimeout = 100"
+            "    MinNumberOfThreads = 1\n"
+            "    MaxNumberOfThreads = 8\n"
+            "    ListenMaxConnections = 255\n"
+            "    IsTextMode = 1\n"
+            "    WebRoot = HttpObjectBrowser1\n"
+            "}\n"
+            "+HttpObjectBrowser1 = {\n"
+            "    Class = HttpObjectBrowser\n"
+            "    Root = \".\""
+            "    +DirectoryResource1 = {\n"
+            "        Class = HttpDirectoryResource\n"
+            "        BaseDir = \".\"\n");
+    cfg.Printf("%s\n", options);
+    cfg.Printf("%s", ""
+            "    }\n"
+            "}\n");
+    cfg.Seek(0LLU);
+    StreamString err;
+    ConfigurationDatabase cdb;
+    StandardParser parser(cfg, cdb, &err);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<HttpService> service = ObjectRegistryDatabase::Instance()->Find("HttpService1");
+    if (ok) {
+        ok = service.IsValid();
+    }
+    if (ok) {
+        ok = service->Start();
+    }
+    return ok;
+}
+
+/**
+ * @brief Stops the service started with StartService.
+ */
+static bool StopService() {
+    ReferenceT<HttpService> service = ObjectRegistryDatabase::Instance()->Find("HttpService1");
+    bool ok = service.IsValid();
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+/**
+ * @brief Creates (or overwrites) the file \a fileName with \a content.
+ */
+static bool WriteFile(const char8 * const fileName,
+                      const char8 * const content) {
+    File f;
+    bool ok = f.Open(fileName, BasicFile::FLAG_CREAT | BasicFile::FLAG_TRUNC | BasicFile::ACCESS_MODE_W);
+    if (ok) {
+        ok = f.Printf("%s", content);
+    }
+    if (ok) {
+        ok = f.Flush();
+    }
+    (void) f.Close();
+    return ok;
+}
+
+/**
+ * @brief Gets \a fileName from the service (adding the If-None-Match header if \a ifNoneMatch is not NULL).
+ */
+static bool GetFile(const char8 * const fileName,
+                    const char8 * const ifNoneMatch,
+                    StreamString &reply,
+                    StreamString &etag,
+                    StreamString &contentType,
+                    int32 &replyCode) {
+    HttpClient test;
+    test.SetServerAddress("127.0.0.1");
+    test.SetServerPort(9094);
+    StreamString p;
+    p.Printf("/?path=%s", fileName);
+    test.SetServerUri(p.Buffer());
+    HttpProtocol *protocol = test.GetHttpProtocol();
+    bool ok = true;
+    if (ifNoneMatch != NULL_PTR(const char8 *)) {
+        ok = protocol->CreateAbsolute("OutputOptions");
+        if (ok) {
+            ok = protocol->Write("If-None-Match", ifNoneMatch);
+        }
+    }
+    if (ok) {
+        ok = test.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    if (ok) {
+        replyCode = protocol->GetHttpCommand();
+        ok = protocol->MoveAbsolute("InputOptions");
+    }
+    if (ok) {
+        etag = "";
+        contentType = "";
+        (void) protocol->Read("ETag", etag);
+        (void) protocol->Read("Content-Type", contentType);
+    }
+    return ok;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -536,3 +656,228 @@ bool HttpDirectoryResourceTest::TestGetAsText_MimeTypes() {
     return ok;
 }
 
+
+bool HttpDirectoryResourceTest::TestGetAsText_ETag() {
+    using namespace MARTe;
+    using namespace HttpDirectoryResourceTestHelper;
+    Directory d("HttpDirectoryResourceTestFolder");
+    d.Create();
+    const char8 * const fileName = "HttpDirectoryResourceTestFolder/f1.html";
+    const char8 * const expectedReply = "<html>Test 1</html>";
+    bool ok = WriteFile(fileName, expectedReply);
+    if (ok) {
+        ok = StartService("");
+    }
+    StreamString reply;
+    StreamString etag;
+    StreamString contentType;
+    int32 replyCode = 0;
+    if (ok) {
+        ok = GetFile(fileName, NULL_PTR(const char8 *), reply, etag, contentType, replyCode);
+    }
+    if (ok) {
+        ok = (replyCode == HttpDefinition::HSHCReplyOK);
+    }
+    if (ok) {
+        ok = (reply == expectedReply);
+    }
+    if (ok) {
+        ok = (etag.Size() > 0u);
+    }
+    //Matching tag
+    StreamString reply2;
+    StreamString etag2;
+    if (ok) {
+        ok = GetFile(fileName, etag.Buffer(), reply2, etag2, contentType, replyCode);
+    }
+    if (ok) {
+        ok = (replyCode == HttpDefinition::HSHCReplyNotModified);
+    }
+    if (ok) {
+        ok = (reply2.Size() == 0u);
+    }
+    if (ok) {
+        ok = (etag2 == etag.Buffer());
+    }
+    //Any tag
+    StreamString reply3;
+    if (ok) {
+        ok = GetFile(fileName, "*", reply3, etag2, contentType, replyCode);
+    }
+    if (ok) {
+        ok = (replyCode == HttpDefinition::HSHCReplyNotModified);
+    }
+    //Not matching tag
+    StreamString reply4;
+    if (ok) {
+        ok = GetFile(fileName, "\"0-0\"", reply4, etag2, contentType, replyCode);
+    }
+    if (ok) {
+        ok = (replyCode == HttpDefinition::HSHCReplyOK);
+    }
+    if (ok) {
+        ok = (reply4 == expectedReply);
+    }
+    //Modified file
+    const char8 * const expectedReply2 = "<html>Test 22</html>";
+    if (ok) {
+        ok = WriteFile(fileName, expectedReply2);
+    }
+    StreamString reply5;
+    if (ok) {
+        ok = GetFile(fileName, etag.Buffer(), reply5, etag2, contentType, replyCode);
+    }
+    if (ok) {
+        ok = (replyCode == HttpDefinition::HSHCReplyOK);
+    }
+    if (ok) {
+        ok = (reply5 == expectedReply2);
+    }
+    if (ok) {
+        ok = !(etag2 == etag.Buffer());
+    }
+    if (!StopService()) {
+        ok = false;
+    }
+    Directory df1(fileName);
+    df1.Delete();
+    d.Delete();
+    return ok;
+}
+
+bool HttpDirectoryResourceTest::TestGetAsText_ContentType() {
+    using namespace MARTe;
+    using namespace HttpDirectoryResourceTestHelper;
+    Directory d("HttpDirectoryResourceTestFolder");
+    d.Create();
+    const uint32 nOfFiles = 7u;
+    const char8 * filenames[nOfFiles] = { "HttpDirectoryResourceTestFolder/f1.html", "HttpDirectoryResourceTestFolder/f1.TXT",
+            "HttpDirectoryResourceTestFolder/f1.png", "HttpDirectoryResourceTestFolder/f1.svg", "HttpDirectoryResourceTestFolder/f1.js",
+            "HttpDirectoryResourceTestFolder/f1.json", "HttpDirectoryResourceTestFolder/f1.bin" };
+    const char8 * mimeTypes[nOfFiles] = { "text/html", "text/plain", "image/png", "image/svg+xml", "application/x-javascript", "application/json",
+            "binary" };
+    bool ok = true;
+    uint32 n;
+    for (n = 0u; (n < nOfFiles) && (ok); n++) {
+        ok = WriteFile(filenames[n], "<html>Test 1</html>");
+    }
+    if (ok) {
+        ok = StartService("");
+    }
+    for (n = 0u; (n < nOfFiles) && (ok); n++) {
+        StreamString reply;
+        StreamString etag;
+        StreamString contentType;
+        int32 replyCode = 0;
+        ok = GetFile(filenames[n], NULL_PTR(const char8 *), reply, etag, contentType, replyCode);
+        if (ok) {
+            ok = (contentType == mimeTypes[n]);
+        }
+        if (ok) {
+            ok = (reply == "<html>Test 1</html>");
+        }
+    }
+    if (!StopService()) {
+        ok = false;
+    }
+    for (n = 0u; n < nOfFiles; n++) {
+        Directory df1(filenames[n]);
+        df1.Delete();
+    }
+    d.Delete();
+    return ok;
+}
+
+bool HttpDirectoryResourceTest::TestGetAsText_Cache() {
+    using namespace MARTe;
+    using namespace HttpDirectoryResourceTestHelper;
+    Directory d("HttpDirectoryResourceTestFolder");
+    d.Create();
+    const uint32 nOfFiles = 4u;
+    const char8 * filenames[nOfFiles] = { "HttpDirectoryResourceTestFolder/f1.html", "HttpDirectoryResourceTestFolder/f2.html",
+            "HttpDirectoryResourceTestFolder/f3.html", "HttpDirectoryResourceTestFolder/f4.html" };
+    const char8 * contents[nOfFiles] = { "<html>Test 1</html>", "<html>Test 2</html>", "<html>Test 3</html>",
+            "<html>Test 4 which is larger than the maximum size of the files in the cache</html>" };
+    bool ok = true;
+    uint32 n;
+    for (n = 0u; (n < nOfFiles) && (ok); n++) {
+        ok = WriteFile(filenames[n], contents[n]);
+    }
+    if (ok) {
+        ok = StartService("CacheSize = 2\nCacheMaxFileSize = 32");
+    }
+    //Forces the replacement of the entries (3 cacheable files and 2 entries).
+    const uint32 nOfRequests = 9u;
+    const uint32 requests[nOfRequests] = { 0u, 0u, 1u, 0u, 2u, 1u, 3u, 0u, 3u };
+    for (n = 0u; (n < nOfRequests) && (ok); n++) {
+        StreamString reply;
+        StreamString etag;
+        StreamString contentType;
+        int32 replyCode = 0;
+        ok = GetFile(filenames[requests[n]], NULL_PTR(const char8 *), reply, etag, contentType, replyCode);
+        if (ok) {
+            ok = (reply == contents[requests[n]]);
+        }
+    }
+    //The cached contents shall not be used after the file is modified.
+    const char8 * const modifiedContent = "<html>Test 11</html>";
+    if (ok) {
+        ok = WriteFile(filenames[0], modifiedContent);
+    }
+    if (ok) {
+        StreamString reply;
+        StreamString etag;
+        StreamString contentType;
+        int32 replyCode = 0;
+        ok = GetFile(filenames[0], NULL_PTR(const char8 *), reply, etag, contentType, replyCode);
+        if (ok) {
+            ok = (reply == modifiedContent);
+        }
+        if (ok) {
+            ok = (contentType == "text/html");
+        }
+    }
+    if (!StopService()) {
+        ok = false;
+    }
+    for (n = 0u; n < nOfFiles; n++) {
+        Directory df1(filenames[n]);
+        df1.Delete();
+    }
+    d.Delete();
+    return ok;
+}
+
+bool HttpDirectoryResourceTest::TestGetAsText_LargeFile() {
+    using namespace MARTe;
+    using namespace HttpDirectoryResourceTestHelper;
+    Directory d("HttpDirectoryResourceTestFolder");
+    d.Create();
+    const char8 * const fileName = "HttpDirectoryResourceTestFolder/f1.txt";
+    StreamString content;
+    uint32 n;
+    for (n = 0u; n < 20000u; n++) {
+        content.Printf("Line %05d\n", n);
+    }
+    bool ok = WriteFile(fileName, content.Buffer());
+    if (ok) {
+        ok = StartService("");
+    }
+    StreamString reply;
+    StreamString etag;
+    StreamString contentType;
+    int32 replyCode = 0;
+    if (ok) {
+        ok = GetFile(fileName, NULL_PTR(const char8 *), reply, etag, contentType, replyCode);
+    }
+    if (ok) {
+        ok = (reply == content.Buffer());
+    }
+    if (!StopService()) {
+        ok = false;
+    }
+    Directory df1(fileName);
+    df1.Delete();
+    d.Delete();
+    return ok;
+}
@@ -80,6 +80,26 @@ public:
      * @brief Tests the SetReplyNotFound
      */
     bool TestSetReplyNotFound();
+
+    /**
+     * @brief Tests that the GetAsText replies with an ETag and with 304 (Not Modified) if the If-None-Match matches it.
+     */
+    bool TestGetAsText_ETag();
+
+    /**
+     * @brief Tests that the GetAsText replies with the Content-Type associated to the file extension.
+     */
+    bool TestGetAsText_ContentType();
+
+    /**
+     * @brief Tests the GetAsText with the files cache enabled, including the replacement and invalidation of the entries.
+     */
+    bool TestGetAsText_Cache();
+
+    /**
+     * @brief Tests the GetAsText with a file which is larger than the stream buffers.
+     */
+    bool TestGetAsText_LargeFile();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -1738,3 +1738,309 @@ bool HttpServiceTest::TestClientService_NoMoreThreads() {
     ObjectRegistryDatabase::Instance()->Purge();
     return ret;
 }
+
+/**
+ * Configuration of the event loop tests. The %s are replaced with the event loop parameters.
+ */
+static const char8 * const eventLoopConfig = ""
+        "$Application = {"
+        "   Class = ReferenceContainer"
+        "   +WebRoot = {"
+        "       Class = HttpObjectBrowser"
+        "       Root = \".\""
+        "       +Test1 = {"
+        "           Class = HttpServiceTestClassTest1"
+        "       }"
+        "   }"
+        "   +HttpServerTest = {"
+        "       Class = HttpService"
+        "       WebRoot = \"Application.WebRoot\""
+        "       Port=9094"
+        "       ListenMaxConnections = 255"
+        "       Timeout = 0"
+        "       AcceptTimeout = 100"
+        "       EventLoop = 1"
+        "       %s"
+        "   }"
+        "}";
+
+/**
+ * The reply to GET /Test1/ in text mode.
+ */
+static const char8 * const eventLoopTest1Reply = "20\r\n"
+        "<html><head><TITLE>HttpServiceTe\r\n"
+        "20\r\n"
+        "stClassTest1</TITLE></head><BODY\r\n"
+        "20\r\n"
+        " BGCOLOR=\"#ffffff\"><H1>HttpServi\r\n"
+        "20\r\n"
+        "ceTestClassTest1</H1><UL></UL></\r\n"
+        "C\r\n"
+        "BODY></html>\r\n"
+        "0\r\n\r\n";
+
+/**
+ * Helper function to load the event loop configuration with the given parameters.
+ */
+static ReferenceT<HttpService> InitialiseEventLoopEnvironment(const char8 * const parameters) {
+    StreamString configStream;
+    ReferenceT<HttpService> service;
+    bool ok = configStream.Printf(eventLoopConfig, parameters);
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = configStream.Seek(0LLU);
+    }
+    if (ok) {
+        StandardParser parser(configStream, cdb);
+        ok = parser.Parse();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = god->Initialise(cdb);
+    }
+    if (ok) {
+        service = god->Find("Application.HttpServerTest");
+    }
+    return service;
+}
+
+/**
+ * Helper function to GET Test1 and check the reply.
+ */
+static bool EventLoopGetTest1(HttpClient &client) {
+    StreamString readOut;
+    bool ok = client.HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 1000u);
+    if (ok) {
+        ok = (readOut == eventLoopTest1Reply);
+    }
+    return ok;
+}
+
+bool HttpServiceTest::TestInitialise_EventLoop() {
+    ReferenceT<HttpService> test = InitialiseEventLoopEnvironment("NumberOfWorkers = 3 MaxNumberOfConnections = 5");
+    bool ret = test.IsValid();
+    if (ret) {
+        ret = test->IsEventLoop();
+    }
+    if (ret) {
+        ret = (test->GetMaxNumberOfConnections() == 5u);
+    }
+    if (ret) {
+        ret = (test->GetMinimumNumberOfPoolThreads() == 3u);
+    }
+    if (ret) {
+        ret = (test->Start() == ErrorManagement::NoError);
+    }
+    if (ret) {
+        //The pool of workers is fixed.
+        uint32 maxWait = 100u;
+        while ((test->GetNumberOfActiveThreads() != 3u) && (maxWait > 0u)) {
+            Sleep::MSec(10u);
+            maxWait--;
+        }
+        ret = (test->GetNumberOfActiveThreads() == 3u);
+    }
+    if (ret) {
+        ret = (test->AddThread() == ErrorManagement::NoError);
+    }
+    if (ret) {
+        ret = (test->GetNumberOfActiveThreads() == 3u);
+    }
+    if (test.IsValid()) {
+        (void) test->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestInitialise_EventLoop_Defaults() {
+    ReferenceT<HttpService> test = InitialiseEventLoopEnvironment("");
+    bool ret = test.IsValid();
+    if (ret) {
+        ret = test->IsEventLoop();
+    }
+    if (ret) {
+        ret = (test->GetMaxNumberOfConnections() == 64u);
+    }
+    if (ret) {
+        ret = (test->GetMinimumNumberOfPoolThreads() == 2u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestInitialise_False_EventLoop_NoWorkers() {
+    ReferenceT<HttpService> test = InitialiseEventLoopEnvironment("NumberOfWorkers = 0");
+    bool ret = !test.IsValid();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestInitialise_False_EventLoop_NoConnections() {
+    ReferenceT<HttpService> test = InitialiseEventLoopEnvironment("MaxNumberOfConnections = 0");
+    bool ret = !test.IsValid();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestClientService_EventLoop() {
+    ReferenceT<HttpService> test = InitialiseEventLoopEnvironment("NumberOfWorkers = 1 MaxNumberOfConnections = 4");
+    bool ret = test.IsValid();
+    if (ret) {
+        ret = (test->Start() == ErrorManagement::NoError);
+    }
+    //With one thread per connection the second client would wait forever for the first connection to be closed.
+    const uint32 numberOfClients = 3u;
+    HttpClient clients[numberOfClients];
+    for (uint32 n = 0u; (n < numberOfClients) && (ret); n++) {
+        clients[n].SetServerAddress("127.0.0.1");
+        clients[n].SetServerPort(9094);
+        clients[n].SetServerUri("Test1/");
+        ret = EventLoopGetTest1(clients[n]);
+    }
+    //Reuse the connections that were kept alive.
+    for (uint32 n = 0u; (n < numberOfClients) && (ret); n++) {
+        ret = EventLoopGetTest1(clients[numberOfClients - 1u - n]);
+    }
+    if (ret) {
+        ret = (test->GetNumberOfActiveThreads() == 1u);
+    }
+    if (test.IsValid()) {
+        (void) test->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestClientService_EventLoop_Pipelined() {
+    ReferenceT<HttpService> test = InitialiseEventLoopEnvironment("NumberOfWorkers = 1 MaxNumberOfConnections = 1");
+    bool ret = test.IsValid();
+    if (ret) {
+        ret = (test->Start() == ErrorManagement::NoError);
+    }
+    TCPSocket socket;
+    if (ret) {
+        ret = socket.Open();
+    }
+    if (ret) {
+        ret = socket.SetBlocking(true);
+    }
+    if (ret) {
+        ret = socket.Connect("127.0.0.1", 9094);
+    }
+    //Both requests are sent at once, so that the second is read together with the first.
+    if (ret) {
+        for (uint32 n = 0u; n < 2u; n++) {
+            socket.Printf("%s", "GET /Test1/ HTTP/1.1\r\n");
+            socket.Printf("%s", "Host: localhost:9094\r\n");
+            socket.Printf("%s", "Connection: keep-alive\r\n\r\n");
+        }
+        ret = socket.Flush();
+    }
+    //The two replies may be received together: wait for both bodies in the raw stream.
+    StreamString received;
+    bool done = false;
+    uint32 maxReads = 100u;
+    while ((ret) && (!done) && (maxReads > 0u)) {
+        char8 buffer[64];
+        uint32 size = 64u;
+        if (!socket.Read(&buffer[0], size, 100u)) {
+            size = 0u;
+        }
+        if (size > 0u) {
+            ret = received.Write(&buffer[0], size);
+        }
+        const char8 *first = StringHelper::SearchString(received.Buffer(), eventLoopTest1Reply);
+        if (first != NULL_PTR(const char8 *)) {
+            done = (StringHelper::SearchString(&first[StringHelper::Length(eventLoopTest1Reply)], eventLoopTest1Reply) != NULL_PTR(const char8 *));
+        }
+        maxReads--;
+    }
+    if (ret) {
+        ret = done;
+    }
+    (void) socket.Close();
+    if (test.IsValid()) {
+        (void) test->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestClientService_EventLoop_TooManyConnections() {
+    ReferenceT<HttpService> test = InitialiseEventLoopEnvironment("NumberOfWorkers = 2 MaxNumberOfConnections = 1");
+    bool ret = test.IsValid();
+    if (ret) {
+        ret = (test->Start() == ErrorManagement::NoError);
+    }
+    HttpClient test1;
+    if (ret) {
+        test1.SetServerAddress("127.0.0.1");
+        test1.SetServerPort(9094);
+        test1.SetServerUri("Test1/");
+        ret = EventLoopGetTest1(test1);
+    }
+    if (ret) {
+        HttpClient test2;
+        test2.SetServerAddress("127.0.0.1");
+        test2.SetServerPort(9094);
+        test2.SetServerUri("Test1/");
+        StreamString readOut;
+        //The server may close the connection before the request is completely sent.
+        if (test2.HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 1000u)) {
+            ret = (test2.GetHttpProtocol()->GetHttpCommand() == HttpDefinition::HSHCReplyTooManyRequests);
+        }
+    }
+    if (ret) {
+        //Closing the connection gives it back to the pool.
+        test1.SetServerUri("TestDoesNotExist");
+        StreamString readOut;
+        (void) test1.HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    if (ret) {
+        HttpClient test3;
+        test3.SetServerAddress("127.0.0.1");
+        test3.SetServerPort(9094);
+        test3.SetServerUri("Test1/");
+        uint32 maxRetries = 10u;
+        ret = EventLoopGetTest1(test3);
+        while ((!ret) && (maxRetries > 0u)) {
+            Sleep::MSec(100u);
+            ret = EventLoopGetTest1(test3);
+            maxRetries--;
+        }
+    }
+    if (test.IsValid()) {
+        (void) test->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestStop_EventLoop_Restart() {
+    ReferenceT<HttpService> test = InitialiseEventLoopEnvironment("NumberOfWorkers = 1 MaxNumberOfConnections = 1");
+    bool ret = test.IsValid();
+    for (uint32 cycle = 0u; (cycle < 3u) && (ret); cycle++) {
+        ret = (test->Start() == ErrorManagement::NoError);
+        //The connection is kept alive, so that it is still in use when the service is stopped.
+        HttpClient client;
+        if (ret) {
+            client.SetServerAddress("127.0.0.1");
+            client.SetServerPort(9094);
+            client.SetServerUri("Test1/");
+            ret = EventLoopGetTest1(client);
+        }
+        if (ret) {
+            ret = (test->Stop() == ErrorManagement::NoError);
+        }
+    }
+    if (test.IsValid()) {
+        (void) test->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -165,6 +165,48 @@ public:
      */
     bool TestClientService_NoMoreThreads();
 
+    /**
+     * @brief Tests the Initialise method in event loop mode.
+     */
+    bool TestInitialise_EventLoop();
+
+    /**
+     * @brief Tests the Initialise method default values in event loop mode.
+     */
+    bool TestInitialise_EventLoop_Defaults();
+
+    /**
+     * @brief Tests that the Initialise method fails in event loop mode if NumberOfWorkers = 0.
+     */
+    bool TestInitialise_False_EventLoop_NoWorkers();
+
+    /**
+     * @brief Tests that the Initialise method fails in event loop mode if MaxNumberOfConnections = 0.
+     */
+    bool TestInitialise_False_EventLoop_NoConnections();
+
+    /**
+     * @brief Tests that in event loop mode a single thread serves several keep-alive connections.
+     */
+    bool TestClientService_EventLoop();
+
+    /**
+     * @brief Tests that in event loop mode requests already buffered on a connection are served.
+     */
+    bool TestClientService_EventLoop_Pipelined();
+
+    /**
+     * @brief Tests that in event loop mode the clients beyond MaxNumberOfConnections are rejected
+     * and that closed connections are given back to the pool.
+     */
+    bool TestClientService_EventLoop_TooManyConnections();
+
+    /**
+     * @brief Tests that in event loop mode the connections still open at Stop are given back to the pool
+     * and that the service can be started again.
+     */
+    bool TestStop_EventLoop_Restart();
+
 };
 
 /*---------------------------------------------------------------------------*/
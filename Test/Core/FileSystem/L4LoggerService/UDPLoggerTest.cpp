@@ -131,3 +131,46 @@ bool UDPLoggerTest::TestConsumeLogMessage() {
     }
     return udpLoggerTestServerOK;
 }
+
+bool UDPLoggerTest::TestConsumeLogMessages() {
+    using namespace MARTe;
+    UDPSocket server;
+    bool ok = server.Open();
+    if (ok) {
+        ok = server.Listen(44449u);
+    }
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "m");
+    cdb.Write("PrintKeys", 0);
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 44449);
+    UDPLogger test;
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
+    LoggerPage pages[3];
+    LoggerPage *logPages[3] = { &pages[0], &pages[1], &pages[2] };
+    uint32 i;
+    for (i = 0u; i < 3u; i++) {
+        pages[i].errorInfo.header.errorType = ErrorManagement::Debug;
+        StreamString msg;
+        msg.Printf("TestConsumeLogMessages %d", i);
+        StringHelper::Copy(&pages[i].errorStrBuffer[0], msg.Buffer());
+    }
+    if (ok) {
+        test.ConsumeLogMessages(&logPages[0], 3u);
+    }
+    for (i = 0u; (i < 3u) && (ok); i++) {
+        char8 buffer[256];
+        uint32 size = 255u;
+        ok = server.Read(&buffer[0], size, 2000u);
+        if (ok) {
+            buffer[size] = '\0';
+            StreamString expected;
+            expected.Printf("|TestConsumeLogMessages %d", i);
+            ok = (expected == &buffer[0]);
+        }
+    }
+    (void) server.Close();
+    return ok;
+}
@@ -69,6 +69,11 @@ public:
      * @brief Tests the ConsumeLogMessage method .
      */
     bool TestConsumeLogMessage();
+
+    /**
+     * @brief Tests that the ConsumeLogMessages method sends one datagram per page.
+     */
+    bool TestConsumeLogMessages();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -73,3 +73,22 @@ bool ConsoleLoggerTest::TestConsumeLogMessage() {
     return ok;
 }
 
+bool ConsoleLoggerTest::TestConsumeLogMessages() {
+    using namespace MARTe;
+    ConsoleLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "Em");
+    cdb.Write("PrintKeys", 1);
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        LoggerPage pages[2];
+        pages[0].errorInfo.header.errorType = ErrorManagement::Debug;
+        pages[1].errorInfo.header.errorType = ErrorManagement::Debug;
+        StringHelper::Copy(&pages[0].errorStrBuffer[0], "TestConsumeLogMessages 1");
+        StringHelper::Copy(&pages[1].errorStrBuffer[0], "TestConsumeLogMessages 2");
+        LoggerPage *logPages[2] = { &pages[0], &pages[1] };
+        test.ConsumeLogMessages(&logPages[0], 2u);
+    }
+    return ok;
+}
+
@@ -56,6 +56,11 @@ public:
      */
     bool TestConsumeLogMessage();
 
+    /**
+     * @brief Tests the ConsumeLogMessages method .
+     */
+    bool TestConsumeLogMessages();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -38,9 +38,21 @@
 /*---------------------------------------------------------------------------*/
 class LoggerConsumerITestHelper: public MARTe::LoggerConsumerI {
 public:
+    LoggerConsumerITestHelper() {
+        numberOfConsumed = 0u;
+    }
+
     virtual void ConsumeLogMessage(MARTe::LoggerPage *logPage) {
+        if (numberOfConsumed < 8u) {
+            consumed[numberOfConsumed] = logPage;
+        }
+        numberOfConsumed++;
     }
 
+    MARTe::LoggerPage *consumed[8];
+
+    MARTe::uint32 numberOfConsumed;
+
     void PrintToStream(MARTe::LoggerPage *logPage, MARTe::BufferedStreamI &err) const {
         MARTe::LoggerConsumerI::PrintToStream(logPage, err);
     }
@@ -195,6 +207,24 @@ bool LoggerConsumerITest::TestPrintToStream() {
     return ok;
 }
 
+bool LoggerConsumerITest::TestConsumeLogMessages() {
+    using namespace MARTe;
+    LoggerConsumerITestHelper test;
+    LoggerPage pages[3];
+    LoggerPage *logPages[3] = { &pages[0], &pages[1], &pages[2] };
+    test.ConsumeLogMessages(&logPages[0], 3u);
+    bool ok = (test.numberOfConsumed == 3u);
+    uint32 i;
+    for (i = 0u; (i < 3u) && (ok); i++) {
+        ok = (test.consumed[i] == &pages[i]);
+    }
+    if (ok) {
+        test.ConsumeLogMessages(&logPages[0], 0u);
+        ok = (test.numberOfConsumed == 3u);
+    }
+    return ok;
+}
+
 bool LoggerConsumerITest::TestPrintToStream_WithKeys() {
     using namespace MARTe;
     LoggerConsumerITestHelper test;
@@ -70,6 +70,11 @@ public:
      * @brief Tests the PrintToStream method with keys enabled.
      */
     bool TestPrintToStream_WithKeys();
+
+    /**
+     * @brief Tests that the default ConsumeLogMessages calls ConsumeLogMessage for each page, in order.
+     */
+    bool TestConsumeLogMessages();
 };
 
 /*---------------------------------------------------------------------------*/
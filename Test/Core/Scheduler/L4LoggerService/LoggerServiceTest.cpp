@@ -103,6 +103,33 @@ bool LoggerServiceTest::TestInitialise_Defaults() {
     return ok;
 }
 
+bool LoggerServiceTest::TestInitialise_DeferredFormatting() {
+    using namespace MARTe;
+    bool ok;
+    {
+        LoggerService test;
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", 0x1);
+        cdb.Write("DeferredFormatting", 1);
+        ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = test.Insert(consumer);
+        ok &= test.Initialise(cdb);
+        ok &= test.IsDeferredFormatting();
+        ok &= Logger::Instance()->IsDeferredFormatting();
+    }
+    {
+        LoggerService test;
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", 0x1);
+        ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok &= test.Insert(consumer);
+        ok &= test.Initialise(cdb);
+        ok &= !test.IsDeferredFormatting();
+        ok &= !Logger::Instance()->IsDeferredFormatting();
+    }
+    return ok;
+}
+
 bool LoggerServiceTest::TestInitialise_False_NoCPUs() {
     using namespace MARTe;
     LoggerService test;
@@ -172,6 +199,10 @@ bool LoggerServiceTest::TestGetStackSize() {
     return TestInitialise();
 }
 
+bool LoggerServiceTest::TestIsDeferredFormatting() {
+    return TestInitialise_DeferredFormatting();
+}
+
 bool LoggerServiceTest::TestExecute() {
     using namespace MARTe;
     LoggerService test;
@@ -204,3 +235,58 @@ bool LoggerServiceTest::TestExecute() {
     return ok;
 }
 
+bool LoggerServiceTest::TestExecute_WakeOnLog() {
+    using namespace MARTe;
+    LoggerService test;
+    ConfigurationDatabase cdb;
+    cdb.Write("CPUs", 0x1);
+    cdb.Write("WakeOnLog", 1);
+    ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = test.Insert(consumer);
+    ok &= test.Initialise(cdb);
+    //Let the service thread empty all the entries and wait for new ones
+    Sleep::Sec(0.2F);
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Debug, "LoggerConsumerITest test");
+    }
+    if (ok) {
+        uint32 maxWait = 2000;
+        uint32 i;
+        ok = consumer->ok;
+        for (i = 0; (i < maxWait) && (!ok); i++) {
+            ok = consumer->ok;
+            Sleep::Sec(1e-3);
+        }
+    }
+    return ok;
+}
+
+bool LoggerServiceTest::TestInitialise_WakeOnLog() {
+    using namespace MARTe;
+    bool ok;
+    {
+        LoggerService test;
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", 0x1);
+        cdb.Write("WakeOnLog", 1);
+        ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = test.Insert(consumer);
+        ok &= test.Initialise(cdb);
+        ok &= test.IsWakeOnLog();
+    }
+    {
+        LoggerService test;
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", 0x1);
+        ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok &= test.Insert(consumer);
+        ok &= test.Initialise(cdb);
+        ok &= !test.IsWakeOnLog();
+    }
+    return ok;
+}
+
+bool LoggerServiceTest::TestIsWakeOnLog() {
+    return TestInitialise_WakeOnLog();
+}
+
@@ -56,6 +56,11 @@ public:
      */
     bool TestInitialise_Defaults();
 
+    /**
+     * @brief Tests the initialise method with DeferredFormatting = 1.
+     */
+    bool TestInitialise_DeferredFormatting();
+
     /**
      * @brief Tests the initialise method without specifying the CPUs.
      */
@@ -86,6 +91,21 @@ public:
      */
     bool TestExecute();
 
+    /**
+     * @brief Tests the Execute method with WakeOnLog = 1.
+     */
+    bool TestExecute_WakeOnLog();
+
+    /**
+     * @brief Tests the initialise method with WakeOnLog = 1.
+     */
+    bool TestInitialise_WakeOnLog();
+
+    /**
+     * @brief Tests the IsWakeOnLog method.
+     */
+    bool TestIsWakeOnLog();
+
     /**
      * @brief Tests the GetNumberOfLogPages method.
      */
@@ -100,6 +120,11 @@ public:
      * @brief Tests the GetStackSize method.
      */
     bool TestGetStackSize();
+
+    /**
+     * @brief Tests the IsDeferredFormatting method.
+     */
+    bool TestIsDeferredFormatting();
 };
 
 /*---------------------------------------------------------------------------*/
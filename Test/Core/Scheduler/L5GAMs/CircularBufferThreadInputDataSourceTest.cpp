@@ -108,6 +108,10 @@ public:
 
     float GetSleepTime();
 
+    bool IsLockFree();
+
+    bool IsEventWakeUp();
+
     void Stop() {
         sem.FastLock();
         stopped = true;
@@ -279,6 +283,14 @@ float CircularBufferThreadInputDataSourceTestDS::GetSleepTime() {
     return sleepTime;
 }
 
+bool CircularBufferThreadInputDataSourceTestDS::IsLockFree() {
+    return lockFree;
+}
+
+bool CircularBufferThreadInputDataSourceTestDS::IsEventWakeUp() {
+    return eventWakeUp;
+}
+
 CLASS_REGISTER(CircularBufferThreadInputDataSourceTestDS, "1.0")
 
 class CircularBufferThreadInputDataSourceTestGAM1: public GAM {
@@ -1542,6 +1554,221 @@ bool CircularBufferThreadInputDataSourceTest::TestSynchronise_SleepTime() {
     return ret;
 }
 
+bool CircularBufferThreadInputDataSourceTest::TestSynchronise_LockFree() {
+
+    static const char8 * const config2 = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = CircularBufferThreadInputDataSourceTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 10"
+            "                   Ranges = {{0,0}, {2,2}}"
+            "                   Samples = 5"
+            "                   Frequency = 0"
+            "               }"
+            "               ErrorCheck = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 1"
+            "                   Samples = 5"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = CircularBufferThreadInputDataSourceTestDS"
+            "            NumberOfBuffers = 10"
+            "            CpuMask = 1"
+            "            ReceiverThreadPriority = 31"
+            "            LockFree = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = MemoryMapInputBrokerTestScheduler1"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config2);
+
+    ReferenceT<CircularBufferThreadInputDataSourceTestDS> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = dataSource->IsLockFree();
+    }
+    if (ret) {
+        ret = dataSource->PrepareNextState("State1", "State1");
+
+    }
+    if (ret) {
+        dataSource->ContinueRead();
+        ret = dataSource->Synchronise();
+        dataSource->TerminateInputCopy(0, 0, 5);
+
+    }
+    if (ret) {
+        uint32 offset;
+        ret = dataSource->GetInputOffset(0, 5, offset);
+        if (ret) {
+            ret = (offset == 0);
+        }
+    }
+    if (ret) {
+        dataSource->ContinueRead();
+        ret = dataSource->Synchronise();
+        dataSource->TerminateInputCopy(0, 0, 5);
+
+    }
+    if (ret) {
+        uint32 offset;
+        ret = dataSource->GetInputOffset(0, 5, offset);
+        if (ret) {
+            ret = (offset == 200);
+        }
+    }
+    dataSource->Stop();
+    ObjectRegistryDatabase::Instance()->Purge();
+
+    return ret;
+}
+
+bool CircularBufferThreadInputDataSourceTest::TestSynchronise_EventWakeUp() {
+
+    static const char8 * const config2 = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = CircularBufferThreadInputDataSourceTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 10"
+            "                   Ranges = {{0,0}, {2,2}}"
+            "                   Samples = 5"
+            "                   Frequency = 0"
+            "               }"
+            "               ErrorCheck = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 1"
+            "                   Samples = 5"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = CircularBufferThreadInputDataSourceTestDS"
+            "            NumberOfBuffers = 10"
+            "            CpuMask = 1"
+            "            ReceiverThreadPriority = 31"
+            "            LockFree = 1"
+            "            EventWakeUp = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = MemoryMapInputBrokerTestScheduler1"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config2);
+
+    ReferenceT<CircularBufferThreadInputDataSourceTestDS> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = dataSource->IsEventWakeUp();
+    }
+    if (ret) {
+        ret = dataSource->PrepareNextState("State1", "State1");
+
+    }
+    if (ret) {
+        dataSource->ContinueRead();
+        ret = dataSource->Synchronise();
+        dataSource->TerminateInputCopy(0, 0, 5);
+
+    }
+    if (ret) {
+        uint32 offset;
+        ret = dataSource->GetInputOffset(0, 5, offset);
+        if (ret) {
+            ret = (offset == 0);
+        }
+    }
+    if (ret) {
+        dataSource->ContinueRead();
+        ret = dataSource->Synchronise();
+        dataSource->TerminateInputCopy(0, 0, 5);
+
+    }
+    if (ret) {
+        uint32 offset;
+        ret = dataSource->GetInputOffset(0, 5, offset);
+        if (ret) {
+            ret = (offset == 200);
+        }
+    }
+    dataSource->Stop();
+    ObjectRegistryDatabase::Instance()->Purge();
+
+    return ret;
+}
+
 bool CircularBufferThreadInputDataSourceTest::TestGetBrokerName() {
 
     bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
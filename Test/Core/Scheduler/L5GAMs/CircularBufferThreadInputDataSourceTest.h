@@ -218,6 +218,18 @@ public:
      */
     bool TestSynchronise_SleepTime();
 
+    /**
+     * @brief Tests the CircularBufferThreadInputDataSource::Synchronise method
+     * with LockFree = 1.
+     */
+    bool TestSynchronise_LockFree();
+
+    /**
+     * @brief Tests the CircularBufferThreadInputDataSource::Synchronise method
+     * with LockFree = 1 and EventWakeUp = 1.
+     */
+    bool TestSynchronise_EventWakeUp();
+
     /**
      * @brief Tests the CircularBufferThreadInputDataSource::GetInputOffset
      * method.
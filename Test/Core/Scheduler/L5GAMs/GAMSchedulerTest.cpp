@@ -1299,12 +1299,26 @@ GAMSchedulerTest::~GAMSchedulerTest() {
 }
 
 bool GAMSchedulerTest::Init(StreamString &config) {
+    return Init(config, false);
+}
+
+bool GAMSchedulerTest::Init(StreamString &config,
+                            const bool persistentThreads) {
     config.Seek(0u);
     ConfigurationDatabase cdb;
     StandardParser parser(config, cdb);
     if (!parser.Parse()) {
         return false;
     }
+    if (persistentThreads) {
+        if (!cdb.MoveAbsolute("$Fibonacci.+Scheduler")) {
+            return false;
+        }
+        if (!cdb.Write("PersistentThreads", 1u)) {
+            return false;
+        }
+        cdb.MoveToRoot();
+    }
 
     ObjectRegistryDatabase::Instance()->Purge();
     if (!ObjectRegistryDatabase::Instance()->Initialise(cdb)) {
@@ -1347,11 +1361,24 @@ bool GAMSchedulerTest::TestInitialise_False_InvalidMessage() {
 }
 
 bool GAMSchedulerTest::TestIntegrated() {
-    bool ok = Init(configFull);
+    return TestIntegratedWithOptions(false);
+}
+
+bool GAMSchedulerTest::TestIntegrated_PersistentThreads() {
+    return TestIntegratedWithOptions(true);
+}
+
+bool GAMSchedulerTest::TestIntegratedWithOptions(const bool persistentThreads) {
+    bool ok = Init(configFull, persistentThreads);
     ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
     if (ok) {
         ok = app->ConfigureApplication();
     }
+    uint32 numberOfThreadsConfigured = Threads::NumberOfThreads();
+    if ((ok) && (persistentThreads)) {
+        //The threads of all the states shall already exist
+        ok = (numberOfThreadsConfigured > numOfThreadsBefore);
+    }
     if (ok) {
         ReferenceT<Message> messageStart = ObjectRegistryDatabase::Instance()->Find("TestMessages.Start");
         if (!messageStart.IsValid()) {
@@ -1439,13 +1466,18 @@ bool GAMSchedulerTest::TestIntegrated() {
             }
         }
     }
+    if ((ok) && (persistentThreads)) {
+        //No threads shall have been created or destroyed by the state changes
+        ok = (Threads::NumberOfThreads() == numberOfThreadsConfigured);
+    }
     ReferenceT<Message> messageStop = ObjectRegistryDatabase::Instance()->Find("TestMessages.Stop");
     if (!messageStop.IsValid()) {
         return false;
     }
     ok &= (MessageI::SendMessage(messageStop, NULL) == ErrorManagement::NoError);
 
-    while (Threads::NumberOfThreads() > 1 + numOfThreadsBefore) {
+    //The persistent threads are only destroyed when the application is purged
+    while ((!persistentThreads) && (Threads::NumberOfThreads() > 1 + numOfThreadsBefore)) {
         Sleep::Sec(0.1);
     }
     ObjectRegistryDatabase::Instance()->Purge();
@@ -1597,7 +1629,15 @@ static void PrepareNext(RealTimeApplication &app) {
 }
 
 bool GAMSchedulerTest::TestStartNextStateExecution() {
-    if (!Init(configSimple)) {
+    return TestStartNextStateExecutionWithOptions(false);
+}
+
+bool GAMSchedulerTest::TestStartNextStateExecution_PersistentThreads() {
+    return TestStartNextStateExecutionWithOptions(true);
+}
+
+bool GAMSchedulerTest::TestStartNextStateExecutionWithOptions(const bool persistentThreads) {
+    if (!Init(configSimple, persistentThreads)) {
         return false;
     }
 
@@ -1634,6 +1674,74 @@ bool GAMSchedulerTest::TestStartNextStateExecution() {
     return err.ErrorsCleared();
 }
 
+/**
+ * Waits for the number of threads to be \a expected.
+ */
+static bool WaitNumberOfThreads(const uint32 expected) {
+    uint32 maxWait = 500u;
+    while ((Threads::NumberOfThreads() != expected) && (maxWait > 0u)) {
+        Sleep::MSec(10);
+        maxWait--;
+    }
+    return (Threads::NumberOfThreads() == expected);
+}
+
+bool GAMSchedulerTest::TestConfigureScheduler_PersistentThreads_StatesChanged() {
+    bool ok = Init(configSimple, true);
+    ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+    ReferenceT<GAMScheduler> sched;
+    ReferenceT<ReferenceContainer> statesContainer;
+    Reference state2;
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    if (ok) {
+        sched = app->Find("Scheduler");
+        statesContainer = app->Find("States");
+        state2 = app->Find("States.State2");
+        ok = (sched.IsValid() && statesContainer.IsValid() && state2.IsValid());
+    }
+    //Each state has two threads
+    if (ok) {
+        ok = WaitNumberOfThreads(numOfThreadsBefore + 4u);
+    }
+    //Less states: the threads of the removed state must also be released and stopped
+    if (ok) {
+        ok = statesContainer->Delete(state2);
+    }
+    if (ok) {
+        ok = sched->ConfigureScheduler(app);
+    }
+    if (ok) {
+        ok = WaitNumberOfThreads(numOfThreadsBefore + 2u);
+    }
+    //More states
+    if (ok) {
+        ok = statesContainer->Insert(state2);
+    }
+    if (ok) {
+        ok = sched->ConfigureScheduler(app);
+    }
+    if (ok) {
+        ok = WaitNumberOfThreads(numOfThreadsBefore + 4u);
+    }
+    if (ok) {
+        ok = app->PrepareNextState("State2");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    if (ok) {
+        Sleep::MSec(100);
+        ok = app->StopCurrentStateExecution();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    while (Threads::NumberOfThreads() > numOfThreadsBefore) {
+        Sleep::MSec(10);
+    }
+    return ok;
+}
+
 bool GAMSchedulerTest::TestStartNextStateExecution_False_PrepareNextState() {
     if (!Init(configSimple)) {
         return false;
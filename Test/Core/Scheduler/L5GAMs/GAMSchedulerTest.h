@@ -65,6 +65,12 @@ public:
      */
     bool Init(StreamString &config);
 
+    /**
+     * @brief Initialises the ObjectRegistryDatabase with the scheduler PersistentThreads option set to \a persistentThreads.
+     */
+    bool Init(StreamString &config,
+              const bool persistentThreads);
+
     /**
      * @brief Tests the scheduler constructor
      */
@@ -115,10 +121,37 @@ public:
      */
     bool TestIntegrated_TriggerErrorMessage();
 
+    /**
+     * @brief Tests the full application execution with PersistentThreads = 1 and verifies that the threads are not recreated on state changes.
+     */
+    bool TestIntegrated_PersistentThreads();
+
+    /**
+     * @brief Tests the StartNextStateExecution and the StopCurrentStateExecution methods with PersistentThreads = 1.
+     */
+    bool TestStartNextStateExecution_PersistentThreads();
+
+    /**
+     * @brief Tests that with PersistentThreads = 1 the scheduler can be configured again with a different number of states.
+     */
+    bool TestConfigureScheduler_PersistentThreads_StatesChanged();
+
     /**
      * @brief Tests that the purge kills all threads
      */
     bool TestPurge();
+
+private:
+
+    /**
+     * @brief Executes the full application and changes state twice.
+     */
+    bool TestIntegratedWithOptions(const bool persistentThreads);
+
+    /**
+     * @brief Starts the application, changes state and stops the application.
+     */
+    bool TestStartNextStateExecutionWithOptions(const bool persistentThreads);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -128,6 +128,9 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
         expectedSignal = NULL;
         counter = 0;
         memoryOK = true;
+        blockSynchronise = false;
+        hugePages = false;
+        lockMemory = false;
     }
 
     virtual ~MemoryMapAsyncOutputBrokerDataSourceTestHelper() {
@@ -148,6 +151,14 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
         data.Read("NumberOfBuffers", numberOfBuffers);
         data.Read("CPUMask", cpuMask);
         data.Read("StackSize", stackSize);
+        uint8 hugePagesIn = 0u;
+        if (data.Read("HugePages", hugePagesIn)) {
+            hugePages = (hugePagesIn > 0u);
+        }
+        uint8 lockMemoryIn = 0u;
+        if (data.Read("LockMemory", lockMemoryIn)) {
+            lockMemory = (lockMemoryIn > 0u);
+        }
         AnyType signalAT = data.GetType("ExpectedSignal");
         numberOfExecutes = signalAT.GetNumberOfElements(0);
         expectedSignal = new uint32[numberOfExecutes];
@@ -226,7 +237,7 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
         broker = ReferenceT<MARTe::MemoryMapAsyncOutputBroker>("MemoryMapAsyncOutputBroker");
         bool ret = broker.IsValid();
         if (ret) {
-            ret = broker->InitWithBufferParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBuffers, cpuMask, stackSize);
+            ret = broker->InitWithBufferParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBuffers, cpuMask, stackSize, hugePages, lockMemory);
         }
         if (ret) {
             ret = outputBrokers.Insert(broker);
@@ -237,6 +248,10 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
     //Check that the memory is indeed set as expected
     virtual bool Synchronise() {
         using namespace MARTe;
+        //Allows to keep the BufferLoop busy (e.g. to force a buffer overrun)
+        while (blockSynchronise) {
+            Sleep::MSec(1);
+        }
         if (counter < numberOfExecutes) {
             uint32 *signalMemory32 = reinterpret_cast<uint32 *>(signalMemory);
             if (memoryOK) {
@@ -274,6 +289,9 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
     MARTe::uint32 counter;
     MARTe::ReferenceT<MARTe::MemoryMapAsyncOutputBroker> broker;
     bool memoryOK;
+    volatile bool blockSynchronise;
+    bool hugePages;
+    bool lockMemory;
     void *signalMemory;
 };
 CLASS_REGISTER(MemoryMapAsyncOutputBrokerDataSourceTestHelper, "1.0")
@@ -432,8 +450,7 @@ static bool TestExecute_Buffers(const MARTe::char8 * const config, MARTe::uint32
 
     //2 seconds to finish
     uint64 maxTimeInCounts = HighResolutionTimer::Counter() + 2 * HighResolutionTimer::Frequency();
-    //Force flushing of BufferLoop
-    scheduler->ExecuteThreadCycle(0);
+    //Every published buffer wakes the BufferLoop, so exactly numberOfExecutes buffers must reach the DataSource
     while (dataSource->counter != dataSource->numberOfExecutes) {
         Sleep::Sec(0.1);
         if (HighResolutionTimer::Counter() > maxTimeInCounts) {
@@ -1101,12 +1118,15 @@ bool MemoryMapAsyncOutputBrokerTest::TestExecute_Buffer_Overrun() {
     char8 *fakeMem = new char8[1024];
     dataSource->GetOutputBrokers(brokers, "GAM1", fakeMem);
     ReferenceT<MemoryMapAsyncOutputBroker> broker = brokers.Get(0);
+    //Do not let the BufferLoop release the first buffer
+    dataSource->blockSynchronise = true;
     if (ok) {
         ok = broker->Execute();
     }
     if (ok) {
         ok = !broker->Execute();
     }
+    dataSource->blockSynchronise = false;
     delete fakeMem;
 
     godb->Purge();
@@ -1132,3 +1152,68 @@ bool MemoryMapAsyncOutputBrokerTest::TestIsIgnoringBufferOverrun() {
 bool MemoryMapAsyncOutputBrokerTest::TestSetIgnoreBufferOverrun() {
     return TestIsIgnoringBufferOverrun();
 }
+
+bool MemoryMapAsyncOutputBrokerTest::TestInitWithBufferParameters_BufferMemoryOptions() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config10;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Data.+Drv1");
+    }
+    if (ok) {
+        ok = cdb.Write("HugePages", 1u);
+    }
+    if (ok) {
+        ok = cdb.Write("LockMemory", 1u);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<MemoryMapAsyncOutputBrokerDataSourceTestHelper> dataSource;
+    if (ok) {
+        dataSource = application->Find("Data.Drv1");
+        ok = dataSource.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    ReferenceContainer brokers;
+    char8 *fakeMem = new char8[1024];
+    if (ok) {
+        ok = dataSource->GetOutputBrokers(brokers, "GAM1", fakeMem);
+    }
+    ReferenceT<MemoryMapAsyncOutputBroker> broker;
+    if (ok) {
+        broker = brokers.Get(0);
+        ok = broker.IsValid();
+    }
+    //The options configured in the DataSource reach the buffer pool (the allocation falls back to the standard pages if needed)
+    if (ok) {
+        ok = broker->IsHugePageBuffers();
+    }
+    if (ok) {
+        ok = broker->IsLockedBuffers();
+    }
+    delete[] fakeMem;
+
+    god->Purge();
+    return ok;
+}
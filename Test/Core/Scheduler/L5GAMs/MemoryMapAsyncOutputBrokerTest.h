@@ -100,6 +100,11 @@ public:
      */
     bool TestGetNumberOfBuffers();
 
+    /**
+     * @brief Tests that the HugePages and LockMemory options of the DataSourceI are passed by InitWithBufferParameters to the buffers.
+     */
+    bool TestInitWithBufferParameters_BufferMemoryOptions();
+
     /**
      * @brief Tests the IsIgnoringBufferOverrun method.
      */
@@ -153,6 +153,10 @@ public:
         memoryOK = true;
         stackSize = 65536;
         broker = NULL;
+        signalBufferHandover = false;
+        handoverCounter = 0u;
+        hugePages = false;
+        lockMemory = false;
     }
 
     virtual ~MemoryMapAsyncTriggerOutputBrokerDataSourceTestHelper() {
@@ -186,6 +190,18 @@ public:
         data.Read("PostTriggerBuffers", postTriggerBuffers);
         data.Read("CPUMask", cpuMask);
         data.Read("StackSize", stackSize);
+        uint8 signalBufferHandoverIn = 0u;
+        if (data.Read("SignalBufferHandover", signalBufferHandoverIn)) {
+            signalBufferHandover = (signalBufferHandoverIn > 0u);
+        }
+        uint8 hugePagesIn = 0u;
+        if (data.Read("HugePages", hugePagesIn)) {
+            hugePages = (hugePagesIn > 0u);
+        }
+        uint8 lockMemoryIn = 0u;
+        if (data.Read("LockMemory", lockMemoryIn)) {
+            lockMemory = (lockMemoryIn > 0u);
+        }
         AnyType triggerAT = data.GetType("ExpectedTrigger");
         numberOfExecutes = triggerAT.GetNumberOfElements(0);
         expectedTrigger = new uint8[numberOfExecutes];
@@ -269,7 +285,7 @@ public:
         ReferenceT<MARTe::MemoryMapAsyncTriggerOutputBroker> brokerNew = ReferenceT<MARTe::MemoryMapAsyncTriggerOutputBroker>("MemoryMapAsyncTriggerOutputBroker");
         bool ret = brokerNew.IsValid();
         if (ret) {
-            ret = brokerNew->InitWithTriggerParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBuffers, preTriggerBuffers, postTriggerBuffers, cpuMask, stackSize);
+            ret = brokerNew->InitWithTriggerParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBuffers, preTriggerBuffers, postTriggerBuffers, cpuMask, stackSize, hugePages, lockMemory);
         }
         if (ret) {
             ret = outputBrokers.Insert(brokerNew);
@@ -299,6 +315,36 @@ public:
         return memoryOK;
     }
 
+    virtual bool IsSignalBufferHandoverSupported() {
+        return signalBufferHandover;
+    }
+
+    //Check that the buffers handed over by the broker hold the expected values
+    virtual bool SynchroniseSignalBuffers(void * const * const signalAddresses) {
+        using namespace MARTe;
+        if (counter < numberOfExecutes) {
+            if (memoryOK) {
+                memoryOK &= (*static_cast<uint8 *>(signalAddresses[0]) == expectedTrigger[counter]);
+                uint32 s;
+                for (s = 1u; s < GetNumberOfSignals(); s++) {
+                    uint32 el = 0u;
+                    memoryOK &= GetSignalNumberOfElements(s, el);
+                    uint32 *signal32 = static_cast<uint32 *>(signalAddresses[s]);
+                    uint32 n;
+                    for (n = 0u; n < el; n++) {
+                        memoryOK &= (signal32[n] == expectedSignal[counter]);
+                    }
+                }
+            }
+        }
+        else {
+            memoryOK = false;
+        }
+        counter++;
+        handoverCounter++;
+        return memoryOK;
+    }
+
     void Reset() {
         counter = 0;
         broker->ResetPreTriggerBuffers();
@@ -318,6 +364,10 @@ public:
     MARTe::MemoryMapAsyncTriggerOutputBroker *broker;
     bool memoryOK;
     void *signalMemory;
+    bool signalBufferHandover;
+    bool hugePages;
+    bool lockMemory;
+    MARTe::uint32 handoverCounter;
 };
 CLASS_REGISTER(MemoryMapAsyncTriggerOutputBrokerDataSourceTestHelper, "1.0")
 
@@ -407,7 +457,7 @@ static bool TestIntegratedInApplication(const MARTe::char8 * const config, bool
  */
 static bool TestExecute_PreTriggerBuffers_PostTriggerBuffers(const MARTe::char8 * const config, MARTe::uint8* triggerToGenerate, MARTe::uint32 *signalToGenerate, MARTe::uint32 toGenerateNumberOfElements, MARTe::uint8* expectedTrigger,
                                                              MARTe::uint32* expectedSignal, MARTe::uint32 expectedNumberOfElements, MARTe::uint32 preTriggerBuffers, MARTe::uint32 postTriggerBuffers, MARTe::uint32 numberOfBuffers,
-                                                             MARTe::uint32 sleepMSec = 10) {
+                                                             MARTe::uint32 sleepMSec = 10, bool signalBufferHandover = false) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -437,6 +487,9 @@ static bool TestExecute_PreTriggerBuffers_PostTriggerBuffers(const MARTe::char8
     cdb.Write("PreTriggerBuffers", preTriggerBuffers);
     cdb.Write("PostTriggerBuffers", postTriggerBuffers);
     cdb.Write("NumberOfBuffers", numberOfBuffers);
+    if (signalBufferHandover) {
+        cdb.Write("SignalBufferHandover", 1u);
+    }
     cdb.MoveToRoot();
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
 
@@ -475,6 +528,9 @@ static bool TestExecute_PreTriggerBuffers_PostTriggerBuffers(const MARTe::char8
     if (ok) {
         ok = application->PrepareNextState("State1");
     }
+    if (ok) {
+        ok = (dataSource->broker->IsSignalBufferHandoverEnabled() == signalBufferHandover);
+    }
     if (ok) {
         ok = application->StartNextStateExecution();
     }
@@ -502,6 +558,74 @@ static bool TestExecute_PreTriggerBuffers_PostTriggerBuffers(const MARTe::char8
     if (ok) {
         ok = dataSource->memoryOK;
     }
+    if ((ok) && (signalBufferHandover)) {
+        ok = (dataSource->handoverCounter == dataSource->counter);
+    }
+
+    godb->Purge();
+    return ok;
+}
+
+/**
+ * Initialises a mini MARTe application against the provided config (optionally asking the DataSource to support the handover of buffers and
+ *  writing only a range of Signal2) and verifies if the broker hands over the buffers by reference.
+ */
+static bool TestSignalBufferHandoverEnabled(const MARTe::char8 * const config, bool signalBufferHandover, bool signal2Ranges, bool expected) {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+    if ((ok) && (signal2Ranges)) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals.Signal2");
+        if (ok) {
+            ConfigurationDatabase rangesCDB;
+            StreamString rangesStream = "Ranges = {{0 4}}";
+            rangesStream.Seek(0);
+            StandardParser rangesParser(rangesStream, rangesCDB);
+            ok = rangesParser.Parse();
+            if (ok) {
+                ok = rangesCDB.Copy(cdb);
+            }
+        }
+    }
+    if ((ok) && (signalBufferHandover)) {
+        ok = cdb.MoveAbsolute("$Test.+Data.+Drv1");
+        if (ok) {
+            ok = cdb.Write("SignalBufferHandover", 1u);
+        }
+    }
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        godb->Purge();
+        ok = godb->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<MemoryMapAsyncTriggerOutputBrokerDataSourceTestHelper> dataSource;
+    if (ok) {
+        dataSource = application->Find("Data.Drv1");
+        ok = dataSource.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = (dataSource->broker != NULL);
+    }
+    if (ok) {
+        ok = (dataSource->broker->IsSignalBufferHandoverEnabled() == expected);
+    }
 
     godb->Purge();
     return ok;
@@ -2162,3 +2286,90 @@ bool MemoryMapAsyncTriggerOutputBrokerTest::TestFlushAllTriggers() {
     godb->Purge();
     return ok;
 }
+
+bool MemoryMapAsyncTriggerOutputBrokerTest::TestExecute_SignalBufferHandover() {
+    using namespace MARTe;
+    uint8 triggerToGenerate[] = { 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    uint32 signalToGenerate[] = { 9, 1, 2, 3, 4, 5, 6, 7, 8, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1, 2, 3, 4, 5 };
+    uint8 expectedTrigger[] = { 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0 };
+    uint32 expectedSignal[] = { 9, 1, 2, 3, 8, 7, 6, 5, 4, 3, 2 };
+
+    return TestExecute_PreTriggerBuffers_PostTriggerBuffers(config1, triggerToGenerate, signalToGenerate, sizeof(triggerToGenerate) / sizeof(uint8), expectedTrigger, expectedSignal, sizeof(expectedTrigger) / sizeof(uint8), 4, 2, 10, 10, true);
+}
+
+bool MemoryMapAsyncTriggerOutputBrokerTest::TestIsSignalBufferHandoverEnabled() {
+    return TestSignalBufferHandoverEnabled(config1, true, false, true);
+}
+
+bool MemoryMapAsyncTriggerOutputBrokerTest::TestIsSignalBufferHandoverEnabled_False_NotSupported() {
+    return TestSignalBufferHandoverEnabled(config1, false, false, false);
+}
+
+bool MemoryMapAsyncTriggerOutputBrokerTest::TestIsSignalBufferHandoverEnabled_False_Ranges() {
+    return TestSignalBufferHandoverEnabled(config1, true, true, false);
+}
+
+bool MemoryMapAsyncTriggerOutputBrokerTest::TestInitWithTriggerParameters_BufferMemoryOptions() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config10;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Data.+Drv1");
+    }
+    if (ok) {
+        ok = cdb.Write("HugePages", 1u);
+    }
+    if (ok) {
+        ok = cdb.Write("LockMemory", 1u);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<MemoryMapAsyncTriggerOutputBrokerDataSourceTestHelper> dataSource;
+    if (ok) {
+        dataSource = application->Find("Data.Drv1");
+        ok = dataSource.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    ReferenceContainer brokers;
+    char8 *fakeMem = new char8[1024];
+    if (ok) {
+        ok = dataSource->GetOutputBrokers(brokers, "GAM1", fakeMem);
+    }
+    ReferenceT<MemoryMapAsyncTriggerOutputBroker> broker;
+    if (ok) {
+        broker = brokers.Get(0);
+        ok = broker.IsValid();
+    }
+    //The options configured in the DataSource reach the buffer pool (the allocation falls back to the standard pages if needed)
+    if (ok) {
+        ok = broker->IsHugePageBuffers();
+    }
+    if (ok) {
+        ok = broker->IsLockedBuffers();
+    }
+    delete[] fakeMem;
+
+    god->Purge();
+    return ok;
+}
@@ -175,6 +175,11 @@ public:
      */
     bool TestGetNumberOfBuffers();
 
+    /**
+     * @brief Tests that the HugePages and LockMemory options of the DataSourceI are passed by InitWithTriggerParameters to the buffers.
+     */
+    bool TestInitWithTriggerParameters_BufferMemoryOptions();
+
     /**
      * @brief Tests the GetPreTriggerBuffers method.
      */
@@ -200,6 +205,26 @@ public:
      */
     bool TestFlushAllTriggers();
 
+    /**
+     * @brief Tests the Execute method when the buffers are handed over by reference to the DataSourceI.
+     */
+    bool TestExecute_SignalBufferHandover();
+
+    /**
+     * @brief Tests the IsSignalBufferHandoverEnabled method.
+     */
+    bool TestIsSignalBufferHandoverEnabled();
+
+    /**
+     * @brief Tests that the IsSignalBufferHandoverEnabled method returns false if the DataSourceI does not support the handover of buffers.
+     */
+    bool TestIsSignalBufferHandoverEnabled_False_NotSupported();
+
+    /**
+     * @brief Tests that the IsSignalBufferHandoverEnabled method returns false if only a range of a signal is written by the GAM.
+     */
+    bool TestIsSignalBufferHandoverEnabled_False_Ranges();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -148,6 +148,12 @@ TEST(BareMetal_L1Portability_AtomicGTest,ExchangeTest) {
     ASSERT_TRUE(exchangeTest.TestExchange());
 }
 
+TEST(BareMetal_L1Portability_AtomicGTest,CompareAndSwapTest) {
+    int32 testValue = 32;
+    AtomicTest<int32> compareAndSwapTest(testValue);
+    ASSERT_TRUE(compareAndSwapTest.TestCompareAndSwap());
+}
+
 TEST(BareMetal_L1Portability_AtomicGTest,AddTest) {
     int32 testValue = 32;
     AtomicTest<int32> addTest(testValue);
@@ -0,0 +1,96 @@
+/**
+ * @file FastAdaptiveMutexSemGTest.cpp
+ * @brief Source file for class FastAdaptiveMutexSemGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FastAdaptiveMutexSemGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MARTe2UTest.h"
+#include "FastAdaptiveMutexSemTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestConstructor) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestConstructor());
+}
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestConstructorFromExternal) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestConstructorFromExternal());
+}
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestCreateNoLock) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestCreate(false));
+}
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestCreateLock) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestCreate(true));
+}
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestFastLock) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLock(32, TTInfiniteWait, FAST_ADAPTIVE_MUTEX_SEM_DEFAULT_SPINS));
+}
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestFastLockWithFiniteTimeout) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLock(4, 10000u, FAST_ADAPTIVE_MUTEX_SEM_DEFAULT_SPINS));
+}
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestFastLockNoSpin) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLock(32, TTInfiniteWait, 0u));
+}
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestFastTryLock) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastTryLock());
+}
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestFastLockErrorCode) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLockErrorCode());
+}
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestFastUnLockWakesWaiter) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastUnLockWakesWaiter());
+}
+
+TEST(BareMetal_L1Portability_FastAdaptiveMutexSemGTest,TestLocked) {
+    FastAdaptiveMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestLocked());
+}
@@ -107,6 +107,26 @@ TEST(BareMetal_L1Portability_MemoryOperationsHelperGTest,TestSearchZeroSize) {
     ASSERT_TRUE(MyMemoryOperationsHelperTest.TestSearchZeroSize());
 }
 
+TEST(BareMetal_L1Portability_MemoryOperationsHelperGTest,TestCopyLargeUnaligned) {
+    MemoryOperationsHelperTest test;
+    ASSERT_TRUE(test.TestCopyLargeUnaligned());
+}
+
+TEST(BareMetal_L1Portability_MemoryOperationsHelperGTest,TestSetLargeUnaligned) {
+    MemoryOperationsHelperTest test;
+    ASSERT_TRUE(test.TestSetLargeUnaligned());
+}
+
+TEST(BareMetal_L1Portability_MemoryOperationsHelperGTest,TestCompareLargeUnaligned) {
+    MemoryOperationsHelperTest test;
+    ASSERT_TRUE(test.TestCompareLargeUnaligned());
+}
+
+TEST(BareMetal_L1Portability_MemoryOperationsHelperGTest,TestSearchLargeUnaligned) {
+    MemoryOperationsHelperTest test;
+    ASSERT_TRUE(test.TestSearchLargeUnaligned());
+}
+
 TEST(BareMetal_L1Portability_MemoryOperationsHelperGTest,TestInterleavedToFlat) {
     MemoryOperationsHelperTest test;
     ASSERT_TRUE(test.TestInterleavedToFlat());
@@ -0,0 +1,66 @@
+/**
+ * @file SlabMemoryGTest.cpp
+ * @brief Source file for class SlabMemoryGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SlabMemoryGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SlabMemoryTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L1Portability_SlabMemoryGTest,TestAllocate) {
+    SlabMemoryTest test;
+    ASSERT_TRUE(test.TestAllocate());
+}
+
+TEST(BareMetal_L1Portability_SlabMemoryGTest,TestAllocate_HugePages) {
+    SlabMemoryTest test;
+    ASSERT_TRUE(test.TestAllocate_HugePages());
+}
+
+TEST(BareMetal_L1Portability_SlabMemoryGTest,TestAllocate_Locked) {
+    SlabMemoryTest test;
+    ASSERT_TRUE(test.TestAllocate_Locked());
+}
+
+TEST(BareMetal_L1Portability_SlabMemoryGTest,TestFree) {
+    SlabMemoryTest test;
+    ASSERT_TRUE(test.TestFree());
+}
+
+TEST(BareMetal_L1Portability_SlabMemoryGTest,TestFree_False) {
+    SlabMemoryTest test;
+    ASSERT_TRUE(test.TestFree_False());
+}
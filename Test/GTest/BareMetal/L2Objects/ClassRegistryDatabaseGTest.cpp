@@ -99,3 +99,23 @@ TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestCleanUp) {
     ClassRegistryDatabaseTest classRegistryDatabaseTest;
     ASSERT_TRUE(classRegistryDatabaseTest.TestCleanUp());
 }
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestFindManyClasses) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestFindManyClasses());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestFindSameNameReturnsFirst) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestFindSameNameReturnsFirst());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestPeek) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestPeek());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestCleanUpResetsIdentifiers) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestCleanUpResetsIdentifiers());
+}
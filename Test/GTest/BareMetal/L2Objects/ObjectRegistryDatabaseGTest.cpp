@@ -68,3 +68,18 @@ TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestGetClassName) {
     ObjectRegistryDatabaseTest objRegTest;
     ASSERT_TRUE(objRegTest.TestGetClassName());
 }
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestFind_Cached) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestFind_Cached());
+}
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestFind_CachedContainerDeleted) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestFind_CachedContainerDeleted());
+}
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestFind_NotCacheable) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestFind_NotCacheable());
+}
@@ -559,3 +559,38 @@ TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestRemoveDomainToken) {
     ReferenceContainerTest referenceContainerTest;
     ASSERT_TRUE(referenceContainerTest.TestRemoveDomainToken());
 }
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFindWithPath_NameIndex) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestFindWithPath_NameIndex());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFindChild) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestFindChild());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFindChild_Duplicated) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestFindChild_Duplicated());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFindChild_Renamed) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestFindChild_Renamed());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFindChild_Removed) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestFindChild_Removed());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestGetGeneration) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestGetGeneration());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFindRemoveAll_Large) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestFindRemoveAll_Large());
+}
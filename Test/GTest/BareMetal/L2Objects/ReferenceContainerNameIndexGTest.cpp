@@ -0,0 +1,126 @@
+/**
+ * @file ReferenceContainerNameIndexGTest.cpp
+ * @brief Source file for class ReferenceContainerNameIndexGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReferenceContainerNameIndexGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ReferenceContainerNameIndexTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestConstructor) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestBuild) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestBuild());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestBuild_Empty) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestBuild_Empty());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestReset) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestReset());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestIsBuilt) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestIsBuilt());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestAdd) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestAdd());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestAdd_NotBuilt) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestAdd_NotBuilt());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestAdd_NoName) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestAdd_NoName());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestRemove) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestRemove());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestRemove_Renamed) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestRemove_Renamed());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestRemove_Reuse) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestRemove_Reuse());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestFind) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestFind());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestFind_Duplicated) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestFind_Duplicated());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestFind_NotTerminated) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestFind_NotTerminated());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestFind_NotFound) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestFind_NotFound());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestGetNumberOfEntries) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestGetNumberOfEntries());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerNameIndexGTest,TestIsNamed) {
+    ReferenceContainerNameIndexTest test;
+    ASSERT_TRUE(test.TestIsNamed());
+}
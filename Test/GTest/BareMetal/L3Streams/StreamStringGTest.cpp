@@ -346,3 +346,18 @@ TEST(BareMetal_L3Streams_StreamStringGTest, TestGetToken) {
     StreamStringTest stringtest;
     ASSERT_TRUE(stringtest.TestGetToken(TokenTestTableTerminators));
 }
+
+TEST(BareMetal_L3Streams_StreamStringGTest, TestSetHeap) {
+    StreamStringTest stringtest;
+    ASSERT_TRUE(stringtest.TestSetHeap());
+}
+
+TEST(BareMetal_L3Streams_StreamStringGTest, TestSetHeap_AlreadyAllocated) {
+    StreamStringTest stringtest;
+    ASSERT_TRUE(stringtest.TestSetHeap_AlreadyAllocated());
+}
+
+TEST(BareMetal_L3Streams_StreamStringGTest, TestCopySmallString) {
+    StreamStringTest stringtest;
+    ASSERT_TRUE(stringtest.TestCopySmallString());
+}
@@ -150,3 +150,18 @@ TEST(BareMetal_L3Streams_StreamStringIOBufferGTest, TestWriteAll_equal_size) {
 }
 
 	
+
+TEST(BareMetal_L3Streams_StreamStringIOBufferGTest, TestSmallBuffer) {
+    StreamStringIOBufferTest myStreamStringIOBufferTest;
+    ASSERT_TRUE(myStreamStringIOBufferTest.TestSmallBuffer());
+}
+
+TEST(BareMetal_L3Streams_StreamStringIOBufferGTest, TestSmallBufferToHeap) {
+    StreamStringIOBufferTest myStreamStringIOBufferTest;
+    ASSERT_TRUE(myStreamStringIOBufferTest.TestSmallBufferToHeap());
+}
+
+TEST(BareMetal_L3Streams_StreamStringIOBufferGTest, TestSmallBufferTruncate) {
+    StreamStringIOBufferTest myStreamStringIOBufferTest;
+    ASSERT_TRUE(myStreamStringIOBufferTest.TestSmallBufferTruncate());
+}
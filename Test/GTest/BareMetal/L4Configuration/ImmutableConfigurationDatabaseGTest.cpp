@@ -0,0 +1,119 @@
+/**
+ * @file ImmutableConfigurationDatabaseGTest.cpp
+ * @brief Source file for class ImmutableConfigurationDatabaseGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ImmutableConfigurationDatabaseGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ImmutableConfigurationDatabaseTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestDefaultConstructor) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestDefaultConstructor());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestCopyConstructor) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestCopyConstructor());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestWriteRead_Scalars) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestWriteRead_Scalars());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestWriteRead_VectorsMatrices) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestWriteRead_VectorsMatrices());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestWrite_Overwrite) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestWrite_Overwrite());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestRead_StructuredData) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestRead_StructuredData());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestGetType) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestGetType());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestCreate) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestCreate());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestMove) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestMove());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestGetChildName) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestGetChildName());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestFreeze) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestFreeze());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestDeleteAddToCurrentNode) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestDeleteAddToCurrentNode());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestCopy) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestCopy());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestInitialise) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestStandardParser) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestStandardParser());
+}
+
+TEST(BareMetal_L4Configuration_ImmutableConfigurationDatabaseGTest,TestManyEntries) {
+    ImmutableConfigurationDatabaseTest test;
+    ASSERT_TRUE(test.TestManyEntries());
+}
@@ -69,3 +69,18 @@ TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestComments) {
     LexicalAnalyzerTest laTest;
     ASSERT_TRUE(laTest.TestComments());
 }
+
+TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestGetTokenAcrossReadBlocks) {
+    LexicalAnalyzerTest laTest;
+    ASSERT_TRUE(laTest.TestGetTokenAcrossReadBlocks());
+}
+
+TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestKeywordAcrossReadBlocks) {
+    LexicalAnalyzerTest laTest;
+    ASSERT_TRUE(laTest.TestKeywordAcrossReadBlocks());
+}
+
+TEST(BareMetal_L4Configuration_LexicalAnalyzerGTest, TestStreamPositionRestored) {
+    LexicalAnalyzerTest laTest;
+    ASSERT_TRUE(laTest.TestStreamPositionRestored());
+}
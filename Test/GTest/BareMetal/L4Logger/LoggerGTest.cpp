@@ -80,3 +80,58 @@ TEST(BareMetal_L4Logger_LoggerGTest,TestLoggerErrorProcessFunction) {
     LoggerTest target;
     ASSERT_TRUE(target.TestLoggerErrorProcessFunction());
 }
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestSetDeferredFormatting) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestSetDeferredFormatting());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestIsDeferredFormatting) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestIsDeferredFormatting());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestSetDeferredFormatting_SetErrorProcessFunction) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestSetDeferredFormatting_SetErrorProcessFunction());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestLoggerDeferredErrorProcessFunction) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestLoggerDeferredErrorProcessFunction());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestLoggerDeferredErrorProcessFunction_Fallback) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestLoggerDeferredErrorProcessFunction_Fallback());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestLoggerDeferredErrorProcessFunction_TooLong) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestLoggerDeferredErrorProcessFunction_TooLong());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestSetWakeUpFunction) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestSetWakeUpFunction());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestSetWakeUpFunction_WaitsForCallers) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestSetWakeUpFunction_WaitsForCallers());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestPrepareWait) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestPrepareWait());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestPrepareWait_PendingLogs) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestPrepareWait_PendingLogs());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestCancelWait) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestCancelWait());
+}
@@ -58,6 +58,21 @@ TEST(BareMetal_L5GAMs_DataSourceIGTest,TestSetConfiguredDatabase) {
     ASSERT_TRUE(test.TestSetConfiguredDatabase());
 }
 
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestSetConfiguredDatabase_ManySignals) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_ManySignals());
+}
+
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestSetConfiguredDatabase_SignalsNode) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_SignalsNode());
+}
+
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestSetConfiguredDatabase_False_NoQualifiedName) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NoQualifiedName());
+}
+
 TEST(BareMetal_L5GAMs_DataSourceIGTest,TestGetNumberOfSignals) {
     DataSourceITest test;
     ASSERT_TRUE(test.TestGetNumberOfSignals());
@@ -278,3 +293,23 @@ TEST(BareMetal_L5GAMs_DataSourceIGTest,TestBrokerCopyTerminated) {
     ASSERT_TRUE(test.TestBrokerCopyTerminated());
 }
 
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestIsSignalBufferHandoverSupported) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestIsSignalBufferHandoverSupported());
+}
+
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestSynchroniseSignalBuffers) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestSynchroniseSignalBuffers());
+}
+
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestIsOffsetCachingSupported) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestIsOffsetCachingSupported());
+}
+
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestIsSignalMemoryMirrored) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestIsSignalMemoryMirrored());
+}
+
@@ -0,0 +1,81 @@
+/**
+ * @file ExecutableStatisticsGTest.cpp
+ * @brief Source file for class ExecutableStatisticsGTest
+ * @date 16/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutableStatisticsGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ExecutableStatisticsTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L5GAMs_ExecutableStatisticsGTest,TestAllocate) {
+    ExecutableStatisticsTest test;
+    ASSERT_TRUE(test.TestAllocate());
+}
+
+TEST(BareMetal_L5GAMs_ExecutableStatisticsGTest,TestInitialise) {
+    ExecutableStatisticsTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(BareMetal_L5GAMs_ExecutableStatisticsGTest,TestUpdate) {
+    ExecutableStatisticsTest test;
+    ASSERT_TRUE(test.TestUpdate());
+}
+
+TEST(BareMetal_L5GAMs_ExecutableStatisticsGTest,TestRequestReset) {
+    ExecutableStatisticsTest test;
+    ASSERT_TRUE(test.TestRequestReset());
+}
+
+TEST(BareMetal_L5GAMs_ExecutableStatisticsGTest,TestGetSnapshot) {
+    ExecutableStatisticsTest test;
+    ASSERT_TRUE(test.TestGetSnapshot());
+}
+
+TEST(BareMetal_L5GAMs_ExecutableStatisticsGTest,TestGetPercentile) {
+    ExecutableStatisticsTest test;
+    ASSERT_TRUE(test.TestGetPercentile());
+}
+
+TEST(BareMetal_L5GAMs_ExecutableStatisticsGTest,TestGetBucketIndex) {
+    ExecutableStatisticsTest test;
+    ASSERT_TRUE(test.TestGetBucketIndex());
+}
+
+TEST(BareMetal_L5GAMs_ExecutableStatisticsGTest,TestGetBucketUpperLimit) {
+    ExecutableStatisticsTest test;
+    ASSERT_TRUE(test.TestGetBucketUpperLimit());
+}
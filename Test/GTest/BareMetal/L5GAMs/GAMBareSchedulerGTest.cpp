@@ -66,3 +66,7 @@ TEST(BareMetal_L5GAMs_GAMBareScheduler, TestStopCurrentStateExecution) {
     ASSERT_TRUE(test.TestStopCurrentStateExecution());
 }
 
+TEST(BareMetal_L5GAMs_GAMBareScheduler, TestStartCurrentStateExecution_RawTicks) {
+    GAMBareSchedulerTest test;
+    ASSERT_TRUE(test.TestStartCurrentStateExecution_RawTicks());
+}
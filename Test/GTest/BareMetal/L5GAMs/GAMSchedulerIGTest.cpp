@@ -75,3 +75,33 @@ TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExecuteSingleCycle_False) {
     GAMSchedulerITest test;
     ASSERT_TRUE(test.TestExecuteSingleCycle_False());
 }
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestGetExecutableStatistics) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestGetExecutableStatistics());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestGetExecutableStatistics_Disabled) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestGetExecutableStatistics_Disabled());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExportData_Statistics) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestExportData_Statistics());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExecuteSingleCycle_RawTicks) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestExecuteSingleCycle_RawTicks());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestConfigureScheduler_RawTicks_Twice) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestConfigureScheduler_RawTicks_Twice());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestInitialise_False_TimingResolution) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestInitialise_False_TimingResolution());
+}
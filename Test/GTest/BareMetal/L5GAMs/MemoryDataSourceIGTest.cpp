@@ -73,3 +73,13 @@ TEST(BareMetal_L5GAMs_MemoryDataSourceIGTest,TestGetSignalMemoryBuffer) {
     ASSERT_TRUE(test.TestGetSignalMemoryBuffer());
 }
 
+TEST(BareMetal_L5GAMs_MemoryDataSourceIGTest,TestGetSignalMemoryBuffer_MirroredBuffers) {
+    MemoryDataSourceITest test;
+    ASSERT_TRUE(test.TestGetSignalMemoryBuffer_MirroredBuffers());
+}
+
+TEST(BareMetal_L5GAMs_MemoryDataSourceIGTest,TestIsSignalMemoryMirrored) {
+    MemoryDataSourceITest test;
+    ASSERT_TRUE(test.TestIsSignalMemoryMirrored());
+}
+
@@ -64,3 +64,8 @@ TEST(BareMetal_L5GAMs_MemoryMapInputBrokerGTest,TestExecute_MultiStateBuffer) {
     MemoryMapInputBrokerTest test;
     ASSERT_TRUE(test.TestExecute_MultiStateBuffer());
 }
+
+TEST(BareMetal_L5GAMs_MemoryMapInputBrokerGTest,TestExecute_CopyPlan) {
+    MemoryMapInputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_CopyPlan());
+}
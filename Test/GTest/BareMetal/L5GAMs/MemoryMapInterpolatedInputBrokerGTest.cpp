@@ -60,6 +60,11 @@ TEST(BareMetal_L5GAMs_MemoryMapInterpolatedInputBrokerGTest,TestExecute_3) {
     ASSERT_TRUE(test.TestExecute_3());
 }
 
+TEST(BareMetal_L5GAMs_MemoryMapInterpolatedInputBrokerGTest,TestExecute_4) {
+    MemoryMapInterpolatedInputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_4());
+}
+
 TEST(BareMetal_L5GAMs_MemoryMapInterpolatedInputBrokerGTest,TestExecute_False) {
     MemoryMapInterpolatedInputBrokerTest test;
     ASSERT_TRUE(test.TestExecute_False());
@@ -115,3 +115,18 @@ TEST(BareMetal_L5GAMs_MemoryMapMultiBufferBrokerGTest,TestCopyOutputs_MoreBuffer
     MemoryMapMultiBufferBrokerTest test;
     ASSERT_TRUE(test.TestCopyOutputs_MoreBuffersThanSamples());
 }
+
+TEST(BareMetal_L5GAMs_MemoryMapMultiBufferBrokerGTest,TestCopyInputs_OffsetCaching) {
+    MemoryMapMultiBufferBrokerTest test;
+    ASSERT_TRUE(test.TestCopyInputs_OffsetCaching());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapMultiBufferBrokerGTest,TestCopyInputs_MirroredBuffers) {
+    MemoryMapMultiBufferBrokerTest test;
+    ASSERT_TRUE(test.TestCopyInputs_MirroredBuffers());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapMultiBufferBrokerGTest,TestCopyOutputs_MirroredBuffers) {
+    MemoryMapMultiBufferBrokerTest test;
+    ASSERT_TRUE(test.TestCopyOutputs_MirroredBuffers());
+}
@@ -616,6 +616,11 @@ TEST(BareMetal_L5GAMs_RealTimeApplicationConfigurationBuilderGTest,TestConfigure
     ASSERT_TRUE(test.TestConfigureBeforeInitialisation());
 }
 
+TEST(BareMetal_L5GAMs_RealTimeApplicationConfigurationBuilderGTest,TestConfigureBeforeInitialisation_FromImmutableConfig) {
+    RealTimeApplicationConfigurationBuilderTest test;
+    ASSERT_TRUE(test.TestConfigureBeforeInitialisation(true));
+}
+
 TEST(BareMetal_L5GAMs_RealTimeApplicationConfigurationBuilderGTest,TestConfigureBeforeInitialisation_VerifyDataSourcesSignals_False) {
     RealTimeApplicationConfigurationBuilderTest test;
     ASSERT_TRUE(test.TestConfigureBeforeInitialisation_VerifyDataSourcesSignals_False());
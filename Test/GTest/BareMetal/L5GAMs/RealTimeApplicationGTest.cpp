@@ -174,3 +174,8 @@ TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestCheckMultipleProducersWrites)
     ASSERT_TRUE(test.TestCheckMultipleProducersWrites());
 }
 
+TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestConfigureApplication_ZeroCopySignals) {
+    RealTimeApplicationTest test;
+    ASSERT_TRUE(test.TestConfigureApplication_ZeroCopySignals());
+}
+
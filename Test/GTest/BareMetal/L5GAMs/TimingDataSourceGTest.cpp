@@ -58,3 +58,23 @@ TEST(BareMetal_L5GAMs_TimingDataSourceGTest,TestCurrentStateValue) {
     TimingDataSourceTest test;
     ASSERT_TRUE(test.TestCurrentStateValue());
 }
+
+TEST(BareMetal_L5GAMs_TimingDataSourceGTest,TestGetInputBrokers) {
+    TimingDataSourceTest test;
+    ASSERT_TRUE(test.TestGetInputBrokers());
+}
+
+TEST(BareMetal_L5GAMs_TimingDataSourceGTest,TestGetInputBrokers_RawTicks) {
+    TimingDataSourceTest test;
+    ASSERT_TRUE(test.TestGetInputBrokers_RawTicks());
+}
+
+TEST(BareMetal_L5GAMs_TimingDataSourceGTest,TestSynchronise) {
+    TimingDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(BareMetal_L5GAMs_TimingDataSourceGTest,TestAddRawTicksTable_False_NoCurrentState) {
+    TimingDataSourceTest test;
+    ASSERT_TRUE(test.TestAddRawTicksTable_False_NoCurrentState());
+}
@@ -221,3 +221,18 @@ TEST(FileSystem_L1Portability_BasicTCPSocketGTest,TestIsConnected) {
 
 
 
+
+TEST(FileSystem_L1Portability_BasicTCPSocketGTest,TestSendFile) {
+    BasicTCPSocketTest basicTCPSocketTest;
+    ASSERT_TRUE(basicTCPSocketTest.TestSendFile());
+}
+
+TEST(FileSystem_L1Portability_BasicTCPSocketGTest,TestSendFile_False_FileTooSmall) {
+    BasicTCPSocketTest basicTCPSocketTest;
+    ASSERT_TRUE(basicTCPSocketTest.TestSendFile_False_FileTooSmall());
+}
+
+TEST(FileSystem_L1Portability_BasicTCPSocketGTest,TestSendFile_False_InvalidSocket) {
+    BasicTCPSocketTest basicTCPSocketTest;
+    ASSERT_TRUE(basicTCPSocketTest.TestSendFile_False_InvalidSocket());
+}
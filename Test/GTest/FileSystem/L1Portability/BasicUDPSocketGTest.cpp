@@ -301,3 +301,43 @@ TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestWrite) {
     ASSERT_TRUE(basicUDPSocketTest.TestWrite(table));
 }
 
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestWriteBatch_ReadBatch) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestWriteBatch_ReadBatch(10u));
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestWriteBatch_ReadBatch_ManyChunks) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestWriteBatch_ReadBatch(150u));
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestReadBatch_Timeout) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestReadBatch_Timeout());
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestReadBatch_Truncate) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestReadBatch_Truncate());
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestReadBatch_Sources) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestReadBatch_Sources());
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestReadBatch_WriteBatch_InvalidSocket) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestReadBatch_WriteBatch_InvalidSocket());
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestSetReceiveBufferSize) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestSetReceiveBufferSize());
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestSetBusyPoll) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestSetBusyPoll());
+}
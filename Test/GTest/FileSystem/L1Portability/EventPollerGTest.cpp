@@ -0,0 +1,122 @@
+/**
+ * @file EventPollerGTest.cpp
+ * @brief Source file for class EventPollerGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EventPollerGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MARTe2UTest.h"
+#include "EventPollerTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestConstructor) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestConstructor());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestIsSupported) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestIsSupported());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestOpen) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestOpen());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestOpen_False_AlreadyOpen) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestOpen_False_AlreadyOpen());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestClose) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestClose());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestClose_False_NotOpen) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestClose_False_NotOpen());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestAdd) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestAdd());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestAdd_False_AlreadyAdded) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestAdd_False_AlreadyAdded());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestAdd_False_NotOpen) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestAdd_False_NotOpen());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestWait) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestWait());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestWait_Timeout) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestWait_Timeout());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestWait_OneShot) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestWait_OneShot());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestRearm) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestRearm());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestRearm_False_NotAdded) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestRearm_False_NotAdded());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestRemove) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestRemove());
+}
+
+TEST(FileSystem_L1Portability_EventPollerGTest, TestRemove_False_NotAdded) {
+    EventPollerTest myTest;
+    ASSERT_TRUE(myTest.TestRemove_False_NotAdded());
+}
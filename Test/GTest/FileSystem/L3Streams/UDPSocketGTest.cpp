@@ -115,3 +115,8 @@ TEST(FileSystem_L3Streams_UDPSocketGTest, TestCanRead) {
     UDPSocketTest test;
     ASSERT_TRUE(test.TestCanRead());
 }
+
+TEST(FileSystem_L3Streams_UDPSocketGTest, TestWriteBatch_ReadBatch) {
+    UDPSocketTest test;
+    ASSERT_TRUE(test.TestWriteBatch_ReadBatch());
+}
@@ -82,3 +82,23 @@ TEST(FileSystem_L4HttpService_HttpDirectoryResource, TestSetReplyNotFound) {
     HttpDirectoryResourceTest test;
     ASSERT_TRUE(test.TestSetReplyNotFound());
 }
+
+TEST(FileSystem_L4HttpService_HttpDirectoryResource, TestGetAsText_ETag) {
+    HttpDirectoryResourceTest test;
+    ASSERT_TRUE(test.TestGetAsText_ETag());
+}
+
+TEST(FileSystem_L4HttpService_HttpDirectoryResource, TestGetAsText_ContentType) {
+    HttpDirectoryResourceTest test;
+    ASSERT_TRUE(test.TestGetAsText_ContentType());
+}
+
+TEST(FileSystem_L4HttpService_HttpDirectoryResource, TestGetAsText_Cache) {
+    HttpDirectoryResourceTest test;
+    ASSERT_TRUE(test.TestGetAsText_Cache());
+}
+
+TEST(FileSystem_L4HttpService_HttpDirectoryResource, TestGetAsText_LargeFile) {
+    HttpDirectoryResourceTest test;
+    ASSERT_TRUE(test.TestGetAsText_LargeFile());
+}
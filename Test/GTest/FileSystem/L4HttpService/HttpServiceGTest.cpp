@@ -149,3 +149,43 @@ TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_NoMoreThreads)
     HttpServiceTest test;
     ASSERT_TRUE(test.TestClientService_NoMoreThreads());
 }
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestInitialise_EventLoop) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestInitialise_EventLoop());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestInitialise_EventLoop_Defaults) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestInitialise_EventLoop_Defaults());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestInitialise_False_EventLoop_NoWorkers) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_EventLoop_NoWorkers());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestInitialise_False_EventLoop_NoConnections) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_EventLoop_NoConnections());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_EventLoop) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestClientService_EventLoop());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_EventLoop_Pipelined) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestClientService_EventLoop_Pipelined());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_EventLoop_TooManyConnections) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestClientService_EventLoop_TooManyConnections());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestStop_EventLoop_Restart) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestStop_EventLoop_Restart());
+}
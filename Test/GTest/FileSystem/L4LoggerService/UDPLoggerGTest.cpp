@@ -67,4 +67,9 @@ TEST(FileSystem_L4LoggerService_UDPLoggerGTest, TestConsumeLogMessage) {
     UDPLoggerTest test;
     ASSERT_TRUE(test.TestConsumeLogMessage());
 }
+
+TEST(FileSystem_L4LoggerService_UDPLoggerGTest, TestConsumeLogMessages) {
+    UDPLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessages());
+}
 	
@@ -54,3 +54,8 @@ TEST(Scheduler_L4LoggerService_ConsoleLoggerGTest,TestConsumeLogMessage) {
     ASSERT_TRUE(target.TestConsumeLogMessage());
 }
 
+TEST(Scheduler_L4LoggerService_ConsoleLoggerGTest,TestConsumeLogMessages) {
+    ConsoleLoggerTest target;
+    ASSERT_TRUE(target.TestConsumeLogMessages());
+}
+
@@ -67,4 +67,9 @@ TEST(Scheduler_L4LoggerService_LoggerConsumerIGTest,TestPrintToStream_WithKeys)
     LoggerConsumerITest target;
     ASSERT_TRUE(target.TestPrintToStream_WithKeys());
 }
+
+TEST(Scheduler_L4LoggerService_LoggerConsumerIGTest,TestConsumeLogMessages) {
+    LoggerConsumerITest target;
+    ASSERT_TRUE(target.TestConsumeLogMessages());
+}
 	
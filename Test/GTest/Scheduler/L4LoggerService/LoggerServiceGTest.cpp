@@ -55,6 +55,11 @@ TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestInitialise_Defaults) {
     ASSERT_TRUE(target.TestInitialise_Defaults());
 }
 
+TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestInitialise_DeferredFormatting) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestInitialise_DeferredFormatting());
+}
+
 TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestInitialise_False_NoCPUs) {
     LoggerServiceTest target;
     ASSERT_TRUE(target.TestInitialise_False_NoCPUs());
@@ -95,7 +100,27 @@ TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestGetStackSize) {
     ASSERT_TRUE(target.TestGetStackSize());
 }
 
+TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestIsDeferredFormatting) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestIsDeferredFormatting());
+}
+
 TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestExecute) {
     LoggerServiceTest target;
     ASSERT_TRUE(target.TestExecute());
 }
+
+TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestExecute_WakeOnLog) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestExecute_WakeOnLog());
+}
+
+TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestInitialise_WakeOnLog) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestInitialise_WakeOnLog());
+}
+
+TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestIsWakeOnLog) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestIsWakeOnLog());
+}
@@ -105,6 +105,16 @@ TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestSynchronise_S
     ASSERT_TRUE(test.TestSynchronise_SleepTime());
 }
 
+TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestSynchronise_LockFree) {
+    CircularBufferThreadInputDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_LockFree());
+}
+
+TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestSynchronise_EventWakeUp) {
+    CircularBufferThreadInputDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_EventWakeUp());
+}
+
 TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestGetBrokerName) {
     CircularBufferThreadInputDataSourceTest test;
     ASSERT_TRUE(test.TestGetBrokerName());
@@ -63,6 +63,21 @@ TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestIntegrated) {
     ASSERT_TRUE(test.TestIntegrated());
 }
 
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestIntegrated_PersistentThreads) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestIntegrated_PersistentThreads());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestStartNextStateExecution_PersistentThreads) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestStartNextStateExecution_PersistentThreads());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestConfigureScheduler_PersistentThreads_StatesChanged) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestConfigureScheduler_PersistentThreads_StatesChanged());
+}
+
 TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestIntegrated_TriggerErrorMessage) {
     GAMSchedulerTest test;
     ASSERT_TRUE(test.TestIntegrated_TriggerErrorMessage());
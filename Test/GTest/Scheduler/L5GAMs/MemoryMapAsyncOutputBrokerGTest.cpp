@@ -93,6 +93,11 @@ TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestGetNumberOfBuffers) {
     ASSERT_TRUE(test.TestGetNumberOfBuffers());
 }
 
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestInitWithBufferParameters_BufferMemoryOptions) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestInitWithBufferParameters_BufferMemoryOptions());
+}
+
 TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestGetStackSize) {
     MemoryMapAsyncOutputBrokerTest test;
     ASSERT_TRUE(test.TestGetStackSize());
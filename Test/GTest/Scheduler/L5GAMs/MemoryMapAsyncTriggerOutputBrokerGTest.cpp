@@ -168,6 +168,11 @@ TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestGetNumberOfBuff
     ASSERT_TRUE(test.TestGetNumberOfBuffers());
 }
 
+TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestInitWithTriggerParameters_BufferMemoryOptions) {
+    MemoryMapAsyncTriggerOutputBrokerTest test;
+    ASSERT_TRUE(test.TestInitWithTriggerParameters_BufferMemoryOptions());
+}
+
 TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestGetPreTriggerBuffers) {
     MemoryMapAsyncTriggerOutputBrokerTest test;
     ASSERT_TRUE(test.TestGetPreTriggerBuffers());
@@ -193,6 +198,26 @@ TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestFlushAllTrigger
     ASSERT_TRUE(test.TestFlushAllTriggers());
 }
 
+TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestExecute_SignalBufferHandover) {
+    MemoryMapAsyncTriggerOutputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_SignalBufferHandover());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestIsSignalBufferHandoverEnabled) {
+    MemoryMapAsyncTriggerOutputBrokerTest test;
+    ASSERT_TRUE(test.TestIsSignalBufferHandoverEnabled());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestIsSignalBufferHandoverEnabled_False_NotSupported) {
+    MemoryMapAsyncTriggerOutputBrokerTest test;
+    ASSERT_TRUE(test.TestIsSignalBufferHandoverEnabled_False_NotSupported());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestIsSignalBufferHandoverEnabled_False_Ranges) {
+    MemoryMapAsyncTriggerOutputBrokerTest test;
+    ASSERT_TRUE(test.TestIsSignalBufferHandoverEnabled_False_Ranges());
+}
+
 TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestExecute_N_PreTriggerBuffers_N_PostTriggerBuffers_PreTriggerIncludesBeforeZero) {
     MemoryMapAsyncTriggerOutputBrokerTest test;
     ASSERT_TRUE(test.TestExecute_N_PreTriggerBuffers_N_PostTriggerBuffers_PreTriggerIncludesBeforeZero());